@@ -1991,1783 +1991,1787 @@ static const unsigned char temp_binary_data_100[] =
 101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,208,177,208,181,209,128,208,184,209,130,208,181,32,209,132,208,176,208,185,208,187,32,208,180,208,187,209,143,32,208,184,208,188,208,
 191,208,190,209,128,209,130,208,176,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,208,181,208,189,208,
 180,208,181,209,128,208,184,208,189,208,179,32,208,178,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,
-209,130,208,176,209,128,209,130,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,158,209,129,209,130,208,176,208,189,
-208,190,208,178,208,184,209,130,209,140,32,209,128,208,181,208,189,208,180,208,181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,208,177,208,181,209,128,208,184,209,130,208,181,32,209,132,208,176,208,185,208,187,32,208,180,208,187,209,143,32,209,128,208,181,208,189,208,180,208,181,209,128,208,176,34,125,44,123,34,110,97,109,
-101,34,58,34,99,111,110,115,111,108,101,58,58,112,114,111,106,101,99,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,209,128,208,190,208,181,208,186,209,130,209,139,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,
-108,101,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,162,209,128,208,181,208,186,208,184,32,208,184,32,208,188,208,181,209,130,208,186,208,184,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,
-115,111,108,101,58,58,99,104,111,114,100,98,117,105,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,177,208,190,209,128,208,186,208,176,32,208,176,208,186,208,186,208,190,209,128,208,180,208,190,208,178,34,125,
-44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,109,111,118,101,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,208,181,209,128,208,181,208,188,208,181,209,129,209,130,208,184,209,130,209,140,
-32,208,189,208,190,209,130,209,139,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,115,117,103,103,101,115,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,209,128,208,181,208,180,208,187,208,190,208,
-182,208,181,208,189,208,184,208,181,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,99,111,109,112,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,177,208,176,208,178,208,184,209,130,209,140,
-32,208,176,208,186,208,186,208,190,209,128,208,180,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,162,208,190,208,
-189,208,176,208,187,209,140,208,189,208,190,209,129,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,208,162,208,190,208,189,208,184,208,186,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,
-157,208,184,209,129,209,133,208,190,208,180,209,143,209,137,208,184,208,185,32,208,178,208,178,208,190,208,180,208,189,209,139,208,185,32,209,130,208,190,208,189,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,
-58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,156,208,181,208,180,208,184,208,176,208,189,209,130,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,
-58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,209,131,208,177,208,180,208,190,208,188,208,184,208,189,208,176,208,189,209,130,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,
-112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,188,208,184,208,189,208,176,208,189,209,130,208,176,34,125,44,123,34,110,97,109,101,34,
-58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,209,131,208,177,208,188,208,181,208,180,208,184,208,176,208,189,209,130,208,176,34,125,
-44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,208,190,209,129,209,133,208,190,208,180,209,143,209,137,208,
-184,208,185,32,208,178,208,178,208,190,208,180,208,189,209,139,208,185,32,209,130,208,190,208,189,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,208,144,209,131,208,180,208,184,208,190,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,163,209,129,209,
-130,209,128,208,190,208,185,209,129,209,130,208,178,208,190,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,
-148,209,128,208,176,208,185,208,178,208,181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,208,167,208,176,209,129,209,130,208,190,209,130,208,176,32,208,180,208,184,209,129,208,186,209,128,208,181,209,130,208,184,208,183,208,176,209,134,208,184,208,184,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,
-100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,208,176,208,183,208,188,208,181,209,128,32,208,177,209,131,209,132,208,181,209,128,208,176,34,125,44,123,34,110,97,109,101,34,
-58,34,115,101,116,116,105,110,103,115,58,58,109,105,100,105,58,58,114,101,99,111,114,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,151,208,176,208,191,208,184,209,129,209,140,32,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,
-34,115,101,116,116,105,110,103,115,58,58,109,105,100,105,58,58,110,111,100,101,118,105,99,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,32,208,178,208,184,208,182,209,131,32,77,73,68,73,32,209,131,209,129,209,130,
-209,128,208,190,208,185,209,129,209,130,208,178,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,162,209,128,208,181,208,177,209,
-131,208,181,209,130,209,129,209,143,32,208,191,208,181,209,128,208,181,208,183,208,176,208,191,209,131,209,129,208,186,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,115,121,110,99,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,208,161,208,184,208,189,209,133,209,128,208,190,208,189,208,184,208,183,208,184,209,128,208,190,208,178,208,176,209,130,209,140,32,208,189,208,176,209,129,209,130,209,128,208,190,208,185,208,186,208,184,34,125,44,123,34,110,97,109,
-101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,166,208,178,208,181,209,130,208,190,208,178,208,176,209,143,32,209,129,209,133,208,181,208,188,208,176,34,125,44,123,34,110,97,
-109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,102,111,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,168,209,128,208,184,209,132,209,130,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,
-103,115,58,58,117,105,58,58,110,97,116,105,118,101,98,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,209,129,208,191,208,190,208,187,209,140,208,183,208,190,208,178,208,176,209,130,209,140,32,209,129,208,184,209,129,209,130,
-208,181,208,188,208,189,209,139,208,185,32,208,183,208,176,208,179,208,190,208,187,208,190,208,178,208,190,208,186,32,208,190,208,186,208,189,208,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,
-103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,32,208,188,208,190,208,182,208,181,209,130,208,181,32,208,191,208,190,208,188,208,190,209,135,209,140,32,209,129,32,208,191,208,181,209,128,208,
-181,208,178,208,190,208,180,208,190,208,188,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,208,181,208,189,208,180,208,
-181,209,128,208,181,209,128,32,208,184,208,189,209,130,208,181,209,128,209,132,208,181,208,185,209,129,208,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,
-116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,208,190,32,209,131,208,188,208,190,208,187,209,135,208,176,208,189,208,184,209,142,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,
-101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,
-114,101,103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,114,101,71,114,97,112,104,105,99,115,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,
-58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,105,114,101,99,116,50,68,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,
-105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,176,209,130,208,184,208,178,208,189,209,139,208,185,32,209,128,208,181,208,189,208,180,208,181,209,128,208,181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,45,209,128,208,181,208,189,208,180,208,181,209,128,208,181,209,128,32,208,189,208,176,208,188,
-208,189,208,190,208,179,208,190,32,208,177,209,139,209,129,209,130,209,128,208,181,208,181,32,208,189,208,176,209,130,208,184,208,178,208,189,208,190,208,179,208,190,44,32,208,189,208,190,44,32,208,178,32,208,183,208,176,208,178,208,184,209,129,208,184,
-208,188,208,190,209,129,209,130,208,184,32,208,190,209,130,32,208,178,208,176,209,136,208,181,208,185,32,209,129,208,184,209,129,209,130,208,181,208,188,209,139,44,32,208,188,208,190,208,182,208,181,209,130,32,208,191,209,128,208,184,208,178,208,181,
-209,129,209,130,208,184,32,208,186,32,208,189,208,181,209,129,209,130,208,176,208,177,208,184,208,187,209,140,208,189,208,190,208,185,32,209,128,208,176,208,177,208,190,209,130,208,181,32,208,191,209,128,208,184,208,187,208,190,208,182,208,181,208,189,
-208,184,209,143,46,32,208,146,208,186,208,187,209,142,209,135,208,184,209,130,209,140,32,79,112,101,110,71,76,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,208,186,208,187,209,142,209,135,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,158,208,191,208,184,209,136,208,184,209,130,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
-111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,190,209,133,209,128,208,176,208,189,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,
-34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,177,209,128,208,190,209,129,208,184,209,130,209,140,32,208,178,209,139,
-208,177,209,128,208,176,208,189,208,189,209,139,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,
-114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,177,209,128,208,190,209,129,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,
-111,117,116,58,58,119,97,114,110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,32,208,191,209,128,208,190,208,181,208,186,209,130,208,181,32,208,181,209,129,209,130,209,140,32,208,189,208,181,209,129,208,190,209,133,
-209,128,208,176,208,189,208,181,208,189,208,189,209,139,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,33,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,
-117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,208,181,209,128,208,181,208,186,208,187,209,142,209,135,208,184,209,130,209,140,209,129,209,143,32,208,189,208,176,32,209,141,209,130,209,131,
-32,208,178,208,181,209,128,209,129,208,184,209,142,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,209,129,208,186,208,
-176,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,163,208,180,208,176,208,187,208,184,209,130,209,140,
-34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,177,208,176,208,178,208,184,209,130,209,140,34,125,44,123,34,110,
-97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,45,34,125,44,
-123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,163,208,180,208,176,208,187,208,181,208,189,208,190,32,45,34,125,
-44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,
-45,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,208,177,208,181,209,128,208,184,209,
-130,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,44,32,208,186,208,190,209,130,208,190,209,128,209,139,208,181,32,209,133,208,190,209,130,208,184,209,130,208,181,32,209,129,208,190,209,133,209,128,208,176,208,189,
-208,184,209,130,209,140,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,208,177,208,181,
-209,128,208,184,209,130,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,44,32,208,186,208,190,209,130,208,190,209,128,209,139,208,181,32,209,133,208,190,209,130,208,184,209,130,208,181,32,208,190,209,130,208,188,208,
-181,208,189,208,184,209,130,209,140,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,
-32,209,131,208,180,208,176,208,187,208,190,209,129,209,140,32,208,178,208,181,209,128,208,189,209,131,209,130,209,140,209,129,209,143,32,208,189,208,176,32,208,186,208,190,208,189,209,130,209,128,208,190,208,187,209,140,208,189,209,131,209,142,32,209,
-130,208,190,209,135,208,186,209,131,32,45,32,209,141,209,130,208,190,32,209,129,208,190,209,130,209,128,208,181,209,130,32,209,130,208,181,208,186,209,131,209,137,208,184,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,
-143,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,32,
-208,178,32,208,191,209,128,208,190,208,181,208,186,209,130,208,181,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,
-208,181,209,128,208,181,208,178,208,190,32,208,184,209,129,209,130,208,190,209,128,208,184,208,184,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,208,155,208,190,208,186,208,176,208,187,209,140,208,189,208,176,209,143,32,208,184,209,129,209,130,208,190,209,128,208,184,209,143,32,208,178,32,208,176,208,186,209,130,209,131,208,176,208,187,209,140,208,189,208,190,208,188,32,209,129,
-208,190,209,129,209,130,208,190,209,143,208,189,208,184,208,184,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,147,208,190,209,130,208,
-190,208,178,208,190,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,128,208,181,208,188,208,181,208,189,208,
-189,208,176,209,143,32,209,136,208,186,208,176,208,187,208,176,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-208,152,208,189,209,132,208,190,209,128,208,188,208,176,209,134,208,184,209,143,32,208,190,32,208,191,209,128,208,190,208,181,208,186,209,130,208,181,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,178,208,181,209,128,209,129,208,184,209,143,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,
-184,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,115,117,112,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,208,190,208,180,208,180,208,181,209,128,208,182,208,176,209,130,209,140,32,208,191,
-209,128,208,190,208,181,208,186,209,130,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,110,101,116,119,111,114,107,101,114,114,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,181,209,130,208,181,
-208,178,208,176,209,143,32,208,190,209,136,208,184,208,177,208,186,208,176,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,
-135,208,181,209,128,208,176,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,158,208,177,208,189,208,190,208,178,208,184,209,130,209,140,34,
-125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,34,125,44,123,34,110,97,109,101,34,58,
-34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,176,32,208,187,208,184,209,134,208,181,208,189,208,183,208,184,209,143,
-34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,208,189,208,176,208,183,208,178,208,
-176,208,189,208,184,208,181,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,
-32,208,176,208,178,209,130,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,
-189,209,143,208,187,208,190,209,129,209,140,32,208,190,208,191,208,184,209,129,208,176,208,189,208,184,208,181,34,125,44,123,34,110,97,109,101,34,58,34,116,101,109,112,101,114,97,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,208,176,209,129,209,140,32,209,130,208,181,208,188,208,191,208,181,209,128,208,176,209,134,208,184,209,143,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,
-114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,32,209,134,208,178,208,181,209,130,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,
-116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,209,131,209,129,209,130,208,190,208,185,32,209,129,208,187,208,190,208,185,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,
-97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,209,131,209,129,209,130,208,190,208,185,32,208,191,208,176,209,130,209,130,208,181,209,128,208,189,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,
-117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,32,208,184,208,189,209,129,209,130,209,128,209,131,208,188,208,181,208,
-189,209,130,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,
-32,208,186,208,190,208,189,209,130,209,128,208,190,208,187,208,187,208,181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,208,190,208,189,208,184,208,185,209,
-129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,173,208,190,208,187,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,
-109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,155,208,184,208,180,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,156,208,184,208,186,209,129,208,190,208,187,208,184,208,180,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,209,128,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,
-164,209,128,208,184,208,179,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,155,208,190,208,186,209,128,208,184,208,185,
-209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,156,208,181,208,187,208,190,208,180,208,184,209,135,208,181,209,129,
-208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,156,208,181,208,187,208,190,208,
-180,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,208,147,208,176,209,128,208,188,208,190,208,189,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,147,208,176,209,128,208,188,208,190,208,189,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,
-103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,208,181,208,189,208,179,208,181,209,128,209,129,208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,
-109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,208,181,208,189,208,179,208,181,209,128,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,
-128,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,208,176,208,191,208,190,208,187,208,184,209,130,208,176,208,189,209,129,
-208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,208,176,
-208,191,208,190,208,187,208,184,209,130,208,176,208,189,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,208,160,209,131,208,188,209,139,208,189,209,129,208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,209,131,208,188,209,139,208,189,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,208,173,208,189,208,184,208,179,208,188,208,176,209,130,208,184,209,135,208,181,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,173,208,189,208,184,208,179,208,188,208,176,209,130,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,
-58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,145,208,187,209,142,208,183,208,190,208,178,209,139,208,185,32,209,132,209,128,208,184,208,179,208,184,208,185,209,129,208,186,208,
-184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,144,209,131,208,180,208,184,208,190,208,178,209,133,208,190,208,180,34,125,44,123,34,110,97,
-109,101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,144,209,131,208,180,208,184,208,190,208,178,209,139,209,133,208,190,208,180,34,125,44,123,34,110,97,109,101,34,58,34,77,105,
-100,105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,45,208,178,209,133,208,190,208,180,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,77,73,68,73,45,208,178,209,139,209,133,208,190,208,180,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,
-115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,133,208,190,208,180,208,189,208,190,208,185,32,208,186,208,176,208,189,208,176,208,187,34,44,34,112,108,117,114,97,108,70,111,114,
-109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,208,176,208,187,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,
-34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,208,176,208,187,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,
-101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,139,209,133,208,190,208,180,208,189,208,190,208,
-185,32,208,186,208,176,208,189,208,176,208,187,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,139,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,
-208,176,208,187,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,139,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,208,176,208,187,208,
-190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,
-109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,176,32,123,120,125,32,208,189,208,190,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,
-190,208,177,208,176,208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,
-208,187,208,181,208,189,208,190,32,123,120,125,32,208,189,208,190,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,176,32,123,120,125,32,208,189,208,190,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
-49,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,
-209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,208,189,208,190,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,
-111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,176,32,123,120,125,32,208,189,208,190,209,130,208,176,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,
-123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,189,208,190,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,
-100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,
-208,177,209,139,209,130,208,184,208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,209,129,208,190,208,
-177,209,139,209,130,208,184,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,
-209,139,209,130,208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,
-34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,
-58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,
-97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,
-208,177,209,139,209,130,208,184,208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,209,129,208,190,208,177,209,
-139,209,130,208,184,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,
-208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,
-97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,32,123,120,125,32,208,186,208,187,208,184,208,191,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,
-208,177,208,176,208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,208,184,208,191,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,
-178,208,187,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,
-32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,32,123,120,125,32,208,186,208,187,208,184,208,191,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,208,184,208,191,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,
-110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,
-34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,32,123,120,125,32,208,186,208,187,208,
-184,208,191,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,208,184,208,191,208,176,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,
-190,208,177,208,176,208,178,208,187,208,181,208,189,208,176,32,123,120,125,32,208,188,208,181,209,130,208,186,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,
-208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,208,188,208,181,209,130,208,186,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,
-181,208,189,208,190,32,123,120,125,32,208,188,208,181,209,130,208,190,208,186,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,
-97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,176,32,123,120,125,32,208,188,208,181,209,130,208,186,208,176,34,44,34,112,108,117,114,
-97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,188,208,181,209,130,208,186,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,
-125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,208,188,208,181,209,130,208,190,208,186,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,
-34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,176,
-32,123,120,125,32,208,188,208,181,209,130,208,186,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,188,208,
-181,209,130,208,186,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,188,208,181,209,130,208,190,208,186,
-34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
-97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,
-101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,
-110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,
-208,181,208,189,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,
-32,209,128,208,176,208,183,208,188,208,181,209,128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,209,128,208,176,208,
-183,208,188,208,181,209,128,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
-34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,
-34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,208,
-177,208,176,208,178,208,187,208,181,208,189,32,123,120,125,32,208,186,208,187,209,142,209,135,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,
-208,189,209,139,32,123,120,125,32,208,186,208,187,209,142,209,135,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,
-120,125,32,208,186,208,187,209,142,209,135,208,181,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,
-117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,32,123,120,125,32,208,186,208,187,209,142,209,135,34,44,34,112,108,117,114,97,108,70,111,114,109,
-34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,209,142,209,135,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,
-109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,209,142,209,135,208,181,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,
-97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,32,123,120,125,
-32,208,186,208,187,209,142,209,135,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,209,142,209,135,208,
-176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,209,142,209,135,208,181,208,185,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,189,208,190,209,
-130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,
-34,58,34,123,120,125,32,208,189,208,190,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,190,208,177,209,139,
-209,130,208,184,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
-51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,181,209,130,208,186,208,
-176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,181,209,130,208,186,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,
-34,58,34,123,120,125,32,208,188,208,181,209,130,208,190,208,186,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,
-120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,190,208,178,34,44,
-34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,
-34,58,34,123,120,125,32,208,186,208,187,209,142,209,135,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,209,142,209,135,208,176,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,209,142,209,135,208,181,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,
-105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,208,184,208,191,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,
-123,120,125,32,208,186,208,187,208,184,208,191,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,191,208,176,209,130,
-209,130,208,181,209,128,208,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,191,208,176,209,130,209,130,208,181,209,128,208,189,208,176,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,191,208,176,209,130,209,130,208,181,209,128,208,189,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,
-34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,187,208,190,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,
-34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,187,208,190,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,187,208,190,209,145,208,178,34,44,34,112,108,117,
-114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,
-208,181,208,178,208,184,208,183,208,184,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,181,208,178,208,184,208,183,208,184,208,184,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,181,208,178,208,184,208,183,208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,
-120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,180,208,181,208,187,209,140,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
-125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,180,208,181,208,187,209,140,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,180,208,181,208,187,209,140,209,
-130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,
-125,32,208,188,208,184,208,189,209,131,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,184,208,189,209,131,209,130,209,139,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,184,208,189,209,131,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,
-99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,181,208,186,209,131,208,189,208,180,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,
-123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,181,208,186,209,131,208,189,208,180,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,181,208,186,209,131,208,
-189,208,180,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,
-34,58,34,208,191,208,181,209,128,208,181,208,184,208,188,208,181,208,189,208,190,208,178,208,176,208,189,32,208,184,208,183,32,123,120,125,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,100,34,58,34,101,
-110,34,44,34,110,97,109,101,34,58,34,69,110,103,108,105,115,104,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,34,40,123,120,125,61,61,49,32,63,32,49,32,58,32,50,41,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,
-34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,115,116,97,114,116,101,100,
-34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,119,32,112,114,111,106,101,99,116,34,125,44,123,
-34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,119,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,100,
-101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-79,114,99,104,101,115,116,114,97,32,112,105,116,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,116,105,110,103,115,34,125,44,123,34,
-110,97,109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,115,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,97,116,116,101,114,110,115,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,107,101,121,77,97,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,101,121,98,111,97,114,
-100,32,109,97,112,112,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,82,101,110,97,109,101,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,82,101,110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,
-101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,97,110,110,111,116,97,116,105,111,110,34,125,44,123,34,
-110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,101,114,32,97,110,110,111,116,97,116,105,
-111,110,32,116,101,120,116,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-69,100,105,116,32,97,110,110,111,116,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,67,104,97,110,103,101,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-65,100,100,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,
-58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,101,114,32,110,101,119,32,109,101,116,101,114,58,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,
-103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
-58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,
-110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,
-105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,
-34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,107,101,121,32,97,110,100,32,115,99,97,108,
-101,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,32,116,114,97,99,107,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,34,125,44,123,34,110,97,
-109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,
-108,111,103,58,58,97,100,100,97,114,112,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,97,114,112,101,103,103,105,97,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,
-108,111,103,58,58,97,100,100,97,114,112,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,
-114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,32,116,104,101,32,112,114,111,106,101,99,116,32,112,101,114,109,97,110,101,110,116,108,121,32,102,114,111,109,32,
-116,104,101,32,99,108,111,117,100,32,97,110,100,32,116,104,101,32,100,105,115,107,32,40,110,111,32,117,110,100,111,41,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,
-111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,121,112,101,32,105,110,32,116,104,101,32,112,114,111,106,101,99,116,32,110,97,109,101,32,116,111,32,99,111,110,102,105,114,109,32,114,
-101,109,111,118,97,108,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,117,116,104,58,58,103,105,116,104,117,98,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,103,105,110,32,119,105,116,104,32,71,105,116,
-72,117,98,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,110,99,101,108,34,125,44,123,34,110,97,109,101,34,58,34,
-100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,112,112,108,121,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,
-58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,65,100,100,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,110,99,101,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,99,111,112,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,112,121,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,117,116,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,97,115,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,97,115,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,100,101,108,101,116,101,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,
-114,111,117,112,32,98,121,32,110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,99,111,108,111,117,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,111,117,112,32,98,121,
-32,99,111,108,111,117,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,111,117,112,32,98,121,
-32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,111,32,103,114,111,117,112,105,110,
-103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,101,100,32,112,108,117,103,105,110,
-115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,105,111,110,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,101,100,32,99,104,97,110,103,101,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,101,100,32,118,101,114,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,
-34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,
-110,58,58,118,99,115,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,
-110,58,58,118,99,115,58,58,115,101,108,101,99,116,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,110,111,110,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
-105,111,110,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,
-58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,101,99,107,111,117,116,32,114,101,118,105,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,
-110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,117,115,104,32,98,114,97,110,99,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,
-99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,117,108,108,32,98,114,97,110,99,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,
-110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,110,101,119,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
-105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,117,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,116,111,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,111,118,101,32,102,114,111,109,32,108,105,115,116,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,100,105,115,99,111,110,110,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,105,115,99,111,110,110,101,99,116,32,102,114,111,109,32,
-97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,111,118,101,32,
-102,114,111,109,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,97,117,100,105,111,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,82,101,99,101,105,118,101,32,97,117,100,105,111,32,102,114,111,109,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,97,117,100,
-105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,110,100,32,97,117,100,105,111,32,116,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,
-101,116,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,99,101,105,118,101,32,77,73,68,73,32,102,114,111,109,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,
-111,117,116,101,58,58,115,101,110,100,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,110,100,32,77,73,68,73,32,116,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,
-58,58,110,111,116,101,115,58,58,97,114,112,101,103,103,105,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,114,112,101,103,103,105,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,
-116,105,111,110,58,58,110,111,116,101,115,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,102,97,99,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
-105,111,110,58,58,110,111,116,101,115,58,58,114,101,115,99,97,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,99,97,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,
-58,58,110,111,116,101,115,58,58,113,117,97,110,116,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,
-58,58,110,111,116,101,115,58,58,100,105,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,105,109,101,32,100,105,118,105,115,105,111,110,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
-108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,111,118,101,32,116,111,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
-108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,116,111,116,114,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,120,116,114,97,99,116,32,97,115,32,110,101,119,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,100,105,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,
-101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,115,101,32,117,112,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,115,101,32,100,
-111,119,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,105,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,100,101,32,99,104,97,110,103,101,115,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,115,104,111,119,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,116,111,114,101,32,99,104,97,110,103,101,115,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,116,111,103,103,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,99,104,97,110,103,101,115,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,111,109,109,105,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,118,99,115,58,58,114,101,115,101,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,116,97,115,104,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,111,112,32,115,116,97,115,
-104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,121,110,99,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,121,110,99,32,97,108,108,32,114,101,118,105,115,105,111,110,115,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,97,114,112,32,102,114,111,109,32,115,101,108,
-101,99,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,108,101,97,110,117,112,32,111,
-118,101,114,108,97,112,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,118,101,114,
-115,101,32,117,112,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,118,101,114,
-115,101,32,100,111,119,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,114,101,116,114,111,103,114,97,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,116,114,
-111,103,114,97,100,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,
-99,32,105,110,118,101,114,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,
-34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,50,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,52,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,
-97,110,116,105,122,101,58,58,56,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,56,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,49,54,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,49,54,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,51,50,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,51,50,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,
-114,103,101,32,116,117,112,108,101,116,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,117,112,108,101,116,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,105,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,52,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,100,114,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,81,117,105,110,116,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,120,116,117,112,108,101,116,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,112,116,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,
-101,116,58,58,56,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,99,116,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,57,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,78,111,110,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,32,
-112,114,111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,97,
-109,101,115,32,100,111,110,39,116,32,109,97,116,99,104,33,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,108,111,
-97,100,32,112,114,111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,97,117,116,111,109,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,
-101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,115,116,101,114,32,116,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-112,114,111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,109,112,111,114,116,32,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,
-106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,
-58,102,108,97,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,116,111,32,70,76,65,67,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,
-111,103,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,116,111,32,79,71,71,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,
-118,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,116,111,32,87,65,86,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,109,105,100,105,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,120,112,111,114,116,32,116,111,32,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,115,97,118,101,
-100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,97,118,101,100,32,116,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,82,101,102,97,99,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,84,114,97,110,115,112,111,115,101,32,117,112,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,84,114,97,110,115,112,111,115,101,32,100,111,119,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,65,114,114,97,110,103,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,69,100,105,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,
-105,111,110,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,
-110,103,101,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,67,104,97,110,103,101,32,116,101,109,112,101,114,97,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,111,110,118,101,114,116,58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,67,111,110,118,101,114,116,32,116,111,32,116,101,109,112,101,114,97,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,101,
-100,105,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,100,105,116,32,114,111,117,116,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,
-117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,104,111,119,32,85,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,101,102,102,101,99,116,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,101,102,102,101,99,116,32,110,111,100,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,105,110,115,116,114,117,109,101,
-110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,105,110,115,116,114,117,109,101,110,116,32,110,111,100,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,
-58,114,101,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,99,97,110,32,99,111,109,109,111,110,32,112,108,117,103,105,110,32,102,111,108,100,101,114,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,
-110,115,116,114,117,109,101,110,116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,99,97,110,32,99,117,115,116,111,109,32,112,108,117,103,105,110,32,102,111,108,100,101,114,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,
-109,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,100,105,116,32,107,101,121,98,111,97,114,100,32,109,97,112,112,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,108,111,
-97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,97,100,32,83,99,97,108,97,32,109,97,112,112,105,110,103,40,115,41,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,114,101,115,101,116,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,32,107,101,121,98,111,97,114,100,32,109,97,112,112,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,97,108,108,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,117,112,108,
-105,99,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,32,116,114,97,99,107,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,114,116,32,97,32,110,101,119,32,112,114,
-111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,32,97,
-32,112,114,111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,117,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,
-110,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,109,117,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,111,108,
-111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,115,111,108,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,
-105,116,108,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,116,104,111,114,34,125,44,123,34,110,97,109,101,34,
-58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,115,99,114,105,112,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,112,
-97,103,101,58,58,112,114,111,106,101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,105,99,101,110,115,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,
-58,58,100,117,114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,110,103,116,104,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,114,116,101,100,32,97,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,32,99,111,110,116,114,111,108,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,67,111,110,115,105,115,116,115,32,111,102,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,70,105,108,101,32,108,111,99,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,
-116,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,108,105,99,107,32,116,111,32,101,100,105,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,
-97,108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,112,32,116,111,32,101,100,105,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,
-97,117,108,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,99,111,103,110,105,116,111,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,
-108,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,112,121,114,105,103,104,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,101,109,112,101,
-114,97,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,109,112,101,114,97,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,112,108,117,103,105,110,
-115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,118,97,105,108,97,98,108,101,32,97,117,100,105,111,32,112,108,117,103,105,110,115,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,
-105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,115,32,111,110,32,115,116,97,103,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,
-99,104,101,115,116,114,97,58,58,118,101,110,100,111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,108,117,103,105,110,32,118,101,110,100,111,114,32,97,110,100,32,110,97,109,101,34,125,44,123,34,110,97,109,
-101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,99,97,116,101,103,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,116,101,103,111,114,121,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,
-58,58,111,114,99,104,101,115,116,114,97,58,58,102,111,114,109,97,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,111,114,109,97,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,115,99,97,110,102,111,108,100,
-101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,102,111,108,100,101,114,32,116,111,32,115,99,97,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,119,
-111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,110,101,119,32,112,114,111,106,101,99,116,34,125,
-44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,32,115,97,118,101,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,
-32,101,120,112,111,114,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,120,112,
-111,114,116,32,100,111,110,101,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,
-105,108,101,32,116,111,32,108,111,97,100,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,
-101,32,97,32,102,105,108,101,32,116,111,32,105,109,112,111,114,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,82,101,110,100,101,114,32,116,111,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,98,111,114,116,32,114,101,110,100,101,114,34,125,44,123,34,110,97,109,
-101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,32,114,101,110,100,101,
-114,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,101,109,112,111,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,32,116,101,109,112,111,44,32,66,80,77,58,34,125,44,123,
-34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,101,109,112,111,58,58,116,97,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,112,32,116,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,111,
-110,101,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,32,111,110,101,32,116,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,112,114,111,106,101,99,116,115,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,115,32,108,105,115,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,84,105,109,101,108,105,110,101,32,97,110,100,32,116,114,97,99,107,115,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,99,104,111,114,100,98,117,105,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,67,104,111,114,100,32,99,111,109,112,105,108,101,114,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,109,111,118,101,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,111,118,101,
-32,110,111,116,101,115,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,109,117,116,101,34,125,44,123,34,110,97,109,101,34,58,
-34,116,111,103,103,108,101,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,115,111,108,111,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,115,99,97,108,101,115,104,108,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,115,99,97,108,101,115,32,104,105,103,104,108,105,103,104,116,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,110,111,116,101,103,
-117,105,100,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,115,104,111,119,32,110,111,116,101,32,110,97,109,101,115,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,108,111,111,112,
-115,101,108,101,99,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,108,111,111,112,32,111,118,101,114,32,115,101,108,101,99,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,
-100,58,58,115,117,103,103,101,115,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,103,103,101,115,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,99,111,109,112,105,108,101,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,110,101,114,97,116,101,32,99,104,111,114,100,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,82,111,111,116,32,107,101,121,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,84,111,110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,101,114,116,111,110,105,99,
-34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,100,105,97,110,116,34,125,44,123,34,110,97,109,101,
-34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,100,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,112,111,
-112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,
-114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,109,101,100,105,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,
-110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,116,111,110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,65,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,118,105,99,
-101,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,114,105,118,101,114,34,125,44,123,34,110,97,109,101,34,
-58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,97,109,112,108,101,32,114,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,115,
-101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,117,102,102,101,114,32,115,105,122,101,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,
-116,105,110,103,115,58,58,109,105,100,105,58,58,114,101,99,111,114,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,99,111,114,100,32,77,73,68,73,32,102,114,111,109,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,
-103,115,58,58,109,105,100,105,58,58,110,111,100,101,118,105,99,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,111,32,105,110,112,117,116,32,100,101,118,105,99,101,115,32,102,111,117,110,100,34,125,44,123,34,110,97,109,101,34,58,
-34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,116,97,114,116,32,114,101,113,117,105,114,101,100,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,
-110,103,115,58,58,115,121,110,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,116,105,110,103,115,32,116,111,32,98,101,32,115,121,110,99,101,100,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,
-117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,32,116,104,101,109,101,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,102,111,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,70,111,110,116,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,110,97,116,105,118,101,98,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,110,97,116,105,118,101,
-32,116,105,116,108,101,32,98,97,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,101,108,112,32,105,109,
-112,114,111,118,105,110,103,32,72,101,108,105,111,32,116,114,97,110,115,108,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,85,73,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,85,115,101,32,100,101,102,97,117,108,116,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,85,115,101,32,79,112,101,110,71,76,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,
-105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,67,111,114,101,71,114,97,112,104,105,99,115,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,
-110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,68,105,114,101,99,116,50,68,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,
-116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,110,97,116,105,118,101,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,
-34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,114,101,110,100,101,114,101,114,32,105,115,32,117,115,117,97,108,108,121,
-32,109,117,99,104,32,102,97,115,116,101,114,32,102,111,114,32,108,97,114,103,101,32,112,114,111,106,101,99,116,115,44,32,98,117,116,32,105,116,32,97,108,115,111,32,109,97,121,32,98,101,32,117,110,115,116,97,98,108,101,32,100,101,112,101,110,100,105,110,
-103,32,111,110,32,121,111,117,114,32,104,97,114,100,119,97,114,101,46,32,83,119,105,116,99,104,32,116,111,32,79,112,101,110,71,76,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,
-101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,101,114,32,99,111,109,109,105,116,32,109,101,115,115,97,103,101,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,
-114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,32,115,101,108,101,99,116,101,100,32,99,104,97,110,103,101,115,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,
-112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,119,97,114,110,105,110,
-103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,99,111,110,116,97,105,110,115,32,117,110,99,111,109,109,105,116,116,101,100,32,99,104,97,110,103,101,115,33,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,101,99,107,111,117,116,32,114,101,118,105,115,105,111,110,34,125,44,123,34,110,97,
-109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,97,114,99,104,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,
-115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,111,118,101,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,73,110,115,116,97,110,116,105,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,65,100,100,101,100,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,111,118,101,100,34,125,
-44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,
-118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,99,104,97,110,103,101,115,32,116,111,32,115,97,118,101,46,34,125,44,123,
-34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,99,104,97,110,103,101,115,32,116,111,32,114,101,
-115,101,116,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,110,110,111,116,32,114,101,118,101,
-114,116,32,115,116,97,115,104,101,100,32,99,104,97,110,103,101,115,44,32,116,104,101,32,115,116,97,103,101,32,105,115,32,110,111,116,32,101,109,112,116,121,33,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,
-116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,99,104,97,110,103,101,115,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,116,105,111,110,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,118,105,115,105,111,110,32,116,114,101,101,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,76,111,99,97,108,32,104,105,115,116,111,114,121,32,105,115,32,97,108,114,101,97,100,121,32,117,112,32,116,111,32,100,97,116,101,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,32,100,111,110,101,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,80,114,111,106,101,99,116,32,116,105,109,101,108,105,110,101,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,80,114,111,106,101,99,116,32,105,110,102,111,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,118,101,114,115,105,111,110,34,125,
-44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,97,110,100,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,115,117,112,112,111,114,116,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,112,111,114,116,32,116,104,101,32,112,114,111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,110,101,116,119,111,114,107,101,114,114,111,114,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,116,119,111,114,107,32,101,114,114,111,114,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,89,101,115,116,101,114,100,97,121,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,112,100,97,116,101,34,125,44,123,34,110,97,
-109,101,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,
-101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,97,117,116,104,111,114,32,99,
-104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,
-110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,116,101,109,112,101,114,97,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,116,101,109,112,101,114,97,109,101,110,116,32,99,104,97,110,103,
-101,100,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,101,
-109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,
-110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,111,110,105,97,110,34,125,44,123,34,110,
-97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,101,111,108,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,76,121,100,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,68,111,
-114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,104,114,121,103,105,
-97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,99,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-77,101,108,111,100,105,99,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,
-125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,
-103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,97,112,
-111,108,105,116,97,110,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,125,
-44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,
-109,97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,105,103,109,97,116,105,99,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,111,110,105,97,
-110,32,65,117,103,109,101,110,116,101,100,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,
-34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,125,44,123,34,110,97,109,101,
-34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,
-108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,
-103,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,112,104,114,121,103,
-105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,108,116,114,97,112,104,114,121,103,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,101,114,
-108,111,99,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,125,44,123,34,110,97,109,101,34,
-58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,101,97,100,105,110,103,32,87,104,111,108,101,45,
-84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,97,100,105,110,103,32,87,104,111,108,101,45,84,111,110,101,34,125,44,123,34,110,97,109,101,34,58,34,68,111,117,98,108,101,32,72,97,114,109,111,110,105,99,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,68,111,117,98,108,101,32,72,97,114,109,111,110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,125,44,123,34,110,97,109,101,34,58,34,65,108,116,101,114,101,100,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,116,101,114,101,100,32,
-68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,105,99,34,
-125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,66,108,
-117,101,115,32,77,111,100,105,102,105,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,77,111,100,105,102,105,101,100,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,125,44,123,34,110,97,109,101,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,99,107,39,110,39,82,111,108,
-108,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,
-79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,77,73,68,73,32,73,110,112,117,116,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,79,117,116,112,117,116,34,125,93,44,34,112,108,
-117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,
-32,105,110,112,117,116,32,99,104,97,110,110,101,108,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,
-32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,112,108,117,114,
-97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,
-123,120,125,32,110,111,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,
-125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,
-111,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,
-44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,34,
-44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,
-109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,34,44,34,112,108,117,114,
-97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,
-109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,
-97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,34,44,34,112,108,117,114,97,108,70,
-111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,
-101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
-125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,
-108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,
-109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,
-99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,
-101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,
-110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,
-109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,
-99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,
-111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
-50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,
-100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,
-116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
-97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,
-100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,
-97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,
-58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,
-103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,
-110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,
-100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,
-114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,
-34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,34,44,34,112,108,117,114,97,108,70,
-111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,
-116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,
-101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,112,108,117,114,97,
-108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,
-125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,
-123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,34,44,
-34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,
-112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,
-101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,112,108,117,114,97,108,70,
-111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,
-111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,
-101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,
-110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,
-110,100,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,
-58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,112,108,117,114,97,108,70,111,114,109,34,
-58,34,49,34,125,125,93,125,44,13,10,123,34,105,100,34,58,34,100,101,34,44,34,110,97,109,101,34,58,34,68,101,117,116,115,99,104,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,34,40,123,120,125,61,61,49,32,63,32,49,32,58,32,50,41,34,
-44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,80,114,111,106,101,107,116,32,101,114,115,116,101,108,108,116,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,78,101,117,101,115,32,80,114,111,106,101,107,116,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-78,101,117,101,32,69,98,101,110,101,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,109,112,111,
-34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,105,110,115,116,114,117,109,
-101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,69,105,110,115,116,101,108,108,117,110,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,101,110,34,125,44,
-123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,97,116,116,101,114,110,115,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,
-115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,117,109,98,101,110,101,110,110,101,110,34,125,44,123,34,
-110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,98,101,110,101,110,110,101,110,
-34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,97,
-109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
-117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,114,107,101,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,120,116,32,101,105,110,103,101,98,101,110,58,34,125,44,123,34,110,97,109,101,34,58,34,
-100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,114,107,101,32,195,164,110,100,101,114,110,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,107,116,97,110,103,97,98,101,32,195,164,110,100,101,114,110,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,107,116,97,110,103,97,98,101,32,104,105,110,122,117,102,195,188,103,101,110,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,107,116,97,
-110,103,97,98,101,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,84,97,107,116,97,110,103,97,98,101,32,101,105,110,103,101,98,101,110,58,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,84,111,110,97,114,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,
-58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,32,117,110,100,32,83,107,97,108,97,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,98,101,110,101,32,117,109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,98,101,110,101,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
-111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,111,108,108,101,110,32,83,105,101,32,100,97,115,32,80,114,111,106,101,107,116,32,101,110,100,
-103,195,188,108,116,105,103,32,97,117,115,32,100,101,114,32,67,108,111,117,100,32,117,110,100,32,118,111,110,32,100,101,114,32,70,101,115,116,112,108,97,116,116,101,32,108,195,182,115,99,104,101,110,63,32,40,68,105,101,115,101,32,65,107,116,105,111,110,
-32,107,97,110,110,32,110,105,99,104,116,32,114,195,188,99,107,103,195,164,110,103,105,103,32,103,101,109,97,99,104,116,32,119,101,114,100,101,110,33,41,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,
-114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,98,101,110,32,83,105,101,32,100,101,110,32,78,97,109,101,110,32,100,101,115,32,80,114,111,106,101,
-107,116,115,32,101,105,110,44,32,117,109,32,100,97,115,32,76,195,182,115,99,104,101,110,32,122,117,32,98,101,115,116,195,164,116,105,103,101,110,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,99,
-97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,98,98,114,101,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,112,112,108,121,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,65,110,119,101,110,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,102,195,188,103,101,110,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,98,98,114,101,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,111,112,121,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,111,112,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,115,99,104,110,101,
-105,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,102,101,114,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
-117,58,58,103,114,111,117,112,98,121,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,117,112,112,105,101,114,101,32,98,101,105,32,78,97,109,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-103,114,111,117,112,98,121,58,58,99,111,108,111,117,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,117,112,112,105,101,114,101,32,98,101,105,32,70,97,114,98,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,
-114,111,117,112,98,121,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,117,112,112,105,101,114,101,32,98,101,105,32,73,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,
-34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,101,105,110,101,32,71,114,117,112,112,105,101,114,117,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,
-101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,103,101,119,195,164,104,108,116,101,32,80,108,117,103,105,110,115,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,119,97,104,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
-108,101,99,116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,119,97,104,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,
-58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,103,101,119,195,164,104,108,116,101,32,195,132,110,100,101,114,117,110,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
-108,101,99,116,105,111,110,58,58,118,99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,103,101,119,195,164,104,108,116,101,32,86,101,114,115,105,111,110,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,115,116,195,164,116,105,103,101,110,34,125,44,123,34,110,97,109,101,34,58,
-34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,114,195,188,99,107,115,101,116,122,101,110,34,125,44,123,34,110,97,109,101,34,58,
-34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,109,97,114,107,105,101,114,101,110,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,119,97,104,108,32,97,117,102,104,101,98,
-101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,115,104,34,125,44,123,34,110,97,
-109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,32,100,105,101,115,101,114,32,86,101,114,115,105,111,110,
-32,117,109,115,99,104,97,108,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,117,115,104,
-34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,117,108,108,34,125,44,123,34,110,97,109,101,34,58,
-34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,117,101,115,32,73,110,115,116,114,117,109,101,110,116,32,97,110,108,101,
-103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,117,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,32,73,110,115,116,114,
-117,109,101,110,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,65,117,115,32,100,101,114,32,76,105,115,116,101,32,101,110,116,102,101,114,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,100,
-105,115,99,111,110,110,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,86,101,114,98,105,110,100,117,110,103,101,110,32,116,114,101,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,32,73,110,115,116,114,117,109,101,110,116,32,101,110,116,102,101,114,110,101,110,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,32,101,109,112,102,
-97,110,103,101,110,32,118,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,65,117,100,105,111,32,115,101,110,100,101,110,32,97,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,109,105,100,105,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,77,73,68,73,32,101,109,112,102,97,110,103,101,110,32,118,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,109,105,
-100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,115,101,110,100,101,110,32,97,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,97,
-114,112,101,103,103,105,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,114,112,101,103,103,105,111,32,101,114,122,101,117,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,
-111,110,58,58,110,111,116,101,115,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,119,97,110,100,101,108,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
-105,111,110,58,58,110,111,116,101,115,58,58,100,105,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,101,105,116,101,105,110,116,101,105,108,117,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,97,114,98,101,105,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,
-101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,110,105,101,114,101,110,32,110,97,99,104,32,111,98,101,
-110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-84,114,97,110,115,112,111,110,105,101,114,101,110,32,110,97,99,104,32,117,110,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,105,100,101,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,195,132,110,100,101,114,117,110,103,101,110,32,97,117,115,98,108,101,110,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,115,104,111,119,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,195,132,110,100,101,114,117,110,103,101,110,32,119,105,100,101,114,104,101,114,115,116,101,108,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,111,109,109,
-105,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,98,101,115,116,195,164,116,105,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,114,101,115,101,116,97,108,108,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,122,117,114,195,188,99,107,115,101,116,122,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,111,112,32,83,116,97,115,104,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,110,108,101,103,101,110,32,97,117,115,32,65,117,115,119,97,104,108,
-34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,195,156,98,101,114,108,97,112,112,117,110,103,101,110,
-32,108,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,97,99,
-104,32,111,98,101,110,32,105,110,118,101,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,100,111,119,110,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,78,97,99,104,32,117,110,116,101,110,32,105,110,118,101,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,114,101,116,114,111,103,
-114,97,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,195,188,99,107,108,195,164,117,102,105,103,107,101,105,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,49,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,68,117,111,108,101,110,32,122,117,115,97,109,109,101,110,102,195,188,104,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,50,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,68,117,111,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,105,111,108,101,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,114,116,111,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,
-58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,105,110,116,111,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,108,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,99,97,110,99,101,108,108,101,100,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,32,97,98,103,101,98,114,111,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,115,99,104,108,105,101,195,159,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,69,98,101,110,101,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,116,111,109,97,116,105,115,105,101,114,117,110,103,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,
-58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,
-105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,105,109,112,111,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,105,110,32,70,76,65,67,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,111,103,103,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,105,110,32,79,71,71,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,118,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,105,110,32,87,65,86,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,109,105,100,105,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,32,77,73,68,73,32,101,120,112,111,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,
-115,97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,115,112,101,105,99,104,101,114,116,32,97,108,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,102,
-97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,103,101,115,116,97,108,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,
-58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,110,105,101,114,101,110,32,110,97,99,104,32,111,98,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,
-58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,110,105,101,114,101,110,32,110,97,99,104,32,117,110,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,
-109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,114,114,97,110,103,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,
-34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,97,114,98,101,105,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,
-101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,195,164,110,100,101,114,110,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,117,109,98,101,110,101,110,110,101,110,
-34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,108,195,182,115,
-99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,101,100,105,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,105,103,110,97,108,102,
-108,117,115,115,32,98,101,97,114,98,101,105,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,101,102,102,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,69,102,102,101,107,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,105,110,115,116,114,117,109,101,110,116,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,
-101,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,108,117,103,105,110,45,76,105,115,116,101,32,117,109,108,97,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,
-116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,114,100,110,101,114,32,115,99,97,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,
-109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,
-97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,115,32,97,117,115,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,
-110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,
-58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,111,112,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,69,105,110,32,110,101,117,101,115,32,80,114,111,106,101,107,116,32,101,114,115,116,101,108,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,
-101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,108,97,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,68,101,97,107,116,105,118,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,107,116,105,118,105,101,114,101,110,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,114,195,188,99,107,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,
-116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,105,116,101,108,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,65,117,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,115,99,104,
-114,101,105,98,117,110,103,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,105,122,101,110,122,34,125,44,123,34,110,
-97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,164,110,103,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,
-112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,114,116,100,97,116,117,109,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,
-58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,115,115,116,97,116,105,115,116,105,107,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,
-99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,115,116,101,104,116,32,97,117,115,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,
-116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,112,101,105,99,104,101,114,111,114,116,32,100,101,114,32,68,97,116,101,105,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,
-58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,109,32,66,101,97,114,98,101,105,116,101,110,32,97,110,107,
-108,105,99,107,101,110,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,70,195,188,114,32,100,105,101,32,66,101,97,114,98,101,105,116,117,110,103,32,98,101,114,195,188,104,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,97,
-117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,107,111,103,110,105,116,111,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,108,105,
-99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,112,121,114,105,103,104,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,112,108,117,103,105,110,115,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,102,195,188,103,98,97,114,101,32,65,117,100,105,111,45,80,108,117,103,105,110,115,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,105,
-110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,101,32,97,117,102,32,100,101,114,32,66,195,188,104,110,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,
-101,58,58,111,114,99,104,101,115,116,114,97,58,58,118,101,110,100,111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,108,117,103,105,110,45,72,101,114,115,116,101,108,108,101,114,32,117,110,100,32,78,97,109,
-101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,99,97,116,101,103,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,97,116,101,103,111,114,105,101,34,125,44,123,34,110,
-97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,102,111,114,109,97,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,111,114,109,97,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,
-58,58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,114,100,110,101,114,32,122,117,109,32,83,99,97,110,110,101,110,32,119,195,164,104,108,101,110,34,125,44,123,34,
-110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,117,101,115,
-32,80,114,111,106,101,107,116,32,101,114,115,116,101,108,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,83,112,101,105,99,104,101,114,110,32,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,69,120,112,111,114,116,32,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,
-109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,120,112,111,114,116,105,101,114,116,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,
-117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,76,97,100,101,110,32,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,73,109,112,111,114,116,32,119,195,164,104,108,101,110,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,110,32,110,97,99,104,58,34,125,44,123,34,
-110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,114,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,
-58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,97,98,98,114,101,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,
-58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,114,101,110,100,101,114,110,32,97,117,115,119,195,164,104,108,101,
-110,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,34,125,44,123,34,110,97,109,101,34,58,34,112,
-111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,105,107,97,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,
-100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,101,114,116,111,110,105,107,97,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,
-110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,100,105,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,
-52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,100,111,109,105,110,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,109,105,110,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,83,117,98,109,101,100,105,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,83,117,98,116,111,110,105,107,97,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,
-34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,114,195,164,116,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,
-97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,101,105,98,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,
-112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,97,109,112,108,105,110,103,102,114,101,113,117,101,110,122,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,
-58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,117,102,102,101,114,45,71,114,195,182,195,159,101,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,
-97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,117,115,116,97,114,116,32,110,111,116,119,101,110,100,105,103,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,70,97,114,98,115,99,104,101,109,97,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,83,105,101,32,107,195,182,110,110,101,110,32,98,101,105,32,100,101,114,32,72,101,108,105,111,45,195,156,98,101,114,115,101,116,122,117,110,103,32,104,101,108,102,101,110,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,
-58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,116,101,114,102,97,99,101,45,82,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,
-110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,110,100,97,114,100,109,195,164,195,159,105,103,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,
-58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,
-114,58,58,99,111,114,101,103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,114,101,32,71,114,97,112,104,105,99,115,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,
-100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,105,114,101,99,116,50,68,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,
-114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,97,116,105,118,45,82,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,
-112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,114,32,79,112,101,110,71,76,45,82,101,110,100,101,114,101,114,32,105,115,116,32,102,195,188,114,32,103,101,119,195,182,104,110,108,105,99,104,32,100,101,117,116,108,
-105,99,104,32,115,99,104,110,101,108,108,101,114,32,102,195,188,114,32,103,114,111,195,159,101,32,80,114,111,106,101,107,116,101,44,32,107,97,110,110,32,97,98,101,114,32,106,101,32,110,97,99,104,32,118,101,114,119,101,110,100,101,116,101,114,32,72,97,
-114,100,119,97,114,101,32,105,110,115,116,97,98,105,108,32,115,101,105,110,46,32,87,105,114,107,108,105,99,104,32,97,117,102,32,79,112,101,110,71,76,32,117,109,115,116,101,108,108,101,110,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,118,101,114,119,101,110,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,
-58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,45,66,101,115,99,104,114,101,105,98,117,110,103,32,101,105,110,103,101,98,101,110,58,34,125,
-44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,112,101,105,99,104,101,114,110,34,125,44,123,34,110,
-97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,111,108,108,101,110,32,83,105,101,32,100,105,101,32,97,117,115,103,119,
-195,164,104,108,116,101,110,32,195,132,110,100,101,114,117,110,103,101,110,32,122,117,114,195,188,99,107,110,101,104,109,101,110,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,114,
-111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,114,195,188,99,107,110,101,104,109,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,
-119,97,114,110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,101,110,116,104,195,164,108,116,32,110,105,99,104,116,32,103,101,115,112,101,105,99,104,101,114,116,101,32,195,132,110,100,101,114,117,
-110,103,101,110,33,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,32,100,105,101,
-115,101,114,32,86,101,114,115,105,111,110,32,117,109,115,99,104,97,108,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,83,117,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,
-110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,
-100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,103,101,102,195,188,103,116,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,
-58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,108,195,182,115,99,104,116,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,
-58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,
-105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,195,164,104,108,101,110,32,83,105,101,32,100,105,101,32,195,132,110,100,101,114,117,110,103,101,110,44,32,100,105,101,32,83,105,101,32,115,112,101,105,99,104,101,114,110,32,119,111,
-108,108,101,110,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,195,164,104,108,101,110,32,83,105,101,
-32,100,105,101,32,195,132,110,100,101,114,117,110,103,101,110,44,32,100,105,101,32,83,105,101,32,122,117,114,195,188,99,107,110,101,104,109,101,110,32,119,111,108,108,101,110,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,
-105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,195,188,99,107,115,112,114,117,110,103,32,97,110,32,100,105,101,32,65,110,115,99,104,108,117,115,115,115,116,101,108,108,101,
-32,117,110,109,195,182,103,108,105,99,104,44,32,100,97,115,32,119,105,114,100,32,195,132,110,100,101,114,117,110,103,101,110,32,108,195,182,115,99,104,101,110,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,
-112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,195,164,110,100,101,114,117,110,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,
-116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,118,105,115,105,111,110,115,98,97,117,109,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,76,111,107,97,108,101,32,72,105,115,116,111,114,105,101,32,105,115,116,32,97,117,102,32,100,101,109,32,110,101,117,101,115,116,101,110,32,83,116,97,110,100,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,
-115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,101,114,116,105,103,115,116,101,108,108,101,110,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,
-109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,84,105,109,101,108,105,110,101,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,
-116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,105,110,102,111,114,109,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,117,110,100,34,125,44,123,
-34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,110,101,116,119,111,114,107,101,114,114,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,116,122,119,101,114,107,32,70,101,104,108,101,114,34,125,44,123,34,110,97,109,101,
-34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,115,116,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,
-100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,107,116,117,97,108,105,115,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,104,105,110,122,117,103,101,102,195,188,103,116,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,105,122,101,110,122,32,103,101,195,164,
-110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,105,116,101,108,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,
-109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,116,111,114,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,
-112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,115,99,104,114,101,105,98,117,110,103,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,
-32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,97,114,98,101,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,101,114,101,32,69,98,101,110,101,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,101,114,
-101,115,32,80,97,116,116,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,103,
-101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,110,116,114,111,108,108,101,114,32,103,101,
-195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,111,110,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,195,132,111,108,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,115,99,104,34,125,44,123,34,
-110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,68,111,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,104,114,121,103,105,115,99,104,34,125,44,123,34,110,97,
-109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,107,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,77,101,108,111,100,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,115,
-99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,114,109,111,110,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,
-109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,114,109,111,110,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,
-97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,103,97,114,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,85,110,103,97,114,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-78,101,97,112,111,108,105,116,97,110,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,97,112,111,108,105,
-116,97,110,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,109,97,110,105,115,99,104,32,68,117,114,34,125,44,
-123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,109,97,110,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,
-97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,105,103,109,97,116,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,69,110,105,103,109,97,116,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,111,110,
-105,115,99,104,32,69,114,104,195,182,104,116,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,115,99,104,32,68,111,109,105,110,97,
-110,116,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,115,99,104,32,69,114,104,195,182,104,116,34,125,44,123,34,110,97,109,
-101,34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,115,99,104,32,86,101,114,109,105,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,77,105,
-120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,115,99,104,32,69,114,104,195,182,104,116,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,
-121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,104,114,121,103,105,115,99,104,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,112,104,114,
-121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,108,116,114,97,112,104,114,121,103,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,76,111,107,114,105,115,99,104,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,
-117,112,101,114,108,111,107,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,108,116,114,97,108,111,107,114,105,115,99,104,34,125,44,
-123,34,110,97,109,101,34,58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,117,114,32,76,111,107,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,76,101,97,100,105,110,103,32,
-87,104,111,108,101,45,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,105,116,101,110,100,101,32,71,97,110,122,116,195,182,110,101,34,125,44,123,34,110,97,109,101,34,58,34,68,111,117,98,108,101,32,72,97,114,109,111,110,
-105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,112,112,101,108,104,97,114,109,111,110,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,72,97,108,98,118,101,114,109,105,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,65,108,116,101,114,101,100,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,
-116,101,114,105,101,114,116,101,32,68,111,109,105,110,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,
-72,101,112,116,97,116,111,110,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,115,99,
-104,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,111,100,105,102,105,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,65,108,116,101,114,105,101,114,116,34,125,44,123,34,110,97,109,101,34,
-58,34,66,108,117,101,115,32,77,105,120,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,71,101,109,105,115,99,104,116,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,
-84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,109,105,116,32,76,101,105,116,116,111,110,34,125,44,123,34,110,97,109,101,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,101,105,110,103,97,110,
-103,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,97,117,115,103,97,110,103,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,
-32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,45,69,105,110,103,97,110,103,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,77,73,68,73,45,65,117,115,103,97,110,103,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,105,110,103,97,110,103,115,107,97,110,97,108,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,105,
-110,103,97,110,103,115,107,97,110,195,164,108,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,65,117,115,103,97,98,101,107,97,110,97,108,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,65,117,115,
-103,97,98,101,107,97,110,195,164,108,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,
-101,110,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,
-32,78,111,116,101,110,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,
-32,78,111,116,101,110,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,
-101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,115,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,
-32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,
-111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,115,101,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,
-101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,32,103,101,195,164,110,100,101,114,
-116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,115,101,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
-34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,32,104,105,110,122,
-117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,115,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,
-111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,
-105,112,32,101,110,116,102,101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,115,32,101,110,116,102,101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,
-32,98,101,97,114,98,101,105,116,101,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,99,125,32,67,108,105,112,115,32,98,101,97,114,98,101,105,116,101,116,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,
-32,77,97,114,107,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,110,32,104,105,110,122,117,103,101,102,195,188,
-103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,110,
-32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,
-125,32,77,97,114,107,101,110,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,
-116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,110,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,
-97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,
-103,97,98,101,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,110,32,103,101,108,195,182,115,99,104,116,34,44,
-34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,
-97,107,116,97,110,103,97,98,101,110,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,
-97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,
-58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,101,110,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,
-34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,32,101,110,116,102,
-101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,101,110,32,101,110,116,102,101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
-50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,
-32,84,111,110,97,114,116,32,98,101,97,114,98,101,105,116,101,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,101,110,32,98,101,97,114,98,101,105,116,101,116,
-34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,
-111,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,
-34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,
-34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,115,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,
-110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,
-110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,110,34,44,34,112,108,117,114,
-97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,
-125,32,84,111,110,97,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,
-123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,
-44,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,80,97,116,116,101,114,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,80,97,116,116,101,114,110,115,34,44,
-34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,98,
-101,110,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,98,101,110,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,
-58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,82,101,118,105,115,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
-49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,82,101,118,105,115,105,111,110,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,68,101,108,116,97,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,68,101,108,116,97,115,
-34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,
-32,77,105,110,117,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,105,110,117,116,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,
-110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,83,101,107,117,110,100,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
-34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,83,101,107,117,110,100,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,
-125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,117,109,98,101,110,97,110,110,116,32,118,111,110,32,123,120,125,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,
-100,34,58,34,122,104,34,44,34,110,97,109,101,34,58,34,231,174,128,228,189,147,228,184,173,230,150,135,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,34,49,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,
-100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,165,231,168,139,229,144,175,229,138,168,34,125,44,123,34,
-110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,229,187,186,229,183,165,231,168,139,34,125,44,123,34,110,
-97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,229,187,186,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,
-58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,159,229,186,166,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,
-111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,165,228,189,156,229,174,164,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,190,231,189,174,34,125,44,123,34,110,97,
-109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,230,160,183,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,107,101,121,77,97,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,148,174,231,155,152,230,152,160,229,176,132,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,185,144,229,153,
-168,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,
-135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,230,179,168,233,135,138,34,125,44,123,34,110,97,109,
-101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,190,147,229,133,165,230,179,168,233,135,138,34,125,44,123,
-34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,232,190,145,230,179,168,233,135,
-138,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,230,139,141,229,143,
-183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,230,139,141,229,143,183,34,125,44,123,34,110,97,109,101,
-34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,230,139,141,229,143,183,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,190,147,229,133,
-165,230,150,176,230,139,141,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,
-230,148,185,232,176,131,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,
-153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,232,176,131,229,143,183,34,125,
-44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,232,
-176,131,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,
-183,187,229,138,160,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,
-189,168,233,129,147,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,
-138,160,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,155,229,187,186,231,144,182,
-233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,155,229,187,186,34,125,44,123,34,110,97,109,101,
-34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,152,175,229,144,166,230,176,184,228,185,133,228,187,142,228,186,145,
-231,171,175,229,146,140,230,156,172,229,156,176,229,136,160,233,153,164,232,175,165,233,161,185,231,155,174,239,188,159,239,188,136,228,184,141,229,143,175,230,146,164,233,148,128,239,188,137,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,190,147,229,133,165,233,161,185,231,155,174,229,144,141,231,
-167,176,228,187,165,231,161,174,232,174,164,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,117,116,104,58,58,103,105,116,104,117,98,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,
-191,231,148,168,32,71,105,116,72,117,98,32,232,180,166,229,143,183,231,153,187,229,189,149,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,229,143,150,230,182,136,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,186,148,231,148,168,34,
-125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,229,143,150,230,182,136,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,111,112,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,141,229,136,182,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,170,229,136,135,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,97,115,116,101,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,231,178,152,232,180,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,165,229,144,141,231,167,176,229,136,134,231,187,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,103,114,111,117,112,98,121,58,58,99,111,108,111,117,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,165,233,162,156,232,137,178,229,136,134,231,187,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,
-111,117,112,98,121,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,165,228,185,144,229,153,168,229,136,134,231,187,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,
-114,111,117,112,98,121,58,58,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,151,160,229,136,134,231,187,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,
-117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,230,143,146,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,233,159,179,231,172,166,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,231,137,135,230,174,181,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,230,143,144,228,186,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,233,135,141,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,229,133,168,233,128,137,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-230,156,170,233,128,137,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,180,174,232,151,143,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,163,128,229,135,186,231,137,136,230,156,
-172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,142,168,233,128,129,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,139,137,229,143,150,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,155,229,187,186,230,150,176,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,
-34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,117,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,229,136,176,228,185,144,229,153,168,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,142,229,136,151,232,161,168,229,136,160,233,153,
-164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,100,105,115,99,111,110,110,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,173,229,188,
-128,230,137,128,230,156,137,232,191,158,230,142,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,228,187,142,228,185,144,229,153,168,228,184,173,231,167,187,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,97,117,100,105,111,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,142,165,229,143,151,233,159,179,233,162,145,232,135,170,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,
-110,100,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,145,233,128,129,233,159,179,233,162,145,232,135,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,
-114,111,117,116,101,58,58,103,101,116,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,142,165,229,143,151,77,73,68,73,232,135,170,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,
-111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,145,233,128,129,77,73,68,73,232,135,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
-108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,97,114,112,101,103,103,105,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,144,182,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
-108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,230,158,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,
-99,116,105,111,110,58,58,110,111,116,101,115,58,58,113,117,97,110,116,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
-105,111,110,58,58,110,111,116,101,115,58,58,100,105,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,135,229,137,178,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
-105,111,110,58,58,110,111,116,101,115,58,58,116,111,116,114,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,138,189,229,135,186,229,136,176,230,150,176,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,232,190,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
-108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,138,231,167,187,232,176,131,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,139,231,167,187,232,
-176,131,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,105,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,154,144,232,151,143,229,143,152,230,155,180,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,115,104,111,119,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,129,162,229,164,141,229,143,152,230,155,180,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,111,109,109,105,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,144,228,186,164,229,133,168,233,131,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,118,99,115,58,58,114,101,115,101,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,231,189,174,229,133,168,233,131,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,
-115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,180,174,232,151,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,229,188,185,229,135,186,232,180,174,232,151,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,121,110,99,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,140,230,173,165,230,137,128,
-230,156,137,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,142,233,128,
-137,230,139,169,228,184,173,229,136,155,229,187,186,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,
-167,187,233,153,164,233,135,141,229,143,160,233,131,168,229,136,134,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,117,112,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,229,144,145,228,184,138,229,143,141,229,144,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,100,111,119,110,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,139,229,143,141,229,144,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,114,101,116,114,111,103,114,97,100,101,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,233,128,134,232,161,140,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,
-150,229,136,176,49,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,50,34,125,44,123,34,110,97,
-109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,52,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,
-117,97,110,116,105,122,101,58,58,56,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,56,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,49,54,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,49,54,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,51,50,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,51,50,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,136,229,185,182,228,
-186,140,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,186,140,232,191,158,233,159,179,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,137,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,
-58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,155,155,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,228,186,148,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,173,232,191,158,233,159,179,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,131,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,
-108,101,116,58,58,56,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,171,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,57,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,228,185,157,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,
-153,164,233,161,185,231,155,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-229,144,141,231,167,176,228,184,141,229,140,185,233,133,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,179,
-233,151,173,233,161,185,231,155,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,232,189,168,233,129,147,34,125,44,123,34,110,
-97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,232,135,170,229,138,168,229,140,150,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,187,233,128,159,229,186,166,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,175,188,229,133,165,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,
-114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,228,184,186,70,76,65,67,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,
-101,110,100,101,114,58,58,111,103,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,228,184,186,79,71,71,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,
-100,101,114,58,58,119,97,118,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,228,184,186,87,65,86,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,
-114,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,175,188,229,135,186,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,115,
-97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,228,184,186,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,230,158,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,229,144,145,228,184,138,231,167,187,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,139,231,167,187,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,230,155,178,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,231,188,150,232,190,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,230,155,180,230,148,185,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-230,155,180,230,148,185,232,176,131,229,190,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,111,110,118,101,114,116,58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,232,189,172,230,141,162,232,176,131,229,190,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,
-141,229,145,189,229,144,141,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,
-160,233,153,164,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,101,100,105,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,
-188,150,232,190,145,232,191,158,230,142,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,101,102,102,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,
-183,187,229,138,160,230,149,136,230,158,156,229,153,168,232,138,130,231,130,185,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,105,110,115,116,114,117,109,101,110,116,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,228,185,144,229,153,168,232,138,130,231,130,185,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,108,111,97,
-100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,232,189,189,230,143,146,228,187,182,229,136,151,232,161,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,115,
-99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,137,171,230,143,143,230,150,135,228,187,182,229,164,185,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,
-116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,231,188,150,232,190,145,233,148,174,231,155,152,230,152,160,229,176,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,138,160,
-232,189,189,83,99,97,108,97,230,152,160,229,176,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,231,189,174,233,148,174,231,
-155,152,230,152,160,229,176,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,168,233,128,137,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,190,231,189,174,228,185,144,229,153,168,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,141,229,136,182,228,184,186,229,137,175,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
-58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,
-101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,229,187,186,229,183,165,231,168,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,
-115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,137,147,229,188,128,229,183,165,231,168,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,
-116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,157,153,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,
-230,182,136,233,157,153,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,139,172,229,165,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
-117,58,58,117,110,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,230,182,136,231,139,172,229,165,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,232,191,148,229,155,158,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,135,233,162,152,
-34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,156,232,128,133,34,125,44,123,34,110,97,109,101,34,58,34,112,97,
-103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,143,232,191,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,
-101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,184,229,143,175,232,175,129,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,114,97,
-116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,149,191,229,186,166,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,232,181,183,229,167,139,228,186,142,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,231,137,136,230,156,172,230,142,167,229,136,182,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,229,140,133,229,144,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,
-135,228,187,182,228,189,141,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,231,130,185,229,135,187,228,187,165,231,188,150,232,190,145,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,109,111,98,
-105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,141,149,229,135,187,228,187,165,231,188,150,232,190,145,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,
-116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,154,144,232,186,171,230,168,161,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,
-117,108,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,157,131,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,101,109,112,101,114,97,
-109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,176,131,229,190,139,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,229,143,175,231,148,168,233,159,179,233,162,145,230,143,146,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,105,110,115,116,114,117,109,101,110,
-116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,228,189,191,231,148,168,231,154,132,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,118,101,
-110,100,111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,146,228,187,182,229,142,130,229,149,134,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,
-99,97,116,101,103,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,177,187,229,136,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,102,111,114,109,97,116,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,188,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,233,128,137,230,139,169,230,150,135,228,187,182,229,164,185,232,191,155,232,161,140,230,137,171,230,143,143,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,
-97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,155,229,187,186,230,150,176,229,183,165,231,168,139,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,229,136,176,230,150,135,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,
-100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,175,188,229,135,186,229,136,176,230,150,135,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,
-100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,175,188,229,135,186,229,174,140,230,175,149,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,230,150,135,228,187,182,229,185,182,229,138,160,232,189,189,34,125,44,123,34,110,97,109,101,34,58,34,100,
-105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,230,150,135,228,187,182,229,185,182,229,175,188,229,133,165,34,125,44,123,34,110,
-97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,228,184,186,239,188,154,34,125,44,123,34,110,97,109,101,34,58,
-34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,
-110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,148,190,229,188,131,230,184,178,230,159,147,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,
-101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,229,136,176,230,150,135,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,101,109,112,111,58,58,
-99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,190,231,189,174,232,138,130,230,139,141,233,128,159,229,186,166,239,188,140,66,80,77,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
-103,58,58,116,101,109,112,111,58,58,116,97,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,149,178,229,135,187,232,138,130,230,139,141,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,112,114,111,106,101,99,
-116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,161,185,231,155,174,229,136,151,232,161,168,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,230,151,182,233,151,180,232,189,180,228,184,142,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,99,104,111,114,100,98,117,105,108,100,101,114,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,229,146,140,229,188,166,231,188,150,232,175,145,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,
-229,133,179,233,157,153,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,179,231,139,172,229,165,143,34,125,44,123,34,110,
-97,109,101,34,58,34,116,111,103,103,108,101,58,58,115,99,97,108,101,115,104,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,179,233,159,179,233,152,182,233,171,152,228,186,174,34,125,44,123,34,110,97,109,101,34,58,
-34,116,111,103,103,108,101,58,58,110,111,116,101,103,117,105,100,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,179,230,152,190,231,164,186,233,159,179,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,116,
-111,103,103,108,101,58,58,108,111,111,112,115,101,108,101,99,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,179,229,190,170,231,142,175,230,137,128,233,128,137,230,174,181,232,144,189,34,125,44,123,34,
-110,97,109,101,34,58,34,99,104,111,114,100,58,58,115,117,103,103,101,115,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,187,186,232,174,174,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,99,111,109,
-112,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,229,188,166,231,148,159,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,176,131,230,128,167,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,228,184,187,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,138,228,184,
-187,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,173,233,159,179,34,125,44,123,34,110,
-97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,229,177,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,
-111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,177,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,
-100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,228,184,173,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,
-99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,228,184,187,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,233,159,179,233,162,145,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,
-190,229,164,135,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,169,177,229,138,168,34,125,44,123,34,110,97,
-109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,135,230,160,183,231,142,135,34,125,44,123,34,110,97,109,101,34,58,
-34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,147,229,173,152,229,164,167,229,176,143,34,125,44,123,34,110,97,109,101,34,58,
-34,115,101,116,116,105,110,103,115,58,58,109,105,100,105,58,58,114,101,99,111,114,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,229,189,149,229,133,165,232,174,190,229,164,135,34,125,44,123,34,110,97,109,101,34,58,34,
-115,101,116,116,105,110,103,115,58,58,109,105,100,105,58,58,110,111,100,101,118,105,99,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,156,170,229,143,145,231,142,176,232,190,147,229,133,165,232,174,190,229,164,135,34,125,44,123,
-34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,156,128,232,166,129,233,135,141,230,150,176,229,144,175,229,138,168,34,125,44,123,34,110,97,109,
-101,34,58,34,115,101,116,116,105,110,103,115,58,58,115,121,110,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,156,128,232,166,129,229,144,140,230,173,165,231,154,132,232,174,190,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,
-115,101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,148,168,230,136,183,231,149,140,233,157,162,228,184,187,233,162,152,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,
-58,58,117,105,58,58,102,111,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,173,151,228,189,147,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,110,97,116,105,118,101,98,97,114,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,229,142,159,231,148,159,230,160,135,233,162,152,230,160,143,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,
-58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,184,174,229,138,169,230,148,185,232,191,155,72,101,108,105,111,231,154,132,231,191,187,232,175,145,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,
-115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,148,168,230,136,183,231,149,140,233,157,162,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,
-103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,233,187,152,232,174,164,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,
-101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,79,112,101,110,71,76,230,184,178,230,159,147,229,153,
-168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,
-67,111,114,101,71,114,97,112,104,105,99,115,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,68,105,114,101,99,116,50,68,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,
-105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,230,156,172,229,156,176,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,
-58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,230,184,178,230,159,147,229,153,168,230,184,178,230,159,147,229,164,167,229,158,139,229,183,165,231,168,139,231,155,184,229,175,185,232,190,
-131,229,191,171,239,188,140,228,189,134,230,152,175,230,160,185,230,141,174,228,184,141,229,144,140,231,161,172,228,187,182,229,143,175,232,131,189,228,188,154,230,156,137,228,184,141,231,168,179,229,174,154,231,142,176,232,177,161,227,128,130,230,152,
-175,229,144,166,229,136,135,230,141,162,229,136,176,79,112,101,110,71,76,230,184,178,230,159,147,229,153,168,239,188,159,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,190,147,229,133,165,230,143,144,228,186,164,228,191,161,230,129,175,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,
-58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,144,228,186,164,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,161,174,232,174,164,233,135,141,231,189,174,229,183,178,233,128,137,229,143,152,230,155,180,239,188,159,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,
-58,114,101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,
-116,58,58,119,97,114,110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,161,185,231,155,174,229,140,133,229,144,171,230,156,170,230,143,144,228,186,164,231,154,132,229,143,152,230,155,180,239,188,129,34,125,44,123,34,110,
-97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,163,128,229,135,186,231,137,136,230,156,172,34,125,44,123,
-34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,144,156,231,180,162,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,
-101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,167,187,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,229,174,158,228,190,139,229,140,150,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,229,183,178,230,183,187,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,
-183,178,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,229,143,152,230,
-155,180,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,229,143,152,230,155,180,
-229,185,182,228,191,157,229,173,152,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,
-229,143,152,230,155,180,229,185,182,233,135,141,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,230,154,130,229,173,152,229,140,186,233,157,158,231,169,186,239,188,140,228,184,141,229,133,129,232,174,184,229,143,141,232,189,172,232,180,174,232,151,143,231,154,132,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,
-58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,161,185,231,155,174,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,
-58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,230,160,145,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,230,156,172,229,156,176,229,142,134,229,143,178,229,183,178,229,144,140,230,173,165,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,229,183,178,229,174,140,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,
-183,165,231,168,139,230,151,182,233,151,180,231,186,191,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,
-165,231,168,139,228,191,161,230,129,175,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,34,125,44,123,34,110,97,109,
-101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,115,117,112,112,111,114,116,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,230,148,175,230,140,129,230,173,164,233,161,185,231,155,174,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,110,101,116,119,111,114,107,101,114,114,111,114,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,231,189,145,231,187,156,233,148,153,232,175,175,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,152,168,229,164,
-169,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,150,176,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,97,108,
-105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,229,136,157,229,167,139,229,140,150,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,232,174,184,229,143,175,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,135,233,162,152,
-229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,156,232,128,133,229,143,152,230,155,180,34,125,44,123,34,110,97,109,
-101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,143,232,191,176,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,
-32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,162,156,232,137,178,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,231,169,186,229,186,143,229,136,151,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,169,186,230,160,183,
-230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,185,144,229,153,168,229,143,152,230,155,180,34,125,44,123,34,110,
-97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,142,167,229,136,182,229,153,168,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,73,
-111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,136,177,229,165,165,229,176,188,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,228,188,138,229,165,165,229,176,188,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,149,229,186,149,228,
-186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,183,229,144,136,229,144,149,229,186,149,228,186,154,232,176,131,229,188,
-143,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,154,229,136,169,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,
-97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,151,233,135,140,229,144,137,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,230,180,155,229,133,139,229,136,169,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,151,139,229,190,
-139,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,151,139,229,190,139,229,176,143,232,176,131,34,125,44,123,34,110,97,109,
-101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,229,163,176,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,
-110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,229,163,176,229,176,143,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,229,140,136,231,137,153,229,136,169,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,140,136,
-231,137,153,229,136,169,229,176,143,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,130,163,228,184,141,229,139,146,230,150,
-175,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,130,163,228,184,141,229,139,146,230,150,175,229,176,143,232,
-176,131,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,189,151,233,169,172,229,176,188,228,186,154,229,164,167,232,176,131,34,125,44,123,34,110,
-97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,189,151,233,169,172,229,176,188,228,186,154,229,176,143,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,66,108,
-117,101,115,32,72,101,112,116,97,116,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,131,229,163,176,229,184,131,233,178,129,230,150,175,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,
-103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,151,233,135,140,229,144,137,228,186,154,229,184,131,233,178,129,230,150,175,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,183,229,144,136,229,184,131,233,178,129,230,150,175,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,228,184,187,233,159,179,229,184,131,233,178,129,230,150,175,34,125,44,123,34,110,97,109,101,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,145,135,230,187,154,
-34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,159,179,233,162,145,232,190,147,229,133,165,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,
-32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,159,179,233,162,145,232,190,147,229,135,186,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,77,73,68,73,232,190,147,229,133,165,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,232,190,147,229,135,186,34,125,93,44,34,
-112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,
-125,228,184,170,232,190,147,229,133,165,233,128,154,233,129,147,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,232,190,147,229,135,186,233,128,154,233,129,147,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,
-97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,233,159,179,231,172,166,34,44,34,112,108,117,
-114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,
-153,164,228,186,134,123,120,125,228,184,170,233,159,179,231,172,166,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,233,159,179,231,172,166,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,
-34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,228,186,139,228,187,182,34,44,34,
-112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,
-34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,228,186,139,228,187,182,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,
-116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,228,186,139,228,187,182,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,
-44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,231,137,135,
-230,174,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,
-109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,231,137,135,230,174,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,
-108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,231,137,135,230,174,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
-125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,
-125,228,184,170,230,179,168,233,135,138,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,230,179,168,233,135,138,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,
-58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,230,179,168,
-233,135,138,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,230,139,141,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,
-118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,230,139,141,229,
-143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,230,139,141,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,
-100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,232,176,131,229,143,183,34,
-44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,232,176,131,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,
-32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,232,176,131,229,143,183,34,44,
-34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,233,159,
-179,231,172,166,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,
-120,125,228,184,170,228,186,139,228,187,182,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,230,179,168,233,135,138,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,
-117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,230,139,141,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,
-58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,232,176,131,229,143,183,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,231,137,135,230,174,181,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,230,160,
-183,229,188,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,
-120,125,229,177,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,
-101,34,58,34,123,120,125,228,184,170,231,137,136,230,156,172,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,229,183,174,229,188,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,229,136,134,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,231,167,146,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,
-120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,228,187,142,123,120,125,228,184,173,231,167,187,233,153,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,
-100,34,58,34,106,97,34,44,34,110,97,109,101,34,58,34,230,151,165,230,156,172,232,170,158,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,34,49,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,
-97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,233,150,
-139,229,167,139,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,232,166,143,227,131,151,
-227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,
-150,176,232,166,143,227,131,172,227,130,164,227,131,164,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,227,131,134,227,131,179,227,131,157,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,185,227,130,191,227,130,184,227,130,170,34,125,44,123,
-34,110,97,109,101,34,58,34,116,114,101,101,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,
-116,105,110,103,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,168,173,229,174,154,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,
-227,131,188,227,130,184,227,131,167,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,145,227,130,191,227,131,188,227,131,179,
-34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,
-168,229,144,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,
-144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,
-137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,
-130,183,227,131,167,227,131,179,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,227,131,134,227,130,173,227,130,185,227,131,136,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,
-116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,227,130,146,231,183,168,233,155,
-134,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,139,141,229,173,144,227,130,146,229,164,
-137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,227,130,146,232,191,
-189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-230,139,141,229,173,144,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,230,150,176,227,129,151,227,129,132,229,176,143,231,175,128,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,170,191,229,143,183,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,
-116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,232,170,191,229,143,183,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,
-111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,170,191,229,143,183,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,
-97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,173,227,131,188,227,129,168,233,159,179,233,154,142,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,
-108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,172,227,130,164,227,131,164,227,131,188,227,129,174,229,144,141,229,137,141,227,130,146,229,
-164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,141,229,137,141,227,
-130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,172,227,130,164,227,
-131,164,227,131,188,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,
-227,131,171,227,131,154,227,130,184,227,130,168,227,131,188,227,130,191,227,131,188,227,130,146,228,189,156,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,112,114,111,99,101,101,100,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,156,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,92,110,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,230,176,184,228,185,133,227,129,171,229,137,138,233,153,164,227,129,151,227,129,190,227,129,153,227,129,139,239,188,136,
-227,130,132,227,130,138,231,155,180,227,129,151,227,129,167,227,129,141,227,129,190,227,129,155,227,130,147,239,188,137,239,188,159,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,
-58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,227,129,153,227,130,139,227,129,159,227,130,129,227,129,171,227,129,175,227,131,151,227,131,173,227,130,
-184,227,130,167,227,130,175,227,131,136,229,144,141,227,130,146,229,133,165,229,138,155,227,129,151,227,129,166,227,129,143,227,129,160,227,129,149,227,129,132,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,117,116,
-104,58,58,103,105,116,104,117,98,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,105,116,72,117,98,227,129,167,227,131,173,227,130,176,227,130,164,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,
-109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,173,227,131,163,227,131,179,227,130,187,227,131,171,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,
-110,58,58,97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,129,169,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,
-138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,173,227,131,163,227,131,179,227,130,187,227,131,171,34,125,44,123,34,110,97,109,101,34,58,
-34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,145,227,130,191,227,131,188,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,
-109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,137,230,155,180,227,130,146,227,131,129,227,130,167,227,131,131,227,130,
-175,227,130,162,227,130,166,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,183,
-168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,228,184,138,227,129,171,232,187,162,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,227,129,171,232,187,162,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,233,135,141,232,164,135,227,130,146,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,
-101,58,58,99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,141,229,137,141,227,129,140,228,184,128,232,135,180,227,129,151,227,129,190,227,129,155,227,130,147,34,125,44,123,34,110,97,109,101,34,58,34,
-109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,233,150,137,227,129,152,227,
-130,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,
-34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,172,227,130,164,227,131,164,227,131,188,227,130,146,232,191,189,229,138,160,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,170,227,131,188,227,131,136,227,131,161,227,131,188,
-227,130,183,227,131,167,227,131,179,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,227,131,161,227,130,164,227,131,179,227,131,134,227,131,179,227,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,77,73,68,73,227,130,146,229,143,150,227,130,138,232,190,188,227,129,191,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,70,76,65,67,227,129,171,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,111,103,103,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,79,71,71,227,129,171,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,118,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,65,86,227,129,171,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,
-58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,227,129,171,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,
-101,110,100,101,114,58,58,115,97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,
-102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,149,227,130,161,227,130,175,227,130,191,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,
-115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,138,227,129,171,232,187,162,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,
-115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,227,129,171,232,187,162,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,
-100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,172,227,131,179,227,130,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,
-58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,183,168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,
-116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,188,227,130,184,227,131,167,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,
-97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,
-115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,129,174,229,144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,130,146,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,
-34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,169,227,130,176,227,130,164,227,131,179,227,131,170,227,130,185,227,
-131,136,227,130,146,229,134,141,232,170,173,232,190,188,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,227,131,135,227,130,163,227,131,172,227,130,175,227,131,136,227,131,170,227,130,146,227,130,185,227,130,173,227,131,163,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,
-115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,229,133,168,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,229,144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,232,164,135,232,163,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,172,227,130,164,227,131,164,227,131,188,227,
-130,146,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-230,150,176,232,166,143,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,233,150,139,229,167,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,
-58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,233,150,139,227,129,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
-58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,146,227,131,159,227,131,165,227,131,188,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,227,129,174,227,131,159,227,131,165,227,131,188,227,131,136,227,130,146,232,167,163,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,230,136,187,227,130,139,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,191,227,130,164,227,131,136,
-227,131,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,156,232,128,133,34,125,44,123,34,110,97,109,101,34,58,
-34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,169,179,231,180,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,
-114,111,106,101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,169,227,130,164,227,130,187,227,131,179,227,130,185,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,
-106,101,99,116,58,58,100,117,114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,149,183,227,129,149,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,
-100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,150,139,229,167,139,230,151,165,230,153,130,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,
-115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,188,227,130,184,227,131,167,227,131,179,227,130,179,227,131,179,227,131,136,227,131,173,227,131,188,227,131,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,
-58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,134,133,229,174,185,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,
-101,99,116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,149,227,130,161,227,130,164,227,131,171,227,129,174,229,160,180,230,137,128,34,125,44,123,34,110,97,109,101,34,58,34,112,
-97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,175,227,131,170,227,131,131,227,130,175,227,129,
-151,227,129,166,231,183,168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,227,130,191,227,131,131,227,131,151,227,129,151,227,129,166,231,183,168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,97,117,116,104,
-111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,140,191,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,108,105,99,101,110,115,101,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,112,121,114,105,103,104,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,92,110,227,130,185,227,130,173,227,131,163,227,131,179,227,129,153,227,130,139,227,131,149,227,130,169,227,131,171,227,131,128,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,232,166,143,227,131,151,227,131,173,
-227,130,184,227,130,167,227,130,175,227,131,136,228,189,156,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,228,191,157,229,173,152,227,129,153,227,130,139,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,
-112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,130,175,227,130,185,227,131,157,227,131,188,227,131,136,227,129,153,227,130,139,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,
-158,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,130,175,227,130,185,
-227,131,157,227,131,188,227,131,136,229,174,140,228,186,134,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,232,170,173,227,129,191,232,190,188,227,130,128,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,
-112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,227,130,138,232,190,188,227,130,128,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,100,
-105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,129,141,229,135,186,227,129,151,229,133,136,239,188,154,34,125,44,123,34,110,97,109,101,34,58,
-34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
-111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,129,141,229,135,186,227,129,151,228,184,173,230,173,162,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
-111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,129,141,229,135,186,227,129,153,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,
-233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,185,233,159,179,34,125,44,123,34,110,97,
-109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,136,227,131,139,227,131,131,227,130,175,34,125,44,123,34,110,97,109,101,34,
-58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,185,227,131,188,227,131,145,227,131,188,227,131,136,227,131,139,227,131,131,227,130,175,
-34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,161,227,131,135,227,130,163,227,130,162,227,131,179,
-227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,181,227,131,150,227,131,137,227,131,159,
-227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,137,227,131,159,
-227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,181,227,131,150,
-227,131,161,227,131,135,227,130,163,227,130,162,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,227,130,181,227,131,150,227,131,136,227,131,139,227,131,131,227,130,175,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,
-170,227,131,188,227,131,135,227,130,163,227,130,170,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,135,
-227,131,144,227,130,164,227,130,185,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,137,227,131,169,227,
-130,164,227,131,144,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,181,227,131,179,227,
-131,151,227,131,170,227,131,179,227,130,176,229,145,168,230,179,162,230,149,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,227,131,144,227,131,131,227,131,149,227,130,161,227,130,181,227,130,164,227,130,186,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,85,73,227,131,134,227,131,188,227,131,158,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,101,
-108,105,111,227,130,146,231,191,187,232,168,179,227,129,153,227,130,139,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,227,
-131,172,227,131,179,227,131,128,227,131,169,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,
-131,135,227,131,149,227,130,169,227,131,171,227,131,136,227,131,172,227,131,179,227,131,128,227,131,169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,
-58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,227,131,172,227,131,179,227,131,128,227,131,169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,
-105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,114,101,71,114,97,112,104,105,99,115,227,131,172,227,131,179,227,131,128,227,131,
-169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,
-105,114,101,99,116,50,68,227,131,172,227,131,179,227,131,128,227,131,169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,141,227,130,164,227,131,134,227,130,163,227,131,150,227,131,172,227,131,179,227,131,128,227,131,169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,227,131,172,227,131,179,227,131,128,227,131,169,227,129,175,228,184,128,232,136,172,231,154,
-132,227,129,171,229,183,168,229,164,167,227,129,170,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,233,171,152,233,128,159,227,129,171,230,137,177,227,129,136,227,129,190,227,129,153,227,129,140,227,128,129,227,131,
-143,227,131,188,227,131,137,227,130,166,227,130,167,227,130,162,227,129,171,227,130,136,227,129,163,227,129,166,227,129,175,228,184,141,229,174,137,229,174,154,227,129,171,227,129,170,227,130,139,229,143,175,232,131,189,230,128,167,227,129,140,227,129,
-130,227,130,138,227,129,190,227,129,153,227,128,130,79,112,101,110,71,76,227,129,171,229,164,137,230,155,180,227,129,151,227,129,190,227,129,153,227,129,139,239,188,159,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,
-110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,
-111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,179,227,131,159,227,131,131,227,131,136,227,131,161,227,131,131,227,130,187,227,131,188,227,130,184,239,188,154,34,125,44,123,34,110,
-97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,179,227,131,159,227,131,131,227,131,136,34,125,44,123,34,110,
-97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,129,184,230,138,158,227,129,151,227,129,159,229,164,137,230,155,180,
-227,130,146,227,131,170,227,130,187,227,131,131,227,131,136,227,129,151,227,129,190,227,129,153,227,129,139,239,188,159,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,114,111,99,101,
-101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,130,187,227,131,131,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,119,97,114,
-110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,179,227,131,159,227,131,131,227,131,136,227,129,149,227,130,140,227,129,166,227,129,132,227,129,170,227,129,132,229,164,137,230,155,180,227,129,140,227,129,130,227,130,
-138,227,129,190,227,129,153,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-229,164,137,230,155,180,227,130,146,227,131,129,227,130,167,227,131,131,227,130,175,227,130,162,227,130,166,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,230,164,156,231,180,162,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,
-138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,174,159,228,189,147,229,140,150,34,125,44,123,34,110,97,109,101,
-34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,125,44,123,34,110,97,109,
-101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,125,44,123,
-34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,
-125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,227,129,153,227,130,139,229,164,137,
-230,155,180,227,130,146,233,129,184,230,138,158,227,129,151,227,129,166,227,129,143,227,129,160,227,129,149,227,129,132,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,
-115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,130,187,227,131,131,227,131,136,227,129,153,227,130,139,229,164,137,230,155,180,227,130,146,233,129,184,230,138,158,227,129,151,227,129,166,227,129,143,227,129,160,
-227,129,149,227,129,132,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,185,227,131,
-134,227,131,188,227,130,184,227,129,140,231,169,186,227,129,167,227,129,170,227,129,132,227,129,159,227,130,129,227,130,185,227,130,191,227,131,131,227,130,183,227,131,165,227,129,149,227,130,140,227,129,159,229,164,137,230,155,180,227,130,146,230,136,
-187,227,129,153,227,129,147,227,129,168,227,129,140,227,129,167,227,129,141,227,129,190,227,129,155,227,130,147,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,129,174,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,
-116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,137,230,155,180,227,131,132,227,131,170,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,177,165,230,173,180,227,129,175,230,156,128,230,150,176,227,129,167,227,129,153,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,174,140,228,186,134,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,191,227,130,164,227,131,160,227,131,169,227,130,164,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,
-99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,230,131,133,229,160,177,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,
-101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,188,227,130,184,227,131,167,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,227,129,168,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,152,168,230,151,165,34,125,44,123,34,
-110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,131,227,131,151,227,131,135,227,131,188,227,131,136,34,125,44,123,34,110,97,109,101,34,58,
-34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,157,230,156,159,229,140,150,227,130,146,229,174,159,232,161,140,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,
-104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,169,227,130,164,227,130,187,227,131,179,227,130,185,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,
-97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,191,227,130,164,227,131,136,227,131,171,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,
-100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,156,232,128,133,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,232,169,179,231,180,176,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,232,137,178,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,169,186,227,129,174,227,131,172,227,130,
-164,227,131,164,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,169,186,227,129,174,227,131,145,227,130,191,227,131,188,227,131,179,
-34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,
-97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,179,227,131,179,227,131,136,227,131,173,227,131,188,227,131,169,227,130,146,229,164,137,230,155,
-180,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,130,164,227,130,170,227,131,139,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,
-108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,130,170,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,159,227,130,175,227,130,189,227,131,170,
-227,131,135,227,130,163,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,137,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,
-34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,149,227,131,170,227,130,174,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,161,
-227,131,173,227,131,135,227,130,163,227,131,131,227,130,175,227,131,161,227,130,184,227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,227,131,161,227,131,173,227,131,135,227,130,163,227,131,131,227,130,175,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,227,131,143,227,131,188,227,131,162,227,131,139,227,131,131,227,130,175,227,131,161,227,130,184,227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,143,227,131,188,227,131,162,227,131,139,227,131,131,227,130,175,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,
-106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,143,227,131,179,227,130,172,227,131,170,227,130,162,227,131,179,227,131,161,227,130,184,227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,
-114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,143,227,131,179,227,130,172,227,131,170,227,130,162,227,131,179,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,
-58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,141,227,130,162,227,131,157,227,131,170,227,130,191,227,131,179,227,131,161,227,130,184,227,131,163,227,131,188,34,125,
-44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,141,227,130,162,227,131,157,227,131,170,227,130,191,227,131,179,227,131,158,227,130,164,227,
-131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,173,227,131,158,227,131,139,227,130,162,227,131,179,227,131,161,227,130,
-184,227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,173,227,131,158,227,131,139,227,130,162,227,131,179,227,131,158,
-227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,131,139,227,130,176,227,131,158,227,131,134,227,130,163,227,131,
-131,227,130,175,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,131,139,227,130,176,227,131,158,227,131,134,227,130,163,227,131,
-131,227,130,175,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,130,164,227,
-130,170,227,131,139,227,130,162,227,131,179,227,130,170,227,131,188,227,130,176,227,131,161,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,227,130,170,227,131,188,227,130,176,227,131,161,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,
-105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,227,131,135,227,130,163,227,131,159,227,131,139,227,131,131,227,130,183,227,131,165,34,125,44,
-123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,159,227,130,175,227,130,189,227,131,170,227,131,135,227,130,163,227,130,162,
-227,131,179,227,130,170,227,131,188,227,130,176,227,131,161,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,
-131,149,227,131,170,227,130,174,227,130,162,227,131,179,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,112,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,227,130,166,227,131,171,227,131,136,227,131,169,227,131,149,227,131,170,227,130,174,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,227,130,185,227,131,188,227,131,145,227,131,188,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,227,130,166,227,131,171,227,131,136,227,131,169,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,227,130,170,227,131,188,227,131,135,227,130,163,227,130,170,229,133,165,229,138,155,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,227,130,170,227,131,188,227,131,135,227,130,163,227,130,170,229,135,186,229,138,155,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,
-73,229,133,165,229,138,155,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,229,135,186,229,138,155,34,125,93,44,34,112,108,117,114,97,108,76,105,
-116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,229,133,165,229,138,
-155,227,131,129,227,131,163,227,131,179,227,131,141,227,131,171,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,229,135,186,229,138,155,227,131,129,227,131,163,227,131,179,227,131,141,227,131,171,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,
-34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,142,227,131,188,227,131,136,32,123,120,125,32,227,130,146,232,191,189,
-229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,142,227,131,188,227,131,136,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,
-34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,142,227,131,188,227,131,136,32,123,
-120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,
-116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,164,227,131,153,227,131,179,227,131,136,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,
-34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,
-58,34,227,130,164,227,131,153,227,131,179,227,131,136,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,
-34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,164,227,131,153,227,131,179,227,131,136,32,123,120,125,32,227,130,146,229,164,
-137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,227,131,151,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,
-109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,
-227,131,151,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,
-120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,227,131,151,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,
-151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,123,34,110,97,109,101,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,
-108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,
-227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,
-125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,162,227,131,142,227,131,134,227,
-131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,
-97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,32,123,120,125,32,227,
-130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,
-105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,
-129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,232,170,
-191,229,143,183,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,
-32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,232,170,191,229,143,183,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,
-227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,232,170,191,229,143,183,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,227,128,130,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,142,227,131,188,227,131,136,32,123,120,125,227,129,164,
-34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,164,227,131,
-153,227,131,179,227,131,136,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,
-109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,32,123,120,125,227,129,164,
+209,130,208,176,209,128,209,130,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,208,181,208,189,208,180,208,181,
+209,128,208,184,209,130,209,140,32,208,186,208,176,208,182,208,180,209,139,208,185,32,208,184,208,189,209,129,209,130,209,128,209,131,208,188,208,181,208,189,209,130,32,208,190,209,130,208,180,208,181,208,187,209,140,208,189,208,190,34,125,44,123,34,
+110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,158,209,129,209,130,208,176,208,189,208,190,208,178,208,184,209,130,209,140,32,209,128,
+208,181,208,189,208,180,208,181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,
+139,208,177,208,181,209,128,208,184,209,130,208,181,32,209,132,208,176,208,185,208,187,32,208,180,208,187,209,143,32,209,128,208,181,208,189,208,180,208,181,209,128,208,176,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,112,
+114,111,106,101,99,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,209,128,208,190,208,181,208,186,209,130,209,139,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,116,105,109,101,108,105,110,101,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,162,209,128,208,181,208,186,208,184,32,208,184,32,208,188,208,181,209,130,208,186,208,184,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,99,104,111,114,100,98,117,
+105,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,177,208,190,209,128,208,186,208,176,32,208,176,208,186,208,186,208,190,209,128,208,180,208,190,208,178,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,
+111,108,101,58,58,109,111,118,101,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,208,181,209,128,208,181,208,188,208,181,209,129,209,130,208,184,209,130,209,140,32,208,189,208,190,209,130,209,139,34,125,44,123,
+34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,115,117,103,103,101,115,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,209,128,208,181,208,180,208,187,208,190,208,182,208,181,208,189,208,184,208,181,34,125,44,
+123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,99,111,109,112,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,177,208,176,208,178,208,184,209,130,209,140,32,208,176,208,186,208,186,208,190,209,128,
+208,180,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,162,208,190,208,189,208,176,208,187,209,140,208,189,208,190,
+209,129,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,162,208,190,208,189,208,184,208,
+186,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,184,209,129,209,133,208,190,208,180,
+209,143,209,137,208,184,208,185,32,208,178,208,178,208,190,208,180,208,189,209,139,208,185,32,209,130,208,190,208,189,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,156,208,181,208,180,208,184,208,176,208,189,209,130,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,
+58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,209,131,208,177,208,180,208,190,208,188,208,184,208,189,208,176,208,189,209,130,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,
+58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,188,208,184,208,189,208,176,208,189,209,130,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,
+114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,209,131,208,177,208,188,208,181,208,180,208,184,208,176,208,189,209,130,208,176,34,125,44,123,34,110,97,109,101,34,58,34,112,111,
+112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,208,190,209,129,209,133,208,190,208,180,209,143,209,137,208,184,208,185,32,208,178,208,178,208,190,
+208,180,208,189,209,139,208,185,32,209,130,208,190,208,189,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,144,209,131,208,180,208,184,208,
+190,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,163,209,129,209,130,209,128,208,190,208,185,209,129,209,
+130,208,178,208,190,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,209,128,208,176,208,185,208,178,208,
+181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,167,208,176,209,129,209,130,208,
+190,209,130,208,176,32,208,180,208,184,209,129,208,186,209,128,208,181,209,130,208,184,208,183,208,176,209,134,208,184,208,184,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,
+114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,208,176,208,183,208,188,208,181,209,128,32,208,177,209,131,209,132,208,181,209,128,208,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,
+58,58,109,105,100,105,58,58,114,101,99,111,114,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,151,208,176,208,191,208,184,209,129,209,140,32,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,
+58,109,105,100,105,58,58,110,111,100,101,118,105,99,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,32,208,178,208,184,208,182,209,131,32,77,73,68,73,32,209,131,209,129,209,130,209,128,208,190,208,185,209,129,209,130,
+208,178,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,162,209,128,208,181,208,177,209,131,208,181,209,130,209,129,209,143,32,208,
+191,208,181,209,128,208,181,208,183,208,176,208,191,209,131,209,129,208,186,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,115,121,110,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,184,208,
+189,209,133,209,128,208,190,208,189,208,184,208,183,208,184,209,128,208,190,208,178,208,176,209,130,209,140,32,208,189,208,176,209,129,209,130,209,128,208,190,208,185,208,186,208,184,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,
+115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,166,208,178,208,181,209,130,208,190,208,178,208,176,209,143,32,209,129,209,133,208,181,208,188,208,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,
+103,115,58,58,117,105,58,58,102,111,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,168,209,128,208,184,209,132,209,130,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,110,97,116,105,
+118,101,98,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,209,129,208,191,208,190,208,187,209,140,208,183,208,190,208,178,208,176,209,130,209,140,32,209,129,208,184,209,129,209,130,208,181,208,188,208,189,209,139,208,185,32,
+208,183,208,176,208,179,208,190,208,187,208,190,208,178,208,190,208,186,32,208,190,208,186,208,189,208,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,101,108,112,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,32,208,188,208,190,208,182,208,181,209,130,208,181,32,208,191,208,190,208,188,208,190,209,135,209,140,32,209,129,32,208,191,208,181,209,128,208,181,208,178,208,190,208,180,208,190,208,188,
+34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,208,181,208,189,208,180,208,181,209,128,208,181,209,128,32,208,184,208,
+189,209,130,208,181,209,128,209,132,208,181,208,185,209,129,208,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,208,159,208,190,32,209,131,208,188,208,190,208,187,209,135,208,176,208,189,208,184,209,142,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,105,99,115,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,114,101,71,114,97,112,104,105,99,115,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,105,114,101,99,116,50,68,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,208,157,208,176,209,130,208,184,208,178,208,189,209,139,208,185,32,209,128,208,181,208,189,208,180,208,181,209,128,208,181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,
+58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,45,209,128,208,181,208,189,208,180,208,181,209,128,208,181,209,128,32,208,189,208,176,208,188,208,189,208,190,208,179,208,190,32,208,177,
+209,139,209,129,209,130,209,128,208,181,208,181,32,208,189,208,176,209,130,208,184,208,178,208,189,208,190,208,179,208,190,44,32,208,189,208,190,44,32,208,178,32,208,183,208,176,208,178,208,184,209,129,208,184,208,188,208,190,209,129,209,130,208,184,
+32,208,190,209,130,32,208,178,208,176,209,136,208,181,208,185,32,209,129,208,184,209,129,209,130,208,181,208,188,209,139,44,32,208,188,208,190,208,182,208,181,209,130,32,208,191,209,128,208,184,208,178,208,181,209,129,209,130,208,184,32,208,186,32,208,
+189,208,181,209,129,209,130,208,176,208,177,208,184,208,187,209,140,208,189,208,190,208,185,32,209,128,208,176,208,177,208,190,209,130,208,181,32,208,191,209,128,208,184,208,187,208,190,208,182,208,181,208,189,208,184,209,143,46,32,208,146,208,186,208,
+187,209,142,209,135,208,184,209,130,209,140,32,79,112,101,110,71,76,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,208,146,208,186,208,187,209,142,209,135,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,208,158,208,191,208,184,209,136,208,184,209,130,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,
+109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,190,209,133,209,128,208,176,208,189,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,
+99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,177,209,128,208,190,209,129,208,184,209,130,209,140,32,208,178,209,139,208,177,209,128,208,176,208,189,208,189,209,
+139,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,208,161,208,177,209,128,208,190,209,129,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,119,97,114,110,105,110,
+103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,32,208,191,209,128,208,190,208,181,208,186,209,130,208,181,32,208,181,209,129,209,130,209,140,32,208,189,208,181,209,129,208,190,209,133,209,128,208,176,208,189,208,181,208,189,208,
+189,209,139,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,33,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,208,181,209,128,208,181,208,186,208,187,209,142,209,135,208,184,209,130,209,140,209,129,209,143,32,208,189,208,176,32,209,141,209,130,209,131,32,208,178,208,181,209,128,209,129,208,184,
+209,142,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,209,129,208,186,208,176,209,130,209,140,34,125,44,123,34,110,
+97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,163,208,180,208,176,208,187,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,
+105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,177,208,176,208,178,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,
+101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,45,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,
+58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,163,208,180,208,176,208,187,208,181,208,189,208,190,32,45,34,125,44,123,34,110,97,109,101,34,58,34,118,99,
+115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,45,34,125,44,123,34,110,97,109,101,34,58,
+34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,208,177,208,181,209,128,208,184,209,130,208,181,32,208,184,208,183,208,188,208,
+181,208,189,208,181,208,189,208,184,209,143,44,32,208,186,208,190,209,130,208,190,209,128,209,139,208,181,32,209,133,208,190,209,130,208,184,209,130,208,181,32,209,129,208,190,209,133,209,128,208,176,208,189,208,184,209,130,209,140,46,34,125,44,123,34,
+110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,139,208,177,208,181,209,128,208,184,209,130,208,181,32,208,184,
+208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,44,32,208,186,208,190,209,130,208,190,209,128,209,139,208,181,32,209,133,208,190,209,130,208,184,209,130,208,181,32,208,190,209,130,208,188,208,181,208,189,208,184,209,130,209,140,46,34,
+125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,32,209,131,208,180,208,176,208,187,208,190,
+209,129,209,140,32,208,178,208,181,209,128,208,189,209,131,209,130,209,140,209,129,209,143,32,208,189,208,176,32,208,186,208,190,208,189,209,130,209,128,208,190,208,187,209,140,208,189,209,131,209,142,32,209,130,208,190,209,135,208,186,209,131,32,45,
+32,209,141,209,130,208,190,32,209,129,208,190,209,130,209,128,208,181,209,130,32,209,130,208,181,208,186,209,131,209,137,208,184,208,181,32,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,46,34,125,44,123,34,110,97,109,101,34,
+58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,208,183,208,188,208,181,208,189,208,181,208,189,208,184,209,143,32,208,178,32,208,191,209,128,208,190,208,181,
+208,186,209,130,208,181,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,148,208,181,209,128,208,181,208,178,208,190,
+32,208,184,209,129,209,130,208,190,209,128,208,184,208,184,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,155,208,190,208,186,
+208,176,208,187,209,140,208,189,208,176,209,143,32,208,184,209,129,209,130,208,190,209,128,208,184,209,143,32,208,178,32,208,176,208,186,209,130,209,131,208,176,208,187,209,140,208,189,208,190,208,188,32,209,129,208,190,209,129,209,130,208,190,209,143,
+208,189,208,184,208,184,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,147,208,190,209,130,208,190,208,178,208,190,46,34,125,44,123,34,
+110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,128,208,181,208,188,208,181,208,189,208,189,208,176,209,143,32,209,136,208,186,
+208,176,208,187,208,176,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,208,189,209,132,208,190,209,128,
+208,188,208,176,209,134,208,184,209,143,32,208,190,32,208,191,209,128,208,190,208,181,208,186,209,130,208,181,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,208,178,208,181,209,128,209,129,208,184,209,143,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,184,34,125,44,123,34,110,97,109,101,34,58,
+34,99,111,109,109,111,110,58,58,115,117,112,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,159,208,190,208,180,208,180,208,181,209,128,208,182,208,176,209,130,209,140,32,208,191,209,128,208,190,208,181,208,186,209,130,
+34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,110,101,116,119,111,114,107,101,114,114,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,161,208,181,209,130,208,181,208,178,208,176,209,143,32,208,190,209,136,
+208,184,208,177,208,186,208,176,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,209,135,208,181,209,128,208,176,34,125,44,123,
+34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,158,208,177,208,189,208,190,208,178,208,184,209,130,209,140,34,125,44,123,34,110,97,109,101,34,58,34,105,
+110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,
+110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,176,32,208,187,208,184,209,134,208,181,208,189,208,183,208,184,209,143,34,125,44,123,34,110,97,109,101,34,58,34,116,
+105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,208,189,208,176,208,183,208,178,208,176,208,189,208,184,208,181,34,125,44,123,
+34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,32,208,176,208,178,209,130,208,190,209,
+128,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,208,190,209,129,209,
+140,32,208,190,208,191,208,184,209,129,208,176,208,189,208,184,208,181,34,125,44,123,34,110,97,109,101,34,58,34,116,101,109,112,101,114,97,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,
+208,190,208,188,208,181,208,189,209,143,208,187,208,176,209,129,209,140,32,209,130,208,181,208,188,208,191,208,181,209,128,208,176,209,134,208,184,209,143,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,32,209,134,208,178,208,181,209,130,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,
+101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,209,131,209,129,209,130,208,190,208,185,32,209,129,208,187,208,190,208,185,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,209,131,209,129,209,130,208,190,208,185,32,208,191,208,176,209,130,209,130,208,181,209,128,208,189,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,
+103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,32,208,184,208,189,209,129,209,130,209,128,209,131,208,188,208,181,208,189,209,130,34,125,44,123,34,110,97,
+109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,191,208,190,208,188,208,181,208,189,209,143,208,187,209,129,209,143,32,208,186,208,190,208,189,209,130,
+209,128,208,190,208,187,208,187,208,181,209,128,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,152,208,190,208,189,208,184,208,185,209,129,208,186,208,184,208,185,34,125,
+44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,173,208,190,208,187,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,
+110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,155,208,184,208,180,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,208,156,208,184,208,186,209,129,208,190,208,187,208,184,208,180,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,208,148,208,190,209,128,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,164,209,128,208,184,208,179,208,184,
+208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,155,208,190,208,186,209,128,208,184,208,185,209,129,208,186,208,184,208,185,34,125,
+44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,156,208,181,208,187,208,190,208,180,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,
+176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,156,208,181,208,187,208,190,208,180,208,184,209,135,208,181,209,129,208,
+186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,147,208,176,209,128,208,188,208,
+190,208,189,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,208,147,208,176,209,128,208,188,208,190,208,189,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,
+114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,208,181,208,189,208,179,208,181,209,128,209,129,208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,
+105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,146,208,181,208,189,208,179,208,181,209,128,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,
+58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,208,176,208,191,208,190,208,187,208,184,209,130,208,176,208,189,209,129,208,186,208,184,208,185,32,208,188,208,
+176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,157,208,181,208,176,208,191,208,190,208,187,208,184,209,130,
+208,176,208,189,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,160,
+209,131,208,188,209,139,208,189,209,129,208,186,208,184,208,185,32,208,188,208,176,208,182,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,208,160,209,131,208,188,209,139,208,189,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,208,173,208,189,208,184,208,179,208,188,208,176,209,130,208,184,209,135,208,181,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,208,173,208,189,208,184,208,179,208,188,208,176,209,130,208,184,209,135,208,181,209,129,208,186,208,184,208,185,32,208,188,208,184,208,189,208,190,209,128,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,
+121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,145,208,187,209,142,208,183,208,190,208,178,209,139,208,185,32,209,132,209,128,208,184,208,179,208,184,208,185,209,129,208,186,208,184,208,185,34,125,44,123,34,110,97,
+109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,144,209,131,208,180,208,184,208,190,208,178,209,133,208,190,208,180,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,
+32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,208,144,209,131,208,180,208,184,208,190,208,178,209,139,209,133,208,190,208,180,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,45,208,178,209,133,208,190,208,180,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,
+73,45,208,178,209,139,209,133,208,190,208,180,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,133,208,190,208,180,208,189,208,190,208,185,32,208,186,208,176,208,189,208,176,208,187,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
+97,109,101,34,58,34,123,120,125,32,208,178,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,208,176,208,187,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,
+125,32,208,178,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,208,176,208,187,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,
+116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,139,209,133,208,190,208,180,208,189,208,190,208,185,32,208,186,208,176,208,189,208,
+176,208,187,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,139,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,208,176,208,187,208,176,34,44,34,
+112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,178,209,139,209,133,208,190,208,180,208,189,209,139,209,133,32,208,186,208,176,208,189,208,176,208,187,208,190,208,178,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,
+208,177,208,176,208,178,208,187,208,181,208,189,208,176,32,123,120,125,32,208,189,208,190,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,
+187,208,181,208,189,209,139,32,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,
+32,123,120,125,32,208,189,208,190,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,176,32,123,120,125,32,208,189,208,190,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,
+34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,
+181,208,189,208,190,32,123,120,125,32,208,189,208,190,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,176,32,123,120,125,32,208,189,208,190,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
+125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,
+208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,189,208,190,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,
+101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,
+208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,209,
+143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,185,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,
+109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,209,
+131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,
+208,187,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,
+125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,
+208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,209,143,34,44,
+34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,185,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,208,
+177,208,176,208,178,208,187,208,181,208,189,32,123,120,125,32,208,186,208,187,208,184,208,191,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,
+208,189,209,139,32,123,120,125,32,208,186,208,187,208,184,208,191,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,
+120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,32,123,120,125,32,208,186,208,187,208,184,208,191,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,
+109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,208,184,208,191,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,
+176,208,187,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,
+32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,32,123,120,125,32,208,186,208,187,208,184,208,191,34,44,34,112,108,117,114,97,108,
+70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,208,184,208,191,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,
+125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,
+110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,
+208,189,208,176,32,123,120,125,32,208,188,208,181,209,130,208,186,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,209,139,32,123,
+120,125,32,208,188,208,181,209,130,208,186,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,208,188,208,
+181,209,130,208,190,208,186,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,176,32,123,120,125,32,208,188,208,181,209,130,208,186,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,
+34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,188,208,181,209,130,208,186,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,
+180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,208,188,208,181,209,130,208,190,208,186,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,
+32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,176,32,123,120,125,32,208,188,208,181,209,130,208,186,
+208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,188,208,181,209,130,208,186,208,184,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,188,208,181,209,130,208,190,208,186,34,44,34,112,108,117,114,97,108,70,111,114,109,34,
+58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,
+208,190,208,177,208,176,208,178,208,187,208,181,208,189,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,
+176,208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,
+208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,
+100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,32,123,120,125,32,209,128,208,176,
+208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,
+128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,208,190,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,190,208,178,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
+97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,
+58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,
+34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,
+189,32,123,120,125,32,208,186,208,187,209,142,209,135,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,209,139,32,123,120,125,32,208,186,
+208,187,209,142,209,135,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,180,208,190,208,177,208,176,208,178,208,187,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,209,142,209,
+135,208,181,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,32,123,120,125,32,208,186,208,187,209,142,209,135,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,
+101,34,58,34,209,131,208,180,208,176,208,187,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,209,142,209,135,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,209,131,208,180,208,176,
+208,187,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,209,142,209,135,208,181,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,
+101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,32,123,120,125,32,208,186,208,187,209,142,209,135,34,
+44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,209,139,32,123,120,125,32,208,186,208,187,209,142,209,135,208,176,34,44,34,112,108,117,114,97,108,
+70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,208,184,208,183,208,188,208,181,208,189,208,181,208,189,208,190,32,123,120,125,32,208,186,208,187,209,142,209,135,208,181,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
+34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,189,208,190,209,130,208,176,34,44,34,112,108,117,114,
+97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,189,208,190,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,189,208,190,
+209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,
+125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,209,143,34,44,34,112,108,
+117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,190,208,177,209,139,209,130,208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,
+34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,181,209,130,208,186,208,176,34,44,34,112,108,117,114,97,108,70,111,
+114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,181,209,130,208,186,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,181,209,
+130,208,190,208,186,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,176,208,183,208,188,
+208,181,209,128,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,176,208,183,208,188,208,181,209,128,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,
+34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,
+209,142,209,135,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,209,142,209,135,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,
+97,109,101,34,58,34,123,120,125,32,208,186,208,187,209,142,209,135,208,181,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,208,184,208,191,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,208,184,208,
+191,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,186,208,187,208,184,208,191,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,
+123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,191,208,176,209,130,209,130,208,181,209,128,208,189,34,44,34,112,
+108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,191,208,176,209,130,209,130,208,181,209,128,208,189,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,
+101,34,58,34,123,120,125,32,208,191,208,176,209,130,209,130,208,181,209,128,208,189,208,190,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,187,208,190,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,
+129,208,187,208,190,209,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,187,208,190,209,145,208,178,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,
+125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,181,208,178,208,184,208,183,208,184,209,143,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,128,208,181,208,178,208,184,208,183,208,184,208,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,
+97,109,101,34,58,34,123,120,125,32,209,128,208,181,208,178,208,184,208,183,208,184,208,185,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,180,208,181,208,187,209,140,209,130,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,
+208,180,208,181,208,187,209,140,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,180,208,181,208,187,209,140,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,
+34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,184,208,189,209,131,209,130,208,
+176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,208,188,208,184,208,189,209,131,209,130,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,
+109,101,34,58,34,123,120,125,32,208,188,208,184,208,189,209,131,209,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,181,208,186,209,131,208,189,208,180,208,176,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,
+208,181,208,186,209,131,208,189,208,180,209,139,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,209,129,208,181,208,186,209,131,208,189,208,180,34,44,34,112,108,117,114,97,108,70,111,
+114,109,34,58,34,51,34,125,93,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,208,191,208,181,209,128,208,181,208,184,
+208,188,208,181,208,189,208,190,208,178,208,176,208,189,32,208,184,208,183,32,123,120,125,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,100,34,58,34,101,110,34,44,34,110,97,109,101,34,58,34,69,110,103,
+108,105,115,104,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,34,40,123,120,125,61,61,49,32,63,32,49,32,58,32,50,41,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,
+110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,115,116,97,114,116,101,100,34,125,44,123,34,110,97,109,101,34,58,34,100,101,
+102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,119,32,112,114,111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,
+108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,119,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,
+112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,83,116,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,114,99,104,101,115,116,114,97,32,112,105,116,
+34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,116,105,110,103,115,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,118,
+99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,115,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+80,97,116,116,101,114,110,115,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,107,101,121,77,97,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,101,121,98,111,97,114,100,32,109,97,112,112,105,110,103,34,125,44,123,34,
+110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,32,105,110,115,
+116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,82,101,110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,34,125,
+44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,97,110,110,111,116,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,
+58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,101,114,32,97,110,110,111,116,97,116,105,111,110,32,116,101,120,116,58,34,125,44,123,34,110,
+97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,100,105,116,32,97,110,110,111,116,97,116,105,111,
+110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,116,105,109,101,32,
+115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,
+101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,116,105,109,101,32,115,105,103,110,
+97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,67,104,97,110,103,101,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,101,114,32,110,101,119,32,109,101,116,101,114,58,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,
+103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,
+58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,
+58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,
+105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,107,101,121,32,97,110,100,32,115,99,97,108,101,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
+97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
+111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,
+116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,99,97,112,
+116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,97,114,112,101,103,103,105,97,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,112,114,111,
+99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,32,116,104,101,32,112,114,111,106,101,99,116,32,112,101,114,109,97,110,101,110,116,108,121,32,102,114,111,109,32,116,104,101,32,99,108,111,117,100,32,97,110,100,32,116,
+104,101,32,100,105,115,107,32,40,110,111,32,117,110,100,111,41,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,121,112,101,32,105,110,32,116,104,101,32,112,114,111,106,101,99,116,32,110,97,109,101,32,116,111,32,99,111,110,102,105,114,109,32,114,101,109,111,118,97,108,58,34,125,44,123,34,110,97,109,
+101,34,58,34,100,105,97,108,111,103,58,58,97,117,116,104,58,58,103,105,116,104,117,98,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,103,105,110,32,119,105,116,104,32,71,105,116,72,117,98,34,125,44,123,34,110,97,109,101,34,58,34,100,
+105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,110,99,101,108,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,
+58,97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,112,112,108,121,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,34,125,44,123,
+34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,110,99,101,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,111,112,121,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,67,111,112,121,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,117,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,112,97,115,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,97,115,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+68,101,108,101,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,111,117,112,32,98,121,32,110,97,109,101,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,99,111,108,111,117,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,111,117,112,32,98,121,32,99,111,108,111,117,114,34,125,44,123,34,110,97,109,
+101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,111,117,112,32,98,121,32,105,110,115,116,114,117,109,101,110,116,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,111,32,103,114,111,117,112,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
+110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,101,100,32,112,108,117,103,105,110,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
+110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,
+116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,
+58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,101,100,32,99,104,97,110,103,101,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,
+99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,101,100,32,118,101,114,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,
+111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,
+58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,97,
+108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,110,
+111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,110,111,110,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,115,104,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,67,104,101,99,107,111,117,116,32,114,101,118,105,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,80,117,115,104,32,98,114,97,110,99,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,80,117,108,108,32,98,114,97,110,99,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,110,101,119,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,
+117,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,116,111,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,
+105,110,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,111,118,101,32,102,114,111,109,32,108,105,115,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,
+110,58,58,114,111,117,116,101,58,58,100,105,115,99,111,110,110,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,105,115,99,111,110,110,101,99,116,32,102,114,111,109,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
+110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,111,118,101,32,102,114,111,109,32,105,110,115,116,114,117,109,101,110,116,
+34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,99,101,105,118,101,32,
+97,117,100,105,111,32,102,114,111,109,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,83,101,110,100,32,97,117,100,105,111,32,116,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,109,105,100,105,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,82,101,99,101,105,118,101,32,77,73,68,73,32,102,114,111,109,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,109,105,100,105,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,110,100,32,77,73,68,73,32,116,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,97,114,112,101,103,
+103,105,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,114,112,101,103,103,105,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,114,
+101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,102,97,99,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,114,101,
+115,99,97,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,99,97,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,113,117,97,110,116,
+105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,100,105,118,105,115,
+105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,105,109,101,32,100,105,118,105,115,105,111,110,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,
+115,58,58,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,111,118,101,32,116,111,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,
+115,58,58,116,111,116,114,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,120,116,114,97,99,116,32,97,115,32,110,101,119,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
+105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,100,105,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,
+115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,115,101,32,117,112,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
+105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,115,101,32,100,111,119,110,34,125,44,123,34,110,97,109,101,34,58,
+34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,105,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,100,101,32,99,104,97,110,103,101,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,115,104,111,119,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,116,111,114,101,32,99,104,97,110,103,101,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
+118,99,115,58,58,99,104,97,110,103,101,115,58,58,116,111,103,103,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,99,104,97,110,103,101,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,
+99,115,58,58,99,111,109,109,105,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,114,101,115,101,116,97,108,
+108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,111,112,32,115,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,
+109,101,110,117,58,58,118,99,115,58,58,115,121,110,99,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,121,110,99,32,97,108,108,32,114,101,118,105,115,105,111,110,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
+58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,97,114,112,32,102,114,111,109,32,115,101,108,101,99,116,105,111,110,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,108,101,97,110,117,112,32,111,118,101,114,108,97,112,115,34,125,44,123,
+34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,118,101,114,115,101,32,117,112,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,118,101,114,115,101,32,100,111,119,110,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,114,101,116,114,111,103,114,97,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,116,114,111,103,114,97,100,101,34,125,44,123,
+34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,99,32,105,110,118,101,114,115,105,
+111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,34,125,44,123,34,110,97,109,101,
+34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,50,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,
+117,97,110,116,105,122,101,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,52,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,56,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,56,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,49,54,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,81,117,97,110,116,105,122,101,32,116,111,32,49,47,49,54,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,51,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+81,117,97,110,116,105,122,101,32,116,111,32,49,47,51,50,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,114,103,101,32,116,117,112,108,
+101,116,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
+58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,105,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,52,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,81,117,97,100,114,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,105,110,116,117,112,108,
+101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,120,116,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,116,117,112,108,101,116,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,112,116,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,56,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,79,99,116,117,112,108,101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,57,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,111,110,117,112,108,
+101,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,32,112,114,111,106,101,99,116,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,97,109,101,115,32,100,111,110,39,116,32,
+109,97,116,99,104,33,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,108,111,97,100,32,112,114,111,106,101,99,116,
+34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,
+116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,32,97,117,116,111,109,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,
+101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,115,116,101,114,32,116,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,
+109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,109,112,111,114,116,32,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,
+101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,116,111,32,70,76,65,67,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,111,103,103,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,116,111,32,79,71,71,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,118,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,116,111,32,87,65,86,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,69,120,112,111,114,116,32,116,111,32,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,115,97,118,101,100,116,111,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,83,97,118,101,100,32,116,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+82,101,102,97,99,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,
+112,111,115,101,32,117,112,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,
+110,115,112,111,115,101,32,100,111,119,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,65,114,114,97,110,103,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,100,105,
+116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,115,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,105,110,115,116,114,117,
+109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,32,116,101,109,
+112,101,114,97,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,111,110,118,101,114,116,58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,110,118,
+101,114,116,32,116,111,32,116,101,109,112,101,114,97,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,82,101,110,97,109,101,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,68,101,108,101,116,101,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,101,100,105,116,111,114,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,69,100,105,116,32,114,111,117,116,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,117,105,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,83,104,111,119,32,85,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,101,102,102,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,65,100,100,32,101,102,102,101,99,116,32,110,111,100,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,65,100,100,32,105,110,115,116,114,117,109,101,110,116,32,110,111,100,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,108,111,97,100,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,83,99,97,110,32,99,111,109,109,111,110,32,112,108,117,103,105,110,32,102,111,108,100,101,114,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,
+58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,99,97,110,32,99,117,115,116,111,109,32,112,108,117,103,105,110,32,102,111,108,100,101,114,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,100,100,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,101,100,105,116,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,69,100,105,116,32,107,101,121,98,111,97,114,100,32,109,97,112,112,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,76,111,97,100,32,83,99,97,108,97,32,109,97,112,112,105,110,103,40,115,41,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,82,101,115,101,116,32,107,101,121,98,111,97,114,100,32,109,97,112,112,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,83,101,108,101,99,116,32,97,108,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,83,101,116,32,105,110,115,116,114,117,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,
+110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,117,112,108,105,99,97,116,101,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,108,101,116,101,32,116,114,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,114,116,32,97,32,110,101,119,32,112,114,111,106,101,99,116,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,32,97,32,112,114,111,106,101,99,116,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,117,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,85,110,109,117,116,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,111,108,111,34,125,44,123,34,110,97,109,101,34,
+58,34,109,101,110,117,58,58,117,110,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,115,111,108,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,66,97,99,107,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,105,116,108,101,34,125,44,123,34,110,97,
+109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,116,104,111,114,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,
+106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,115,99,114,105,112,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,
+116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,105,99,101,110,115,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,114,97,116,105,111,110,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,110,103,116,104,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,83,116,97,114,116,101,100,32,97,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,
+114,115,105,111,110,32,99,111,110,116,114,111,108,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,67,111,110,115,105,115,116,115,32,111,102,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,
+105,108,101,32,108,111,99,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,67,108,105,99,107,32,116,111,32,101,100,105,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,109,111,98,105,
+108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,112,32,116,111,32,101,100,105,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,97,117,116,104,
+111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,99,111,103,110,105,116,111,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,108,105,99,101,110,115,
+101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,112,121,114,105,103,104,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,101,109,112,101,114,97,109,101,110,116,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,109,112,101,114,97,109,101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,65,118,97,105,108,97,98,108,101,32,97,117,100,105,111,32,112,108,117,103,105,110,115,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,105,110,115,116,114,117,109,101,110,
+116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,115,32,111,110,32,115,116,97,103,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,118,
+101,110,100,111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,108,117,103,105,110,32,118,101,110,100,111,114,32,97,110,100,32,110,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,
+111,114,99,104,101,115,116,114,97,58,58,99,97,116,101,103,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,116,101,103,111,114,121,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,
+97,58,58,102,111,114,109,97,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,111,114,109,97,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,
+110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,102,111,108,100,101,114,32,116,111,32,115,99,97,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,
+99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,114,101,97,116,101,32,110,101,119,32,112,114,111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,100,
+105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,32,115,97,118,101,34,125,44,123,34,110,97,109,101,34,58,
+34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,32,101,120,112,111,114,116,34,125,44,123,
+34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,120,112,111,114,116,32,100,111,110,101,46,34,125,
+44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,32,108,111,97,100,
+34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,
+32,105,109,112,111,114,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,116,111,58,
+34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,34,125,44,123,34,110,97,109,101,34,58,34,
+100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,32,101,97,99,104,32,105,110,115,116,114,117,109,101,110,116,32,115,101,112,97,114,97,116,
+101,108,121,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,98,111,114,116,32,114,101,110,100,101,114,34,125,44,123,34,
+110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,111,111,115,101,32,97,32,102,105,108,101,32,116,111,32,114,101,
+110,100,101,114,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,101,109,112,111,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,32,116,101,109,112,111,44,32,66,80,77,58,
+34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,101,109,112,111,58,58,116,97,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,112,32,116,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,111,110,101,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,32,111,110,101,32,116,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,112,114,111,106,101,99,116,
+115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,115,32,108,105,115,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,84,105,109,101,108,105,110,101,32,97,110,100,32,116,114,97,99,107,115,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,99,104,111,114,100,98,117,105,108,100,101,114,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,67,104,111,114,100,32,99,111,109,112,105,108,101,114,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,109,111,118,101,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+77,111,118,101,32,110,111,116,101,115,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,109,117,116,101,34,125,44,123,34,110,97,
+109,101,34,58,34,116,111,103,103,108,101,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,115,111,108,111,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,115,99,97,108,
+101,115,104,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,115,99,97,108,101,115,32,104,105,103,104,108,105,103,104,116,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,110,
+111,116,101,103,117,105,100,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,115,104,111,119,32,110,111,116,101,32,110,97,109,101,115,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,
+108,111,111,112,115,101,108,101,99,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,103,103,108,101,32,108,111,111,112,32,111,118,101,114,32,115,101,108,101,99,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,
+99,104,111,114,100,58,58,115,117,103,103,101,115,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,103,103,101,115,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,99,111,109,112,105,108,
+101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,110,101,114,97,116,101,32,99,104,111,114,100,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,82,111,111,116,32,107,101,121,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,84,111,110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,101,114,116,111,
+110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,100,105,97,110,116,34,125,44,123,34,110,
+97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,100,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,
+34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,
+99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,109,101,100,105,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,
+58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,116,111,110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,
+118,105,99,101,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,114,105,118,101,114,34,125,44,123,34,110,97,
+109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,97,109,112,108,101,32,114,97,116,101,34,125,44,123,34,110,97,109,101,
+34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,117,102,102,101,114,32,115,105,122,101,34,125,44,123,34,110,97,109,101,34,58,
+34,115,101,116,116,105,110,103,115,58,58,109,105,100,105,58,58,114,101,99,111,114,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,99,111,114,100,32,77,73,68,73,32,102,114,111,109,34,125,44,123,34,110,97,109,101,34,58,34,115,101,
+116,116,105,110,103,115,58,58,109,105,100,105,58,58,110,111,100,101,118,105,99,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,111,32,105,110,112,117,116,32,100,101,118,105,99,101,115,32,102,111,117,110,100,34,125,44,123,34,110,
+97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,116,97,114,116,32,114,101,113,117,105,114,101,100,34,125,44,123,34,110,97,109,101,34,58,34,115,
+101,116,116,105,110,103,115,58,58,115,121,110,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,116,116,105,110,103,115,32,116,111,32,98,101,32,115,121,110,99,101,100,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,
+103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,32,116,104,101,109,101,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,102,111,110,116,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,70,111,110,116,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,110,97,116,105,118,101,98,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,110,97,
+116,105,118,101,32,116,105,116,108,101,32,98,97,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,101,
+108,112,32,105,109,112,114,111,118,105,110,103,32,72,101,108,105,111,32,116,114,97,110,115,108,97,116,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,85,73,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,85,115,101,32,100,101,102,97,117,108,116,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,79,112,101,110,71,76,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,
+103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,67,111,114,101,71,114,97,112,104,105,99,115,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,
+115,58,58,114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,68,105,114,101,99,116,50,68,32,114,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,
+58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,110,97,116,105,118,101,32,114,101,110,100,101,114,101,114,34,125,44,123,
+34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,114,101,110,100,101,114,101,114,32,105,115,32,117,115,
+117,97,108,108,121,32,109,117,99,104,32,102,97,115,116,101,114,32,102,111,114,32,108,97,114,103,101,32,112,114,111,106,101,99,116,115,44,32,98,117,116,32,105,116,32,97,108,115,111,32,109,97,121,32,98,101,32,117,110,115,116,97,98,108,101,32,100,101,112,
+101,110,100,105,110,103,32,111,110,32,121,111,117,114,32,104,97,114,100,119,97,114,101,46,32,83,119,105,116,99,104,32,116,111,32,79,112,101,110,71,76,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,
+58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,115,101,32,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,
+116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,101,114,32,99,111,109,109,105,116,32,109,101,115,115,97,103,101,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,
+109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,
+116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,32,115,101,108,101,99,116,101,100,32,99,104,97,110,103,101,115,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,
+101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,115,101,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,
+119,97,114,110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,99,111,110,116,97,105,110,115,32,117,110,99,111,109,109,105,116,116,101,100,32,99,104,97,110,103,101,115,33,34,125,44,123,34,110,97,109,
+101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,101,99,107,111,117,116,32,114,101,118,105,115,105,111,110,34,
+125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,97,114,99,104,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,
+117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,111,118,101,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,97,110,116,105,97,116,101,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,65,100,100,101,100,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,109,
+111,118,101,100,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,104,97,110,103,101,100,34,125,44,123,34,
+110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,99,104,97,110,103,101,115,32,116,111,32,115,97,
+118,101,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,101,108,101,99,116,32,99,104,97,110,103,101,
+115,32,116,111,32,114,101,115,101,116,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,97,110,110,
+111,116,32,114,101,118,101,114,116,32,115,116,97,115,104,101,100,32,99,104,97,110,103,101,115,44,32,116,104,101,32,115,116,97,103,101,32,105,115,32,110,111,116,32,101,109,112,116,121,33,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,
+97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,99,104,97,110,103,101,115,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,
+99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,118,105,115,105,111,110,32,116,114,101,101,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,99,97,108,32,104,105,115,116,111,114,121,32,105,115,32,97,108,114,101,97,100,121,32,117,112,32,116,111,32,100,97,116,101,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,
+110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,32,100,111,110,101,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,116,105,109,101,108,105,110,101,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,99,116,32,105,110,102,111,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,118,
+101,114,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,97,110,100,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,115,
+117,112,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,112,111,114,116,32,116,104,101,32,112,114,111,106,101,99,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,110,101,116,119,111,114,
+107,101,114,114,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,116,119,111,114,107,32,101,114,114,111,114,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,89,101,115,116,101,114,100,97,121,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,112,100,97,
+116,101,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,
+110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,100,101,115,99,114,
+105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,116,101,109,112,101,114,97,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,116,101,109,112,101,114,
+97,109,101,110,116,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,125,
+44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,125,44,123,34,110,97,109,101,34,58,34,101,109,
+112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,
+103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+73,111,110,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,101,111,108,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,97,110,34,125,
+44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,80,104,114,121,103,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,99,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,
+111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,114,109,
+111,110,105,99,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,125,44,123,
+34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,
+97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,
+114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,109,
+97,110,105,97,110,32,77,97,106,111,114,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,125,44,
+123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,105,103,109,97,116,105,99,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,73,111,110,105,97,110,32,65,117,103,109,101,110,116,101,100,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,
+105,97,110,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,
+116,101,100,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,125,44,
+123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,125,
+44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,
+34,58,34,85,108,116,114,97,112,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,108,116,114,97,112,104,114,121,103,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,
+110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,108,116,114,97,108,111,99,114,
+105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,125,44,123,34,110,97,109,101,34,58,34,76,101,
+97,100,105,110,103,32,87,104,111,108,101,45,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,97,100,105,110,103,32,87,104,111,108,101,45,84,111,110,101,34,125,44,123,34,110,97,109,101,34,58,34,68,111,117,98,108,101,32,
+72,97,114,109,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,117,98,108,101,32,72,97,114,109,111,110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,125,44,123,34,110,97,109,101,34,58,34,65,108,116,101,114,101,100,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,65,108,116,101,114,101,100,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,
+32,72,101,112,116,97,116,111,110,105,99,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,125,
+44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,111,100,105,102,105,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,77,111,100,105,102,105,101,100,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,
+101,115,32,77,105,120,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,125,44,123,34,110,97,109,101,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,82,111,99,107,39,110,39,82,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,125,44,123,34,110,97,109,
+101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,73,110,112,117,116,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,79,117,116,
+112,117,116,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,
+110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,
+115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,
+110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,
+101,108,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,
+109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,
+97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,
+111,118,101,100,32,123,120,125,32,110,111,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,
+32,123,120,125,32,110,111,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
+34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,
+101,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,
+34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,
+116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,
+123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,
+116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,
+34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,34,44,34,112,108,117,114,
+97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,
+111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,
+34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,
+32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,
+44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,
+111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
+34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,
+101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,34,44,34,
+112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,
+44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,
+32,97,110,110,111,116,97,116,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,112,108,117,114,
+97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,
+109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,
+109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,
+101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
+34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,
+58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,
+109,101,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,
+44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+91,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,
+125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,
+117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,
+34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,
+34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,
+121,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,112,
+108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,
+125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,
+58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,
+110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,
+34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,
+117,114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,
+123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,
+114,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,
+125,32,99,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,
+101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,
+34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,
+112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,
+32,114,101,118,105,115,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,
+93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,34,44,34,112,108,117,114,97,108,70,111,114,109,
+34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,
+116,101,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,
+123,120,125,32,115,101,99,111,110,100,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,
+44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,100,34,58,34,100,101,34,44,34,110,97,109,101,34,58,34,68,101,117,116,115,99,104,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,34,40,123,120,125,61,61,49,
+32,63,32,49,32,58,32,50,41,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,101,114,115,116,101,108,108,116,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,78,101,117,101,115,32,80,114,111,106,101,107,116,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,78,101,117,101,32,69,98,101,110,101,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,84,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,
+58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,115,116,101,108,108,117,110,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,
+115,105,111,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,97,116,116,101,114,110,115,34,125,44,123,34,110,97,109,101,34,58,34,100,
+105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,117,109,98,101,110,101,
+110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,
+109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,98,101,110,101,110,
+110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,
+110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,114,107,101,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,
+109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,120,116,32,101,105,110,103,101,98,101,110,58,34,125,
+44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,97,114,107,101,32,195,164,110,100,
+101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,107,116,97,110,103,97,98,101,32,
+195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,
+104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,107,116,97,110,103,97,98,101,32,104,105,110,
+122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,84,97,107,116,97,110,103,97,98,101,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,97,107,116,97,110,103,97,98,101,32,101,105,110,103,101,98,101,110,58,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,
+104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,
+101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,
+116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,
+116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,97,114,116,32,117,110,100,32,83,107,97,108,97,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,
+97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,98,101,110,101,32,117,109,98,101,110,101,110,110,101,110,34,125,44,
+123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,
+97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,98,101,110,101,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,
+110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,111,108,108,101,110,32,83,105,101,32,100,97,115,32,
+80,114,111,106,101,107,116,32,101,110,100,103,195,188,108,116,105,103,32,97,117,115,32,100,101,114,32,67,108,111,117,100,32,117,110,100,32,118,111,110,32,100,101,114,32,70,101,115,116,112,108,97,116,116,101,32,108,195,182,115,99,104,101,110,63,32,40,
+68,105,101,115,101,32,65,107,116,105,111,110,32,107,97,110,110,32,110,105,99,104,116,32,114,195,188,99,107,103,195,164,110,103,105,103,32,103,101,109,97,99,104,116,32,119,101,114,100,101,110,33,41,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
+111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,98,101,110,32,83,105,101,32,100,101,110,32,78,97,109,
+101,110,32,100,101,115,32,80,114,111,106,101,107,116,115,32,101,105,110,44,32,117,109,32,100,97,115,32,76,195,182,115,99,104,101,110,32,122,117,32,98,101,115,116,195,164,116,105,103,101,110,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
+103,58,58,99,111,109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,98,98,114,101,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,
+97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,110,119,101,110,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,
+110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,98,98,114,101,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,
+34,109,101,110,117,58,58,99,111,112,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,111,112,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,65,117,115,115,99,104,110,101,105,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,116,102,101,114,110,101,110,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,117,112,112,105,101,114,101,32,98,101,105,32,78,97,109,101,110,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,99,111,108,111,117,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,117,112,112,105,101,114,101,32,98,101,105,32,70,97,114,98,101,34,125,44,123,34,110,97,
+109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,114,117,112,112,105,101,114,101,32,98,101,105,32,73,110,115,116,114,117,109,
+101,110,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,101,105,110,101,32,71,114,117,112,112,105,101,114,117,110,103,34,
+125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,103,101,119,195,164,104,108,116,101,32,80,108,117,
+103,105,110,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,119,97,104,108,34,125,44,123,34,110,97,
+109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,119,97,104,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,
+101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,103,101,119,195,164,104,108,116,101,32,195,132,110,100,101,114,117,110,103,101,110,34,125,44,123,34,110,97,
+109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,103,101,119,195,164,104,108,116,101,32,86,101,114,115,
+105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,115,116,195,164,116,105,103,
+101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,114,195,188,99,107,115,101,116,122,
+101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,109,97,114,
+107,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,
+115,119,97,104,108,32,97,117,102,104,101,98,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,32,100,105,101,
+115,101,114,32,86,101,114,115,105,111,110,32,117,109,115,99,104,97,108,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,80,117,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,117,108,
+108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,117,101,115,32,73,110,115,116,
+114,117,109,101,110,116,32,97,110,108,101,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,117,103,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,90,117,32,73,110,115,116,114,117,109,101,110,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,114,101,
+109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,32,100,101,114,32,76,105,115,116,101,32,101,110,116,102,101,114,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,
+111,110,58,58,114,111,117,116,101,58,58,100,105,115,99,111,110,110,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,86,101,114,98,105,110,100,117,110,103,101,110,32,116,114,101,110,110,101,110,34,125,44,123,34,
+110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,115,32,73,110,115,116,114,117,109,101,110,116,
+32,101,110,116,102,101,114,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,65,117,100,105,111,32,101,109,112,102,97,110,103,101,110,32,118,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,97,117,100,105,111,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,32,115,101,110,100,101,110,32,97,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,
+109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,101,109,112,102,97,110,103,101,110,32,118,111,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,
+117,116,101,58,58,115,101,110,100,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,115,101,110,100,101,110,32,97,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,
+110,58,58,110,111,116,101,115,58,58,97,114,112,101,103,103,105,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,114,112,101,103,103,105,111,32,101,114,122,101,117,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,119,97,110,100,101,108,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
+110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,100,105,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,101,105,116,101,105,110,116,101,105,108,117,110,103,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,97,114,98,101,105,116,101,110,34,125,44,123,34,110,97,109,101,
+34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,110,105,101,114,101,
+110,32,110,97,99,104,32,111,98,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,110,105,101,114,101,110,32,110,97,99,104,32,117,110,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,105,100,101,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,195,132,110,100,101,114,117,110,103,101,110,32,97,117,115,98,108,101,110,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,
+58,58,115,104,111,119,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,195,132,110,100,101,114,117,110,103,101,110,32,119,105,100,101,114,104,101,114,115,116,101,108,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
+118,99,115,58,58,99,111,109,109,105,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,98,101,115,116,195,164,116,105,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,
+114,101,115,101,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,32,122,117,114,195,188,99,107,115,101,116,122,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,116,97,
+115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,111,112,32,
+83,116,97,115,104,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,110,108,101,103,101,110,32,97,117,
+115,32,65,117,115,119,97,104,108,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,195,156,98,101,114,108,
+97,112,112,117,110,103,101,110,32,108,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,117,112,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,78,97,99,104,32,111,98,101,110,32,105,110,118,101,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,105,110,118,101,114,115,101,100,111,119,
+110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,97,99,104,32,117,110,116,101,110,32,105,110,118,101,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,
+58,58,114,101,116,114,111,103,114,97,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,195,188,99,107,108,195,164,117,102,105,103,107,101,105,116,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,
+116,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,117,111,108,101,110,32,122,117,115,97,109,109,101,110,102,195,188,104,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,
+50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,117,111,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,105,111,
+108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,97,114,116,111,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,116,117,112,108,101,116,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,81,117,105,110,116,111,108,101,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,108,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,99,
+97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,32,97,98,103,101,98,114,111,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,
+58,58,117,110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,115,99,104,108,105,101,195,159,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,
+58,97,100,100,105,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,
+121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,98,101,110,101,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,
+116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,116,111,109,97,116,105,115,105,101,114,117,110,103,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,112,114,111,106,101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,101,109,112,111,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,109,
+112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,105,109,112,111,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,
+58,114,101,110,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,
+108,97,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,105,110,32,70,76,65,67,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,
+58,58,111,103,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,105,110,32,79,71,71,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,
+114,58,58,119,97,118,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,105,110,32,87,65,86,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,
+101,114,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,32,77,73,68,73,32,101,120,112,111,114,116,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,
+58,114,101,110,100,101,114,58,58,115,97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,115,112,101,105,99,104,101,114,116,32,97,108,115,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,
+106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,103,101,115,116,97,108,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,
+114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,110,105,101,114,101,110,32,110,97,99,104,32,111,98,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
+58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,97,110,115,112,111,110,105,101,114,101,110,32,110,97,99,104,32,117,110,116,101,110,34,125,
+44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,114,114,97,110,103,105,101,114,101,110,34,
+125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,97,114,98,101,105,116,101,110,34,125,
+44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,101,110,34,125,44,123,34,110,97,109,
+101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,195,164,110,
+100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,
+117,109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,
+117,109,101,110,116,32,108,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,101,100,105,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,83,105,103,110,97,108,102,108,117,115,115,32,98,101,97,114,98,101,105,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,101,102,102,101,99,116,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,69,102,102,101,107,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,105,110,115,116,
+114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,104,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,
+117,109,101,110,116,115,58,58,114,101,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,108,117,103,105,110,45,76,105,115,116,101,32,117,109,108,97,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
+105,110,115,116,114,117,109,101,110,116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,114,100,110,101,114,32,115,99,97,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,102,195,188,103,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,
+107,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,108,101,115,32,97,117,115,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,
+99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,195,164,110,100,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,109,98,101,110,101,110,110,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,
+112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,111,112,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,69,105,110,32,110,101,117,101,115,32,80,114,111,106,101,107,116,32,101,114,115,116,101,108,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,
+106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,108,97,100,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,68,101,97,107,116,105,118,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,107,116,105,118,105,101,
+114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,114,195,188,99,107,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,
+101,99,116,58,58,116,105,116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,105,116,101,108,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,65,117,116,111,114,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,66,101,115,99,104,114,101,105,98,117,110,103,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,105,122,101,
+110,122,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,195,164,110,103,101,34,125,44,123,34,110,97,109,101,34,
+58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,114,116,100,97,116,117,109,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,
+58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,115,115,116,97,116,105,115,116,105,107,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,
+101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,115,116,101,104,116,32,97,117,115,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,
+58,58,112,114,111,106,101,99,116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,112,101,105,99,104,101,114,111,114,116,32,100,101,114,32,68,97,116,101,105,34,125,44,123,34,110,97,109,
+101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,109,32,66,101,97,114,98,101,105,
+116,101,110,32,97,110,107,108,105,99,107,101,110,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,70,195,188,114,32,100,105,101,32,66,101,97,114,98,101,105,116,117,110,103,32,98,101,114,195,188,104,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,
+97,117,108,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,107,111,103,110,105,116,111,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,
+108,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,112,121,114,105,103,104,116,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,112,108,117,
+103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,102,195,188,103,98,97,114,101,32,65,117,100,105,111,45,80,108,117,103,105,110,115,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,
+115,116,114,97,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,101,32,97,117,102,32,100,101,114,32,66,195,188,104,110,101,34,125,44,123,34,110,97,109,
+101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,118,101,110,100,111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,108,117,103,105,110,45,72,101,114,115,116,101,108,108,101,114,32,
+117,110,100,32,78,97,109,101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,99,97,116,101,103,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,75,97,116,101,103,111,114,105,
+101,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,102,111,114,109,97,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,111,114,109,97,116,34,125,44,123,34,110,97,109,101,34,58,34,
+100,105,97,108,111,103,58,58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,114,100,110,101,114,32,122,117,109,32,83,99,97,110,110,101,110,32,119,195,164,104,108,101,
+110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,78,101,117,101,115,32,80,114,111,106,101,107,116,32,101,114,115,116,101,108,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,83,112,101,105,99,104,101,114,110,32,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,
+120,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,69,120,112,111,114,116,32,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,
+58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,120,112,111,114,116,105,101,114,116,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,
+103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,76,97,100,101,110,32,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,
+101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,32,73,109,112,111,114,116,32,119,195,
+164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,110,32,110,97,99,104,
+58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,114,116,34,125,44,123,34,110,97,109,101,34,58,34,100,
+105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,74,101,100,101,115,32,73,110,115,116,114,117,109,101,110,116,32,115,101,112,97,114,97,116,32,114,101,110,100,101,114,
+110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,110,100,101,114,105,110,103,32,97,98,98,114,101,99,104,101,110,
+34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,105,110,101,32,68,97,116,101,105,32,122,117,109,
+32,114,101,110,100,101,114,110,32,97,117,115,119,195,164,104,108,101,110,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,84,111,110,97,114,116,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,111,110,105,107,97,34,125,44,123,
+34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,101,114,116,111,110,105,107,97,34,125,44,123,34,110,97,109,101,
+34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,100,105,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,
+58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,100,111,109,105,110,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,
+111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,109,105,110,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,
+110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,109,101,100,105,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,
+110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,98,116,111,110,105,107,97,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,65,117,100,105,111,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,114,195,164,116,34,125,44,
+123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,114,101,105,98,101,114,34,125,44,123,34,110,97,109,101,34,58,34,115,101,
+116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,97,109,112,108,105,110,103,102,114,101,113,117,101,110,122,34,125,44,123,34,110,97,109,101,34,
+58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,117,102,102,101,114,45,71,114,195,182,195,159,101,34,125,44,123,34,110,97,109,101,
+34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,117,115,116,97,114,116,32,110,111,116,119,101,110,100,105,103,34,125,44,123,34,110,97,109,101,34,58,34,115,101,
+116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,97,114,98,115,99,104,101,109,97,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,
+101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,105,101,32,107,195,182,110,110,101,110,32,98,101,105,32,100,101,114,32,72,101,108,105,111,45,195,156,98,101,114,115,101,116,122,117,110,103,32,104,101,108,102,101,110,34,125,44,
+123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,110,116,101,114,102,97,99,101,45,82,101,110,100,101,114,101,114,34,125,44,123,34,110,97,
+109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,116,97,110,100,97,114,100,109,195,164,195,159,105,103,34,125,44,123,
+34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,115,
+101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,114,101,32,71,114,97,112,104,105,99,115,34,125,44,123,34,110,97,109,
+101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,105,114,101,99,116,50,68,34,125,44,123,34,110,97,109,101,34,58,34,115,
+101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,97,116,105,118,45,82,101,110,100,101,114,101,114,34,125,44,123,34,110,97,109,101,34,58,34,100,
+105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,101,114,32,79,112,101,110,71,76,45,82,101,110,100,101,114,101,114,32,105,115,116,32,102,195,188,114,32,103,
+101,119,195,182,104,110,108,105,99,104,32,100,101,117,116,108,105,99,104,32,115,99,104,110,101,108,108,101,114,32,102,195,188,114,32,103,114,111,195,159,101,32,80,114,111,106,101,107,116,101,44,32,107,97,110,110,32,97,98,101,114,32,106,101,32,110,97,
+99,104,32,118,101,114,119,101,110,100,101,116,101,114,32,72,97,114,100,119,97,114,101,32,105,110,115,116,97,98,105,108,32,115,101,105,110,46,32,87,105,114,107,108,105,99,104,32,97,117,102,32,79,112,101,110,71,76,32,117,109,115,116,101,108,108,101,110,
+63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,118,101,114,119,101,110,100,101,110,
+34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,109,109,105,116,45,66,101,115,99,104,114,
+101,105,98,117,110,103,32,101,105,110,103,101,98,101,110,58,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,83,112,101,105,99,104,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,111,
+108,108,101,110,32,83,105,101,32,100,105,101,32,97,117,115,103,119,195,164,104,108,116,101,110,32,195,132,110,100,101,114,117,110,103,101,110,32,122,117,114,195,188,99,107,110,101,104,109,101,110,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,
+108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,114,195,188,99,107,110,101,104,109,101,110,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,
+108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,119,97,114,110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,101,110,116,104,195,164,108,116,32,110,105,99,104,116,32,103,101,
+115,112,101,105,99,104,101,114,116,101,32,195,132,110,100,101,114,117,110,103,101,110,33,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,90,117,32,100,105,101,115,101,114,32,86,101,114,115,105,111,110,32,117,109,115,99,104,97,108,116,101,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,
+97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,76,195,182,115,99,104,101,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,102,195,188,103,
+101,110,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,105,110,122,117,103,101,102,195,188,103,116,34,125,44,123,
+34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,108,195,182,115,99,104,116,34,125,44,123,34,110,97,109,101,34,58,
+34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,
+97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,195,164,104,108,101,110,32,83,105,101,32,100,105,101,32,195,132,110,100,101,114,117,110,103,101,110,44,32,100,105,
+101,32,83,105,101,32,115,112,101,105,99,104,101,114,110,32,119,111,108,108,101,110,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,87,195,164,104,108,101,110,32,83,105,101,32,100,105,101,32,195,132,110,100,101,114,117,110,103,101,110,44,32,100,105,101,32,83,105,101,32,122,117,114,195,188,99,107,110,101,104,109,101,110,32,119,111,108,108,101,110,46,34,
+125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,195,188,99,107,115,112,114,117,110,103,32,97,110,32,100,
+105,101,32,65,110,115,99,104,108,117,115,115,115,116,101,108,108,101,32,117,110,109,195,182,103,108,105,99,104,44,32,100,97,115,32,119,105,114,100,32,195,132,110,100,101,114,117,110,103,101,110,32,108,195,182,115,99,104,101,110,46,34,125,44,123,34,110,
+97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,195,164,110,100,101,114,117,110,103,101,110,34,125,44,123,34,110,97,109,101,
+34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,101,118,105,115,105,111,110,115,98,97,117,109,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,
+58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,107,97,108,101,32,72,105,115,116,111,114,105,101,32,105,115,116,32,97,117,102,32,100,101,109,32,110,101,117,101,115,116,101,110,
+32,83,116,97,110,100,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,101,114,116,105,103,115,116,101,108,108,101,110,46,34,125,44,123,34,
+110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,32,84,105,109,101,108,105,110,101,34,125,44,123,34,110,97,109,101,
+34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,114,111,106,101,107,116,105,110,102,111,114,109,97,116,105,111,110,34,125,44,123,34,110,97,109,
+101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,86,101,114,115,105,111,110,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,117,110,100,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,110,101,116,119,111,114,107,101,114,114,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,116,122,
+119,101,114,107,32,70,101,104,108,101,114,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,101,115,116,101,114,110,34,125,44,123,34,
+110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,107,116,117,97,108,105,115,105,101,114,101,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,
+97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,104,105,110,122,117,103,101,102,195,188,103,116,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,76,105,122,101,110,122,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,84,
+105,116,101,108,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,116,111,114,32,103,101,195,164,110,
+100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,101,115,99,104,114,101,105,98,117,110,103,32,103,101,195,164,
+110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,97,114,98,101,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,
+101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,101,114,101,32,69,98,101,110,101,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,
+114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,101,114,101,115,32,80,97,116,116,101,114,110,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,73,110,115,116,114,117,109,101,110,116,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,67,111,110,116,114,111,108,108,101,114,32,103,101,195,164,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,111,110,105,
+115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,195,132,111,108,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,115,99,104,34,
+125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,80,104,114,121,103,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,107,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,
+58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,101,108,111,100,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,72,97,114,109,111,110,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,114,109,111,110,105,115,99,104,
+32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,103,97,114,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,
+34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,110,103,97,114,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,
+32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,97,112,111,108,105,116,97,110,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,78,101,97,112,111,108,105,116,97,110,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,82,111,109,97,110,105,115,99,104,32,68,117,114,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,109,97,110,105,115,
+99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,105,103,109,97,116,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,
+103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,69,110,105,103,109,97,116,105,115,99,104,32,77,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,32,65,117,103,109,101,110,
+116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,73,111,110,105,115,99,104,32,69,114,104,195,182,104,116,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,76,121,100,105,115,99,104,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+76,121,100,105,115,99,104,32,69,114,104,195,182,104,116,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,121,100,105,115,99,104,32,
+86,101,114,109,105,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,105,120,111,108,121,100,105,115,
+99,104,32,69,114,104,195,182,104,116,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,80,104,114,121,103,105,115,99,104,32,68,111,109,105,
+110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,112,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,108,116,114,97,112,104,114,121,103,105,115,99,104,34,125,44,123,34,110,97,109,101,
+34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,111,107,114,105,115,99,104,32,68,111,109,105,110,97,110,116,34,125,44,123,34,110,97,109,101,34,58,34,83,117,112,101,114,
+108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,83,117,112,101,114,108,111,107,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,85,108,116,114,97,108,111,107,114,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,117,114,32,76,111,107,114,
+105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,76,101,97,100,105,110,103,32,87,104,111,108,101,45,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,76,101,105,116,101,110,100,101,32,71,97,110,122,116,195,182,110,101,
+34,125,44,123,34,110,97,109,101,34,58,34,68,111,117,98,108,101,32,72,97,114,109,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,111,112,112,101,108,104,97,114,109,111,110,105,115,99,104,34,125,44,123,34,110,97,109,101,34,
+58,34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,97,108,98,118,101,114,109,105,110,100,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,65,108,116,101,114,101,100,32,68,111,
+109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,108,116,101,114,105,101,114,116,101,32,68,111,109,105,110,97,110,116,101,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,
+105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,115,99,104,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,111,100,105,102,105,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,
+117,101,115,32,65,108,116,101,114,105,101,114,116,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,71,101,109,105,115,99,104,116,34,125,
+44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,66,108,117,101,115,32,109,105,116,32,76,101,105,116,116,111,110,34,125,44,123,34,110,97,109,
+101,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,111,101,105,110,103,97,110,103,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,65,117,100,105,
+111,97,117,115,103,97,110,103,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,45,69,105,110,103,97,110,103,34,125,44,123,34,110,97,109,101,34,58,34,
+77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,45,65,117,115,103,97,110,103,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,
+120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,105,110,103,97,110,103,115,107,97,110,97,108,34,44,34,112,108,117,114,97,108,
+70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,105,110,103,97,110,103,115,107,97,110,195,164,108,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,
+120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,65,117,115,103,97,98,101,107,97,110,97,108,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,65,117,115,103,97,98,101,107,97,110,195,164,108,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,
+101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,
+70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,110,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,
+34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,
+117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,110,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,
+34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,
+117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,110,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,
+101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,32,104,105,110,122,117,103,101,102,195,
+188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,115,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,
+114,101,105,103,110,105,115,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,115,101,32,103,101,108,195,182,115,99,
+104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,
+110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,
+115,115,101,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,67,
+108,105,112,115,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,32,101,110,116,102,101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,
+125,32,67,108,105,112,115,32,101,110,116,102,101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,32,98,101,97,114,98,101,105,116,101,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,99,125,
+32,67,108,105,112,115,32,98,101,97,114,98,101,105,116,101,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
+97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,110,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,
+120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,110,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,
+104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,32,103,101,195,164,110,100,101,114,116,34,44,
+34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,110,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,
+34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,
+97,98,101,32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,110,32,104,105,110,122,117,103,101,102,
+195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,
+34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,110,32,103,101,108,195,182,115,99,104,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,
+105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,
+117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,110,32,103,101,195,164,110,100,101,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,
+123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,
+32,104,105,110,122,117,103,101,102,195,188,103,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,101,110,32,104,105,110,122,117,103,101,102,195,188,103,116,34,
+44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,32,101,110,116,102,101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,
+101,110,32,101,110,116,102,101,114,110,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,32,98,101,97,114,98,101,105,116,101,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,
+101,34,58,34,123,120,125,32,84,111,110,97,114,116,101,110,32,98,101,97,114,98,101,105,116,101,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,78,111,116,101,110,34,44,34,
+112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,
+101,105,103,110,105,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,114,101,105,103,110,105,115,115,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,
+44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,97,114,107,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,
+103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
+97,109,101,34,58,34,123,120,125,32,84,97,107,116,97,110,103,97,98,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,110,97,114,116,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,84,111,
+110,97,114,116,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,
+34,123,120,125,32,67,108,105,112,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,67,108,105,112,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,
+110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,80,97,116,116,101,114,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,
+58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,80,97,116,116,101,114,110,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,69,98,101,110,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,69,98,101,110,101,110,34,
+44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,
+120,125,32,82,101,118,105,115,105,111,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,82,101,118,105,115,105,111,110,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
+50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,68,101,108,116,97,34,44,34,112,108,117,114,97,108,70,111,
+114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,68,101,108,116,97,115,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,77,105,110,117,116,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,77,105,110,
+117,116,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,
+58,34,123,120,125,32,83,101,107,117,110,100,101,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,83,101,107,117,110,100,101,110,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
+50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,117,109,98,101,110,97,110,110,116,32,118,111,110,32,123,120,
+125,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,100,34,58,34,122,104,34,44,34,110,97,109,101,34,58,34,231,174,128,228,189,147,228,184,173,230,150,135,34,44,34,112,108,117,114,97,108,69,113,117,97,116,
+105,111,110,34,58,34,49,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,229,183,165,231,168,139,229,144,175,229,138,168,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,230,150,176,229,187,186,229,183,165,231,168,139,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,230,150,176,229,187,186,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,233,128,159,229,186,166,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,165,228,189,156,229,174,164,34,125,44,123,34,110,97,109,101,34,58,34,116,
+114,101,101,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,190,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,34,125,44,123,34,
+110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,183,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,107,101,121,77,97,112,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,148,174,231,155,152,230,152,160,229,176,132,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,
+97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,185,144,229,153,168,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,
+58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,
+111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,
+101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,230,183,187,229,138,160,230,179,168,233,135,138,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,232,190,147,229,133,165,230,179,168,233,135,138,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,232,190,145,230,179,168,233,135,138,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,230,139,141,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,230,183,187,229,138,160,230,139,141,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,230,139,141,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,
+105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,190,147,229,133,165,230,150,176,230,139,141,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,
+104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,232,176,131,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,
+108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,232,176,131,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,
+110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,232,176,131,229,143,183,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,
+99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,
+99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,189,168,233,129,147,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,
+99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,
+116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,99,97,112,116,105,111,110,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,155,229,187,186,231,144,182,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,229,136,155,229,187,186,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,230,152,175,229,144,166,230,176,184,228,185,133,228,187,142,228,186,145,231,171,175,229,146,140,230,156,172,229,156,176,229,136,160,233,153,164,232,175,165,233,161,185,231,155,174,239,188,159,239,188,136,228,184,141,229,143,175,
+230,146,164,233,148,128,239,188,137,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,232,190,147,229,133,165,233,161,185,231,155,174,229,144,141,231,167,176,228,187,165,231,161,174,232,174,164,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,117,116,104,58,
+58,103,105,116,104,117,98,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,32,71,105,116,72,117,98,32,232,180,166,229,143,183,231,153,187,229,189,149,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,
+58,99,111,109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,230,182,136,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,112,112,108,
+121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,186,148,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,34,125,44,123,
+34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,230,182,136,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,111,112,121,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,229,164,141,229,136,182,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,170,229,136,135,34,125,44,123,34,110,97,109,
+101,34,58,34,109,101,110,117,58,58,112,97,115,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,178,152,232,180,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,165,229,144,141,
+231,167,176,229,136,134,231,187,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,99,111,108,111,117,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,165,233,162,156,232,137,178,
+229,136,134,231,187,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,165,228,185,144,229,153,
+168,229,136,134,231,187,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,103,114,111,117,112,98,121,58,58,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,151,160,229,136,134,231,187,132,34,125,44,123,
+34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,230,143,146,228,187,182,34,125,44,123,34,110,97,
+109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,233,159,179,231,172,166,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,231,137,135,230,174,181,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,
+101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
+108,101,99,116,105,111,110,58,58,118,99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,233,128,137,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,
+101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,144,228,186,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,
+111,110,58,58,118,99,115,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,
+58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,168,233,128,137,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,
+108,101,99,116,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,156,170,233,128,137,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,115,
+104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,180,174,232,151,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,230,163,128,229,135,186,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,230,142,168,233,128,129,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,230,139,137,229,143,150,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,
+155,229,187,186,230,150,176,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,117,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,230,183,187,229,138,160,229,136,176,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,228,187,142,229,136,151,232,161,168,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,100,105,115,99,111,110,110,
+101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,173,229,188,128,230,137,128,230,156,137,232,191,158,230,142,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,
+111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,142,228,185,144,229,153,168,228,184,173,231,167,187,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,
+101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,142,165,229,143,151,233,159,179,233,162,145,232,135,170,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,145,233,128,129,233,159,179,233,162,145,232,135,179,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,142,165,229,143,151,77,73,68,73,232,135,
+170,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,145,233,128,129,
+77,73,68,73,232,135,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,97,114,112,101,103,103,105,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+231,144,182,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,
+141,230,158,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,113,117,97,110,116,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,
+140,150,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,100,105,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,135,229,
+137,178,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,116,111,116,114,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,138,189,229,135,186,229,
+136,176,230,150,176,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,
+188,150,232,190,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,229,144,145,228,184,138,231,167,187,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,139,231,167,187,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,105,100,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,233,154,144,232,151,143,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,115,104,111,119,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,230,129,162,229,164,141,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,111,109,109,105,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,144,
+228,186,164,229,133,168,233,131,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,114,101,115,101,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,231,189,174,229,133,168,233,131,
+168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,180,174,232,151,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
+118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,185,229,135,186,232,180,174,232,151,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,121,110,99,97,108,108,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,140,230,173,165,230,137,128,230,156,137,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,
+116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,187,142,233,128,137,230,139,169,228,184,173,229,136,155,229,187,186,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,
+99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,167,187,233,153,164,233,135,141,229,143,160,233,131,168,229,136,134,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,
+105,110,103,58,58,105,110,118,101,114,115,101,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,138,229,143,141,229,144,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,
+114,105,110,103,58,58,105,110,118,101,114,115,101,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,139,229,143,141,229,144,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,
+99,116,111,114,105,110,103,58,58,114,101,116,114,111,103,114,97,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,134,232,161,140,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,
+58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,50,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,50,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,
+229,136,176,49,47,52,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,56,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,56,34,125,44,123,34,110,
+97,109,101,34,58,34,109,101,110,117,58,58,113,117,97,110,116,105,122,101,58,58,49,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,49,54,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,113,117,97,110,116,105,122,101,58,58,51,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,143,229,140,150,229,136,176,49,47,51,50,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,
+49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,136,229,185,182,228,186,140,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,50,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,228,186,140,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,137,232,191,158,233,159,
+179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,155,155,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,116,117,112,108,101,116,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,186,148,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,54,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,229,133,173,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,131,232,191,
+158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,56,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,171,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,116,117,112,108,101,116,58,58,57,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,185,157,232,191,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,
+108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,233,161,185,231,155,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,
+99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,141,231,167,176,228,184,141,229,140,185,233,133,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,
+110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,179,233,151,173,233,161,185,231,155,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,
+115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,230,183,187,229,138,160,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,230,183,187,229,138,160,232,135,170,229,138,168,229,140,150,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,228,184,187,233,128,159,229,186,166,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,229,175,188,229,133,165,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,34,125,
+44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,228,184,186,70,76,65,67,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,111,103,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,228,184,186,79,71,71,34,125,44,123,34,
+110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,118,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,228,184,186,87,65,86,34,125,44,123,34,110,97,109,
+101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,175,188,229,135,186,77,73,68,73,34,125,44,123,34,110,97,109,101,34,58,34,
+109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,115,97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,228,184,186,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,230,158,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,
+116,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,138,231,167,187,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,
+99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,145,228,184,139,231,167,187,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,
+106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,230,155,178,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,
+58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,232,190,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,
+116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,
+114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,
+58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,180,230,148,185,232,176,131,229,190,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,111,110,118,101,114,116,
+58,58,116,109,112,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,189,172,230,141,162,232,176,131,229,190,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,
+97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,229,145,189,229,144,141,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,
+101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,101,100,
+105,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,232,190,145,232,191,158,230,142,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,101,102,
+102,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,230,149,136,230,158,156,229,153,168,232,138,130,231,130,185,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,
+101,110,116,58,58,97,100,100,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,228,185,144,229,153,168,232,138,130,231,130,185,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
+110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,232,189,189,230,143,146,228,187,182,229,136,151,232,161,168,34,125,44,123,34,110,97,109,101,
+34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,137,171,230,143,143,230,150,135,228,187,182,229,164,185,34,125,44,123,
+34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,187,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,107,98,109,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,188,150,232,190,145,233,148,174,231,155,152,230,152,160,229,176,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,
+108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,138,160,232,189,189,83,99,97,108,97,230,152,160,229,176,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,98,109,58,58,114,101,115,101,116,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,231,189,174,233,148,174,231,155,152,230,152,160,229,176,132,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,168,233,128,137,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,232,174,190,231,189,174,228,185,144,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,233,135,141,229,145,189,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,141,229,136,182,228,184,
+186,229,137,175,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,160,233,153,164,232,189,168,233,129,147,34,
+125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,229,187,186,229,183,165,
+231,168,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,137,147,229,188,128,229,
+183,165,231,168,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,157,153,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,
+110,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,230,182,136,233,157,153,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,231,139,172,229,165,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,230,182,136,231,139,172,229,165,143,34,125,44,123,
+34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,148,229,155,158,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,116,
+108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,135,233,162,152,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,228,189,156,232,128,133,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,143,
+232,191,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,184,229,143,175,232,175,129,34,125,44,123,34,110,
+97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,149,191,229,186,166,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,
+112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,181,183,229,167,139,228,186,142,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,
+58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,230,142,167,229,136,182,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,
+97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,140,133,229,144,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,102,105,108,101,108,111,99,
+97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,135,228,187,182,228,189,141,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,
+58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,130,185,229,135,187,228,187,165,231,188,150,232,190,145,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,
+106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,141,149,229,135,187,228,187,165,231,188,150,232,190,145,34,125,44,123,34,110,97,109,
+101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,154,144,232,186,171,230,168,161,229,188,143,34,125,44,123,34,110,
+97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,157,131,34,125,44,123,34,110,97,109,101,
+34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,101,109,112,101,114,97,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,176,131,229,190,139,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,
+111,114,99,104,101,115,116,114,97,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,175,231,148,168,233,159,179,233,162,145,230,143,146,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,
+101,58,58,111,114,99,104,101,115,116,114,97,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,228,189,191,231,148,168,231,154,132,228,185,144,229,153,168,34,125,44,123,34,110,97,
+109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,118,101,110,100,111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,146,228,187,182,229,142,130,229,149,134,34,125,44,123,
+34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,99,97,116,101,103,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,177,187,229,136,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,
+103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,102,111,114,109,97,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,188,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,115,99,97,110,102,111,
+108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,230,150,135,228,187,182,229,164,185,232,191,155,232,161,140,230,137,171,230,143,143,34,125,44,123,34,110,97,109,101,34,
+58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,155,229,187,186,230,150,176,
+229,183,165,231,168,139,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,229,136,176,230,150,
+135,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,175,188,229,135,186,229,136,176,230,150,
+135,228,187,182,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,175,188,229,135,186,
+229,174,140,230,175,149,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,230,150,135,228,187,
+182,229,185,182,229,138,160,232,189,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,
+169,230,150,135,228,187,182,229,185,182,229,175,188,229,133,165,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+230,184,178,230,159,147,228,184,186,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,
+159,147,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,148,190,229,188,131,230,184,178,230,159,147,34,125,44,123,34,
+110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,184,178,230,159,147,229,136,176,230,150,135,228,187,182,34,125,44,
+123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,101,109,112,111,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,190,231,189,174,232,138,130,230,139,141,233,128,159,229,186,166,239,188,
+140,66,80,77,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,101,109,112,111,58,58,116,97,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,149,178,229,135,187,232,138,130,230,139,141,34,125,44,
+123,34,110,97,109,101,34,58,34,99,111,110,115,111,108,101,58,58,112,114,111,106,101,99,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,161,185,231,155,174,229,136,151,232,161,168,34,125,44,123,34,110,97,109,101,34,58,34,99,111,
+110,115,111,108,101,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,151,182,233,151,180,232,189,180,228,184,142,232,189,168,233,129,147,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,115,111,
+108,101,58,58,99,104,111,114,100,98,117,105,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,229,188,166,231,188,150,232,175,145,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,
+109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,179,233,157,153,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,115,111,108,111,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,229,188,128,229,133,179,231,139,172,229,165,143,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,115,99,97,108,101,115,104,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,
+179,233,159,179,233,152,182,233,171,152,228,186,174,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,110,111,116,101,103,117,105,100,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,179,230,
+152,190,231,164,186,233,159,179,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,116,111,103,103,108,101,58,58,108,111,111,112,115,101,108,101,99,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,128,229,133,179,
+229,190,170,231,142,175,230,137,128,233,128,137,230,174,181,232,144,189,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,115,117,103,103,101,115,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,187,186,
+232,174,174,34,125,44,123,34,110,97,109,101,34,58,34,99,104,111,114,100,58,58,99,111,109,112,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,229,188,166,231,148,159,230,136,144,34,125,44,123,34,110,97,109,101,34,58,
+34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,176,131,230,128,167,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,
+58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,187,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,
+58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,138,228,184,187,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,173,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,228,184,139,229,177,158,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,177,158,
+233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,228,184,173,233,159,179,34,125,44,
+123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,228,184,187,233,159,179,34,125,44,123,34,110,97,109,101,
+34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,159,179,233,162,145,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,
+58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,190,229,164,135,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,233,169,177,229,138,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,233,135,135,230,160,183,231,142,135,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,231,188,147,229,173,152,229,164,167,229,176,143,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,109,105,100,105,58,58,114,101,99,111,114,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,
+73,32,229,189,149,229,133,165,232,174,190,229,164,135,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,109,105,100,105,58,58,110,111,100,101,118,105,99,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+230,156,170,229,143,145,231,142,176,232,190,147,229,133,165,232,174,190,229,164,135,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,115,116,97,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+233,156,128,232,166,129,233,135,141,230,150,176,229,144,175,229,138,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,115,121,110,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,156,128,232,166,129,
+229,144,140,230,173,165,231,154,132,232,174,190,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,148,168,230,136,183,231,149,140,233,157,
+162,228,184,187,233,162,152,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,102,111,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,173,151,228,189,147,34,125,44,123,34,110,97,109,101,
+34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,58,58,110,97,116,105,118,101,98,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,229,142,159,231,148,159,230,160,135,233,162,152,230,160,143,34,125,44,123,
+34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,184,174,229,138,169,230,148,185,232,191,155,72,101,108,105,111,231,154,
+132,231,191,187,232,175,145,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,148,168,230,136,183,231,149,140,233,157,162,230,
+184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,
+148,168,233,187,152,232,174,164,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,228,189,191,231,148,168,79,112,101,110,71,76,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,105,
+99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,67,111,114,101,71,114,97,112,104,105,99,115,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,
+114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,68,105,114,101,99,116,50,68,230,184,178,230,159,147,229,153,168,34,125,44,123,34,110,97,109,101,34,
+58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,230,156,172,229,156,176,230,184,178,230,159,147,229,153,168,34,
+125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,230,184,178,230,159,147,229,153,168,230,184,178,
+230,159,147,229,164,167,229,158,139,229,183,165,231,168,139,231,155,184,229,175,185,232,190,131,229,191,171,239,188,140,228,189,134,230,152,175,230,160,185,230,141,174,228,184,141,229,144,140,231,161,172,228,187,182,229,143,175,232,131,189,228,188,154,
+230,156,137,228,184,141,231,168,179,229,174,154,231,142,176,232,177,161,227,128,130,230,152,175,229,144,166,229,136,135,230,141,162,229,136,176,79,112,101,110,71,76,230,184,178,230,159,147,229,153,168,239,188,159,34,125,44,123,34,110,97,109,101,34,58,
+34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,191,231,148,168,79,112,101,110,71,76,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
+111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,190,147,229,133,165,230,143,144,228,186,164,228,191,161,230,129,175,239,188,154,34,125,44,123,34,110,
+97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,143,144,228,186,164,34,125,44,123,34,110,97,109,101,34,58,34,100,
+105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,161,174,232,174,164,233,135,141,231,189,174,229,183,178,233,128,137,229,143,152,230,155,180,
+239,188,159,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,231,189,174,34,125,44,123,
+34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,119,97,114,110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,161,185,231,155,174,229,140,133,229,144,171,230,156,
+170,230,143,144,228,186,164,231,154,132,229,143,152,230,155,180,239,188,129,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,230,163,128,229,135,186,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,230,144,156,231,180,162,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,167,187,233,153,164,34,125,44,123,34,110,
+97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,174,158,228,190,139,229,140,150,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,
+116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,230,183,187,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,
+58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,229,136,160,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,
+101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,229,143,152,230,155,180,229,185,182,228,191,157,229,173,152,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,
+115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,128,137,230,139,169,229,143,152,230,155,180,229,185,182,233,135,141,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,
+97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,154,130,229,173,152,229,140,186,233,157,158,231,169,186,239,188,140,228,184,141,229,133,129,232,174,184,229,143,141,232,189,172,232,180,174,232,
+151,143,231,154,132,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,161,185,231,155,174,229,143,152,230,
+155,180,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,230,160,145,34,125,44,123,34,110,97,109,
+101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,156,172,229,156,176,229,142,134,229,143,178,229,183,178,229,144,140,230,173,165,34,125,44,123,34,110,97,
+109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,229,174,140,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,
+116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,165,231,168,139,230,151,182,233,151,180,231,186,191,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,
+101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,165,231,168,139,228,191,161,230,129,175,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,231,137,136,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,34,125,44,123,34,110,97,109,101,
+34,58,34,99,111,109,109,111,110,58,58,115,117,112,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,148,175,230,140,129,230,173,164,233,161,185,231,155,174,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,
+58,58,110,101,116,119,111,114,107,101,114,114,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,189,145,231,187,156,233,148,153,232,175,175,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,
+114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,152,168,229,164,169,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,230,155,180,230,150,176,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,183,178,229,136,157,229,167,139,229,140,150,34,125,44,123,34,110,97,109,
+101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,174,184,229,143,175,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,
+110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,160,135,233,162,152,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,228,189,156,232,128,133,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,
+143,143,232,191,176,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,162,156,232,137,178,229,143,152,230,155,180,34,125,44,
+123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,169,186,229,186,143,229,136,151,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,
+116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,169,186,230,160,183,230,156,172,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,228,185,144,229,153,168,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,230,142,167,229,136,182,229,153,168,229,143,152,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,136,177,229,165,165,229,176,188,228,186,154,232,176,131,229,
+188,143,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,188,138,229,165,165,229,176,188,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,76,
+121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,149,229,186,149,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,230,183,183,229,144,136,229,144,149,229,186,149,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,154,229,
+136,169,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,151,233,135,140,229,144,137,228,186,154,232,176,131,229,188,143,34,
+125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,180,155,229,133,139,229,136,169,228,186,154,232,176,131,229,188,143,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,
+100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,151,139,229,190,139,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,230,151,139,229,190,139,229,176,143,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,229,
+163,176,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,146,140,229,163,176,229,176,143,232,176,131,34,125,44,123,34,110,
+97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,140,136,231,137,153,229,136,169,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,
+97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,140,136,231,137,153,229,136,169,229,176,143,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,
+111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,130,163,228,184,141,229,139,146,230,150,175,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,233,130,163,228,184,141,229,139,146,230,150,175,229,176,143,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,231,189,151,233,169,172,229,176,188,228,186,154,229,164,167,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,189,151,
+233,169,172,229,176,188,228,186,154,229,176,143,232,176,131,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,131,229,163,176,229,184,
+131,233,178,129,230,150,175,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,188,151,233,135,140,229,144,137,228,186,154,229,184,131,233,178,129,
+230,150,175,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,183,183,229,144,136,229,184,131,233,178,129,230,150,175,34,125,44,123,34,110,97,109,101,34,58,
+34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,187,233,159,179,229,184,131,233,178,129,230,150,175,34,125,44,123,34,110,97,109,101,34,58,34,82,111,99,107,39,110,
+39,82,111,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,145,135,230,187,154,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,159,
+179,233,162,145,232,190,147,229,133,165,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,159,179,233,162,145,232,190,147,229,135,186,34,125,44,123,34,
+110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,232,190,147,229,133,165,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,232,190,147,229,135,186,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,
+115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,232,190,147,229,133,165,233,128,154,233,129,147,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,
+109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,232,190,147,229,135,186,233,128,154,233,129,147,34,
+44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,
+183,187,229,138,160,228,186,134,123,120,125,228,184,170,233,159,179,231,172,166,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,233,159,179,231,172,166,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,
+110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,233,159,179,231,
+172,166,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,
+34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,228,186,139,228,187,182,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,
+101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,228,186,139,228,187,182,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
+125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,
+184,170,228,186,139,228,187,182,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,
+34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,231,137,135,230,174,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,
+120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,231,137,135,230,174,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,
+58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,
+228,184,170,231,137,135,230,174,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,230,179,168,233,135,138,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,
+109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,230,179,168,233,135,138,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,
+34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,230,179,168,233,135,138,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,
+116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,230,139,141,229,143,183,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,
+110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,230,139,141,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,
+32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,230,139,141,229,143,183,34,44,34,112,108,
+117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,
+101,34,58,34,230,183,187,229,138,160,228,186,134,123,120,125,228,184,170,232,176,131,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,
+101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,231,167,187,233,153,164,228,186,134,123,120,125,228,184,170,232,176,131,229,143,183,34,44,34,112,108,117,114,97,
+108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,
+34,58,34,230,155,180,230,148,185,228,186,134,123,120,125,228,184,170,232,176,131,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,233,159,179,231,172,166,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,
+116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,228,186,139,228,187,182,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,
+120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,230,179,168,233,135,138,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
+125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,230,139,141,229,143,183,
 34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,
-34,58,34,232,170,191,229,143,183,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,227,131,151,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,
-110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,145,227,130,191,227,131,188,227,131,179,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,
-97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,172,227,130,164,227,131,164,227,131,188,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,172,227,131,147,227,130,184,227,
-131,167,227,131,179,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,
-34,110,97,109,101,34,58,34,227,131,135,227,131,171,227,130,191,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,229,136,134,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,
-34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,231,167,146,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,
-123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,227,129,139,227,130,137,231,167,187,229,139,149,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,
-34,105,100,34,58,34,107,114,34,44,34,110,97,109,101,34,58,34,237,149,156,234,181,173,236,150,180,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,34,40,123,120,125,61,61,49,32,63,32,49,32,58,32,50,41,34,44,34,108,105,116,101,114,97,
-108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,
-236,160,157,237,138,184,32,236,139,156,236,158,145,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,
-131,136,32,237,148,132,235,161,156,236,160,157,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,
-131,136,32,237,138,184,235,158,153,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,133,156,237,143,
-172,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,138,164,237,138,156,235,148,148,236,152,164,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,
-58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,236,132,164,236,160,149,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,236,160,132,34,125,44,123,34,110,97,109,101,
-34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,140,168,237,132,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,
-116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,
-97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,163,188,236,132,157,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,
-116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,163,188,236,132,157,32,237,133,141,236,138,164,237,138,184,32,236,158,133,235,160,165,34,125,44,123,34,110,97,109,
-101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,163,188,236,132,157,32,237,142,184,236,167,145,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,176,149,236,158,144,32,235,179,128,234,178,189,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,
-34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,176,149,236,158,144,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,
-100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,176,149,236,158,144,32,235,179,128,234,178,189,34,125,
-44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,235,161,156,236,
-154,180,32,235,167,136,235,148,148,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,130,164,32,235,
-179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,173,236,160,156,34,125,
-44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,130,164,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,
-34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,130,164,32,235,179,128,234,178,189,34,125,44,123,
-34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,130,164,32,47,32,236,157,140,234,179,
-132,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,138,184,235,
-158,153,32,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,237,138,184,235,158,153,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,235,165,188,32,236,152,129,234,181,172,32,236,130,173,236,160,156,237,149,152,236,139,156,234,178,160,236,138,181,235,139,136,234,185,140,63,40,236,136,152,236,160,149,237,149,160,32,236,
-136,152,32,236,151,134,236,138,181,235,139,136,235,139,164,46,41,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,234,177,176,32,237,153,149,236,157,184,236,157,132,32,236,156,132,237,149,180,32,237,148,132,235,161,156,236,160,157,237,138,184,32,236,157,180,235,166,132,236,157,132,32,236,158,
-133,235,160,165,237,149,152,236,132,184,236,154,148,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,183,168,236,
-134,140,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,129,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,
-100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,
-111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,236,183,168,236,134,140,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,111,112,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,181,236,130,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,
-99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,152,235,157,188,235,130,180,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,
-235,144,156,32,237,148,140,235,159,172,234,183,184,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,
-132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,34,125,44,123,34,110,97,
-109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,235,144,156,32,235,179,128,234,178,189,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,235,144,156,32,235,178,132,236,
-160,188,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,153,149,236,157,184,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,180,136,234,184,176,237,153,148,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,170,168,235,145,144,32,236,132,160,237,131,157,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,110,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,235,172,180,234,178,131,235,143,
-132,32,236,132,160,237,131,157,237,149,152,236,167,128,32,236,149,138,236,157,140,46,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,236,136,168,234,185,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,235,179,128,234,178,189,32,237,153,149,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,236,151,133,235,161,156,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,
-139,164,236,154,180,235,161,156,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,236,131,136,32,236,149,133,234,184,176,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,117,103,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,114,101,109,111,118,101,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,236,138,164,237,138,184,235,161,156,235,182,128,237,132,176,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,
-114,111,117,116,101,58,58,100,105,115,99,111,110,110,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,132,236,178,180,235,161,156,235,182,128,237,132,176,32,236,151,176,234,178,176,32,237,149,180,236,160,156,34,125,44,123,
-34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,235,161,156,235,182,128,237,
-132,176,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,235,161,156,32,235,182,128,237,132,176,32,236,152,164,235,148,148,236,152,164,32,235,176,155,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,
-100,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,32,236,152,164,235,148,148,236,152,164,32,236,160,132,235,139,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,
-111,110,58,58,114,111,117,116,101,58,58,103,101,116,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,32,235,182,128,237,132,176,32,77,73,68,73,32,235,176,155,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,
-109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,32,77,73,68,73,32,236,160,132,235,139,172,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,97,114,112,101,103,103,105,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,235,165,180,237,142,152,236,
-167,128,236,152,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,
-237,142,153,237,134,160,235,167,129,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,100,105,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,236,139,156,234,176,132,32,235,182,132,237,149,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,237,142,184,236,167,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,236,156,132,235,161,156,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,
-111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,235,158,152,235,161,156,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,
-105,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,32,236,136,168,234,185,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,115,104,111,119,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,32,236,160,128,236,158,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,111,109,109,105,116,97,108,108,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,236,160,132,236,178,180,32,237,153,149,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,114,101,115,101,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,236,160,132,236,178,180,32,236,180,136,234,184,176,237,153,148,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,132,236,139,156,236,
-160,128,236,158,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,132,236,139,156,236,160,128,236,158,165,32,236,160,156,234,177,176,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,236,156,188,235,161,156,235,182,
-128,237,132,176,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,164,
-235,178,132,235,158,169,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,114,101,116,114,111,103,114,97,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
-34,58,34,236,151,173,237,150,137,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,135,235,139,168,236,157,140,237,145,156,235,165,188,32,
-237,149,169,236,185,152,235,139,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,135,235,139,183,236,157,140,237,145,156,34,125,44,
-123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,133,139,236,158,135,235,139,168,236,157,140,237,145,156,34,125,44,123,34,110,97,109,101,34,58,34,109,
-101,110,117,58,58,116,117,112,108,101,116,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,132,183,236,158,135,235,139,168,236,157,140,237,145,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,
-101,116,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,139,164,236,132,175,236,158,135,235,139,168,236,157,140,237,145,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,
-108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,
-101,108,101,116,101,58,58,99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,166,132,236,157,180,32,236,157,188,236,185,152,237,149,152,236,167,128,32,236,149,138,236,138,181,235,139,136,235,139,
-164,33,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,235,139,171,234,
-184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,
-34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,160,136,236,157,180,236,150,180,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,
-58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,144,235,143,153,237,153,148,32,236,182,148,234,176,128,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,167,136,236,138,164,237,132,176,32,237,133,156,237,143,172,34,125,44,123,34,
-110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,234,176,128,236,160,184,32,236,152,164,234,184,176,
-34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,76,65,67,235,161,156,32,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,111,103,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,71,71,235,161,156,32,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
-117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,118,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,65,66,235,161,156,32,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
-58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,175,184,235,148,148,32,237,143,172,235,167,183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,115,97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,32,236,160,128,236,158,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,112,114,111,106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,237,140,169,237,132,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,
-116,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,156,132,235,161,156,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,
-99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,235,158,152,235,161,156,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
-58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,149,235,160,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,
-111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,142,184,236,167,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,
-58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,236,160,188,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,
-58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,
-116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,
-114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,
-109,101,110,116,58,58,115,104,111,119,101,100,105,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,136,236,176,168,32,237,142,184,236,167,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,
-114,117,109,101,110,116,58,58,97,100,100,101,102,102,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,154,168,234,179,188,32,235,167,136,235,148,148,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
-110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,235,167,136,235,148,148,32,236,182,148,234,176,128,34,
-125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,140,235,159,172,234,183,184,236,157,184,32,235,166,
-172,236,138,164,237,138,184,32,236,158,172,235,161,156,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,237,143,180,235,141,148,32,236,138,164,236,186,148,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,132,236,178,180,32,236,132,
-160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,
-176,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,34,125,44,123,34,110,97,109,
-101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,164,145,235,179,181,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,
-99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,138,184,235,158,153,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,
-112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,32,237,148,132,235,161,156,236,160,157,237,138,184,32,236,139,156,236,158,145,34,125,44,123,34,110,97,109,101,34,58,34,109,
-101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,236,151,180,234,184,176,34,125,44,
-123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,140,236,134,140,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,185,132,236,157,140,236,134,140,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,143,
-140,236,149,132,234,176,128,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,235,170,169,34,125,44,123,
-34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,145,234,179,161,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,
-101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,164,235,170,133,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,
-99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,157,188,236,157,180,236,132,188,236,138,164,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,
-114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,184,184,236,157,180,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,236,139,156,236,158,145,236,157,188,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,235,178,132,236,160,132,32,236,160,156,236,150,180,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,235,130,180,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-237,140,140,236,157,188,32,236,156,132,236,185,152,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,237,129,180,235,166,173,237,149,152,236,151,172,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,
-108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,131,173,237,149,152,236,151,172,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,
-58,58,100,101,102,97,117,108,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,181,235,170,133,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,
-97,117,108,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,128,236,158,145,234,182,140,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,112,
-108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,172,236,154,169,32,234,176,128,235,138,165,237,149,156,32,236,152,164,235,148,148,236,152,164,32,237,148,140,235,159,172,234,183,184,236,157,184,34,125,44,123,
-34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,172,236,154,169,32,236,164,145,236,157,184,32,236,
-149,133,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,118,101,110,100,111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,140,235,159,
-172,234,183,184,32,236,157,184,32,234,179,181,234,184,137,32,236,151,133,236,178,180,32,235,176,143,32,236,157,180,235,166,132,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,99,97,116,101,103,111,
-114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,185,180,237,133,140,234,179,160,235,166,172,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,102,111,114,109,97,116,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,181,172,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,235,179,181,236,130,172,237,149,160,32,237,143,180,235,141,148,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,
-114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,32,237,148,132,235,161,156,236,160,157,237,138,184,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,100,
-105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,128,236,158,165,237,149,160,32,237,140,140,236,157,188,236,157,132,32,236,132,160,237,131,157,237,149,152,
-236,132,184,236,154,148,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,130,180,235,179,180,235,130,
-188,32,237,140,140,236,157,188,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,235,179,180,235,130,180,234,184,176,32,236,153,132,235,163,140,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,235,182,136,235,159,172,236,152,172,32,194,160,237,140,140,236,157,188,32,236,132,160,237,131,157,40,76,111,97,100,41,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,
-112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,182,136,235,159,172,236,152,172,32,237,140,140,236,157,188,32,236,132,160,237,131,157,40,73,109,112,111,114,116,41,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
-111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,46,46,46,235,161,156,32,235,160,140,235,141,148,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,
-101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,160,140,235,141,148,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,
-116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,160,140,235,141,148,32,236,164,145,235,139,168,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,
-101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,167,140,235,147,164,32,237,140,140,236,157,188,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,
-107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,163,168,237,138,184,32,237,130,164,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,156,188,235,156,184,237,153,148,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,236,131,129,236,163,188,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,235,169,148,235,148,148,236,149,136,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,235,178,132,234,184,136,235,148,184,235,166,188,237,153,148,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,235,148,184,235,166,188,237,153,148,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
-58,34,236,132,156,235,184,140,235,169,148,235,148,148,236,149,136,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,236,132,156,235,184,140,237,134,160,235,139,137,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,164,235,148,148,236,
-152,164,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,184,176,234,184,176,34,125,44,123,34,110,97,109,101,
-34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,147,156,235,157,188,236,157,180,235,178,132,34,125,44,123,34,110,97,109,101,34,58,34,115,101,
-116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,152,237,148,140,32,235,160,136,236,157,180,237,138,184,34,125,44,123,34,110,97,109,101,34,
-58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,237,141,188,32,236,130,172,236,157,180,236,166,136,34,125,44,123,34,110,
-97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,32,237,133,140,235,167,136,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,
-117,97,103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,101,108,105,111,32,235,178,136,236,151,173,236,151,144,32,235,143,132,236,155,128,236,163,188,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,115,
-101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,32,235,169,148,236,157,180,236,187,164,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,
-114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,184,176,235,179,184,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,
-58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,
-34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,114,101,71,114,97,112,
-104,105,99,115,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,34,194,160,68,105,114,101,99,116,50,68,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,
-58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,110,97,116,105,118,101,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,
-101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,235,160,140,235,141,148,235,159,172,235,138,148,32,237,129,176,32,237,148,132,235,161,156,236,160,157,237,138,184,235,
-147,164,235,179,180,235,139,164,32,235,185,160,235,165,180,236,167,128,235,167,140,32,235,152,144,237,149,156,32,236,130,172,236,154,169,236,158,144,236,157,152,32,237,149,152,235,147,156,236,155,168,236,150,180,236,151,144,32,235,148,176,235,157,188,
-32,235,182,136,236,149,136,236,160,149,237,149,160,32,236,136,152,32,236,158,136,236,138,181,235,139,136,235,139,164,46,32,79,112,101,110,71,76,235,161,156,32,235,176,148,234,190,184,236,139,156,234,178,160,236,138,181,235,139,136,234,185,140,63,34,125,
-44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,108,32,236,130,172,236,154,169,34,125,44,123,34,110,
-97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,153,149,236,157,184,32,235,169,148,236,132,184,236,167,128,32,236,
-136,152,235,157,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,153,149,236,157,184,34,
-125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,235,144,156,32,235,179,128,234,
-178,189,236,130,172,237,149,173,236,157,132,32,236,180,136,234,184,176,237,153,148,32,237,149,152,236,139,156,234,178,160,236,138,181,235,139,136,234,185,140,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,
-101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,180,136,234,184,176,237,153,148,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,
-111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,32,237,153,149,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,
-101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,178,128,236,131,137,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,136,236,139,156,34,125,44,
-123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,182,148,234,176,128,235,144,156,34,125,44,123,34,110,97,109,101,34,58,34,
-118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,234,177,176,235,144,156,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,
-101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,235,144,156,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,
-58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,128,236,158,165,237,149,160,32,235,179,128,234,178,189,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,
-58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,180,136,234,184,176,237,153,148,237,149,160,32,235,179,128,234,178,189,32,236,132,160,237,131,157,34,125,
-44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,136,168,234,178,168,236,167,132,32,235,179,128,234,178,189,
-236,130,172,237,149,173,236,157,132,32,235,179,181,234,181,172,237,149,160,32,236,136,152,32,236,151,134,236,138,181,235,139,136,235,139,164,46,32,236,157,180,32,236,138,164,237,133,140,236,157,180,236,167,128,235,138,148,32,235,185,132,236,150,180,236,
-158,136,236,167,128,32,236,149,138,236,138,181,235,139,136,235,139,164,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,
-132,235,161,156,236,160,157,237,138,184,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,176,
-156,236,160,149,32,237,138,184,235,166,172,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,108,111,99,97,108,194,160,237,158,136,
-236,138,164,237,134,160,235,166,172,234,176,128,32,236,157,180,235,175,184,32,236,181,156,236,139,160,32,236,131,129,237,131,156,236,158,133,235,139,136,235,139,164,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,
-111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,170,168,235,145,144,32,236,153,132,235,163,140,235,144,152,236,151,136,236,138,181,235,139,136,235,139,164,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,
-101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,237,131,128,236,158,132,32,235,157,188,236,157,184,34,125,44,123,34,110,97,109,101,34,58,
-34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,236,160,149,235,179,180,34,125,44,123,34,110,97,109,
-101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,236,160,132,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,234,179,188,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,150,180,236,160,156,34,125,
-44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,151,133,235,141,176,236,157,180,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,
-116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,180,136,234,184,176,237,153,148,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,34,235,157,188,236,157,180,236,132,188,236,138,164,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,236,160,156,235,170,169,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,
-145,234,179,161,234,176,128,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,164,
-235,170,133,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,137,234,185,148,32,235,179,128,234,178,189,
-235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,185,136,32,236,139,156,237,128,128,236,138,164,34,125,44,123,34,110,97,109,101,
-34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,185,136,32,237,140,168,237,132,180,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,
-110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,187,168,237,138,184,235,161,164,235,159,172,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,236,157,180,236,152,164,235,139,136,236,149,132,236,139,157,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,151,144,236,152,172,235,166,172,236,150,184,
-34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,235,148,148,236,149,132,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,235,175,185,236,134,148,235,166,172,235,148,148,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,143,132,235,166,
-172,236,149,136,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,166,172,236,167,128,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,
-105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,235,169,148,236,157,180,236,160,128,32,236,132,160,236,156,168,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,167,136,236,157,180,
-235,132,136,32,236,132,160,236,156,168,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,169,148,236,157,180,236,160,128,32,237,153,148,236,132,177,
-34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,167,136,236,157,180,235,132,136,32,237,153,148,236,132,177,34,125,44,123,34,110,97,109,101,34,
-58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,151,157,234,176,128,235,166,172,236,150,184,32,235,169,148,236,157,180,236,160,128,34,125,44,123,34,110,97,109,101,34,58,34,72,
-117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,151,157,234,176,128,235,166,172,236,150,184,32,235,167,136,236,157,180,235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,
-112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,130,152,237,143,180,235,166,172,236,150,184,32,235,169,148,236,157,180,236,160,128,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,
-111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,130,152,237,143,180,235,166,172,236,150,184,32,235,167,136,236,157,180,235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,
-105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,235,167,136,235,139,136,236,150,184,32,235,169,148,236,157,180,236,160,128,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,
-77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,235,167,136,235,139,136,236,150,184,32,235,167,136,236,157,180,235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,139,136,234,183,184,235,167,164,237,139,177,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,236,157,180,235,139,136,234,183,184,235,167,164,237,139,177,32,235,167,136,236,157,180,235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,235,166,172,235,148,148,236,149,136,32,235,143,132,235,175,184,235,132,140,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,235,166,172,235,148,148,236,149,136,32,236,150,180,234,183,184,235,168,188,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,235,166,172,235,148,148,236,149,136,32,234,176,144,236,134,140,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
-34,235,175,185,236,134,140,235,161,156,235,148,148,236,150,184,32,236,150,180,234,183,184,235,168,188,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,
-97,116,105,111,110,34,58,34,237,148,132,235,166,172,236,167,128,236,150,184,32,235,143,132,235,175,184,235,132,140,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,112,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,
-116,105,111,110,34,58,34,236,154,184,237,138,184,235,157,188,32,237,148,132,235,166,172,236,167,128,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,
-105,111,110,34,58,34,235,157,188,237,129,172,235,166,172,236,150,184,32,235,143,132,235,175,184,235,132,140,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,
-110,34,58,34,236,138,136,237,141,188,235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,154,184,237,138,
-184,235,157,188,235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,169,148,236,157,180,236,160,128,32,
-235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,76,101,97,100,105,110,103,32,87,104,111,108,101,45,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,168,236,157,140,32,235,166,
-172,235,148,169,34,125,44,123,34,110,97,109,101,34,58,34,68,111,117,98,108,101,32,72,97,114,109,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,141,148,235,184,148,32,237,149,152,235,170,168,235,139,136,34,125,44,123,34,
-110,97,109,101,34,58,34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,176,152,234,176,144,34,125,44,123,34,110,97,109,101,34,58,34,65,108,116,101,114,101,100,32,68,111,109,105,
-110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,140,237,132,176,235,147,156,32,235,143,132,235,175,184,235,132,140,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,
-110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,237,151,181,237,131,128,237,134,160,235,139,137,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,237,148,132,235,166,172,236,167,128,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,111,100,105,102,105,101,100,34,44,34,
-116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,235,170,168,235,148,148,237,140,140,236,157,180,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,235,175,185,236,138,164,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,235,166,172,235,148,169,32,237,134,164,34,125,44,123,34,110,97,109,101,34,58,34,82,111,99,107,39,110,39,82,111,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
-235,161,185,236,149,164,235,164,140,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,164,235,148,148,236,152,164,32,236,158,133,235,160,165,34,125,44,
-123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,164,235,148,148,236,152,164,32,236,182,156,235,160,165,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,
-105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,236,158,133,235,160,165,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,34,77,73,68,73,32,236,182,156,235,160,165,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,
-115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,177,132,235,132,144,32,236,158,133,235,160,165,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,
-177,132,235,132,144,235,147,164,32,236,158,133,235,160,165,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,177,132,235,132,144,32,236,182,156,235,160,165,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,
-125,32,236,177,132,235,132,144,235,147,164,32,236,182,156,235,160,165,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,
-97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,133,184,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,
-236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,
-116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,235,133,184,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,
-123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,
-100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,235,133,184,237,138,184,34,44,34,112,108,117,114,97,108,70,111,
-114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,
-58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,34,
-44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
-34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,
-32,123,120,125,32,236,157,180,235,178,164,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,235,147,
-164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,
-97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,
-120,125,32,236,157,180,235,178,164,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,
-108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,237,129,180,235,166,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,
-234,176,128,235,144,156,32,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,
-34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,237,129,180,235,166,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,
-109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,
-125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,237,129,180,235,166,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
-49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,
-101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,163,188,236,132,157,34,44,34,112,
-108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,163,188,236,132,157,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,
-44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,
-123,120,125,32,236,163,188,236,132,157,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,236,163,188,236,132,157,235,147,164,34,44,34,112,108,117,
-114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,
-101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,163,188,236,132,157,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,163,
-188,236,132,157,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,
-110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,
-34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,
-120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,
-34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,
-58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,
-235,179,128,234,178,189,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,235,176,
-149,236,158,144,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,
-114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,161,176,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,
-58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,
-101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,236,161,176,237,145,156,34,44,34,112,108,117,114,97,108,
-70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,
-101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,
-32,236,161,176,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,
-111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,133,184,237,138,184,34,44,34,112,
-108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,
-125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,157,180,235,178,164,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
-97,109,101,34,58,34,123,120,125,32,236,157,180,235,178,164,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,
-44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,163,188,236,132,157,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,163,
-188,236,132,157,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,176,149,236,158,144,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,176,149,236,158,144,237,145,156,
-235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,
-34,110,97,109,101,34,58,34,123,120,125,32,236,161,176,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,
-111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,237,129,180,235,166,189,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,
-32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,237,140,168,237,132,180,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,
-101,34,58,34,123,120,125,32,237,140,168,237,132,180,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,
-111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,160,136,236,157,180,236,150,180,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,160,136,236,157,180,236,150,180,
-235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,
-34,58,34,123,120,125,32,235,179,128,234,178,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,179,128,234,178,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,
-34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,141,184,237,131,128,34,44,34,112,108,117,114,97,
-108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,141,184,237,131,128,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,
-110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,182,132,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,
-32,235,182,132,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,
-34,123,120,125,32,236,180,136,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,180,136,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,
-101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,236,151,144,236,132,156,32,236,152,174,234,178,168,236,167,144,34,44,34,112,108,
-117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,13,10,93,125,125,0,0 };
+34,58,34,123,120,125,228,184,170,232,176,131,229,143,183,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,231,137,135,230,174,181,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,230,160,183,229,188,143,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,
+115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,229,177,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,
+115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,231,137,136,230,156,172,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,
+34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,228,184,170,229,183,174,229,188,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,
+44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,229,136,134,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
+125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,231,167,146,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
+49,34,125,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,228,187,142,123,120,125,228,184,173,231,167,187,233,153,164,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,100,34,58,34,106,97,34,44,34,110,97,109,101,34,58,34,230,151,165,230,156,172,232,170,158,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,
+58,34,49,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,233,150,139,229,167,139,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,110,97,109,101,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,232,166,143,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,
+114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,232,166,143,227,131,172,227,130,164,227,131,164,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,
+109,112,111,116,114,97,99,107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,134,227,131,179,227,131,157,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,227,130,185,227,130,191,227,130,184,227,130,170,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+230,165,189,229,153,168,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,168,173,229,174,154,34,125,44,123,34,110,97,109,101,34,58,34,116,114,
+101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,188,227,130,184,227,131,167,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,145,227,130,191,227,131,188,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,
+116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,229,144,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,
+110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,
+110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,
+110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,
+111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,227,131,134,227,130,173,227,130,185,227,131,136,239,
+188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,
+142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,227,130,146,231,183,168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,139,141,229,173,144,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,
+101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,
+116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,139,141,229,173,144,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,
+103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,227,129,151,227,129,132,229,176,143,231,175,128,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,170,191,229,143,183,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,
+34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,
+101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,170,191,229,143,183,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,
+107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,170,191,229,143,183,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,
+34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,173,227,131,188,227,129,168,233,159,179,233,154,
+142,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,
+172,227,130,164,227,131,164,227,131,188,227,129,174,229,144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,112,114,111,99,101,101,
+100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,99,107,58,58,99,97,112,116,105,111,
+110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,172,227,130,164,227,131,164,227,131,188,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,99,97,
+112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,171,227,131,154,227,130,184,227,130,168,227,131,188,227,130,191,227,131,188,227,130,146,228,189,156,230,136,144,34,125,44,123,34,110,97,109,101,34,58,
+34,100,105,97,108,111,103,58,58,97,100,100,97,114,112,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,156,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,
+101,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,92,110,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,230,176,184,228,185,133,227,
+129,171,229,137,138,233,153,164,227,129,151,227,129,190,227,129,153,227,129,139,239,188,136,227,130,132,227,130,138,231,155,180,227,129,151,227,129,167,227,129,141,227,129,190,227,129,155,227,130,147,239,188,137,239,188,159,34,125,44,123,34,110,97,109,
+101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,227,129,
+153,227,130,139,227,129,159,227,130,129,227,129,171,227,129,175,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,229,144,141,227,130,146,229,133,165,229,138,155,227,129,151,227,129,166,227,129,143,227,129,160,227,129,149,227,129,
+132,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,117,116,104,58,58,103,105,116,104,117,98,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,71,105,116,72,117,98,227,129,167,227,131,173,227,130,176,227,
+130,164,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,173,227,131,163,227,131,179,227,130,187,227,
+131,171,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,129,169,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,
+100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,
+111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,227,130,173,227,131,163,227,131,179,227,130,187,227,131,171,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,227,131,145,227,130,191,227,131,188,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,229,164,137,230,155,180,227,130,146,227,131,129,227,130,167,227,131,131,227,130,175,227,130,162,227,130,166,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,
+105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,183,168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,
+114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,138,227,129,171,232,187,162,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,
+58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,227,129,171,232,187,162,231,189,174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,114,101,102,97,99,116,111,114,105,110,103,58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,135,141,232,164,135,227,130,146,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,229,137,138,233,153,164,34,125,44,123,34,
+110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,141,229,137,141,227,129,140,228,184,128,
+232,135,180,227,129,151,227,129,190,227,129,155,227,130,147,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,
+227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,233,150,137,227,129,152,227,130,139,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,227,131,172,227,130,164,227,131,164,227,131,188,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,227,130,170,227,131,188,227,131,136,227,131,161,227,131,188,227,130,183,227,131,167,227,131,179,227,130,146,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,
+101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,161,227,130,164,227,131,179,227,131,134,227,131,179,227,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,
+111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,227,130,146,229,143,150,227,130,138,232,190,188,227,129,191,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
+110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,
+111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,70,76,65,67,227,129,171,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,
+110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,111,103,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,71,71,227,129,171,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,
+34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,118,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,87,65,86,227,129,171,230,155,184,227,129,141,229,135,186,227,129,151,34,125,44,123,34,
+110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,227,129,171,230,155,184,227,129,141,229,135,186,227,129,
+151,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,115,97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,239,188,154,
+34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,149,227,130,161,227,130,175,227,130,191,34,125,
+44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,138,227,129,171,232,187,162,231,189,174,34,125,
+44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,184,139,227,129,171,232,187,162,231,189,
+174,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,172,227,131,179,
+227,130,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,231,183,168,233,155,134,34,125,
+44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,188,227,130,184,227,131,167,227,131,179,
+34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,
+130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,
+129,174,229,144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,230,165,189,229,153,168,227,130,146,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,227,131,151,227,131,169,227,130,176,227,130,164,227,131,179,227,131,170,227,130,185,227,131,136,227,130,146,229,134,141,232,170,173,232,190,188,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,
+110,116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,135,227,130,163,227,131,172,227,130,175,227,131,136,227,131,170,227,130,146,227,130,185,227,130,173,227,131,163,227,131,179,34,
+125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,138,160,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,133,168,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,
+58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,165,189,229,153,168,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,
+58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,144,141,229,137,141,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,
+107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,164,135,232,163,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,172,227,130,164,227,131,164,227,131,188,227,130,146,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,
+101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,232,166,143,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,233,150,139,229,167,139,34,125,44,123,34,110,97,109,101,
+34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,
+227,130,146,233,150,139,227,129,143,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,146,227,131,159,227,131,165,227,131,188,227,131,136,34,125,44,123,34,
+110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,129,174,227,131,159,227,131,165,227,131,188,227,131,136,227,130,146,232,167,163,233,153,164,34,125,44,123,34,110,97,
+109,101,34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,136,187,227,130,139,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,105,116,108,101,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,191,227,130,164,227,131,136,227,131,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,228,189,156,232,128,133,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,232,169,179,231,180,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,169,227,130,164,227,130,187,227,
+131,179,227,130,185,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,149,183,227,129,149,34,125,44,123,34,110,
+97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,233,150,139,229,167,139,230,151,165,230,153,130,34,125,44,123,34,110,97,109,101,34,
+58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,188,227,130,184,227,131,167,227,131,179,227,130,179,227,131,179,227,131,136,
+227,131,173,227,131,188,227,131,171,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,134,
+133,229,174,185,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,149,227,130,161,227,130,164,
+227,131,171,227,129,174,229,160,180,230,137,128,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,227,130,175,227,131,170,227,131,131,227,130,175,227,129,151,227,129,166,231,183,168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,
+116,58,58,118,97,108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,191,227,131,131,227,131,151,227,129,151,227,129,166,231,183,168,233,155,134,34,125,44,123,34,110,97,109,101,34,58,34,112,97,
+103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,140,191,229,144,141,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,
+114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,112,121,114,105,103,104,116,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,
+58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,92,110,227,130,185,227,130,173,227,131,163,227,131,179,227,129,153,227,130,139,227,131,149,227,130,169,227,131,171,227,
+131,128,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,230,150,176,232,166,143,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,228,189,156,230,136,144,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,
+101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,191,157,229,173,152,227,129,153,227,130,139,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,
+101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,130,175,227,130,185,227,131,157,227,131,188,227,131,136,227,129,153,227,
+130,139,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,130,175,227,130,185,227,131,157,227,131,188,227,131,136,229,174,140,228,186,134,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,
+101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,170,173,227,129,191,232,190,188,227,130,128,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,
+101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,143,150,227,130,138,232,190,188,227,130,128,227,131,149,227,130,161,227,130,164,227,
+131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,129,
+141,229,135,186,227,129,151,229,133,136,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,
+227,129,141,229,135,186,227,129,151,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,129,141,229,135,186,
+227,129,151,228,184,173,230,173,162,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,155,184,227,
+129,141,229,135,186,227,129,153,227,131,149,227,130,161,227,130,164,227,131,171,227,130,146,233,129,184,230,138,158,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,230,160,185,233,159,179,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,227,131,136,227,131,139,227,131,131,227,130,175,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,
+130,185,227,131,188,227,131,145,227,131,188,227,131,136,227,131,139,227,131,131,227,130,175,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,227,131,161,227,131,135,227,130,163,227,130,162,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,227,130,181,227,131,150,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,
+58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,
+58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,181,227,131,150,227,131,161,227,131,135,227,130,163,227,130,162,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,
+58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,181,227,131,150,227,131,136,227,131,139,227,131,131,227,130,175,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,
+58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,170,227,131,188,227,131,135,227,130,163,227,130,170,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,
+101,118,105,99,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,135,227,131,144,227,130,164,227,130,185,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,
+114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,137,227,131,169,227,130,164,227,131,144,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,
+101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,181,227,131,179,227,131,151,227,131,170,227,131,179,227,130,176,229,145,168,230,179,162,230,149,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,
+97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,131,227,131,149,227,130,161,227,130,181,227,130,164,227,130,186,34,125,44,123,34,110,97,109,101,34,58,34,115,
+101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,227,131,134,227,131,188,227,131,158,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,
+58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,101,108,105,111,227,130,146,231,191,187,232,168,179,227,129,153,227,130,139,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,
+100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,227,131,172,227,131,179,227,131,128,227,131,169,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,
+100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,135,227,131,149,227,130,169,227,131,171,227,131,136,227,131,172,227,131,179,227,131,128,227,131,169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,
+97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,227,131,172,227,131,179,227,131,128,227,131,169,227,
+130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,67,111,114,101,71,114,97,112,104,105,99,115,227,131,172,227,131,179,227,131,128,227,131,169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,
+105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,68,105,114,101,99,116,50,68,227,131,172,227,131,179,227,131,128,227,131,169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,
+116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,141,227,130,164,227,131,134,227,130,163,227,131,150,227,131,172,227,131,179,227,131,128,227,131,
+169,227,130,146,228,189,191,231,148,168,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,227,
+131,172,227,131,179,227,131,128,227,131,169,227,129,175,228,184,128,232,136,172,231,154,132,227,129,171,229,183,168,229,164,167,227,129,170,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,146,233,171,152,233,128,159,227,
+129,171,230,137,177,227,129,136,227,129,190,227,129,153,227,129,140,227,128,129,227,131,143,227,131,188,227,131,137,227,130,166,227,130,167,227,130,162,227,129,171,227,130,136,227,129,163,227,129,166,227,129,175,228,184,141,229,174,137,229,174,154,227,
+129,171,227,129,170,227,130,139,229,143,175,232,131,189,230,128,167,227,129,140,227,129,130,227,130,138,227,129,190,227,129,153,227,128,130,79,112,101,110,71,76,227,129,171,229,164,137,230,155,180,227,129,151,227,129,190,227,129,153,227,129,139,239,188,
+159,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,227,130,146,228,189,191,231,148,168,34,
+125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,179,227,131,159,227,131,131,227,131,136,227,
+131,161,227,131,131,227,130,187,227,131,188,227,130,184,239,188,154,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,227,130,179,227,131,159,227,131,131,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,233,129,184,230,138,158,227,129,151,227,129,159,229,164,137,230,155,180,227,130,146,227,131,170,227,130,187,227,131,131,227,131,136,227,129,151,227,129,190,227,129,153,227,129,139,239,188,159,34,125,44,123,34,110,97,109,101,34,58,34,
+100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,130,187,227,131,131,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,100,
+105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,119,97,114,110,105,110,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,179,227,131,159,227,131,131,227,131,136,227,129,149,227,130,140,227,129,166,227,
+129,132,227,129,170,227,129,132,229,164,137,230,155,180,227,129,140,227,129,130,227,130,138,227,129,190,227,129,153,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,
+112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,137,230,155,180,227,130,146,227,131,129,227,130,167,227,131,131,227,130,175,227,130,162,227,130,166,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,105,
+110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,230,164,156,231,180,162,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,
+109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,137,138,233,153,164,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,229,174,159,228,189,147,229,140,150,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,191,189,229,
+138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,
+137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,228,191,157,229,173,152,227,129,153,227,130,139,229,164,137,230,155,180,227,130,146,233,129,184,230,138,158,227,129,151,227,129,166,227,129,143,227,129,160,227,129,149,227,129,132,227,128,130,34,125,44,123,34,110,97,109,101,34,
+58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,130,187,227,131,131,227,131,136,227,129,153,227,130,139,229,164,137,230,155,
+180,227,130,146,233,129,184,230,138,158,227,129,151,227,129,166,227,129,143,227,129,160,227,129,149,227,129,132,227,128,130,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,
+114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,185,227,131,134,227,131,188,227,130,184,227,129,140,231,169,186,227,129,167,227,129,170,227,129,132,227,129,159,227,130,129,227,130,185,227,130,191,227,131,131,227,130,183,227,
+131,165,227,129,149,227,130,140,227,129,159,229,164,137,230,155,180,227,130,146,230,136,187,227,129,153,227,129,147,227,129,168,227,129,140,227,129,167,227,129,141,227,129,190,227,129,155,227,130,147,227,128,130,34,125,44,123,34,110,97,109,101,34,58,
+34,118,99,115,58,58,115,116,97,103,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,129,174,229,164,137,230,155,180,34,125,44,123,
+34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,121,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,164,137,230,155,180,227,131,132,227,131,170,227,131,188,34,125,44,123,34,110,97,109,
+101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,177,165,230,173,180,227,129,175,230,156,128,230,150,176,227,129,167,227,129,153,227,128,130,34,125,44,123,
+34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,174,140,228,186,134,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,
+105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,227,130,191,227,130,164,227,131,160,227,131,169,227,130,164,227,131,179,34,125,44,123,34,110,
+97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,151,227,131,173,227,130,184,227,130,167,227,130,175,227,131,136,230,131,133,
+229,160,177,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,144,227,131,188,227,130,184,227,131,167,227,131,179,34,125,44,123,34,110,
+97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,129,168,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,97,121,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,230,152,168,230,151,165,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,131,131,
+227,131,151,227,131,135,227,131,188,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,229,136,157,230,156,159,229,140,150,227,130,146,229,174,159,
+232,161,140,34,125,44,123,34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,169,227,130,164,227,130,187,227,131,179,227,130,185,227,130,146,229,164,137,
+230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,191,227,130,164,227,131,136,227,131,171,227,130,146,229,164,137,230,155,180,34,125,
+44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,228,189,156,232,128,133,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,100,
+101,115,99,114,105,112,116,105,111,110,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,169,179,231,180,176,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,
+99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,232,137,178,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,231,169,186,227,129,174,227,131,172,227,130,164,227,131,164,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,231,169,186,227,129,174,227,131,145,227,130,191,227,131,188,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+230,165,189,229,153,168,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,179,227,131,179,
+227,131,136,227,131,173,227,131,188,227,131,169,227,130,146,229,164,137,230,155,180,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,130,164,227,130,170,227,131,
+139,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,168,227,130,170,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,
+58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,227,131,159,227,130,175,227,130,189,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,68,111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,227,131,137,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,149,227,131,170,227,130,174,227,130,162,227,131,179,34,125,44,
+123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,97,
+106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,161,227,131,173,227,131,135,227,130,163,227,131,131,227,130,175,227,131,161,227,130,184,227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,
+105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,161,227,131,173,227,131,135,227,130,163,227,131,131,227,130,175,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,
+72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,143,227,131,188,227,131,162,227,131,139,227,131,131,227,130,175,227,131,161,227,130,184,227,131,163,227,131,188,34,125,44,123,34,110,
+97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,143,227,131,188,227,131,162,227,131,139,227,131,131,227,130,175,227,131,158,227,130,164,227,131,138,227,131,188,
+34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,143,227,131,179,227,130,172,227,131,170,227,130,162,227,131,179,227,131,161,227,130,184,
+227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,143,227,131,179,227,130,172,227,131,170,227,130,162,227,131,179,
+227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,141,227,130,162,227,131,157,227,131,
+170,227,130,191,227,131,179,227,131,161,227,130,184,227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,141,227,
+130,162,227,131,157,227,131,170,227,130,191,227,131,179,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,227,131,173,227,131,158,227,131,139,227,130,162,227,131,179,227,131,161,227,130,184,227,131,163,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,227,131,173,227,131,158,227,131,139,227,130,162,227,131,179,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,227,130,168,227,131,139,227,130,176,227,131,158,227,131,134,227,130,163,227,131,131,227,130,175,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,227,130,168,227,131,139,227,130,176,227,131,158,227,131,134,227,130,163,227,131,131,227,130,175,227,131,158,227,130,164,227,131,138,227,131,188,34,125,44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,32,65,117,103,109,101,110,116,101,100,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,162,227,130,164,227,130,170,227,131,139,227,130,162,227,131,179,227,130,170,227,131,188,227,130,176,227,131,161,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,
+105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,
+101,34,58,34,76,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,227,130,170,227,131,188,227,130,176,227,131,161,227,131,179,
+227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,227,131,135,227,
+130,163,227,131,159,227,131,139,227,131,131,227,130,183,227,131,165,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,
+159,227,130,175,227,130,189,227,131,170,227,131,135,227,130,163,227,130,162,227,131,179,227,130,170,227,131,188,227,130,176,227,131,161,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,
+97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,149,227,131,170,227,130,174,227,130,162,227,131,179,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,
+112,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,166,227,131,171,227,131,136,227,131,169,227,131,149,227,131,170,227,130,174,227,130,162,227,131,179,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,
+114,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,227,131,137,227,131,159,227,131,138,227,131,179,227,131,136,34,125,44,123,34,110,97,
+109,101,34,58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,185,227,131,188,227,131,145,227,131,188,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,
+97,109,101,34,58,34,85,108,116,114,97,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,166,227,131,171,227,131,136,227,131,169,227,131,173,227,130,175,227,131,170,227,130,162,227,131,179,34,125,44,123,34,110,
+97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,170,227,131,188,227,131,135,227,130,163,227,130,170,229,133,165,229,138,155,34,125,44,123,34,110,97,109,101,34,58,34,65,117,
+100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,227,130,170,227,131,188,227,131,135,227,130,163,227,130,170,229,135,186,229,138,155,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,
+117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,229,133,165,229,138,155,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,
+68,73,229,135,186,229,138,155,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,229,133,165,229,138,155,227,131,129,227,131,163,227,131,179,227,131,141,227,131,171,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,
+125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,229,135,186,229,138,155,227,131,129,227,131,163,227,131,179,227,131,141,227,131,171,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,
+131,142,227,131,188,227,131,136,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,
+111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,142,227,131,188,227,131,136,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,
+190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,123,34,110,97,109,101,34,58,34,227,131,142,227,131,188,227,131,136,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,
+110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,164,227,131,153,227,131,179,227,131,136,32,123,120,125,32,227,130,146,
+232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,164,227,131,153,227,131,179,227,131,136,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,164,
+227,131,153,227,131,179,227,131,136,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,
+101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,227,131,151,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,
+129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,227,131,151,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,
+125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,227,131,151,32,123,120,125,
+32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,
+116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,
+129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,
+159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+123,34,110,97,109,101,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,
+230,139,141,229,173,144,232,168,152,229,143,183,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,
+34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,32,123,
+120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,
+109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,230,139,141,229,173,144,232,168,152,229,143,183,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,
+227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,232,170,191,229,143,183,32,123,120,125,32,227,130,146,232,191,189,229,138,160,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,
+49,34,125,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,232,170,191,229,
+143,183,32,123,120,125,32,227,130,146,229,137,138,233,153,164,227,129,151,227,129,190,227,129,151,227,129,159,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,
+125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,232,170,191,229,143,183,32,123,120,125,32,227,130,146,229,164,137,230,155,180,227,129,151,227,129,190,
+227,129,151,227,129,159,227,128,130,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,
+101,34,58,34,227,131,142,227,131,188,227,131,136,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,164,227,131,153,227,131,179,227,131,136,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,
+97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,162,227,131,142,227,131,134,227,131,188,227,130,183,227,131,167,227,131,179,32,123,120,125,227,129,164,34,44,34,
+112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,
+58,34,230,139,141,229,173,144,232,168,152,229,143,183,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,
+115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,232,170,191,229,143,183,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,
+120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,130,175,227,131,170,227,131,131,227,131,151,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,
+34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,145,227,130,191,227,131,188,227,131,179,123,120,125,227,129,164,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,172,227,130,
+164,227,131,164,227,131,188,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,172,227,131,147,227,130,184,227,131,167,227,131,179,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,
+100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,227,131,135,227,131,171,227,130,191,32,123,120,125,227,129,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,44,123,
+34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,229,136,134,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,
+44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,231,167,146,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
+125,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,227,129,139,227,130,137,231,167,187,229,139,149,34,
+44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,44,13,10,123,34,105,100,34,58,34,107,114,34,44,34,110,97,109,101,34,58,34,237,149,156,234,181,173,236,150,180,34,44,34,112,108,117,114,97,108,69,113,117,97,116,105,111,110,34,58,
+34,40,123,120,125,61,61,49,32,63,32,49,32,58,32,50,41,34,44,34,108,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,116,58,58,102,105,114,115,116,99,111,109,109,105,
+116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,236,139,156,236,158,145,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,112,114,111,106,101,99,
+116,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,32,237,148,132,235,161,156,236,160,157,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,110,101,119,116,114,97,99,
+107,58,58,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,32,237,138,184,235,158,153,34,125,44,123,34,110,97,109,101,34,58,34,100,101,102,97,117,108,116,115,58,58,116,101,109,112,111,116,114,97,99,107,58,58,110,
+97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,133,156,237,143,172,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,114,111,111,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,138,164,237,
+138,156,235,148,148,236,152,164,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,105,110,115,116,114,117,109,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,34,125,44,123,34,110,97,109,
+101,34,58,34,116,114,101,101,58,58,115,101,116,116,105,110,103,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,164,236,160,149,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,118,99,115,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,235,178,132,236,160,132,34,125,44,123,34,110,97,109,101,34,58,34,116,114,101,101,58,58,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,140,168,237,132,180,34,125,44,123,34,
+110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,157,180,
+235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,163,188,236,132,157,32,236,182,148,234,176,128,
+34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,163,188,236,132,157,32,237,133,
+141,236,138,164,237,138,184,32,236,158,133,235,160,165,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,110,110,111,116,97,116,105,111,110,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,236,163,188,236,132,157,32,237,142,184,236,167,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,103,101,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,235,176,149,236,158,144,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,
+176,149,236,158,144,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,235,176,149,236,158,144,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,116,105,109,101,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,235,161,156,236,154,180,32,235,167,136,235,148,148,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,99,104,97,110,
+103,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,130,164,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,100,101,108,101,116,101,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,237,130,164,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,101,100,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,237,130,164,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,107,101,121,115,105,103,110,97,116,117,114,101,58,58,97,100,100,58,58,99,97,112,116,105,111,110,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,130,164,32,47,32,236,157,140,234,179,132,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,114,97,99,107,58,58,99,97,112,
+116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,138,184,235,158,153,32,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,97,109,101,116,
+114,97,99,107,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,166,132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,97,100,100,116,114,97,
+99,107,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,138,184,235,158,153,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,112,114,
+111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,235,165,188,32,236,152,129,234,181,172,32,236,130,173,236,160,156,237,149,152,236,139,156,234,
+178,160,236,138,181,235,139,136,234,185,140,63,40,236,136,152,236,160,149,237,149,160,32,236,136,152,32,236,151,134,236,138,181,235,139,136,235,139,164,46,41,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,101,108,101,116,101,
+112,114,111,106,101,99,116,58,58,99,111,110,102,105,114,109,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,234,177,176,32,237,153,149,236,157,184,236,157,132,32,236,156,132,237,149,180,32,237,148,
+132,235,161,156,236,160,157,237,138,184,32,236,157,180,235,166,132,236,157,132,32,236,158,133,235,160,165,237,149,152,236,132,184,236,154,148,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,99,97,
+110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,183,168,236,134,140,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,112,112,108,121,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,236,160,129,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,234,177,
+176,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,99,111,109,109,111,110,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,
+117,58,58,99,97,110,99,101,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,183,168,236,134,140,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,111,112,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,235,179,181,236,130,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,99,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,152,235,157,188,235,130,180,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,
+109,101,110,117,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,173,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,117,103,
+105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,235,144,156,32,237,148,140,235,159,172,234,183,184,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,
+110,58,58,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,105,112,115,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,103,101,34,44,34,116,114,97,110,115,108,97,116,
+105,111,110,34,58,34,236,132,160,237,131,157,235,144,156,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,104,105,115,116,111,114,121,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,235,144,156,32,235,178,132,236,160,188,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,99,111,109,109,105,116,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,153,149,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,114,101,115,101,116,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,236,180,136,234,184,176,237,153,148,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,97,108,108,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,235,170,168,235,145,144,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,101,108,101,99,116,110,111,110,101,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,235,172,180,234,178,131,235,143,132,32,236,132,160,237,131,157,237,149,152,236,167,128,32,236,149,138,236,157,140,46,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,
+108,101,99,116,105,111,110,58,58,118,99,115,58,58,115,116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,136,168,234,185,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,
+58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,32,237,153,149,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
+105,111,110,58,58,118,99,115,58,58,112,117,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,151,133,235,161,156,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,
+118,99,115,58,58,112,117,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,139,164,236,154,180,235,161,156,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,112,108,
+117,103,105,110,58,58,105,110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,32,236,149,133,234,184,176,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,
+105,111,110,58,58,112,108,117,103,105,110,58,58,112,108,117,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,
+101,99,116,105,111,110,58,58,112,108,117,103,105,110,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,236,138,164,237,138,184,235,161,156,235,182,128,237,132,176,32,236,160,156,234,177,176,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,100,105,115,99,111,110,110,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,132,236,178,180,235,161,
+156,235,182,128,237,132,176,32,236,151,176,234,178,176,32,237,149,180,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,114,101,109,111,118,101,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,235,161,156,235,182,128,237,132,176,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,
+101,58,58,103,101,116,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,32,235,182,128,237,132,176,32,236,152,164,235,148,148,236,152,164,32,235,176,155,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,
+101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,32,236,152,164,235,148,148,236,152,164,32,236,160,132,235,
+139,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,103,101,116,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,32,235,182,128,
+237,132,176,32,77,73,68,73,32,235,176,155,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,114,111,117,116,101,58,58,115,101,110,100,109,105,100,105,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,235,161,156,32,77,73,68,73,32,236,160,132,235,139,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,97,114,112,101,103,103,105,97,116,101,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,235,165,180,237,142,152,236,167,128,236,152,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,101,115,58,58,114,
+101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,237,142,153,237,134,160,235,167,129,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,110,111,116,
+101,115,58,58,100,105,118,105,115,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,139,156,234,176,132,32,235,182,132,237,149,160,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,
+111,110,58,58,99,108,105,112,115,58,58,101,100,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,142,184,236,167,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,101,99,116,105,111,110,58,58,99,108,
+105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,156,132,235,161,156,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,115,101,108,
+101,99,116,105,111,110,58,58,99,108,105,112,115,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,235,158,152,235,161,156,32,235,179,128,234,178,189,34,125,44,123,34,
+110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,104,105,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,32,236,136,168,234,185,128,34,125,44,123,34,110,97,109,
+101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,99,104,97,110,103,101,115,58,58,115,104,111,119,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,32,236,160,128,236,158,165,34,125,44,123,34,110,97,109,101,34,58,34,
+109,101,110,117,58,58,118,99,115,58,58,99,111,109,109,105,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,132,236,178,180,32,237,153,149,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,
+99,115,58,58,114,101,115,101,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,132,236,178,180,32,236,180,136,234,184,176,237,153,148,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,115,
+116,97,115,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,132,236,139,156,236,160,128,236,158,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,118,99,115,58,58,112,111,112,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,236,158,132,236,139,156,236,160,128,236,158,165,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,97,114,112,101,103,103,105,97,116,111,114,115,58,58,99,114,101,97,116,101,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,236,156,188,235,161,156,235,182,128,237,132,176,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,110,103,
+58,58,99,108,101,97,110,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,164,235,178,132,235,158,169,32,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,114,101,102,97,99,116,111,114,105,
+110,103,58,58,114,101,116,114,111,103,114,97,100,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,151,173,237,150,137,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,49,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,236,158,135,235,139,168,236,157,140,237,145,156,235,165,188,32,237,149,169,236,185,152,235,139,164,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,50,34,44,34,116,
+114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,135,235,139,183,236,157,140,237,145,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+236,133,139,236,158,135,235,139,168,236,157,140,237,145,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,132,183,236,158,135,235,139,168,
+236,157,140,237,145,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,117,112,108,101,116,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,139,164,236,132,175,236,158,135,235,139,168,236,157,140,237,145,156,
+34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,236,130,173,236,160,
+156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,100,101,108,101,116,101,58,58,99,97,110,99,101,108,108,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,166,132,236,
+157,180,32,236,157,188,236,185,152,237,149,152,236,167,128,32,236,149,138,236,138,181,235,139,136,235,139,164,33,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,117,110,108,111,97,100,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,235,139,171,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,105,116,101,109,115,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,108,97,121,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,235,160,136,236,157,180,236,150,180,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,97,117,116,111,109,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,236,158,144,235,143,153,237,153,148,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,97,100,100,116,101,109,112,111,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,235,167,136,236,138,164,237,132,176,32,237,133,156,237,143,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,105,109,112,111,114,116,58,58,109,105,100,105,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,234,176,128,236,160,184,32,236,152,164,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,34,44,34,116,114,97,110,
+115,108,97,116,105,111,110,34,58,34,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,102,108,97,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,70,76,65,67,235,161,156,32,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,111,103,103,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,79,71,71,235,161,156,32,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,119,97,118,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+87,65,66,235,161,156,32,235,179,128,237,153,152,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,109,105,100,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,
+235,175,184,235,148,148,32,237,143,172,235,167,183,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,110,100,101,114,58,58,115,97,118,101,100,116,111,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,235,161,156,32,236,160,128,236,158,165,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,114,101,102,97,99,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,
+237,140,169,237,132,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,117,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,156,132,235,161,156,
+32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,116,114,97,110,115,112,111,115,101,58,58,100,111,119,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,132,
+235,158,152,235,161,156,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,236,160,149,235,160,172,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,108,105,110,101,97,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,
+142,184,236,167,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,101,100,105,116,111,114,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,236,160,188,34,125,44,
+123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,112,114,111,106,101,99,116,58,58,99,104,97,110,103,101,58,58,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,235,179,128,
+234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,114,101,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,157,180,235,166,
+132,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,
+236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,115,104,111,119,101,100,105,116,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,136,236,176,
+168,32,237,142,184,236,167,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,101,102,102,101,99,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,154,168,234,
+179,188,32,235,167,136,235,148,148,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,58,58,97,100,100,105,110,115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,235,167,136,235,148,148,32,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,108,111,97,100,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,140,235,159,172,234,183,184,236,157,184,32,235,166,172,236,138,164,237,138,184,32,236,158,172,235,161,156,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,105,110,
+115,116,114,117,109,101,110,116,115,58,58,115,99,97,110,102,111,108,100,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,143,180,235,141,148,32,236,138,164,236,186,148,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,
+58,105,110,115,116,114,117,109,101,110,116,115,58,58,97,100,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,182,148,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,115,101,108,101,
+99,116,97,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,132,236,178,180,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,99,104,97,110,103,101,58,58,105,110,
+115,116,114,117,109,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,114,101,110,97,109,101,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,117,112,108,105,99,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,236,164,145,235,179,181,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,116,114,97,99,107,58,58,100,101,108,101,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,138,184,235,158,153,32,236,160,156,234,
+177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,99,114,101,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,32,237,148,132,
+235,161,156,236,160,157,237,138,184,32,236,139,156,236,158,145,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,119,111,114,107,115,112,97,99,101,58,58,112,114,111,106,101,99,116,58,58,111,112,101,110,34,44,34,116,114,97,110,115,108,97,
+116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,236,151,180,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,140,
+236,134,140,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,109,101,110,117,58,58,117,110,109,117,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,185,132,236,157,140,236,134,140,234,177,176,34,125,44,123,34,110,97,109,101,
+34,58,34,109,101,110,117,58,58,98,97,99,107,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,143,140,236,149,132,234,176,128,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,116,
+105,116,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,235,170,169,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,236,158,145,234,179,161,234,176,128,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,115,99,114,105,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,
+34,58,34,236,132,164,235,170,133,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,157,188,236,157,180,236,132,188,
+236,138,164,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,117,114,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,184,184,236,157,180,34,125,44,123,34,110,97,109,
+101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,115,116,97,114,116,100,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,139,156,236,158,145,236,157,188,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,
+58,58,112,114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,118,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,236,160,132,32,236,160,156,236,150,180,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,
+114,111,106,101,99,116,58,58,115,116,97,116,115,58,58,99,111,110,116,101,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,130,180,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,
+116,58,58,102,105,108,101,108,111,99,97,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,140,140,236,157,188,32,236,156,132,236,185,152,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,
+116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,100,101,115,107,116,111,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,129,180,235,166,173,237,149,152,236,151,172,32,236,131,157,236,132,177,34,125,44,123,34,110,
+97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,118,97,108,117,101,58,58,109,111,98,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,131,173,237,149,152,236,151,172,
+32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,97,117,116,104,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,181,
+235,170,133,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,112,114,111,106,101,99,116,58,58,100,101,102,97,117,108,116,58,58,108,105,99,101,110,115,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,128,236,158,145,
+234,182,140,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,112,108,117,103,105,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,172,236,154,169,32,234,176,128,235,138,165,
+237,149,156,32,236,152,164,235,148,148,236,152,164,32,237,148,140,235,159,172,234,183,184,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,105,110,115,116,114,117,109,101,110,116,115,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,130,172,236,154,169,32,236,164,145,236,157,184,32,236,149,133,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,118,101,110,100,
+111,114,97,110,100,110,97,109,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,140,235,159,172,234,183,184,32,236,157,184,32,234,179,181,234,184,137,32,236,151,133,236,178,180,32,235,176,143,32,236,157,180,235,166,132,34,125,44,
+123,34,110,97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,99,97,116,101,103,111,114,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,185,180,237,133,140,234,179,160,235,166,172,34,125,44,123,34,110,
+97,109,101,34,58,34,112,97,103,101,58,58,111,114,99,104,101,115,116,114,97,58,58,102,111,114,109,97,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,181,172,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,
+58,58,115,99,97,110,102,111,108,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,181,236,130,172,237,149,160,32,237,143,180,235,141,148,32,236,132,160,237,131,157,34,125,44,123,34,110,97,
+109,101,34,58,34,100,105,97,108,111,103,58,58,119,111,114,107,115,112,97,99,101,58,58,99,114,101,97,116,101,112,114,111,106,101,99,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,136,32,237,148,
+132,235,161,156,236,160,157,237,138,184,32,236,131,157,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,115,97,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,
+160,128,236,158,165,237,149,160,32,237,140,140,236,157,188,236,157,132,32,236,132,160,237,131,157,237,149,152,236,132,184,236,154,148,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,101,120,
+112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,130,180,235,179,180,235,130,188,32,237,140,140,236,157,188,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,
+109,101,110,116,58,58,101,120,112,111,114,116,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,180,235,130,180,234,184,176,32,236,153,132,235,163,140,46,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,
+111,103,58,58,100,111,99,117,109,101,110,116,58,58,108,111,97,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,182,136,235,159,172,236,152,172,32,194,160,237,140,140,236,157,188,32,236,132,160,237,131,157,40,76,111,97,100,41,34,125,
+44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,100,111,99,117,109,101,110,116,58,58,105,109,112,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,182,136,235,159,172,236,152,172,32,237,140,140,236,157,188,32,
+236,132,160,237,131,157,40,73,109,112,111,114,116,41,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,46,46,46,235,
+161,156,32,235,160,140,235,141,148,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,160,140,235,141,148,34,125,
+44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,97,98,111,114,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,160,140,235,141,148,32,236,164,145,235,139,168,34,125,44,123,34,110,97,109,
+101,34,58,34,100,105,97,108,111,103,58,58,114,101,110,100,101,114,58,58,115,101,108,101,99,116,102,105,108,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,167,140,235,147,164,32,237,140,140,236,157,188,32,236,132,160,237,131,157,34,
+125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,114,111,111,116,107,101,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,163,168,237,138,184,32,237,130,164,34,125,44,123,34,110,97,109,101,34,
+58,34,112,111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,49,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,156,188,235,156,184,237,153,148,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,
+111,112,117,112,58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,50,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,129,236,163,188,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,
+99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,51,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,169,148,235,148,148,236,149,136,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,111,
+114,100,58,58,102,117,110,99,116,105,111,110,58,58,52,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,234,184,136,235,148,184,235,166,188,237,153,148,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,
+58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,53,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,148,184,235,166,188,237,153,148,236,157,140,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,58,58,99,104,
+111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,54,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,156,235,184,140,235,169,148,235,148,148,236,149,136,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,112,111,112,117,112,
+58,58,99,104,111,114,100,58,58,102,117,110,99,116,105,111,110,58,58,55,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,156,235,184,140,237,134,160,235,139,137,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,
+58,58,97,117,100,105,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,164,235,148,148,236,152,164,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,101,118,105,99,101,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,184,176,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,100,114,105,118,101,114,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,235,147,156,235,157,188,236,157,180,235,178,132,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,115,97,109,112,108,101,114,97,116,101,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,236,131,152,237,148,140,32,235,160,136,236,157,180,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,97,117,100,105,111,58,58,98,117,102,102,101,114,115,105,122,101,34,44,34,116,114,97,110,115,
+108,97,116,105,111,110,34,58,34,235,178,132,237,141,188,32,236,130,172,236,157,180,236,166,136,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,117,105,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,32,
+237,133,140,235,167,136,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,108,97,110,103,117,97,103,101,58,58,104,101,108,112,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,72,101,108,105,111,32,235,178,136,236,
+151,173,236,151,144,32,235,143,132,236,155,128,236,163,188,234,184,176,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,85,73,32,
+235,169,148,236,157,180,236,187,164,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,101,102,97,117,108,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,184,176,
+235,179,184,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,111,112,101,110,103,108,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,99,111,114,101,103,
+114,97,112,104,105,99,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,67,111,114,101,71,114,97,112,104,105,99,115,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,
+105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,100,105,114,101,99,116,50,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,194,160,68,105,114,101,99,116,50,68,32,235,169,148,236,157,180,236,187,164,32,236,130,172,236,154,169,
+34,125,44,123,34,110,97,109,101,34,58,34,115,101,116,116,105,110,103,115,58,58,114,101,110,100,101,114,101,114,58,58,110,97,116,105,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,110,97,116,105,118,101,32,235,169,148,236,157,180,
+236,187,164,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,76,32,235,
+160,140,235,141,148,235,159,172,235,138,148,32,237,129,176,32,237,148,132,235,161,156,236,160,157,237,138,184,235,147,164,235,179,180,235,139,164,32,235,185,160,235,165,180,236,167,128,235,167,140,32,235,152,144,237,149,156,32,236,130,172,236,154,169,
+236,158,144,236,157,152,32,237,149,152,235,147,156,236,155,168,236,150,180,236,151,144,32,235,148,176,235,157,188,32,235,182,136,236,149,136,236,160,149,237,149,160,32,236,136,152,32,236,158,136,236,138,181,235,139,136,235,139,164,46,32,79,112,101,110,
+71,76,235,161,156,32,235,176,148,234,190,184,236,139,156,234,178,160,236,138,181,235,139,136,234,185,140,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,111,112,101,110,103,108,58,58,112,114,111,99,101,101,100,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,79,112,101,110,71,108,32,236,130,172,236,154,169,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,99,97,112,116,105,111,110,34,44,34,116,114,
+97,110,115,108,97,116,105,111,110,34,58,34,237,153,149,236,157,184,32,235,169,148,236,132,184,236,167,128,32,236,136,152,235,157,189,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,111,109,109,105,116,58,58,112,
+114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,153,149,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,99,97,112,116,105,111,110,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,160,237,131,157,235,144,156,32,235,179,128,234,178,189,236,130,172,237,149,173,236,157,132,32,236,180,136,234,184,176,237,153,148,32,237,149,152,236,139,156,234,178,160,236,138,181,235,139,
+136,234,185,140,63,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,114,101,115,101,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,180,136,234,184,176,237,153,
+148,34,125,44,123,34,110,97,109,101,34,58,34,100,105,97,108,111,103,58,58,118,99,115,58,58,99,104,101,99,107,111,117,116,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,189,32,237,153,149,
+236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,115,101,97,114,99,104,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,178,128,236,131,137,34,125,44,123,34,110,97,109,101,34,58,34,
+105,110,115,116,114,117,109,101,110,116,115,58,58,114,101,109,111,118,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,234,177,176,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,115,58,58,105,
+110,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,136,236,139,156,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,97,100,100,101,100,34,44,34,116,114,97,110,115,108,
+97,116,105,111,110,34,58,34,236,182,148,234,176,128,235,144,156,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,114,101,109,111,118,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,
+58,34,236,160,156,234,177,176,235,144,156,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,100,101,108,116,97,58,58,116,121,112,101,58,58,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,179,128,234,178,
+189,235,144,156,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,99,111,109,109,105,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,128,236,158,165,237,149,160,32,
+235,179,128,234,178,189,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,115,101,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,180,
+136,234,184,176,237,153,148,237,149,160,32,235,179,128,234,178,189,32,236,132,160,237,131,157,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,119,97,114,110,105,110,103,58,58,99,97,110,110,111,116,114,101,118,101,114,116,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,236,136,168,234,178,168,236,167,132,32,235,179,128,234,178,189,236,130,172,237,149,173,236,157,132,32,235,179,181,234,181,172,237,149,160,32,236,136,152,32,236,151,134,236,138,181,235,139,136,235,139,164,46,32,
+236,157,180,32,236,138,164,237,133,140,236,157,180,236,167,128,235,138,148,32,235,185,132,236,150,180,236,158,136,236,167,128,32,236,149,138,236,138,181,235,139,136,235,139,164,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,116,97,103,
+101,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,138,184,32,235,179,128,234,178,189,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,104,105,115,116,111,114,
+121,58,58,99,97,112,116,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,176,156,236,160,149,32,237,138,184,235,166,172,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,117,112,116,111,100,97,116,
+101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,108,111,99,97,108,194,160,237,158,136,236,138,164,237,134,160,235,166,172,234,176,128,32,236,157,180,235,175,184,32,236,181,156,236,139,160,32,236,131,129,237,131,156,236,158,133,235,139,
+136,235,139,164,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,115,121,110,99,58,58,100,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,170,168,235,145,144,32,236,153,132,235,163,140,235,144,152,236,151,136,236,
+138,181,235,139,136,235,139,164,46,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,116,105,109,101,108,105,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,161,156,236,160,157,237,
+138,184,32,237,131,128,236,158,132,32,235,157,188,236,157,184,34,125,44,123,34,110,97,109,101,34,58,34,118,99,115,58,58,105,116,101,109,115,58,58,112,114,111,106,101,99,116,105,110,102,111,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,
+148,132,235,161,156,236,160,157,237,138,184,32,236,160,149,235,179,180,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,118,101,114,115,105,111,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,178,132,236,160,132,
+34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,97,110,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,234,179,188,34,125,44,123,34,110,97,109,101,34,58,34,99,111,109,109,111,110,58,58,121,101,115,116,101,114,100,
+97,121,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,150,180,236,160,156,34,125,44,123,34,110,97,109,101,34,58,34,117,112,100,97,116,101,58,58,112,114,111,99,101,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,
+151,133,235,141,176,236,157,180,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,105,110,105,116,105,97,108,105,122,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,180,136,234,184,176,237,153,148,235,144,168,34,125,44,123,
+34,110,97,109,101,34,58,34,108,105,99,101,110,115,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,157,188,236,157,180,236,132,188,236,138,164,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,
+97,109,101,34,58,34,116,105,116,108,101,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,160,156,235,170,169,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,97,117,116,104,111,
+114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,158,145,234,179,161,234,176,128,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,100,101,115,99,114,105,112,116,105,111,110,
+32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,132,164,235,170,133,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,99,111,108,111,114,32,99,104,97,110,103,101,100,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,131,137,234,185,148,32,235,179,128,234,178,189,235,144,168,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,115,101,113,117,101,110,99,101,34,44,34,116,114,97,110,115,108,97,116,105,
+111,110,34,58,34,235,185,136,32,236,139,156,237,128,128,236,138,164,34,125,44,123,34,110,97,109,101,34,58,34,101,109,112,116,121,32,112,97,116,116,101,114,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,185,136,32,237,140,168,237,
+132,180,34,125,44,123,34,110,97,109,101,34,58,34,105,110,115,116,114,117,109,101,110,116,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,133,234,184,176,32,235,179,128,234,178,189,235,144,168,34,125,44,
+123,34,110,97,109,101,34,58,34,99,111,110,116,114,111,108,108,101,114,32,99,104,97,110,103,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,187,168,237,138,184,235,161,164,235,159,172,32,235,179,128,234,178,189,235,144,168,34,125,
+44,123,34,110,97,109,101,34,58,34,73,111,110,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,236,152,164,235,139,136,236,149,132,236,139,157,34,125,44,123,34,110,97,109,101,34,58,34,65,101,111,108,105,97,110,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,151,144,236,152,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,235,148,148,236,
+149,132,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,175,185,236,134,148,235,166,172,235,148,148,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,68,
+111,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,143,132,235,166,172,236,149,136,34,125,44,123,34,110,97,109,101,34,58,34,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,
+148,132,235,166,172,236,167,128,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,76,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,
+34,58,34,77,101,108,111,100,105,99,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,169,148,236,157,180,236,160,128,32,236,132,160,236,156,168,34,125,44,123,34,110,97,109,101,34,58,34,77,101,108,111,100,105,99,32,77,
+105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,167,136,236,157,180,235,132,136,32,236,132,160,236,156,168,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,97,106,111,114,34,44,34,116,114,97,
+110,115,108,97,116,105,111,110,34,58,34,235,169,148,236,157,180,236,160,128,32,237,153,148,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,72,97,114,109,111,110,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,
+34,235,167,136,236,157,180,235,132,136,32,237,153,148,236,132,177,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,151,157,234,176,128,235,166,
+172,236,150,184,32,235,169,148,236,157,180,236,160,128,34,125,44,123,34,110,97,109,101,34,58,34,72,117,110,103,97,114,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,151,157,234,176,128,235,166,172,236,
+150,184,32,235,167,136,236,157,180,235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,130,152,237,143,180,235,166,172,236,150,
+184,32,235,169,148,236,157,180,236,160,128,34,125,44,123,34,110,97,109,101,34,58,34,78,101,97,112,111,108,105,116,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,130,152,237,143,180,235,166,172,236,150,184,
+32,235,167,136,236,157,180,235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,97,106,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,235,167,136,235,139,136,236,150,184,32,235,169,148,
+236,157,180,236,160,128,34,125,44,123,34,110,97,109,101,34,58,34,82,111,109,97,110,105,97,110,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,156,235,167,136,235,139,136,236,150,184,32,235,167,136,236,157,180,
+235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,69,110,105,103,109,97,116,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,139,136,234,183,184,235,167,164,237,139,177,34,125,44,123,34,110,97,109,101,34,58,34,69,
+110,105,103,109,97,116,105,99,32,77,105,110,111,114,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,157,180,235,139,136,234,183,184,235,167,164,237,139,177,32,235,167,136,236,157,180,235,132,136,34,125,44,123,34,110,97,109,101,34,58,34,
+76,121,100,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,235,148,148,236,149,136,32,235,143,132,235,175,184,235,132,140,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,76,121,
+100,105,97,110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,235,148,148,236,149,136,32,236,150,180,234,183,184,235,168,188,237,138,184,34,125,44,123,34,110,97,109,101,34,58,34,76,121,100,
+105,97,110,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,166,172,235,148,148,236,149,136,32,234,176,144,236,134,140,34,125,44,123,34,110,97,109,101,34,58,34,77,105,120,111,108,121,100,105,97,
+110,32,65,117,103,109,101,110,116,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,175,185,236,134,140,235,161,156,235,148,148,236,150,184,32,236,150,180,234,183,184,235,168,188,237,138,184,34,125,44,123,34,110,97,109,101,34,58,
+34,80,104,114,121,103,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,237,148,132,235,166,172,236,167,128,236,150,184,32,235,143,132,235,175,184,235,132,140,237,138,184,34,125,44,123,34,110,97,109,
+101,34,58,34,85,108,116,114,97,112,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,154,184,237,138,184,235,157,188,32,237,148,132,235,166,172,236,167,128,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,
+76,111,99,114,105,97,110,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,157,188,237,129,172,235,166,172,236,150,184,32,235,143,132,235,175,184,235,132,140,237,138,184,34,125,44,123,34,110,97,109,101,34,
+58,34,83,117,112,101,114,108,111,99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,138,136,237,141,188,235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,85,108,116,114,97,108,111,
+99,114,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,154,184,237,138,184,235,157,188,235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,77,97,106,111,114,32,76,111,99,114,105,97,110,34,
+44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,169,148,236,157,180,236,160,128,32,235,157,188,237,129,172,235,166,172,236,150,184,34,125,44,123,34,110,97,109,101,34,58,34,76,101,97,100,105,110,103,32,87,104,111,108,101,45,84,111,110,101,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,168,236,157,140,32,235,166,172,235,148,169,34,125,44,123,34,110,97,109,101,34,58,34,68,111,117,98,108,101,32,72,97,114,109,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,235,141,148,235,184,148,32,237,149,152,235,170,168,235,139,136,34,125,44,123,34,110,97,109,101,34,58,34,72,97,108,102,32,68,105,109,105,110,105,115,104,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,176,152,234,176,
+144,34,125,44,123,34,110,97,109,101,34,58,34,65,108,116,101,114,101,100,32,68,111,109,105,110,97,110,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,149,140,237,132,176,235,147,156,32,235,143,132,235,175,184,235,132,140,237,138,184,
+34,125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,72,101,112,116,97,116,111,110,105,99,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,237,151,181,237,131,128,237,134,160,235,139,137,34,
+125,44,123,34,110,97,109,101,34,58,34,66,108,117,101,115,32,80,104,114,121,103,105,97,110,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,237,148,132,235,166,172,236,167,128,236,150,184,34,125,44,123,
+34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,111,100,105,102,105,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,235,170,168,235,148,148,237,140,140,236,157,180,235,147,156,34,125,44,123,
+34,110,97,109,101,34,58,34,66,108,117,101,115,32,77,105,120,101,100,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,235,175,185,236,138,164,235,147,156,34,125,44,123,34,110,97,109,101,34,58,34,66,108,
+117,101,115,32,76,101,97,100,105,110,103,32,84,111,110,101,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,184,148,235,163,168,236,138,164,32,235,166,172,235,148,169,32,237,134,164,34,125,44,123,34,110,97,109,101,34,58,34,82,111,99,107,
+39,110,39,82,111,108,108,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,235,161,185,236,149,164,235,164,140,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,34,236,152,164,235,148,148,236,152,164,32,236,158,133,235,160,165,34,125,44,123,34,110,97,109,101,34,58,34,65,117,100,105,111,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,236,152,164,235,148,148,236,
+152,164,32,236,182,156,235,160,165,34,125,44,123,34,110,97,109,101,34,58,34,77,105,100,105,32,73,110,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,236,158,133,235,160,165,34,125,44,123,34,110,97,109,101,34,58,
+34,77,105,100,105,32,79,117,116,112,117,116,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,34,77,73,68,73,32,236,182,156,235,160,165,34,125,93,44,34,112,108,117,114,97,108,76,105,116,101,114,97,108,34,58,91,123,34,110,97,109,101,34,58,34,123,
+120,125,32,105,110,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,177,132,235,132,144,32,236,158,133,235,160,165,34,44,34,112,108,117,114,97,108,
+70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,177,132,235,132,144,235,147,164,32,236,158,133,235,160,165,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,
+34,123,120,125,32,111,117,116,112,117,116,32,99,104,97,110,110,101,108,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,177,132,235,132,144,32,236,182,156,235,160,165,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,177,132,235,132,144,235,147,164,32,236,182,156,235,160,165,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,
+101,34,58,34,97,100,100,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,133,184,237,138,184,34,44,34,112,
+108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,
+44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,235,133,
+184,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,
+34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,
+32,123,120,125,32,235,133,184,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,
+114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,
+234,176,128,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,157,180,235,178,
+164,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,
+177,176,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,101,118,101,110,
+116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,
+125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,157,180,235,178,164,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,
+100,100,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,237,129,180,235,166,189,34,44,34,112,108,117,114,97,
+108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,
+109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,237,129,180,235,166,189,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,
+125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,
+32,237,129,180,235,166,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,
+148,234,176,128,235,144,156,32,123,120,125,32,236,163,188,236,132,157,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,163,188,236,132,157,235,
+147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,
+110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,236,163,188,236,132,157,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,
+144,156,32,123,120,125,32,236,163,188,236,132,157,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,97,110,110,111,116,97,116,105,111,110,
+115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,163,188,236,132,157,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
+97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,163,188,236,132,157,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,123,120,125,
+32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,34,44,34,
+112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,
+34,125,93,125,44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,
+156,234,177,176,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,235,176,149,236,
+158,144,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,116,105,109,101,32,115,105,103,110,97,116,117,114,101,115,34,44,34,
+116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,
+97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,235,176,149,236,158,144,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,97,100,100,101,100,32,
+123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,161,176,237,145,156,34,44,34,112,
+108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,182,148,234,176,128,235,144,156,32,123,120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,
+44,123,34,110,97,109,101,34,58,34,114,101,109,111,118,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,
+144,156,32,123,120,125,32,236,161,176,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,236,160,156,234,177,176,235,144,156,32,123,120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,
+108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,99,104,97,110,103,101,100,32,123,120,125,32,107,101,121,32,115,105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,
+123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,120,125,32,236,161,176,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,235,179,128,234,178,189,235,144,156,32,123,
+120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,110,111,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,
+34,110,97,109,101,34,58,34,123,120,125,32,235,133,184,237,138,184,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,133,184,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,101,118,101,110,116,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,157,180,235,178,164,237,138,184,
+34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,157,180,235,178,164,237,138,184,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,
+97,109,101,34,58,34,123,120,125,32,97,110,110,111,116,97,116,105,111,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,163,188,236,132,157,34,44,34,112,108,117,114,97,108,70,111,114,
+109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,163,188,236,132,157,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,116,105,109,101,32,115,
+105,103,110,97,116,117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,176,149,236,158,144,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,
+34,110,97,109,101,34,58,34,123,120,125,32,235,176,149,236,158,144,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,107,101,121,32,115,105,103,110,97,116,
+117,114,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,161,176,237,145,156,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,
+120,125,32,236,161,176,237,145,156,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,99,108,105,112,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,
+34,110,97,109,101,34,58,34,123,120,125,32,237,129,180,235,166,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,237,129,180,235,166,189,235,147,164,34,44,34,112,108,117,114,97,108,70,
+111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,112,97,116,116,101,114,110,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,237,140,168,237,132,180,34,
+44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,237,140,168,237,132,180,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,
+34,123,120,125,32,108,97,121,101,114,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,160,136,236,157,180,236,150,180,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,
+123,34,110,97,109,101,34,58,34,123,120,125,32,235,160,136,236,157,180,236,150,180,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,114,101,118,105,115,105,111,110,115,
+34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,179,128,234,178,189,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,179,
+128,234,178,189,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,100,101,108,116,97,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,
+101,34,58,34,123,120,125,32,235,141,184,237,131,128,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,141,184,237,131,128,235,147,164,34,44,34,112,108,117,114,97,108,70,111,114,109,
+34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,109,105,110,117,116,101,115,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,235,182,132,34,44,34,112,108,117,114,97,108,
+70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,235,182,132,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,115,101,99,111,110,100,115,34,44,
+34,116,114,97,110,115,108,97,116,105,111,110,34,58,91,123,34,110,97,109,101,34,58,34,123,120,125,32,236,180,136,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,44,123,34,110,97,109,101,34,58,34,123,120,125,32,236,180,136,34,44,34,112,
+108,117,114,97,108,70,111,114,109,34,58,34,50,34,125,93,125,44,123,34,110,97,109,101,34,58,34,109,111,118,101,100,32,102,114,111,109,32,123,120,125,34,44,34,116,114,97,110,115,108,97,116,105,111,110,34,58,123,34,110,97,109,101,34,58,34,123,120,125,32,
+236,151,144,236,132,156,32,236,152,174,234,178,168,236,167,144,34,44,34,112,108,117,114,97,108,70,111,114,109,34,58,34,49,34,125,125,93,125,13,10,93,125,125,0,0 };
 
 const char* translations_json = (const char*) temp_binary_data_100;
 
@@ -3882,7 +3886,7 @@ const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
         case 0x25669f2b:  numBytes = 15292; return hotkeySchemes_json;
         case 0x048f5efe:  numBytes = 8357; return scales_json;
         case 0x77719112:  numBytes = 839; return temperaments_json;
-        case 0xf8655f25:  numBytes = 136595; return translations_json;
+        case 0xf8655f25:  numBytes = 136879; return translations_json;
         default: break;
     }
 
@@ -309,7 +309,7 @@ namespace BinaryData
     const int            temperaments_jsonSize = 839;
 
     extern const char*   translations_json;
-    const int            translations_jsonSize = 136595;
+    const int            translations_jsonSize = 136879;
 
     // Number of elements in the namedResourceList and originalFileNames arrays.
     const int namedResourceListSize = 101;
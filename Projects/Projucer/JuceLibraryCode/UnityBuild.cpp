@@ -19,9 +19,14 @@
 #include "../../Source/Core/Audio/Monitoring/AudioMonitor.cpp"
 #include "../../Source/Core/Audio/Monitoring/SpectrumAnalyzer.cpp"
 #include "../../Source/Core/Audio/Transport/MidiRecorder.cpp"
+#include "../../Source/Core/Audio/Transport/HeadlessRenderer.cpp"
 #include "../../Source/Core/Audio/Transport/PlayerThread.cpp"
 #include "../../Source/Core/Audio/Transport/RendererThread.cpp"
+#include "../../Source/Core/Audio/Transport/RenderWorkerPool.cpp"
+#include "../../Source/Core/Audio/Transport/SequencedMidiStream.cpp"
+#include "../../Source/Core/Audio/Transport/TempoMap.cpp"
 #include "../../Source/Core/Audio/Transport/Transport.cpp"
+#include "../../Source/Core/Audio/Transport/TransportPlaybackCache.cpp"
 #include "../../Source/Core/Audio/AudioCore.cpp"
 #include "../../Source/Core/Configuration/Models/Arpeggiator.cpp"
 #include "../../Source/Core/Configuration/Models/Chord.cpp"
@@ -75,7 +80,9 @@
 #include "../../Source/Core/Serialization/Autosaver.cpp"
 #include "../../Source/Core/Serialization/Document.cpp"
 #include "../../Source/Core/Serialization/DocumentHelpers.cpp"
+#include "../../Source/Core/Serialization/DocumentWriter.cpp"
 #include "../../Source/Core/Serialization/SerializedData.cpp"
+#include "../../Source/Core/Serialization/SerializedDataReader.cpp"
 #include "../../Source/Core/Serialization/BinarySerializer.cpp"
 #include "../../Source/Core/Serialization/JsonSerializer.cpp"
 #include "../../Source/Core/Serialization/XmlSerializer.cpp"
@@ -247,6 +254,7 @@
 #include "../../Source/UI/Sequencer/PatternRoll/ClipComponents/AutomationStepsClip/AutomationStepEventComponent.cpp"
 #include "../../Source/UI/Sequencer/PatternRoll/ClipComponents/AutomationStepsClip/AutomationStepEventsConnector.cpp"
 #include "../../Source/UI/Sequencer/PatternRoll/ClipComponents/PianoClip/PianoClipComponent.cpp"
+#include "../../Source/UI/Sequencer/PatternRoll/ClipComponents/PianoClip/PianoClipThumbnails.cpp"
 #include "../../Source/UI/Sequencer/PatternRoll/ClipComponents/ClipComponent.cpp"
 #include "../../Source/UI/Sequencer/PatternRoll/ClipComponents/DummyClipComponent.cpp"
 #include "../../Source/UI/Sequencer/PatternRoll/PatternRoll.cpp"
@@ -257,6 +265,7 @@
 #include "../../Source/UI/Sequencer/PianoRoll/NoteResizerLeft.cpp"
 #include "../../Source/UI/Sequencer/PianoRoll/NoteResizerRight.cpp"
 #include "../../Source/UI/Sequencer/PianoRoll/PianoRoll.cpp"
+#include "../../Source/UI/Sequencer/PianoRoll/PianoRollNotesIndex.cpp"
 #include "../../Source/UI/Sequencer/Sidebars/SequencerSidebarLeft.cpp"
 #include "../../Source/UI/Sequencer/Sidebars/SequencerSidebarRight.cpp"
 #include "../../Source/UI/Sequencer/MiniMaps/AnnotationsMap/AnnotationLargeComponent.cpp"
@@ -268,6 +277,7 @@
 #include "../../Source/UI/Sequencer/MiniMaps/LevelsMap/LevelsMapScroller.cpp"
 #include "../../Source/UI/Sequencer/MiniMaps/LevelsMap/VelocityProjectMap.cpp"
 #include "../../Source/UI/Sequencer/MiniMaps/PianoMap/PianoProjectMap.cpp"
+#include "../../Source/UI/Sequencer/MiniMaps/PianoMap/PianoProjectMapTiles.cpp"
 #include "../../Source/UI/Sequencer/MiniMaps/PianoMap/ProjectMapScroller.cpp"
 #include "../../Source/UI/Sequencer/MiniMaps/PianoMap/ProjectMapScrollerScreen.cpp"
 #include "../../Source/UI/Sequencer/MiniMaps/TimeSignaturesMap/TimeSignatureLargeComponent.cpp"
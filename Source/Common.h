@@ -81,6 +81,14 @@ struct IdentifierHash
     }
 };
 
+struct UuidHash
+{
+    inline HashCode operator()(const juce::Uuid &key) const noexcept
+    {
+        return static_cast<HashCode>(key.hash());
+    }
+};
+
 //===----------------------------------------------------------------------===//
 // Various helpers
 //===----------------------------------------------------------------------===//
@@ -26,6 +26,7 @@
 #include "XmlSerializer.h"
 #include "SerializationKeys.h"
 #include "SerializablePluginDescription.h"
+#include "HeadlessRenderer.h"
 
 #include "MainLayout.h"
 #include "Workspace.h"
@@ -480,10 +481,19 @@ void App::setTitleBarComponent(WeakReference<Component> component)
 // JUCEApplication
 //===----------------------------------------------------------------------===//
 
+// the command line options for the headless render mode
+static const String renderCommand = "--render";
+static const String blockSizeOption = "--block-size";
+static const String stemsOption = "--stems";
+
 void App::initialise(const String &commandLine)
 {
     this->runMode = App::NORMAL;
-    if (commandLine.isNotEmpty() &&
+    if (commandLine.trimStart().startsWith(renderCommand))
+    {
+        this->runMode = App::RENDER;
+    }
+    else if (commandLine.isNotEmpty() &&
         DocumentHelpers::getTempSlot(commandLine).existsAsFile())
     {
         this->runMode = App::PLUGIN_CHECK;
@@ -580,6 +590,11 @@ void App::initialise(const String &commandLine)
         this->checkPlugin(commandLine);
         this->quit();
     }
+    else if (this->runMode == App::RENDER)
+    {
+        this->renderProject(commandLine);
+        this->quit();
+    }
 }
 
 void App::shutdown()
@@ -622,6 +637,10 @@ const String App::getApplicationName()
     {
         return "Helio Plugin Check";
     }
+    else if (this->runMode == App::RENDER)
+    {
+        return "Helio Render";
+    }
 
     return "Helio";
 }
@@ -733,6 +752,72 @@ void App::checkPlugin(const String &markerFile)
     }
 }
 
+// Usage: helio --render <project.helio> <output.wav|flac> [--block-size N] [--stems]
+void App::renderProject(const String &commandLine)
+{
+#if JUCE_MAC
+    Process::setDockIconVisible(false);
+#endif
+
+    StringArray args(StringArray::fromTokens(commandLine, true));
+    for (auto &arg : args)
+    {
+        arg = arg.unquoted();
+    }
+
+    args.removeEmptyStrings();
+
+    const auto commandIndex = args.indexOf(renderCommand);
+    if (commandIndex < 0 || args.size() < commandIndex + 3)
+    {
+        Logger::writeToLog("Usage: " + renderCommand +
+            " <project.helio> <output.wav|flac> [" + blockSizeOption + " N] [" + stemsOption + "]");
+        this->setApplicationReturnValue(1);
+        return;
+    }
+
+    const File inputFile(File::getCurrentWorkingDirectory().getChildFile(args[commandIndex + 1]));
+    const File outputFile(File::getCurrentWorkingDirectory().getChildFile(args[commandIndex + 2]));
+
+    int blockSize = HeadlessRenderer::defaultBlockSize;
+    const auto blockSizeIndex = args.indexOf(blockSizeOption);
+    if (blockSizeIndex >= 0 && blockSizeIndex < args.size() - 1)
+    {
+        blockSize = jlimit(32, 8192, args[blockSizeIndex + 1].getIntValue());
+    }
+
+    // each instrument is also written into its own file next to the output one
+    const bool renderStems = args.contains(stemsOption);
+
+    HeadlessRenderer renderer;
+    auto result = renderer.loadProject(inputFile);
+
+    HeadlessRenderer::Stats stats;
+    if (result.wasOk())
+    {
+        result = renderer.render(outputFile, stats, blockSize, renderStems);
+    }
+
+    if (result.failed())
+    {
+        Logger::writeToLog("Render failed: " + result.getErrorMessage());
+        this->setApplicationReturnValue(1);
+        return;
+    }
+
+    Logger::writeToLog("Rendered " + String(stats.numTracks) + " tracks, " +
+        String(stats.numEvents) + " events to " + outputFile.getFullPathName());
+
+    if (renderStems)
+    {
+        Logger::writeToLog("Rendered " + String(stats.numStems) + " stems next to it");
+    }
+
+    Logger::writeToLog("Audio length: " + String(stats.renderedTimeMs / 1000.0, 2) +
+        " s, wall-clock time: " + String(stats.wallClockTimeMs / 1000.0, 2) +
+        " s, realtime factor: " + String(stats.getRealtimeFactor(), 1) + "x");
+}
+
 void App::handleAsyncUpdate()
 {
     JUCEApplication::quit();
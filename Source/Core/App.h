@@ -121,11 +121,13 @@ private:
 private:
 
     void checkPlugin(const String &markerFile);
+    void renderProject(const String &commandLine);
 
     enum RunMode
     {
         NORMAL,
-        PLUGIN_CHECK
+        PLUGIN_CHECK,
+        RENDER
     };
 
     App::RunMode runMode;
@@ -25,11 +25,37 @@ struct BuiltInSynthSound final : public SynthesiserSound
     bool appliesToChannel(int midiChannel) override { return true; }
 };
 
+// one period of the sine, shared by all voices, which read it
+// with the linear interpolation instead of calling std::sin for each sample;
+// the extra sample at the end is the first one, so that the interpolation
+// never needs to wrap around
+struct SineWavetable final
+{
+    static constexpr auto size = 2048;
+
+    SineWavetable()
+    {
+        for (int i = 0; i <= SineWavetable::size; ++i)
+        {
+            this->samples[i] = float(std::sin(MathConstants<double>::twoPi *
+                double(i) / double(SineWavetable::size)));
+        }
+    }
+
+    float samples[SineWavetable::size + 1];
+};
+
+static const SineWavetable &getSineWavetable() noexcept
+{
+    static const SineWavetable wavetable;
+    return wavetable;
+}
+
 class BuiltInSynthVoice final : public SynthesiserVoice
 {
 public:
 
-    BuiltInSynthVoice()
+    BuiltInSynthVoice() : wavetable(getSineWavetable())
     {
         ADSR::Parameters ap;
         ap.attack = 0.001f;
@@ -37,15 +63,6 @@ public:
         ap.sustain = 0.2f;
         ap.release = 0.5f;
         this->adsr.setParameters(ap);
-
-        Reverb::Parameters rp;
-        rp.roomSize = 0.0f;
-        rp.damping = 0.0f;
-        rp.wetLevel = 0.23f;
-        rp.dryLevel = 0.73f;
-        rp.width = 0.0f;
-        rp.freezeMode = 0.4f;
-        this->reverb.setParameters(rp);
     }
 
     bool canPlaySound(SynthesiserSound *) override
@@ -58,24 +75,29 @@ public:
         if (sampleRate > 0)
         {
             this->adsr.setSampleRate(sampleRate);
-            this->reverb.setSampleRate(sampleRate);
             SynthesiserVoice::setCurrentPlaybackSampleRate(sampleRate);
         }
     }
 
+    void setMaxBlockSize(int maxBlockSize)
+    {
+        this->buffer.setSize(1, maxBlockSize, false, false, true);
+    }
+
     void startNote(int midiNoteNumber, float velocity, SynthesiserSound*, int) override
     {
         const auto channel = this->getCurrentChannel();
         const int realNoteNumber = midiNoteNumber +
             Globals::twelveToneKeyboardSize * (channel - 1);
 
-        this->currentAngle = 0.0;
-        this->level = velocity * 0.15;
+        this->phase = 0.0;
+        this->level = velocity * 0.15f;
 
         const auto cyclesPerSecond = this->getNoteInHertz(realNoteNumber);
         const auto cyclesPerSample = cyclesPerSecond / this->getSampleRate();
 
-        this->angleDelta = cyclesPerSample * MathConstants<double>::twoPi;
+        // the frequencies above the sample rate alias, as they did with std::sin
+        this->phaseDelta = std::fmod(cyclesPerSample, 1.0) * SineWavetable::size;
 
         this->adsr.noteOn();
     }
@@ -90,7 +112,6 @@ public:
         {
             this->clearCurrentNote();
             this->adsr.reset();
-            this->reverb.reset();
         }
     }
 
@@ -99,23 +120,44 @@ public:
 
     void renderNextBlock(AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override
     {
-        if (this->adsr.isActive())
+        if (!this->adsr.isActive())
         {
-            while (--numSamples >= 0)
-            {
-                const auto amplitude = this->adsr.getNextSample();
-                auto currentSample = (float)(std::sin(currentAngle) * level * amplitude);
-                this->reverb.processMono(&currentSample, 1);
+            return;
+        }
+
+        // normally, a no-op, unless the block is larger than the expected one
+        this->buffer.setSize(1, numSamples, false, false, true);
 
-                for (auto i = outputBuffer.getNumChannels(); --i >= 0;)
-                {
-                    outputBuffer.addSample(i, startSample, currentSample);
-                }
+        auto *samples = this->buffer.getWritePointer(0);
+        const auto *table = this->wavetable.samples;
+        constexpr auto tableSize = double(SineWavetable::size);
 
-                this->currentAngle += this->angleDelta;
-                ++startSample;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto index = int(this->phase);
+            const auto fraction = float(this->phase - double(index));
+            samples[i] = table[index] + fraction * (table[index + 1] - table[index]);
+
+            this->phase += this->phaseDelta;
+            if (this->phase >= tableSize)
+            {
+                this->phase -= tableSize;
             }
         }
+
+        FloatVectorOperations::multiply(samples, this->level, numSamples);
+        this->adsr.applyEnvelopeToBuffer(this->buffer, 0, numSamples);
+
+        for (int i = 0; i < outputBuffer.getNumChannels(); ++i)
+        {
+            outputBuffer.addFrom(i, startSample, samples, numSamples);
+        }
+
+        // the release has ended, so the voice can be reused
+        if (!this->adsr.isActive())
+        {
+            this->clearCurrentNote();
+        }
     }
 
     using SynthesiserVoice::renderNextBlock;
@@ -128,15 +170,18 @@ public:
 
 private:
 
-    double currentAngle = 0.0;
-    double angleDelta = 0.0;
-    double level = 0.0;
+    // the position in the wavetable and its increment per sample
+    double phase = 0.0;
+    double phaseDelta = 0.0;
+    float level = 0.f;
 
     int periodSize = Globals::twelveTonePeriodSize;
     int middleC = Temperament::periodNumForMiddleC * Globals::twelveTonePeriodSize;
 
     ADSR adsr;
-    Reverb reverb;
+
+    const SineWavetable &wavetable;
+    AudioBuffer<float> buffer;
 
     double getNoteInHertz(int noteNumber, double frequencyOfA = 440.0) noexcept
     {
@@ -168,6 +213,65 @@ BuiltInSynth::BuiltInSynth()
     }
 
     this->addSound(new BuiltInSynthSound());
+
+    Reverb::Parameters rp;
+    rp.roomSize = 0.0f;
+    rp.damping = 0.0f;
+    rp.wetLevel = 0.23f;
+    rp.dryLevel = 0.73f;
+    rp.width = 0.0f;
+    rp.freezeMode = 0.4f;
+    this->reverb.setParameters(rp);
+}
+
+void BuiltInSynth::prepareToPlay(double sampleRate, int estimatedSamplesPerBlock)
+{
+    this->setCurrentPlaybackSampleRate(sampleRate);
+
+    const ScopedLock sl(this->lock);
+
+    this->monoBus.setSize(1, estimatedSamplesPerBlock, false, false, true);
+    for (int i = 0; i < this->getNumVoices(); ++i)
+    {
+        if (auto *voice = dynamic_cast<BuiltInSynthVoice *>(this->getVoice(i)))
+        {
+            voice->setMaxBlockSize(estimatedSamplesPerBlock);
+        }
+    }
+}
+
+void BuiltInSynth::setCurrentPlaybackSampleRate(double sampleRate)
+{
+    if (sampleRate > 0)
+    {
+        const ScopedLock sl(this->lock);
+        this->reverb.setSampleRate(sampleRate);
+    }
+
+    Synthesiser::setCurrentPlaybackSampleRate(sampleRate);
+}
+
+void BuiltInSynth::renderVoices(AudioBuffer<float> &outputAudio, int startSample, int numSamples)
+{
+    // normally, a no-op, unless the block is larger than the expected one
+    this->monoBus.setSize(1, numSamples, false, false, true);
+    this->monoBus.clear(0, 0, numSamples);
+
+    for (auto *voice : this->voices)
+    {
+        voice->renderNextBlock(this->monoBus, 0, numSamples);
+    }
+
+    // the reverb is linear, so a single one for the sum of all voices
+    // sounds the same as a reverb of each voice (except that the tails
+    // no longer get cut off when the voice stops)
+    auto *samples = this->monoBus.getWritePointer(0);
+    this->reverb.processMono(samples, numSamples);
+
+    for (int i = 0; i < outputAudio.getNumChannels(); ++i)
+    {
+        outputAudio.addFrom(i, startSample, samples, numSamples);
+    }
 }
 
 void BuiltInSynth::setPeriodSize(int periodSize)
@@ -181,6 +285,9 @@ void BuiltInSynth::setPeriodSize(int periodSize)
             voice->setPeriodSize(periodSize);
         }
     }
+
+    const ScopedLock sl(this->lock);
+    this->reverb.reset();
 }
 
 // the built-in synth doesn't have pedals.
@@ -189,3 +296,96 @@ void BuiltInSynth::handleSustainPedal(int midiChannel, bool isDown) {}
 // seriously, just want to make sure that once I send a note-off event,
 // the BuiltInSynthVoice shuts the fuck up regardless of controller states
 void BuiltInSynth::handleSostenutoPedal(int midiChannel, bool isDown) {}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class BuiltInSynthBenchmarkTests final : public UnitTest
+{
+public:
+    BuiltInSynthBenchmarkTests() : UnitTest("Built-in synth benchmark", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Rendering time versus the number of voices");
+
+        for (int numNotes = 1; numNotes <= maxNumNotes; numNotes *= 2)
+        {
+            BuiltInSynth synth;
+            synth.prepareToPlay(sampleRate, blockSize);
+
+            AudioBuffer<float> buffer(2, blockSize);
+            MidiBuffer midi;
+            for (int i = 0; i < numNotes; ++i)
+            {
+                midi.addEvent(MidiMessage::noteOn(1, 48 + i * 3, 0.8f), 0);
+            }
+
+            float magnitude = 0.f;
+            const auto startTime = Time::getMillisecondCounterHiRes();
+            for (int i = 0; i < numBlocks; ++i)
+            {
+                buffer.clear();
+                synth.renderNextBlock(buffer, midi, 0, blockSize);
+                magnitude = jmax(magnitude, buffer.getMagnitude(0, blockSize));
+                midi.clear();
+            }
+            const auto renderTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+
+            expectGreaterThan(magnitude, 0.f);
+
+            const auto audioTimeMs = 1000.0 * numBlocks * blockSize / sampleRate;
+            logMessage(String(numNotes) + " voices: " + String(renderTimeMs, 1) +
+                " ms to render " + String(audioTimeMs, 0) + " ms of audio (" +
+                String(100.0 * renderTimeMs / audioTimeMs, 2) + "% of the real time)");
+        }
+
+        beginTest("The voices are freed after the release");
+
+        BuiltInSynth synth;
+        synth.prepareToPlay(sampleRate, blockSize);
+
+        AudioBuffer<float> buffer(2, blockSize);
+        MidiBuffer midi;
+        midi.addEvent(MidiMessage::noteOn(1, 60, 0.8f), 0);
+        synth.renderNextBlock(buffer, midi, 0, blockSize);
+
+        int numActiveVoices = 0;
+        for (int i = 0; i < synth.getNumVoices(); ++i)
+        {
+            numActiveVoices += synth.getVoice(i)->isVoiceActive() ? 1 : 0;
+        }
+
+        expectEquals(numActiveVoices, 1);
+
+        midi.clear();
+        midi.addEvent(MidiMessage::noteOff(1, 60), 0);
+        synth.renderNextBlock(buffer, midi, 0, blockSize);
+
+        // the release is half a second
+        midi.clear();
+        for (int i = 0; i < int(sampleRate) / blockSize; ++i)
+        {
+            synth.renderNextBlock(buffer, midi, 0, blockSize);
+        }
+
+        for (int i = 0; i < synth.getNumVoices(); ++i)
+        {
+            expect(!synth.getVoice(i)->isVoiceActive());
+        }
+    }
+
+private:
+
+    static constexpr auto sampleRate = 44100.0;
+    static constexpr auto blockSize = 256;
+    static constexpr auto numBlocks = 2000;
+    static constexpr auto maxNumNotes = 16;
+};
+
+static BuiltInSynthBenchmarkTests builtInSynthBenchmarkTests;
+
+#endif
@@ -23,6 +23,13 @@ public:
 
     BuiltInSynth();
 
+    // sets the sample rate, and allocates the buffers for the given block size,
+    // so that the audio thread doesn't need to do that (if the block is larger
+    // than expected, the buffers will grow on the audio thread, though)
+    void prepareToPlay(double sampleRate, int estimatedSamplesPerBlock);
+
+    void setCurrentPlaybackSampleRate(double sampleRate) override;
+
     // what we want here is to make all built-in temperaments
     // work out of the box with the built-in instrument, so that
     // all features are easily previewed even before the user
@@ -40,7 +47,19 @@ protected:
     void handleSustainPedal(int midiChannel, bool isDown) override;
     void handleSostenutoPedal(int midiChannel, bool isDown) override;
 
+    // all voices are rendered block-wise into the mono bus,
+    // which then goes through the reverb once per block,
+    // instead of a reverb per voice processing one sample at a time
+    void renderVoices(AudioBuffer<float> &outputAudio,
+        int startSample, int numSamples) override;
+    using Synthesiser::renderVoices;
+
     static constexpr auto numVoices = 16;
 
+private:
+
+    AudioBuffer<float> monoBus;
+    Reverb reverb;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BuiltInSynth)
 };
@@ -57,7 +57,7 @@ void BuiltInSynthAudioPlugin::processBlock(AudioSampleBuffer &buffer, MidiBuffer
 
 void BuiltInSynthAudioPlugin::prepareToPlay(double sampleRate, int estimatedSamplesPerBlock)
 {
-    this->synth.setCurrentPlaybackSampleRate(sampleRate);
+    this->synth.prepareToPlay(sampleRate, estimatedSamplesPerBlock);
 }
 
 void BuiltInSynthAudioPlugin::reset()
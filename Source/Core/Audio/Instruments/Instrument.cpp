@@ -24,6 +24,7 @@
 #include "BuiltInSynthAudioPlugin.h"
 #include "BuiltInSynthFormat.h"
 #include "KeyboardMapping.h"
+#include "SequencedMidiStream.h"
 
 Instrument::Instrument(AudioPluginFormatManager &formatManager, const String &name) :
     formatManager(formatManager),
@@ -789,6 +790,11 @@ void Instrument::AudioCallback::setProcessor(AudioProcessor *const newOne)
     }
 }
 
+void Instrument::AudioCallback::setSequencedStream(SequencedMidiStream *stream) noexcept
+{
+    this->sequencedStream = stream;
+}
+
 void Instrument::AudioCallback::audioDeviceIOCallback(const float** const inputChannelData,
     const int numInputChannels, float **const outputChannelData,
     const int numOutputChannels, const int numSamples)
@@ -797,6 +803,12 @@ void Instrument::AudioCallback::audioDeviceIOCallback(const float** const inputC
 
     this->incomingMidi.clear();
     this->messageCollector.removeNextBlockOfMessages(this->incomingMidi, numSamples);
+
+    if (this->sequencedStream != nullptr)
+    {
+        this->sequencedStream->renderNextBlock(this->incomingMidi, numSamples);
+    }
+
     int totalNumChans = 0;
 
     if (numInputChannels > numOutputChannels)
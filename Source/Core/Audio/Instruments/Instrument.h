@@ -18,6 +18,7 @@
 #pragma once
 
 class KeyboardMapping;
+class SequencedMidiStream;
 
 class Instrument final :
     public Serializable,
@@ -50,6 +51,11 @@ public:
         void setProcessor(AudioProcessor *processor);
         MidiMessageCollector &getMidiMessageCollector() noexcept { return messageCollector; }
 
+        // the sample-accurate player's events are read right in the audio callback;
+        // the stream is only changed while holding the device's audio callback lock,
+        // and its owner should keep it alive until it's detached
+        void setSequencedStream(SequencedMidiStream *stream) noexcept;
+
         void audioDeviceIOCallback(const float **, int, float **, int, int) override;
         void audioDeviceAboutToStart(AudioIODevice *) override;
         void audioDeviceStopped() override;
@@ -70,6 +76,7 @@ public:
 
         MidiBuffer incomingMidi;
         MidiMessageCollector messageCollector;
+        SequencedMidiStream *sequencedStream = nullptr;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioCallback)
     };
@@ -59,10 +59,21 @@ private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OversaturationWarningAsyncCallback)
 };
 
-AudioMonitor::AudioMonitor() : fft()
+AudioMonitor::AudioMonitor() : Thread("AudioMonitor")
 {
     this->asyncClippingWarning = make<ClippingWarningAsyncCallback>(*this);
     this->asyncOversaturationWarning = make<OversaturationWarningAsyncCallback>(*this);
+
+    this->fftInput.allocate(SpectrumFFT::maxSize, true);
+    this->fftMagnitudes.allocate(SpectrumFFT::maxSize / 2, true);
+    this->history.clear();
+
+    this->startThread(3);
+}
+
+AudioMonitor::~AudioMonitor()
+{
+    this->stopThread(1000);
 }
 
 //===----------------------------------------------------------------------===//
@@ -78,13 +89,9 @@ void AudioMonitor::audioDeviceIOCallback(const float **inputChannelData, int num
     float **outputChannelData, int numOutputChannels, int numSamples)
 {
     const int minNumChannels = jmin(AudioMonitor::numChannels, numOutputChannels);
-    
-    for (int channel = 0; channel < minNumChannels; ++channel)
-    {
-        this->fft.computeSpectrum(outputChannelData[channel], 0, numSamples,
-            this->spectrum[channel], AudioMonitor::spectrumSize,
-            channel, numOutputChannels);
-    }
+
+    // the spectrum is computed on the analysis thread
+    this->pushSamples(outputChannelData, minNumChannels, numSamples);
     
     for (int channel = 0; channel < minNumChannels; ++channel)
     {
@@ -119,26 +126,206 @@ void AudioMonitor::audioDeviceIOCallback(const float **inputChannelData, int num
     }
 }
 
+void AudioMonitor::pushSamples(float **channelData,
+    int numChannelsAvailable, int numSamples) noexcept
+{
+    int start1, size1, start2, size2;
+    this->ringBufferFifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+    for (int channel = 0; channel < AudioMonitor::numChannels; ++channel)
+    {
+        if (channel < numChannelsAvailable)
+        {
+            const auto *data = channelData[channel];
+            this->ringBuffer.copyFrom(channel, start1, data, size1);
+            if (size2 > 0)
+            {
+                this->ringBuffer.copyFrom(channel, start2, data + size1, size2);
+            }
+        }
+        else
+        {
+            this->ringBuffer.clear(channel, start1, size1);
+            if (size2 > 0)
+            {
+                this->ringBuffer.clear(channel, start2, size2);
+            }
+        }
+    }
+
+    this->ringBufferFifo.finishedWrite(size1 + size2);
+
+    // only wakes up the analysis thread once after it went idle,
+    // so the callback doesn't signal it on every block
+    if (this->isAnalysisIdle.compareAndSetBool(false, true))
+    {
+        this->notify();
+    }
+}
+
+//===----------------------------------------------------------------------===//
+// Thread
+//===----------------------------------------------------------------------===//
+
+void AudioMonitor::run()
+{
+    bool hasNewSamples = false;
+    double lastUpdateTimeMs = 0.0;
+
+    while (!this->threadShouldExit())
+    {
+        const auto size = this->fftSize.get();
+        const bool sizeChanged = this->fft.getSize() != size;
+        if (sizeChanged)
+        {
+            this->fft.prepare(size);
+        }
+
+        // the ring buffer is drained regardless of the update rate,
+        // so that it never fills up and the callback never drops the samples,
+        // and the spectrum is always computed from the latest ones
+        hasNewSamples = this->readRingBuffer() || hasNewSamples;
+
+        // the spectrum is kept as is while nothing is playing
+        const auto timeNowMs = Time::getMillisecondCounterHiRes();
+        const auto updateIntervalMs = 1000.0 / double(this->updatesPerSecond.get());
+        if ((hasNewSamples || sizeChanged) &&
+            timeNowMs - lastUpdateTimeMs >= updateIntervalMs)
+        {
+            this->updateSpectrum();
+            hasNewSamples = false;
+            lastUpdateTimeMs = timeNowMs;
+        }
+
+        if (hasNewSamples || this->ringBufferFifo.getNumReady() > 0)
+        {
+            this->wait(AudioMonitor::ringBufferDrainIntervalMs);
+            continue;
+        }
+
+        // nothing is playing, so sleep until the callback pushes more samples;
+        // the fifo is checked again after the flag is set, since the callback
+        // might have pushed the samples right before it could see the flag
+        this->isAnalysisIdle = true;
+        if (this->ringBufferFifo.getNumReady() == 0)
+        {
+            this->wait(-1);
+        }
+
+        this->isAnalysisIdle = false;
+    }
+}
+
+bool AudioMonitor::readRingBuffer()
+{
+    const auto numReady = this->ringBufferFifo.getNumReady();
+    if (numReady == 0)
+    {
+        return false;
+    }
+
+    int start1, size1, start2, size2;
+    this->ringBufferFifo.prepareToRead(numReady, start1, size1, start2, size2);
+    this->appendToHistory(start1, size1);
+    this->appendToHistory(start2, size2);
+    this->ringBufferFifo.finishedRead(size1 + size2);
+    return true;
+}
+
+void AudioMonitor::appendToHistory(int ringBufferStart, int numSamples)
+{
+    // only the latest samples matter, if there are more than the history can keep
+    const auto historySize = this->history.getNumSamples();
+    if (numSamples > historySize)
+    {
+        ringBufferStart += numSamples - historySize;
+        numSamples = historySize;
+    }
+
+    while (numSamples > 0)
+    {
+        const auto chunkSize = jmin(numSamples, historySize - this->historyPosition);
+        for (int channel = 0; channel < AudioMonitor::numChannels; ++channel)
+        {
+            this->history.copyFrom(channel, this->historyPosition,
+                this->ringBuffer, channel, ringBufferStart, chunkSize);
+        }
+
+        ringBufferStart += chunkSize;
+        numSamples -= chunkSize;
+        this->historyPosition = (this->historyPosition + chunkSize) % historySize;
+    }
+}
+
+void AudioMonitor::updateSpectrum()
+{
+    const auto size = this->fft.getSize();
+    const auto historySize = this->history.getNumSamples();
+    const auto numBins = size / 2;
+    const auto binsPerPoint = numBins / AudioMonitor::spectrumSize;
+
+    const auto back = 1 - this->frontSpectrum.get();
+
+    for (int channel = 0; channel < AudioMonitor::numChannels; ++channel)
+    {
+        // the latest size samples, which end at the history position
+        const auto *data = this->history.getReadPointer(channel);
+        const auto start = (this->historyPosition - size + historySize) % historySize;
+        const auto size1 = jmin(size, historySize - start);
+        FloatVectorOperations::copy(this->fftInput, data + start, size1);
+        FloatVectorOperations::copy(this->fftInput + size1, data, size - size1);
+
+        this->fft.computeMagnitudes(this->fftInput, this->fftMagnitudes);
+
+        for (int i = 0; i < AudioMonitor::spectrumSize; ++i)
+        {
+            const auto *bins = this->fftMagnitudes + i * binsPerPoint;
+            float magnitude = 0.f;
+            for (int j = 0; j < binsPerPoint; ++j)
+            {
+                magnitude = jmax(magnitude, bins[j]);
+            }
+
+            this->spectrum[back][channel][i] = jmin(1.f, 2.5f * magnitude);
+        }
+    }
+
+    this->frontSpectrum = back;
+}
+
 //===----------------------------------------------------------------------===//
 // Spectrum data
 //===----------------------------------------------------------------------===//
 
+void AudioMonitor::setSpectrumAnalysisParameters(int newFftSize, int newUpdatesPerSecond)
+{
+    this->fftSize = jlimit(AudioMonitor::minFftSize,
+        SpectrumFFT::maxSize, nextPowerOfTwo(newFftSize));
+
+    this->updatesPerSecond = jlimit(1, 100, newUpdatesPerSecond);
+
+    // the spectrum is recomputed with the new size, even if nothing is playing
+    this->notify();
+}
+
 float AudioMonitor::getInterpolatedSpectrumAtFrequency(float frequency) const
 {
     const float resolution = 
         float(this->sampleRate.get() / 2.f) / float(AudioMonitor::spectrumSize);
+
+    const auto &spectrum = this->spectrum[this->frontSpectrum.get()];
     
     const int index1 = roundToInt(frequency / resolution);
-    const int safeIndex1 = jlimit(0, AudioMonitor::spectrumSize, index1);
+    const int safeIndex1 = jlimit(0, AudioMonitor::spectrumSize - 1, index1);
     const float f1 = index1 * resolution;
-    const float y1 = (this->spectrum[0][safeIndex1].get() +
-                      this->spectrum[1][safeIndex1].get()) / 2.f;
+    const float y1 = (spectrum[0][safeIndex1].get() +
+                      spectrum[1][safeIndex1].get()) / 2.f;
     
     const int index2 = index1 + 1;
-    const int safeIndex2 = jlimit(0, AudioMonitor::spectrumSize, index2);
+    const int safeIndex2 = jlimit(0, AudioMonitor::spectrumSize - 1, index2);
     const float f2 = index2 * resolution;
-    const float y2 = (this->spectrum[0][safeIndex2].get() +
-                      this->spectrum[1][safeIndex2].get()) / 2.f;
+    const float y2 = (spectrum[0][safeIndex2].get() +
+                      spectrum[1][safeIndex2].get()) / 2.f;
     
     return y1 + ((AudioCore::fastLog10(frequency) - AudioCore::fastLog10(f1)) /
                  (AudioCore::fastLog10(f2) - AudioCore::fastLog10(f1))) * (y2 - y1);
@@ -176,3 +363,114 @@ float AudioMonitor::getRootMeanSquare(int channel) const
 {
     return this->rms[channel].get();
 }
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class AudioMonitorTests final : public UnitTest
+{
+public:
+    AudioMonitorTests() : UnitTest("Audio monitor", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Spectrum of a sine wave");
+
+        SpectrumFFT fft;
+        fft.prepare(fftSize);
+
+        HeapBlock<float> samples(fftSize);
+        HeapBlock<float> magnitudes(fftSize / 2);
+        for (int i = 0; i < fftSize; ++i)
+        {
+            samples[i] = std::sin(MathConstants<float>::twoPi * float(sineBin * i) / float(fftSize));
+        }
+
+        fft.computeMagnitudes(samples, magnitudes);
+
+        int peakBin = 0;
+        for (int i = 0; i < fftSize / 2; ++i)
+        {
+            peakBin = magnitudes[i] > magnitudes[peakBin] ? i : peakBin;
+        }
+
+        expectEquals(peakBin, sineBin);
+        expectWithinAbsoluteError(magnitudes[peakBin], 0.25f, 0.001f);
+
+        beginTest("Audio callback time");
+
+        AudioBuffer<float> block(2, blockSize);
+        const auto fillBlock = [&block](int blockIndex)
+        {
+            for (int channel = 0; channel < block.getNumChannels(); ++channel)
+            {
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    const auto t = float(blockIndex * blockSize + i) / 44100.f;
+                    block.setSample(channel, i, 0.5f * std::sin(MathConstants<float>::twoPi * 1000.f * t));
+                }
+            }
+        };
+
+        // what the callback used to do: a spectrum of each channel for each block
+        double fftTimeMs = 0.0;
+        for (int i = 0; i < numBlocks; ++i)
+        {
+            fillBlock(i);
+            const auto startTime = Time::getMillisecondCounterHiRes();
+            for (int channel = 0; channel < block.getNumChannels(); ++channel)
+            {
+                FloatVectorOperations::copy(samples, block.getReadPointer(channel), blockSize);
+                fft.computeMagnitudes(samples, magnitudes);
+            }
+            fftTimeMs += Time::getMillisecondCounterHiRes() - startTime;
+        }
+
+        AudioMonitor monitor;
+        double callbackTimeMs = 0.0;
+        for (int i = 0; i < numBlocks; ++i)
+        {
+            fillBlock(i);
+            const auto startTime = Time::getMillisecondCounterHiRes();
+            monitor.audioDeviceIOCallback(nullptr, 0,
+                block.getArrayOfWritePointers(), block.getNumChannels(), blockSize);
+            callbackTimeMs += Time::getMillisecondCounterHiRes() - startTime;
+        }
+
+        logMessage("Average callback time with the spectrum: " +
+            String(fftTimeMs * 1000.0 / numBlocks, 2) + " us, with the ring buffer only: " +
+            String(callbackTimeMs * 1000.0 / numBlocks, 2) + " us");
+
+        beginTest("The spectrum is published by the analysis thread");
+
+        // the analysis thread only takes the latest samples,
+        // so these need to keep coming until it has picked them up
+        bool hasSpectrum = false;
+        for (int i = 0; i < 200 && !hasSpectrum; ++i)
+        {
+            fillBlock(i);
+            monitor.audioDeviceIOCallback(nullptr, 0,
+                block.getArrayOfWritePointers(), block.getNumChannels(), blockSize);
+            Thread::sleep(10);
+
+            hasSpectrum = monitor.getInterpolatedSpectrumAtFrequency(1000.f) >
+                monitor.getInterpolatedSpectrumAtFrequency(10000.f) * 10.f;
+        }
+
+        expect(hasSpectrum);
+    }
+
+private:
+
+    static constexpr auto fftSize = 512;
+    static constexpr auto sineBin = 37;
+    static constexpr auto blockSize = 64;
+    static constexpr auto numBlocks = 10000;
+};
+
+static AudioMonitorTests audioMonitorTests;
+
+#endif
@@ -19,11 +19,12 @@
 
 #include "SpectrumAnalyzer.h"
 
-class AudioMonitor final : public AudioIODeviceCallback
+class AudioMonitor final : public AudioIODeviceCallback, private Thread
 {
 public:
     
     AudioMonitor();
+    ~AudioMonitor() override;
 
     //===------------------------------------------------------------------===//
     // AudioIODeviceCallback
@@ -63,23 +64,70 @@ public:
     //===------------------------------------------------------------------===//
     
     float getInterpolatedSpectrumAtFrequency(float frequency) const;
+
+    // the spectrum is not computed in the audio callback, which only
+    // pushes the samples into the ring buffer; instead, the low-priority
+    // analysis thread takes the latest fftSize samples updatesPerSecond times
+    // a second, and publishes the spectrum for the readers
+    void setSpectrumAnalysisParameters(int fftSize, int updatesPerSecond);
     
 private:
 
-    SpectrumFFT fft;
-
-    // 256*2 == we just need quite a small resolution on a spectrum
+    // we just need quite a small resolution on a spectrum
     static constexpr auto spectrumSize = 256;
     static constexpr auto numChannels = 2;
 
-    static_assert((numChannels * spectrumSize) <= SpectrumFFT::maxSpectrumSize, "Oh no");
+    static constexpr auto minFftSize = spectrumSize * 2;
+    static constexpr auto defaultFftSize = minFftSize;
+    static constexpr auto defaultUpdatesPerSecond = 30;
+
+    static_assert(minFftSize >= SpectrumFFT::minSize &&
+        minFftSize <= SpectrumFFT::maxSize, "Oh no");
+
+    Atomic<int> fftSize = defaultFftSize;
+    Atomic<int> updatesPerSecond = defaultUpdatesPerSecond;
+
+    //===------------------------------------------------------------------===//
+    // Thread
+    //===------------------------------------------------------------------===//
+
+    void run() override;
+
+    // the lock-free single producer, single consumer queue
+    // between the audio callback and the analysis thread;
+    // the thread drains it every few milliseconds, whatever the update rate is,
+    // which is well within the ring buffer size even at high sample rates;
+    // only if the thread is starved for longer, the callback drops the samples;
+    // when the fifo is empty, the thread waits until the callback notifies it
+    static constexpr auto ringBufferSize = SpectrumFFT::maxSize * 2;
+    static constexpr auto ringBufferDrainIntervalMs = 10;
+    AbstractFifo ringBufferFifo { ringBufferSize };
+    Atomic<bool> isAnalysisIdle = false;
+    AudioBuffer<float> ringBuffer { numChannels, ringBufferSize };
+
+    void pushSamples(float **channelData, int numChannelsAvailable, int numSamples) noexcept;
+
+    // only accessed by the analysis thread:
+    SpectrumFFT fft;
+    AudioBuffer<float> history { numChannels, SpectrumFFT::maxSize };
+    int historyPosition = 0;
+    HeapBlock<float> fftInput;
+    HeapBlock<float> fftMagnitudes;
+
+    bool readRingBuffer();
+    void appendToHistory(int ringBufferStart, int numSamples);
+    void updateSpectrum();
 
     static constexpr auto defaultSampleRate = 44100;
     static constexpr auto clipThreshold = 0.995f;
     static constexpr auto oversaturationThreshold = 0.5f;
     static constexpr auto oversaturationRate = 4.f;
 
-    Atomic<float> spectrum[numChannels][spectrumSize];
+    // double-buffered: the analysis thread writes into the back spectrum,
+    // and then flips the index, so that the readers see the complete one
+    Atomic<float> spectrum[2][numChannels][spectrumSize];
+    Atomic<int> frontSpectrum = 0;
+
     Atomic<float> peak[numChannels];
     Atomic<float> rms[numChannels];
 
@@ -18,141 +18,104 @@
 #include "Common.h"
 #include "SpectrumAnalyzer.h"
 
-SpectrumFFT::SpectrumFFT()
+void SpectrumFFT::prepare(int fftSize)
 {
-    for (int count = 0; count < SpectrumFFT::cosTableSize; count++)
+    fftSize = jlimit(SpectrumFFT::minSize, SpectrumFFT::maxSize, nextPowerOfTwo(fftSize));
+    if (this->size == fftSize)
     {
-        this->costab[count] = cosf(MathConstants<float>::halfPi *
-            static_cast<float>(count) / static_cast<float>(SpectrumFFT::cosTableSize));
+        return;
     }
-}
 
-inline float SpectrumFFT::cosine(float x) const noexcept
-{
-    int y;
-    
-    x *= SpectrumFFT::tableRange;
-    y = static_cast<int>(x);
-    if (y < 0)
+    this->size = fftSize;
+
+    int bits = 0;
+    while ((1 << bits) < fftSize)
     {
-        y = -y;
+        bits++;
     }
 
-    y &= SpectrumFFT::tableMask;
-    switch (y >> SpectrumFFT::cosTableBits)
+    // the Hann window, which also normalizes the magnitudes
+    this->window.allocate(fftSize, false);
+    for (int i = 0; i < fftSize; ++i)
     {
-        case 0 : return  this->costab[y];
-        case 1 : return -this->costab[(SpectrumFFT::cosTableSize - 1) - (y - (SpectrumFFT::cosTableSize * 1))];
-        case 2 : return -this->costab[                                  (y - (SpectrumFFT::cosTableSize * 2))];
-        case 3 : return  this->costab[(SpectrumFFT::cosTableSize - 1) - (y - (SpectrumFFT::cosTableSize * 3))];
+        const auto phase = MathConstants<double>::twoPi * double(i) / double(fftSize);
+        this->window[i] = float(0.5 * (1.0 - std::cos(phase)) / double(fftSize));
     }
-    
-    return 0.f;
-}
-
-inline float SpectrumFFT::sine(float x) const noexcept
-{
-    return this->cosine(x - 0.25f);
-}
 
-inline unsigned int SpectrumFFT::reverse(unsigned int val, int bits) const noexcept
-{
-    unsigned int retn = 0;
-    
-    while (bits--)
+    this->bitReversedIndices.allocate(fftSize, false);
+    for (int i = 0; i < fftSize; ++i)
     {
-        retn <<= 1;
-        retn |= (val & 1);
-        val >>= 1;
+        int reversed = 0;
+        for (int b = 0; b < bits; ++b)
+        {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+
+        this->bitReversedIndices[i] = reversed;
     }
-    
-    return (retn);
-}
 
-inline void SpectrumFFT::process(int bits)
-{
-    int count, count2, count3;
-    int fftlen = 1 << bits;
-    unsigned i1 = fftlen / 2;
-    int i2 = 1, i3, i4, y;
-    float a1, a2, b1, b2, z1, z2;
-    float oneOverN = 1.0f / fftlen;
-    
-    for (count = 0; count < bits; count++)
+    this->twiddlesRe.allocate(fftSize, false);
+    this->twiddlesIm.allocate(fftSize, false);
+    for (int half = 1; half < fftSize; half <<= 1)
     {
-        i3 = 0;
-        i4 = i1;
-        
-        for (count2 = 0; count2 < i2; count2++)
+        for (int j = 0; j < half; ++j)
         {
-            y  = this->reverse(i3 / static_cast<int>(i1), bits);
-            z1 = this->cosine(static_cast<float>(y) * oneOverN);
-            z2 = -this->sine(static_cast<float>(y) * oneOverN);
-
-            for (count3 = i3; count3 < i4; count3++)
-            {
-                a1 = this->buffer[count3].re;
-                a2 = this->buffer[count3].im;
-                
-                b1 = (z1 * this->buffer[count3 + i1].re) - (z2 * this->buffer[count3 + i1].im);
-                b2 = (z2 * this->buffer[count3 + i1].re) + (z1 * this->buffer[count3 + i1].im);
-                
-                this->buffer[count3].re = a1 + b1;
-                this->buffer[count3].im = a2 + b2;
-                
-                this->buffer[count3 + i1].re = a1 - b1;
-                this->buffer[count3 + i1].im = a2 - b2;
-            }
-            
-            i3 += (i1 << 1);
-            i4 += (i1 << 1);
+            const auto phase = -MathConstants<double>::pi * double(j) / double(half);
+            this->twiddlesRe[half - 1 + j] = float(std::cos(phase));
+            this->twiddlesIm[half - 1 + j] = float(std::sin(phase));
         }
-        
-        i1 >>= 1;
-        i2 <<= 1;
     }
+
+    this->windowed.allocate(fftSize, false);
+    this->re.allocate(fftSize, false);
+    this->im.allocate(fftSize, true);
 }
 
-void SpectrumFFT::computeSpectrum(float *pcmBuffer,
-    unsigned int pcmPosition, unsigned int pcmLength,
-    Atomic<float> *spectrum, int length,
-    int channel, int numchannels)
+void SpectrumFFT::computeMagnitudes(const float *samples, float *magnitudes)
 {
-    int count, bits, bitslength, nyquist;
-    
-    bitslength = length;
-    bits = 0;
-    while (bitslength > 1)
+    jassert(this->size > 0);
+    const int n = this->size;
+
+    FloatVectorOperations::multiply(this->windowed, samples, this->window, n);
+
+    for (int i = 0; i < n; ++i)
     {
-        bitslength >>= 1;
-        bits++;
+        this->re[this->bitReversedIndices[i]] = this->windowed[i];
     }
-    
-    // Apply Hanning window
-    for (count = 0; count < length; count++)
+
+    FloatVectorOperations::clear(this->im, n);
+
+    for (int half = 1; half < n; half <<= 1)
     {
-        const float percent = static_cast<float>(count) / static_cast<float>(length);
-        const float window = 0.5f * (1.0f  - this->cosine(percent));
-        
-        this->buffer[count].re = pcmBuffer[pcmPosition] * window;
-        this->buffer[count].re /= static_cast<float>(length);
-        this->buffer[count].im = 0.00000001f;
-        
-        pcmPosition++;
-        if (pcmPosition >= pcmLength)
+        const float *wr = this->twiddlesRe + (half - 1);
+        const float *wi = this->twiddlesIm + (half - 1);
+
+        for (int start = 0; start < n; start += half * 2)
         {
-            pcmPosition = 0;
+            float *r1 = this->re + start;
+            float *i1 = this->im + start;
+            float *r2 = r1 + half;
+            float *i2 = i1 + half;
+
+            for (int j = 0; j < half; ++j)
+            {
+                const float tr = wr[j] * r2[j] - wi[j] * i2[j];
+                const float ti = wr[j] * i2[j] + wi[j] * r2[j];
+                r2[j] = r1[j] - tr;
+                i2[j] = i1[j] - ti;
+                r1[j] += tr;
+                i1[j] += ti;
+            }
         }
     }
 
-    this->process(bits);
+    const int numBins = n / 2;
+    FloatVectorOperations::multiply(this->re, this->re, numBins);
+    FloatVectorOperations::multiply(this->im, this->im, numBins);
+    FloatVectorOperations::add(this->re, this->im, numBins);
 
-    nyquist = (length / 2);
-    for (count = 0; count < (nyquist - 1); ++count)
+    for (int i = 0; i < numBins; ++i)
     {
-        const auto n = this->reverse(count, bits);
-        spectrum[count] = jmin(1.0f, 2.5f *
-            (sqrtf((this->buffer[n].re * this->buffer[n].re)
-                + (this->buffer[n].im * this->buffer[n].im))));
+        magnitudes[i] = std::sqrt(this->re[i]);
     }
 }
@@ -17,40 +17,43 @@
 
 #pragma once
 
+// A radix-2 FFT of the real signal, giving the magnitudes of its spectrum;
+// the window, the bit-reversed order and the twiddle factors of each stage
+// are precomputed for the given size, and the butterflies work on separate
+// real and imaginary arrays, so that the inner loops are easy to vectorize
+
 class SpectrumFFT final
 {
 public:
     
-    SpectrumFFT();
-    
-    void computeSpectrum(float *pcmBuffer,
-        unsigned int pcmPosition, unsigned int pcmLength,
-        Atomic<float> *spectrum, int length,
-        int channel, int numchannels);
+    SpectrumFFT() = default;
+
+    // the size is a power of two, within minSize and maxSize
+    void prepare(int fftSize);
+    int getSize() const noexcept { return this->size; }
+
+    // windows the size samples with the Hann window, and writes
+    // the magnitudes of the size / 2 bins, normalized by the size
+    void computeMagnitudes(const float *samples, float *magnitudes);
 
-    // please make sure no consumer ever asks for a spectrum larger than that:
-    static constexpr auto maxSpectrumSize = 512;
+    static constexpr auto minSize = 64;
+    static constexpr auto maxSize = 4096;
 
 private:
 
-    static constexpr auto cosTableBits = 13;
-    static constexpr auto cosTableSize = 1 << cosTableBits;
-    static constexpr auto tableRange = cosTableSize * 4;
-    static constexpr auto tableMask = tableRange - 1;
+    int size = 0;
 
-    struct FftComplex final
-    {
-        float re = 0.f;
-        float im = 0.f;
-    };
-    
-    FftComplex buffer[maxSpectrumSize];
-    float costab[cosTableSize];
-    
-    inline float cosine(float x) const noexcept;
-    inline float sine(float x) const noexcept;
-    inline unsigned int reverse(unsigned int val, int bits) const noexcept;
-    inline void process(int bits);
+    HeapBlock<float> window;
+    HeapBlock<int> bitReversedIndices;
+
+    // the twiddle factors of the stage with the half-size of n
+    // start at (n - 1), so the inner loop reads them contiguously
+    HeapBlock<float> twiddlesRe;
+    HeapBlock<float> twiddlesIm;
+
+    HeapBlock<float> windowed;
+    HeapBlock<float> re;
+    HeapBlock<float> im;
     
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumFFT);
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumFFT)
 };
@@ -0,0 +1,571 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "HeadlessRenderer.h"
+#include "TempoMap.h"
+#include "MidiTrack.h"
+#include "PianoSequence.h"
+#include "AutomationSequence.h"
+#include "Pattern.h"
+#include "KeyboardMapping.h"
+#include "BuiltInSynthAudioPlugin.h"
+#include "DocumentHelpers.h"
+#include "SerializationKeys.h"
+
+// A bare track which only holds the data, with no tree node,
+// no undo stack and no listeners, just like the timeline tracks
+class HeadlessRenderer::Track final : public MidiTrack
+{
+public:
+
+    Track(ProjectEventDispatcher &dispatcher, bool isAutomation)
+    {
+        if (isAutomation)
+        {
+            this->sequence.reset(new AutomationSequence(*this, dispatcher));
+        }
+        else
+        {
+            this->sequence.reset(new PianoSequence(*this, dispatcher));
+        }
+
+        this->pattern.reset(new Pattern(*this, dispatcher));
+    }
+
+    void deserialize(const SerializedData &data)
+    {
+        using namespace Serialization;
+
+        this->name = data.getProperty(Core::treeNodeName);
+        this->channel = data.getProperty(Core::trackChannel, this->channel);
+        this->deserializeTrackProperties(data);
+
+        this->sequence->deserialize(data);
+
+        // falls back to a single clip at zero bar, when no pattern is found
+        const auto patternData = data.getChildWithName(Midi::pattern);
+        this->pattern->deserialize(patternData.isValid() ?
+            patternData : SerializedData(Midi::pattern));
+    }
+
+    const String &getTrackId() const noexcept override { return this->id; }
+    int getTrackChannel() const noexcept override { return this->channel; }
+
+    String getTrackName() const noexcept override { return this->name; }
+    void setTrackName(const String &val, bool sendNotifications) override { this->name = val; }
+
+    Colour getTrackColour() const noexcept override { return this->colour; }
+    void setTrackColour(const Colour &val, bool sendNotifications) override { this->colour = val; }
+
+    String getTrackInstrumentId() const noexcept override { return this->instrumentId; }
+    void setTrackInstrumentId(const String &val, bool sendNotifications) override { this->instrumentId = val; }
+
+    int getTrackControllerNumber() const noexcept override { return this->controllerNumber; }
+    void setTrackControllerNumber(int val, bool sendNotifications) override { this->controllerNumber = val; }
+
+    MidiSequence *getSequence() const noexcept override { return this->sequence.get(); }
+    Pattern *getPattern() const noexcept override { return this->pattern.get(); }
+
+protected:
+
+    void setTrackId(const String &val) override { this->id = val; }
+
+private:
+
+    String id;
+    String name;
+    Colour colour;
+    String instrumentId;
+    int controllerNumber = 0;
+    int channel = 1;
+
+    UniquePointer<MidiSequence> sequence;
+    UniquePointer<Pattern> pattern;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Track)
+};
+
+HeadlessRenderer::HeadlessRenderer() {}
+HeadlessRenderer::~HeadlessRenderer() {}
+
+int HeadlessRenderer::getNumTracks() const noexcept
+{
+    return this->tracks.size();
+}
+
+//===----------------------------------------------------------------------===//
+// Loading
+//===----------------------------------------------------------------------===//
+
+Result HeadlessRenderer::loadProject(const File &file)
+{
+    if (!file.existsAsFile())
+    {
+        return Result::fail("File not found: " + file.getFullPathName());
+    }
+
+    return this->loadProject(DocumentHelpers::load(file));
+}
+
+Result HeadlessRenderer::loadProject(const SerializedData &data)
+{
+    this->tracks.clear();
+
+    const auto root = data.hasType(Serialization::Core::project) ?
+        data : data.getChildWithName(Serialization::Core::project);
+
+    if (!root.isValid())
+    {
+        return Result::fail("Not a valid project");
+    }
+
+    this->loadTracksRecursively(root);
+    return Result::ok();
+}
+
+// the tracks may be nested in the track groups at any depth,
+// and all other nodes, like the version control, are skipped
+void HeadlessRenderer::loadTracksRecursively(const SerializedData &node)
+{
+    using namespace Serialization;
+
+    forEachChildWithType(node, child, Core::treeNode)
+    {
+        const auto type = child.getProperty(Core::treeNodeType).toString();
+        const bool isPianoTrack = type == Core::pianoTrack.toString();
+        const bool isAutomationTrack = type == Core::automationTrack.toString();
+
+        if (isPianoTrack || isAutomationTrack)
+        {
+            auto *track = this->tracks.add(new Track(this->eventDispatcher, isAutomationTrack));
+            track->deserialize(child);
+        }
+        else
+        {
+            this->loadTracksRecursively(child);
+        }
+    }
+}
+
+//===----------------------------------------------------------------------===//
+// Rendering
+//===----------------------------------------------------------------------===//
+
+Result HeadlessRenderer::render(const File &target, Stats &outStats,
+    int blockSize, bool renderStems)
+{
+    const auto extension = target.getFileExtension().toLowerCase();
+
+    RenderFormat format;
+    if (extension == "." + getExtensionForRenderFormat(RenderFormat::WAV))
+    {
+        format = RenderFormat::WAV;
+    }
+    else if (extension == "." + getExtensionForRenderFormat(RenderFormat::FLAC))
+    {
+        format = RenderFormat::FLAC;
+    }
+    else
+    {
+        return Result::fail("Unsupported format: " + target.getFileName());
+    }
+
+    target.deleteFile();
+    UniquePointer<FileOutputStream> outStream(new FileOutputStream(target));
+    if (outStream->failedToOpen())
+    {
+        return Result::fail("Cannot write to " + target.getFullPathName());
+    }
+
+    return this->render(outStream.release(), format, outStats,
+        blockSize, renderStems ? target : File());
+}
+
+Result HeadlessRenderer::render(OutputStream *target, RenderFormat format,
+    Stats &outStats, int blockSize)
+{
+    return this->render(target, format, outStats, blockSize, File());
+}
+
+Result HeadlessRenderer::render(OutputStream *target, RenderFormat format,
+    Stats &outStats, int blockSize, const File &stemsTarget)
+{
+    UniquePointer<OutputStream> outStream(target);
+
+    const auto startTimeMs = Time::getMillisecondCounterHiRes();
+
+    UniquePointer<AudioFormatWriter> writer(createWriterForRenderFormat(format,
+        outStream.get(), HeadlessRenderer::defaultSampleRate, HeadlessRenderer::numOutputChannels));
+
+    if (writer == nullptr)
+    {
+        return Result::fail("Cannot create the audio writer");
+    }
+
+    outStream.release();
+
+    // step 1. export all tracks, same way Transport builds its playback cache,
+    // except that the keyboard mappings are the default ones
+    const KeyboardMapping keyMap;
+
+    bool hasSoloClips = false;
+    for (const auto *track : this->tracks)
+    {
+        hasSoloClips = hasSoloClips || track->getPattern()->hasSoloClips();
+    }
+
+    // the tracks of each instrument are played by a synth of its own,
+    // and all instruments are mixed down after each block
+    struct InstrumentRender final
+    {
+        String name;
+        MidiMessageSequence events;
+        int nextEventIndex = 0;
+        BuiltInSynthAudioPlugin synth;
+        AudioBuffer<float> buffer;
+        UniquePointer<AudioFormatWriter> stemWriter;
+    };
+
+    OwnedArray<InstrumentRender> instruments;
+    FlatHashMap<String, InstrumentRender *, StringHash> instrumentsById;
+
+    MidiMessageSequence tempoEvents;
+    float firstBeat = FLT_MAX;
+    float lastBeat = -FLT_MAX;
+    int numEvents = 0;
+
+    for (const auto *track : this->tracks)
+    {
+        const auto *sequence = track->getSequence();
+        const auto *pattern = track->getPattern();
+
+        MidiMessageSequence trackEvents;
+        for (const auto *clip : pattern->getClips())
+        {
+            sequence->exportMidi(trackEvents, *clip, keyMap, hasSoloClips, 0.0, 1.0);
+
+            // tempo map uses all the clips, even if some other ones are soloed
+            if (track->isTempoTrack())
+            {
+                sequence->exportMidi(tempoEvents, *clip, keyMap, false, 0.0, 1.0);
+            }
+        }
+
+        numEvents += trackEvents.getNumEvents();
+
+        // the tempo tracks don't make any sound on their own
+        if (!track->isTempoTrack())
+        {
+            const auto instrumentId = track->getTrackInstrumentId();
+            auto found = instrumentsById.find(instrumentId);
+            if (found == instrumentsById.end())
+            {
+                auto *instrument = instruments.add(new InstrumentRender());
+                instrument->name = track->getTrackName();
+                found = instrumentsById.emplace(instrumentId, instrument).first;
+            }
+
+            found->second->events.addSequence(trackEvents, 0.0);
+        }
+
+        // the same beat range as in ProjectNode::getProjectRangeInBeats
+        firstBeat = jmin(firstBeat, sequence->getFirstBeat() + pattern->getFirstBeat());
+        lastBeat = jmax(lastBeat, sequence->getLastBeat() + pattern->getLastBeat());
+    }
+
+    if (firstBeat == FLT_MAX)
+    {
+        firstBeat = 0;
+    }
+    else if (firstBeat > lastBeat)
+    {
+        firstBeat = lastBeat - Globals::Defaults::projectLength;
+    }
+
+    if ((lastBeat - firstBeat) < Globals::Defaults::projectLength)
+    {
+        lastBeat = firstBeat + Globals::Defaults::projectLength;
+    }
+
+    TempoMap tempoMap;
+    tempoMap.rebuild(tempoEvents);
+
+    const auto sampleRate = HeadlessRenderer::defaultSampleRate;
+    const auto firstBeatTimeMs = tempoMap.getTimeAt(firstBeat);
+    const auto totalTimeMs = tempoMap.getTimeAt(lastBeat) - firstBeatTimeMs;
+    const auto lastFrame = int64(totalTimeMs / 1000.0 * sampleRate);
+
+    auto getFrameForMessage = [&tempoMap, firstBeatTimeMs, sampleRate](const MidiMessage &message) -> int64
+    {
+        const auto timeMs = tempoMap.getTimeAt(message.getTimeStamp()) - firstBeatTimeMs;
+        return jmax(int64(0), int64(timeMs / 1000.0 * sampleRate));
+    };
+
+    // step 2. prepare the synths, no processor graphs here,
+    // so there's nothing to wait for before the rendering starts
+    for (auto *instrument : instruments)
+    {
+        instrument->events.sort();
+        instrument->buffer.setSize(HeadlessRenderer::numOutputChannels, blockSize);
+        instrument->synth.setPlayConfigDetails(0, HeadlessRenderer::numOutputChannels, sampleRate, blockSize);
+        instrument->synth.setNonRealtime(true);
+        instrument->synth.prepareToPlay(sampleRate, blockSize);
+    }
+
+    // step 2a. create the stems, if needed
+    if (stemsTarget != File())
+    {
+        Array<File> stemFiles;
+        for (int i = 0; i < instruments.size(); ++i)
+        {
+            auto *instrument = instruments.getUnchecked(i);
+            const auto stemName = instrument->name.isNotEmpty() ?
+                File::createLegalFileName(instrument->name) : String(i + 1);
+
+            auto stemFile = stemsTarget.getSiblingFile(stemsTarget.getFileNameWithoutExtension() +
+                " - " + stemName + stemsTarget.getFileExtension());
+
+            // overwrite the stems left from the previous render,
+            // but not the ones of the instruments with the same name
+            if (stemFiles.contains(stemFile))
+            {
+                stemFile = stemFile.getNonexistentSibling();
+            }
+            else if (stemFile.existsAsFile())
+            {
+                stemFile.deleteFile();
+            }
+
+            stemFiles.add(stemFile);
+
+            auto stemStream = stemFile.createOutputStream();
+            if (stemStream == nullptr)
+            {
+                return Result::fail("Cannot write to " + stemFile.getFullPathName());
+            }
+
+            // the writer takes the ownership of the stream only if succeeded
+            instrument->stemWriter.reset(createWriterForRenderFormat(format, stemStream.get(),
+                sampleRate, HeadlessRenderer::numOutputChannels));
+
+            if (instrument->stemWriter == nullptr)
+            {
+                return Result::fail("Cannot create the audio writer for " + stemFile.getFileName());
+            }
+
+            stemStream.release();
+        }
+    }
+
+    // step 3. render as fast as possible
+    AudioBuffer<float> mixingBuffer(HeadlessRenderer::numOutputChannels, blockSize);
+    MidiBuffer midiBuffer;
+
+    for (int64 currentFrame = 0; currentFrame < lastFrame; currentFrame += blockSize)
+    {
+        const auto numSamples = int(jmin(int64(blockSize), lastFrame - currentFrame));
+
+        mixingBuffer.clear();
+
+        for (auto *instrument : instruments)
+        {
+            midiBuffer.clear();
+            while (instrument->nextEventIndex < instrument->events.getNumEvents())
+            {
+                const auto &message = instrument->events.getEventPointer(instrument->nextEventIndex)->message;
+                const auto eventFrame = getFrameForMessage(message);
+                if (eventFrame >= currentFrame + numSamples)
+                {
+                    break;
+                }
+
+                midiBuffer.addEvent(message, int(jmax(int64(0), eventFrame - currentFrame)));
+                instrument->nextEventIndex++;
+            }
+
+            instrument->synth.processBlock(instrument->buffer, midiBuffer);
+
+            if (instrument->stemWriter != nullptr)
+            {
+                instrument->stemWriter->writeFromAudioSampleBuffer(instrument->buffer, 0, numSamples);
+            }
+
+            for (int channel = 0; channel < HeadlessRenderer::numOutputChannels; ++channel)
+            {
+                mixingBuffer.addFrom(channel, 0, instrument->buffer, channel, 0, numSamples);
+            }
+        }
+
+        writer->writeFromAudioSampleBuffer(mixingBuffer, 0, numSamples);
+    }
+
+    // flushes the data
+    int numStems = 0;
+    for (auto *instrument : instruments)
+    {
+        instrument->synth.releaseResources();
+        if (instrument->stemWriter != nullptr)
+        {
+            instrument->stemWriter = nullptr;
+            numStems++;
+        }
+    }
+
+    writer = nullptr;
+
+    outStats.renderedTimeMs = totalTimeMs;
+    outStats.wallClockTimeMs = Time::getMillisecondCounterHiRes() - startTimeMs;
+    outStats.numTracks = this->tracks.size();
+    outStats.numEvents = numEvents;
+    outStats.numStems = numStems;
+
+    return Result::ok();
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class HeadlessRendererTests final : public UnitTest
+{
+public:
+    HeadlessRendererTests() : UnitTest("Headless renderer tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Render a project without the workspace");
+
+        using namespace Serialization;
+
+        // one bar of 1/16 notes, with the tracks nested in a group
+        SerializedData groupNode(Core::treeNode);
+        groupNode.setProperty(Core::treeNodeType, Core::trackGroup.toString());
+        groupNode.appendChild(makeTrack("Test", "", 60));
+
+        SerializedData projectNode(Core::project);
+        projectNode.appendChild(groupNode);
+
+        HeadlessRenderer renderer;
+        expect(renderer.loadProject(projectNode).wasOk());
+        expectEquals(renderer.getNumTracks(), 1);
+
+        MemoryBlock renderedData;
+        HeadlessRenderer::Stats stats;
+        const auto result = renderer.render(new MemoryOutputStream(renderedData, false),
+            RenderFormat::WAV, stats);
+
+        expect(result.wasOk());
+        expectEquals(stats.numTracks, 1);
+        expectEquals(stats.numEvents, numNotes * 2);
+        expect(stats.renderedTimeMs > 0.0);
+
+        WavAudioFormat wavFormat;
+        UniquePointer<AudioFormatReader> reader(wavFormat.createReaderFor(
+            new MemoryInputStream(renderedData, false), true));
+
+        expect(reader != nullptr);
+        expectEquals(int(reader->numChannels), HeadlessRenderer::numOutputChannels);
+
+        const auto expectedLength = int64(stats.renderedTimeMs / 1000.0 * reader->sampleRate);
+        expectEquals(reader->lengthInSamples, expectedLength);
+
+        AudioBuffer<float> readBuffer(int(reader->numChannels), int(reader->lengthInSamples));
+        reader->read(&readBuffer, 0, int(reader->lengthInSamples), 0, true, true);
+        expect(readBuffer.getMagnitude(0, readBuffer.getNumSamples()) > 0.f);
+
+        logMessage("Rendered " + String(stats.renderedTimeMs, 0) + " ms in " +
+            String(stats.wallClockTimeMs, 0) + " ms, realtime factor: " +
+            String(stats.getRealtimeFactor(), 1));
+
+        beginTest("Render the stems of a two-instrument project");
+
+        SerializedData twoInstrumentsProject(Core::project);
+        twoInstrumentsProject.appendChild(makeTrack("Piano", "instrument1", 48));
+        twoInstrumentsProject.appendChild(makeTrack("Strings", "instrument2", 72));
+
+        const auto outputDirectory = File::getSpecialLocation(File::tempDirectory)
+            .getChildFile("HelioStemsTest").getNonexistentSibling();
+        expect(outputDirectory.createDirectory().wasOk());
+
+        const auto masterFile = outputDirectory.getChildFile("Test.wav");
+        expect(renderer.loadProject(twoInstrumentsProject).wasOk());
+        expect(renderer.render(masterFile, stats, HeadlessRenderer::defaultBlockSize, true).wasOk());
+        expectEquals(stats.numStems, 2);
+
+        const auto renderedFiles = outputDirectory.findChildFiles(File::findFiles, false, "*.wav");
+        expectEquals(renderedFiles.size(), 3);
+
+        for (const auto &file : { masterFile,
+            outputDirectory.getChildFile("Test - Piano.wav"),
+            outputDirectory.getChildFile("Test - Strings.wav") })
+        {
+            expect(file.existsAsFile(), file.getFileName());
+            if (!file.existsAsFile())
+            {
+                continue;
+            }
+
+            UniquePointer<AudioFormatReader> fileReader(wavFormat.createReaderFor(
+                file.createInputStream().release(), true));
+
+            expect(fileReader != nullptr, file.getFileName());
+            if (fileReader != nullptr)
+            {
+                expectEquals(fileReader->lengthInSamples,
+                    int64(stats.renderedTimeMs / 1000.0 * fileReader->sampleRate));
+
+                AudioBuffer<float> fileBuffer(int(fileReader->numChannels), int(fileReader->lengthInSamples));
+                fileReader->read(&fileBuffer, 0, int(fileReader->lengthInSamples), 0, true, true);
+                expect(fileBuffer.getMagnitude(0, fileBuffer.getNumSamples()) > 0.f, file.getFileName());
+            }
+        }
+
+        outputDirectory.deleteRecursively();
+    }
+
+private:
+
+    static constexpr auto numNotes = 16;
+
+    // one bar of 1/16 notes, starting from the given key
+    static SerializedData makeTrack(const String &name, const String &instrumentId, int firstKey)
+    {
+        using namespace Serialization;
+
+        EmptyMidiTrack emptyTrack;
+        EmptyEventDispatcher dispatcher;
+        PianoSequence sequence(emptyTrack, dispatcher);
+        for (int i = 0; i < numNotes; ++i)
+        {
+            sequence.insert(Note(&sequence, firstKey + i % 12, i * 0.25f, 0.25f, 0.75f), false);
+        }
+
+        SerializedData trackNode(Core::treeNode);
+        trackNode.setProperty(Core::treeNodeType, Core::pianoTrack.toString());
+        trackNode.setProperty(Core::treeNodeName, name);
+        trackNode.setProperty(Core::trackInstrumentId, instrumentId);
+        trackNode.appendChild(sequence.serialize());
+        return trackNode;
+    }
+};
+
+static HeadlessRendererTests headlessRendererTests;
+
+#endif
@@ -0,0 +1,85 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "RenderFormat.h"
+#include "ProjectEventDispatcher.h"
+
+// Renders a project file without the workspace, the window and the audio device:
+// the tracks are loaded straight from the serialized project, the tracks
+// of each instrument are played by its own built-in synth, and the blocks
+// are processed as fast as the cpu allows, instead of waiting for the
+// processor graphs; this is what the command line render mode uses
+
+class HeadlessRenderer final
+{
+public:
+
+    HeadlessRenderer();
+    ~HeadlessRenderer();
+
+    static constexpr auto defaultSampleRate = 44100.0;
+    static constexpr auto defaultBlockSize = 512;
+    static constexpr auto numOutputChannels = 2;
+
+    Result loadProject(const File &file);
+    Result loadProject(const SerializedData &data);
+
+    struct Stats final
+    {
+        double renderedTimeMs = 0.0;
+        double wallClockTimeMs = 0.0;
+        int numTracks = 0;
+        int numEvents = 0;
+        int numStems = 0;
+
+        // how many times faster than realtime the project was rendered
+        double getRealtimeFactor() const noexcept
+        {
+            return this->wallClockTimeMs > 0.0 ?
+                this->renderedTimeMs / this->wallClockTimeMs : 0.0;
+        }
+    };
+
+    // the format is picked by the target file extension, wav or flac;
+    // if renderStems is set, each instrument is also written into its own file
+    // next to the target one, named after its first track, e.g. "Song - Piano.wav"
+    Result render(const File &target, Stats &outStats,
+        int blockSize = defaultBlockSize, bool renderStems = false);
+
+    // takes the ownership of the stream
+    Result render(OutputStream *target, RenderFormat format,
+        Stats &outStats, int blockSize = defaultBlockSize);
+
+    int getNumTracks() const noexcept;
+
+private:
+
+    EmptyEventDispatcher eventDispatcher;
+
+    class Track;
+    OwnedArray<Track> tracks;
+
+    void loadTracksRecursively(const SerializedData &node);
+
+    // the stems are only written if the stems target is set
+    Result render(OutputStream *target, RenderFormat format,
+        Stats &outStats, int blockSize, const File &stemsTarget);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HeadlessRenderer)
+};
@@ -18,6 +18,9 @@
 #include "Common.h"
 
 #include "PlayerThread.h"
+#include "SequencedMidiStream.h"
+#include "Workspace.h"
+#include "AudioCore.h"
 
 PlayerThread::PlayerThread(Transport &transport) :
     Thread("PlayerThread"),
@@ -41,6 +44,13 @@ void PlayerThread::startPlayback(Transport::PlaybackContext::Ptr context)
 
 void PlayerThread::run()
 {
+    // with no sample rate known there's nothing to play anyway
+    if (this->context->sampleAccurate && this->context->sampleRate > 0.0)
+    {
+        this->runSampleAccurate();
+        return;
+    }
+
     Array<Instrument *> uniqueInstruments;
     uniqueInstruments.addArray(this->sequences.getUniqueInstruments());
 
@@ -53,8 +63,7 @@ void PlayerThread::run()
 
     const bool isLooped = this->context->playbackLoopMode;
 
-    const auto seek = this->context->startBeat - this->context->projectFirstBeat;
-    this->sequences.seekToTime(seek);
+    this->sequences.seekToTime(this->context->startBeat);
 
     Atomic<float> previousEventBeat = this->context->startBeat;
     broadcastSeek(previousEventBeat);
@@ -140,6 +149,10 @@ void PlayerThread::run()
     sendMidiStart();
     sendControllerStates();
 
+    // event timing is taken from the tempo map, while tempo events
+    // in the sequences are only used to notify the listeners and instruments
+    const auto &tempoMap = this->context->tempoMap;
+
     double nextEventTimeDelta = 0.0;
     auto currentTimeMs = this->context->startBeatTimeMs;
     Atomic<double> currentTempo = this->context->startBeatTempo;
@@ -151,8 +164,8 @@ void PlayerThread::run()
         // Handle playback from the last event to the end of track:
         if (!this->sequences.getNextMessage(wrapper))
         {
-            nextEventTimeDelta = currentTempo.get() *
-                (this->context->endBeat - previousEventBeat.get());
+            nextEventTimeDelta = tempoMap.getTimeAt(this->context->endBeat) -
+                tempoMap.getTimeAt(previousEventBeat.get());
 
             const uint32 targetTime =
                 Time::getMillisecondCounter() + uint32(nextEventTimeDelta);
@@ -173,7 +186,7 @@ void PlayerThread::run()
 
             if (isLooped)
             {
-                this->sequences.seekToTime(this->context->rewindBeat - this->context->projectFirstBeat);
+                this->sequences.seekToTime(this->context->rewindBeat);
                 previousEventBeat = this->context->rewindBeat;
                 broadcastSeek(previousEventBeat);
                 continue;
@@ -199,8 +212,7 @@ void PlayerThread::run()
             }
         }
 
-        const auto messageBeat =
-            wrapper.message.getTimeStamp() + this->context->projectFirstBeat;
+        const auto messageBeat = wrapper.message.getTimeStamp();
 
         const bool shouldRewind =
             (isLooped && (messageBeat > this->context->endBeat));
@@ -208,7 +220,8 @@ void PlayerThread::run()
         const auto nextEventBeat =
             float(shouldRewind ? this->context->endBeat : messageBeat);
 
-        nextEventTimeDelta = currentTempo.get() * (nextEventBeat - previousEventBeat.get());
+        nextEventTimeDelta = tempoMap.getTimeAt(nextEventBeat) -
+            tempoMap.getTimeAt(previousEventBeat.get());
         currentTimeMs += nextEventTimeDelta;
         
         jassert(previousEventBeat.get() <= nextEventBeat);
@@ -242,7 +255,7 @@ void PlayerThread::run()
         
         if (shouldRewind)
         {
-            this->sequences.seekToTime(this->context->rewindBeat - this->context->projectFirstBeat);
+            this->sequences.seekToTime(this->context->rewindBeat);
 
             previousEventBeat = this->context->rewindBeat;
             broadcastSeek(previousEventBeat);
@@ -290,3 +303,194 @@ void PlayerThread::run()
     
     jassertfalse;
 }
+
+//===----------------------------------------------------------------------===//
+// Sample-accurate playback
+//===----------------------------------------------------------------------===//
+
+void PlayerThread::runSampleAccurate()
+{
+    const auto &tempoMap = this->context->tempoMap;
+    const auto sampleRate = this->context->sampleRate;
+    const bool isLooped = this->context->playbackLoopMode;
+
+    // all sample positions are counted from the start or the loop start,
+    // whichever is earlier, so that the loop passes can be pre-rendered once
+    const auto originBeat = jmin(this->context->startBeat, this->context->rewindBeat);
+    const auto originTimeMs = tempoMap.getTimeAt(originBeat);
+
+    auto getSamplePosition = [&tempoMap, originTimeMs, sampleRate](double beat) -> int64
+    {
+        const auto timeMs = tempoMap.getTimeAt(beat) - originTimeMs;
+        return int64(std::floor(timeMs * sampleRate * 0.001 + 0.5));
+    };
+
+    const auto startPosition = getSamplePosition(this->context->startBeat);
+    const auto loopStartPosition = getSamplePosition(this->context->rewindBeat);
+    const auto endPosition = getSamplePosition(this->context->endBeat);
+
+    // one stream per instrument
+    Array<Instrument *> instruments;
+    Array<WeakReference<Instrument>> instrumentRefs;
+    ReferenceCountedArray<SequencedMidiStream> streams;
+
+    for (auto *instrument : this->sequences.getUniqueInstruments())
+    {
+        SequencedMidiStream::Ptr stream(new SequencedMidiStream(startPosition,
+            loopStartPosition, endPosition, isLooped));
+
+        stream->addInitialMessage(MidiMessage::midiStart());
+
+        for (int cc = 0; cc < Transport::PlaybackContext::numCCs; ++cc)
+        {
+            const auto state = this->context->ccStates[cc];
+            if (state < 0) // not present in any track
+            {
+                continue;
+            }
+
+            for (int channel = 1; channel < Globals::numChannels; ++channel)
+            {
+                stream->addInitialMessage(MidiMessage::controllerEvent(channel, cc, state));
+            }
+        }
+
+        instruments.add(instrument);
+        instrumentRefs.add(instrument);
+        streams.add(stream);
+    }
+
+    jassert(!streams.isEmpty());
+
+    this->sequences.seekToTime(originBeat);
+
+    CachedMidiMessage wrapper;
+    while (this->sequences.getNextMessage(wrapper))
+    {
+        const auto messageBeat = wrapper.message.getTimeStamp();
+        if (messageBeat > this->context->endBeat)
+        {
+            break;
+        }
+
+        const auto samplePosition = getSamplePosition(messageBeat);
+
+        // Master tempo event is sent to everybody
+        if (wrapper.message.isTempoMetaEvent())
+        {
+            for (auto *stream : streams)
+            {
+                stream->addEvent(samplePosition, wrapper.message);
+            }
+        }
+        else
+        {
+            const auto instrumentIndex = instruments.indexOf(wrapper.instrument);
+            jassert(instrumentIndex >= 0);
+            streams.getObjectPointerUnchecked(instrumentIndex)->addEvent(samplePosition, wrapper.message);
+        }
+    }
+
+    // The streams are attached and detached while holding the device's
+    // callback lock, which is held for the whole audio block for all instruments,
+    // so all the streams are guaranteed to start at the same block
+    auto &audioCallbackLock = App::Workspace().getAudioCore().getDevice().getAudioCallbackLock();
+
+    {
+        const ScopedLock lock(audioCallbackLock);
+        for (int i = 0; i < instruments.size(); ++i)
+        {
+            instruments.getUnchecked(i)->getProcessorPlayer().setSequencedStream(streams.getObjectPointerUnchecked(i));
+        }
+    }
+
+    auto detachStreamsAndSendNotesOff = [&audioCallbackLock, &instrumentRefs, &streams]()
+    {
+        {
+            const ScopedLock lock(audioCallbackLock);
+            for (auto &instrument : instrumentRefs)
+            {
+                if (instrument != nullptr)
+                {
+                    instrument->getProcessorPlayer().setSequencedStream(nullptr);
+                }
+            }
+        }
+
+        const auto timeNow = Time::getMillisecondCounterHiRes() * 0.001;
+
+        for (int i = 0; i < instrumentRefs.size(); ++i)
+        {
+            auto *instrument = instrumentRefs.getReference(i).get();
+            if (instrument == nullptr)
+            {
+                continue;
+            }
+
+            auto &collector = instrument->getProcessorPlayer().getMidiMessageCollector();
+
+            for (auto &noteOff : streams.getObjectPointerUnchecked(i)->getNoteOffsForHoldingNotes())
+            {
+                noteOff.setTimeStamp(timeNow);
+                collector.addMessageToQueue(noteOff);
+            }
+
+            MidiMessage stopPlayback(MidiMessage::midiStop());
+            stopPlayback.setTimeStamp(timeNow);
+            collector.addMessageToQueue(stopPlayback);
+        }
+
+        // Wait until all plugins process the messages in their queues
+        Thread::sleep(50);
+    };
+
+    // From now on, this thread only follows the playhead to notify the listeners,
+    // all the streams are started at the same block, so any of them will do
+    const auto *clock = streams.getObjectPointerUnchecked(0);
+    auto currentTempo = this->context->startBeatTempo;
+
+    this->transport.broadcastSeek(this->context->startBeat,
+        this->context->startBeatTimeMs, this->context->totalTimeMs);
+
+    while (!this->threadShouldExit())
+    {
+        Thread::sleep(PlayerThread::seekUpdateIntervalMs);
+
+        const auto playheadTimeMs = originTimeMs +
+            double(clock->getPlayheadPosition()) * 1000.0 / sampleRate;
+
+        const auto playheadBeat = tempoMap.getBeatAt(playheadTimeMs);
+
+        this->transport.broadcastSeek(float(playheadBeat),
+            this->context->startBeatTimeMs, this->context->totalTimeMs);
+
+        const auto tempo = tempoMap.getTempoAt(playheadBeat);
+        if (tempo != currentTempo)
+        {
+            currentTempo = tempo;
+            this->transport.broadcastTempoChanged(currentTempo);
+        }
+
+        if (clock->hasFinished())
+        {
+            while (this->transport.isRecording() && !this->threadShouldExit())
+            {
+                Thread::sleep(PlayerThread::minStopCheckTimeMs);
+            }
+
+            detachStreamsAndSendNotesOff();
+
+            if (this->threadShouldExit())
+            {
+                return; // the transport have already stopped
+            }
+
+            this->transport.allNotesControllersAndSoundOff();
+            this->transport.stopRecording();
+            this->transport.stopPlayback();
+            return;
+        }
+    }
+
+    detachStreamsAndSendNotesOff();
+}
@@ -32,6 +32,10 @@ private:
 
     void run() override;
 
+    // the alternative playback mode: the events are pre-rendered into
+    // the instruments' streams, and this thread only follows the playhead
+    void runSampleAccurate();
+
     Transport &transport;
     TransportPlaybackCache sequences;
 
@@ -40,5 +44,8 @@ private:
     // checking if the thread needs to stop at least once a second
     static constexpr auto minStopCheckTimeMs = 1000;
 
+    // how often the sample-accurate mode notifies the listeners about the playhead
+    static constexpr auto seekUpdateIntervalMs = 20;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PlayerThread)
 };
@@ -55,6 +55,8 @@ public:
         playbackContext->endBeat = endBeat;
         playbackContext->rewindBeat = rewindBeat;
         playbackContext->playbackLoopMode = loopMode;
+        playbackContext->sampleAccurate =
+            App::Config().getUiFlags()->areExperimentalFeaturesEnabled();
 
         // let listeners know about the tempo before the playback starts
         this->transport.broadcastTempoChanged(playbackContext->startBeatTempo);
@@ -33,3 +33,28 @@ inline String getExtensionForRenderFormat(RenderFormat format) noexcept
 
     return {};
 }
+
+// The writer takes the ownership of the stream only if succeeded
+inline AudioFormatWriter *createWriterForRenderFormat(RenderFormat format,
+    OutputStream *outStream, double sampleRate, int numChannels)
+{
+    // 16 bits per sample should be enough for anybody :)
+    // ..wanna fight about it? https://people.xiph.org/~xiphmont/demo/neil-young.html
+    const int bitDepth = 16;
+
+    switch (format)
+    {
+    case RenderFormat::WAV:
+    {
+        WavAudioFormat wavFormat;
+        return wavFormat.createWriterFor(outStream, sampleRate, numChannels, bitDepth, {}, 0);
+    }
+    case RenderFormat::FLAC:
+    {
+        FlacAudioFormat flacFormat;
+        return flacFormat.createWriterFor(outStream, sampleRate, numChannels, bitDepth, {}, 0);
+    }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,234 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "RenderWorkerPool.h"
+
+class RenderWorkerPool::Worker final : public Thread
+{
+public:
+
+    Worker(RenderWorkerPool &pool, const String &threadName) :
+        Thread(threadName),
+        pool(pool) {}
+
+    ~Worker() override
+    {
+        this->signalThreadShouldExit();
+        this->startEvent.signal();
+        this->stopThread(1000);
+    }
+
+    void startTasks()
+    {
+        this->startEvent.signal();
+    }
+
+private:
+
+    void run() override
+    {
+        while (!this->threadShouldExit())
+        {
+            this->startEvent.wait(-1);
+
+            if (this->threadShouldExit())
+            {
+                return;
+            }
+
+            this->pool.runPendingTasks();
+
+            if (--this->pool.numBusyWorkers == 0)
+            {
+                this->pool.allWorkersDone.signal();
+            }
+        }
+    }
+
+    RenderWorkerPool &pool;
+    WaitableEvent startEvent;
+
+    JUCE_DECLARE_NON_COPYABLE(Worker)
+};
+
+RenderWorkerPool::RenderWorkerPool(int numWorkers) :
+    RenderWorkerPool(numWorkers, "RenderWorker", RenderWorkerPool::renderPriority) {}
+
+RenderWorkerPool::RenderWorkerPool(int numWorkers,
+    const String &threadName, int threadPriority)
+{
+    for (int i = 0; i < numWorkers; ++i)
+    {
+        auto *worker = this->workers.add(new Worker(*this, threadName));
+        worker->startThread(threadPriority);
+    }
+}
+
+RenderWorkerPool::~RenderWorkerPool()
+{
+    this->workers.clear();
+}
+
+int RenderWorkerPool::getNumWorkers() const noexcept
+{
+    return this->workers.size();
+}
+
+int RenderWorkerPool::getOptimalNumWorkers(int numTasks) noexcept
+{
+    return jmax(0, jmin(numTasks, SystemStats::getNumCpus()) - 1);
+}
+
+void RenderWorkerPool::runAndWait(int numTasks, const Task &task)
+{
+    this->currentTask = &task;
+    this->numTasks = numTasks;
+    this->nextTaskIndex = 0;
+
+    if (this->workers.isEmpty())
+    {
+        this->runPendingTasks();
+        return;
+    }
+
+    this->numBusyWorkers = this->workers.size();
+
+    for (auto *worker : this->workers)
+    {
+        worker->startTasks();
+    }
+
+    this->runPendingTasks();
+
+    // the barrier: the workers may still be finishing their last tasks
+    this->allWorkersDone.wait(-1);
+    this->currentTask = nullptr;
+}
+
+// The tasks are picked dynamically rather than split evenly in advance,
+// because some instruments are way heavier than others
+void RenderWorkerPool::runPendingTasks()
+{
+    while (true)
+    {
+        const auto taskIndex = (++this->nextTaskIndex) - 1;
+        if (taskIndex >= this->numTasks)
+        {
+            return;
+        }
+
+        (*this->currentTask)(taskIndex);
+    }
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class RenderWorkerPoolTests final : public UnitTest
+{
+public:
+    RenderWorkerPoolTests() : UnitTest("Render worker pool tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("All tasks are done before the barrier");
+
+        {
+            RenderWorkerPool pool(3);
+            Array<int> counters;
+            counters.insertMultiple(0, 0, numInstruments);
+
+            for (int block = 0; block < 100; ++block)
+            {
+                pool.runAndWait(numInstruments, [&counters](int i)
+                {
+                    counters.getReference(i)++;
+                });
+
+                for (const auto counter : counters)
+                {
+                    expectEquals(counter, block + 1);
+                }
+            }
+        }
+
+        beginTest("Parallel mixdown is bit-identical to the serial one");
+
+        {
+            const auto serialMix = renderMixdown(0);
+            const auto parallelMix = renderMixdown(RenderWorkerPool::getOptimalNumWorkers(numInstruments));
+
+            expectEquals(serialMix.getNumSamples(), parallelMix.getNumSamples());
+            expect(memcmp(serialMix.getReadPointer(0), parallelMix.getReadPointer(0),
+                sizeof(float) * size_t(serialMix.getNumSamples())) == 0);
+        }
+    }
+
+private:
+
+    static constexpr auto numInstruments = 12;
+    static constexpr auto numBlocks = 64;
+    static constexpr auto blockSize = 512;
+
+    // each "instrument" keeps its own state across the blocks, like a synth would,
+    // and the blocks are mixed in the same order after each barrier
+    static AudioBuffer<float> renderMixdown(int numWorkers)
+    {
+        RenderWorkerPool pool(numWorkers);
+
+        OwnedArray<AudioBuffer<float>> instrumentBuffers;
+        Array<double> phases;
+        for (int i = 0; i < numInstruments; ++i)
+        {
+            instrumentBuffers.add(new AudioBuffer<float>(1, blockSize));
+            phases.add(0.0);
+        }
+
+        AudioBuffer<float> mixdown(1, numBlocks * blockSize);
+        mixdown.clear();
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            pool.runAndWait(numInstruments, [&instrumentBuffers, &phases](int i)
+            {
+                auto *samples = instrumentBuffers.getUnchecked(i)->getWritePointer(0);
+                auto &phase = phases.getReference(i);
+                const auto delta = MathConstants<double>::twoPi * (110.0 * (i + 1)) / 44100.0;
+                for (int s = 0; s < blockSize; ++s)
+                {
+                    samples[s] = float(std::sin(phase)) * 0.1f;
+                    phase += delta;
+                }
+            });
+
+            for (auto *buffer : instrumentBuffers)
+            {
+                mixdown.addFrom(0, block * blockSize, *buffer, 0, 0, blockSize, 1.f);
+            }
+        }
+
+        return mixdown;
+    }
+};
+
+static RenderWorkerPoolTests renderWorkerPoolTests;
+
+#endif
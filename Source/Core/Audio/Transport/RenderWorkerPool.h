@@ -0,0 +1,67 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// A tiny pool of threads used by the renderer to process the instruments
+// in parallel: runAndWait() hands out the task indices to the workers
+// and to the calling thread, and returns only when all of them are done,
+// which makes a barrier between the render blocks
+
+class RenderWorkerPool final
+{
+public:
+
+    // the calling thread also runs the tasks, so zero workers is fine,
+    // in that case all tasks are just run serially
+    explicit RenderWorkerPool(int numWorkers);
+
+    // the pools doing some background work, like the vcs diffs,
+    // should use the lower priority, so they don't compete
+    // with the UI and the playback, which the renderer is allowed to
+    RenderWorkerPool(int numWorkers, const String &threadName, int threadPriority);
+
+    ~RenderWorkerPool();
+
+    static constexpr auto renderPriority = 9;
+    static constexpr auto backgroundPriority = 4;
+
+    using Task = Function<void(int taskIndex)>;
+    void runAndWait(int numTasks, const Task &task);
+
+    int getNumWorkers() const noexcept;
+
+    // a sensible number of workers for the given number of tasks,
+    // leaving one core for the calling thread
+    static int getOptimalNumWorkers(int numTasks) noexcept;
+
+private:
+
+    void runPendingTasks();
+
+    class Worker;
+    OwnedArray<Worker> workers;
+
+    const Task *currentTask = nullptr;
+    int numTasks = 0;
+
+    Atomic<int> nextTaskIndex = 0;
+    Atomic<int> numBusyWorkers = 0;
+    WaitableEvent allWorkersDone;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderWorkerPool)
+};
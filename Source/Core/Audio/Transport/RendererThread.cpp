@@ -17,12 +17,13 @@
 
 #include "Common.h"
 #include "RendererThread.h"
-#include "Workspace.h"
 #include "AudioCore.h"
+#include "RenderWorkerPool.h"
 
 RendererThread::RendererThread(Transport &parentTransport) :
     Thread("RendererThread"),
-    transport(parentTransport) {}
+    transport(parentTransport),
+    stemsWriterThread("RenderStemsWriter") {}
 
 RendererThread::~RendererThread()
 {
@@ -34,13 +35,43 @@ float RendererThread::getPercentsComplete() const noexcept
     return this->percentsDone.get();
 }
 
+float RendererThread::getPercentsComplete(const Instrument *instrument) const
+{
+    const ScopedLock lock(this->subBuffersLock);
+    for (const auto *subBuffer : this->subBuffers)
+    {
+        if (subBuffer->instrument == instrument)
+        {
+            return subBuffer->percentsDone.get();
+        }
+    }
+
+    return 0.f;
+}
+
+Array<const Instrument *> RendererThread::getRenderedInstruments() const
+{
+    Array<const Instrument *> result;
+
+    const ScopedLock lock(this->subBuffersLock);
+    for (const auto *subBuffer : this->subBuffers)
+    {
+        result.add(subBuffer->instrument);
+    }
+
+    return result;
+}
+
 void RendererThread::startRendering(const URL &target, RenderFormat format,
-    Transport::PlaybackContext::Ptr playbackContext)
+    Transport::PlaybackContext::Ptr playbackContext, int blockSize, bool renderStems)
 {
     this->stop();
 
+    jassert(blockSize > 0);
     this->format = format;
     this->context = playbackContext;
+    this->blockSize = blockSize;
+    this->shouldRenderStems = renderStems && target.isLocalFile();
 
     // keep the url copy alive while rendering,
     // since on iOS it contains a security bookmark:
@@ -55,24 +86,11 @@ void RendererThread::startRendering(const URL &target, RenderFormat format,
     if (auto outStream = this->renderTarget.createOutputStream())
     {
         this->percentsDone = 0.f;
-        
-        // 16 bits per sample should be enough for anybody :)
-        // ..wanna fight about it? https://people.xiph.org/~xiphmont/demo/neil-young.html
-        const int bitDepth = 16;
 
-        if (this->format == RenderFormat::WAV)
         {
-            WavAudioFormat wavFormat;
             const ScopedLock sl(this->writerLock);
-            this->writer.reset(wavFormat.createWriterFor(outStream.release(),
-                this->context->sampleRate, this->context->numOutputChannels, bitDepth, {}, 0));
-        }
-        else if (this->format == RenderFormat::FLAC)
-        {
-            FlacAudioFormat flacFormat;
-            const ScopedLock sl(this->writerLock);
-            this->writer.reset(flacFormat.createWriterFor(outStream.release(),
-                this->context->sampleRate, this->context->numOutputChannels, bitDepth, {}, 0));
+            this->writer.reset(createWriterForRenderFormat(this->format, outStream.release(),
+                this->context->sampleRate, this->context->numOutputChannels));
         }
 
         if (writer != nullptr)
@@ -101,50 +119,144 @@ bool RendererThread::isRendering() const
     return this->isThreadRunning();
 }
 
+void RendererThread::createStemWriters(double sampleRate, int numChannels)
+{
+    const auto mainFile = this->renderTarget.getLocalFile();
+    const auto extension = "." + getExtensionForRenderFormat(this->format);
+
+    // the fifo of each stem writer, big enough for the writer thread
+    // to catch up after encoding the other stems
+    const auto numSamplesToBuffer = jmax(this->blockSize * 32, 65536);
+
+    Array<File> stemFiles;
+    for (auto *subBuffer : this->subBuffers)
+    {
+        auto stemFile = mainFile.getSiblingFile(mainFile.getFileNameWithoutExtension() +
+            " - " + File::createLegalFileName(subBuffer->instrument->getName()) + extension);
+
+        // overwrite the stems left from the previous render,
+        // but not the ones of the instruments with the same name
+        if (stemFiles.contains(stemFile))
+        {
+            stemFile = stemFile.getNonexistentSibling();
+        }
+        else if (stemFile.existsAsFile())
+        {
+            stemFile.deleteFile();
+        }
+
+        stemFiles.add(stemFile);
+
+        auto outStream = stemFile.createOutputStream();
+        if (outStream == nullptr)
+        {
+            DBG("Failed to create a stem file: " + stemFile.getFullPathName());
+            continue;
+        }
+
+        // the writer takes the ownership of the stream only if succeeded
+        auto *stemWriter = createWriterForRenderFormat(this->format,
+            outStream.get(), sampleRate, numChannels);
+
+        if (stemWriter != nullptr)
+        {
+            outStream.release();
+            subBuffer->stemWriter = make<AudioFormatWriter::ThreadedWriter>(stemWriter,
+                this->stemsWriterThread, numSamplesToBuffer);
+        }
+    }
+
+    this->stemsWriterThread.startThread(3);
+}
+
 //===----------------------------------------------------------------------===//
 // Thread
 //===----------------------------------------------------------------------===//
 
-struct RenderBuffer final
-{
-    Instrument *instrument;
-    AudioBuffer<float> sampleBuffer;
-    MidiBuffer midiBuffer;
-};
-
 void RendererThread::run()
 {
     // step 0. init.
     this->transport.recacheIfNeeded();
     auto sequences = this->transport.getPlaybackCache();
-    constexpr auto bufferSize = 512;
+    const auto bufferSize = this->blockSize;
 
     // assuming that number of channels and sample rate is equal for all instruments
     const int numOutChannels = sequences.getNumOutputChannels();
     const int numInChannels = sequences.getNumInputChannels();
     const double sampleRate = sequences.getSampleRate();
     const double totalTimeMs = this->context->totalTimeMs;
-    const double msPerQuarter = this->context->startBeatTempo;
-    double secPerQuarter = msPerQuarter / 1000.0;
 
     double currentFrame = 0.0;
     const double lastFrame = totalTimeMs / 1000.0 * sampleRate;
 
+    // message timestamps are in beats, and the tempo map
+    // converts them to the sample positions from the project start
+    const auto &tempoMap = this->context->tempoMap;
+    const auto firstBeat = this->context->projectFirstBeat;
+    const auto startTimeMs = tempoMap.getTimeAt(firstBeat);
+    auto getFrameForMessage = [&tempoMap, startTimeMs, sampleRate](const MidiMessage &message) -> double
+    {
+        const auto timeMs = tempoMap.getTimeAt(message.getTimeStamp()) - startTimeMs;
+        return timeMs / 1000.0 * sampleRate;
+    };
+
     // step 1. create a list of unique instruments with audio buffers for them.
-    OwnedArray<RenderBuffer> subBuffers;
     Array<Instrument *> uniqueInstruments;
     uniqueInstruments.addArray(sequences.getUniqueInstruments());
 
-    for (int i = 0; i < uniqueInstruments.size(); ++i)
     {
-        Instrument *instrument = uniqueInstruments[i];
-        auto *subBuffer = new RenderBuffer();
-        subBuffer->instrument = instrument;
-        subBuffer->sampleBuffer = AudioBuffer<float>(numOutChannels, bufferSize);
-        subBuffers.add(subBuffer);
-        //DBG("Adding instrument: " + String(instrument->getName()));
+        const ScopedLock lock(this->subBuffersLock);
+        this->subBuffers.clear();
+
+        for (int i = 0; i < uniqueInstruments.size(); ++i)
+        {
+            Instrument *instrument = uniqueInstruments[i];
+            auto *subBuffer = new RenderBuffer();
+            subBuffer->instrument = instrument;
+            subBuffer->sampleBuffer = AudioBuffer<float>(numOutChannels, bufferSize);
+            this->subBuffers.add(subBuffer);
+            //DBG("Adding instrument: " + String(instrument->getName()));
+        }
+    }
+
+    // the sub-buffers array is not changed until the next render,
+    // so it's safe to iterate it without the lock here
+    const auto &subBuffers = this->subBuffers;
+
+    // step 1a. create the stems, if needed.
+    if (this->shouldRenderStems)
+    {
+        this->createStemWriters(sampleRate, numOutChannels);
     }
 
+    // step 1b. count the events of each instrument within the rendered range,
+    // so that the progress can be reported per instrument.
+    {
+        CachedMidiMessage message;
+        sequences.seekToTime(firstBeat);
+        while (sequences.getNextMessage(message))
+        {
+            if (message.message.isTempoMetaEvent() ||
+                getFrameForMessage(message.message) >= lastFrame)
+            {
+                continue;
+            }
+
+            for (auto *subBuffer : subBuffers)
+            {
+                if (message.instrument == subBuffer->instrument)
+                {
+                    subBuffer->numEvents++;
+                }
+            }
+        }
+    }
+
+    RenderWorkerPool workers(this->numWorkers >= 0 ? this->numWorkers :
+        RenderWorkerPool::getOptimalNumWorkers(subBuffers.size()));
+    DBG("Rendering " + String(subBuffers.size()) + " instruments with " +
+        String(workers.getNumWorkers() + 1) + " threads");
+
     // step 2. release resources, prepare to play, etc.
     for (auto *subBuffer : subBuffers)
     {
@@ -160,7 +272,7 @@ void RendererThread::run()
     Thread::sleep(200);
 
     // step 3. render loop itself.
-    sequences.seekToTime(0.0);
+    sequences.seekToTime(firstBeat);
     
     CachedMidiMessage nextMessage;
     bool hasNextMessage = sequences.getNextMessage(nextMessage);
@@ -169,12 +281,8 @@ void RendererThread::run()
     // TODO: add double precision rendering someday (for processor graphs who support it)
     AudioBuffer<float> mixingBuffer(numOutChannels, bufferSize);
     
-    double lastEventTick = 0.0;
-    double prevEventTimeStamp = 0.0;
-    double nextEventTickDelta = (nextMessage.message.getTimeStamp() - prevEventTimeStamp) * secPerQuarter;
-    double nextEventTick = lastEventTick + nextEventTickDelta;
-
-    int messageFrame = int((nextEventTick * sampleRate) - currentFrame);
+    double nextEventFrame = getFrameForMessage(nextMessage.message);
+    int messageFrame = int(nextEventFrame - currentFrame);
 
     // And here we go: send MidiStart
     for (auto *subBuffer : subBuffers)
@@ -191,15 +299,13 @@ void RendererThread::run()
         
         // step 3a. fill up the midi buffers.
         while (hasNextMessage &&
-               ( (nextEventTick * sampleRate) >= currentFrame &&
-                 (nextEventTick * sampleRate) < (currentFrame + bufferSize) ))
+               (nextEventFrame >= currentFrame &&
+                nextEventFrame < (currentFrame + bufferSize)))
         {
-            messageFrame = int((nextEventTick * sampleRate) - currentFrame);
+            messageFrame = int(nextEventFrame - currentFrame);
 
             if (nextMessage.message.isTempoMetaEvent())
             {
-                secPerQuarter = nextMessage.message.getTempoSecondsPerQuarterNote();
-
                 // Sends this to everybody (need to do that for drum-machines) - TODO test
                 for (auto *subBuffer : subBuffers)
                 {
@@ -214,21 +320,22 @@ void RendererThread::run()
                     {
                         //DBG("Adding message with frame " + String(messageFrame));
                         subBuffer->midiBuffer.addEvent(nextMessage.message, messageFrame);
+                        subBuffer->numRenderedEvents++;
                     }
                 }
             }
 
-            lastEventTick += nextEventTickDelta;
-            prevEventTimeStamp = nextMessage.message.getTimeStamp();
-            
             hasNextMessage = sequences.getNextMessage(nextMessage);
-            nextEventTickDelta = (nextMessage.message.getTimeStamp() - prevEventTimeStamp) * secPerQuarter;
-            nextEventTick = lastEventTick + nextEventTickDelta;
+            nextEventFrame = getFrameForMessage(nextMessage.message);
         }
 
-        // step 3b. call processBlock for every instrument.
-        for (auto *subBuffer : subBuffers)
+        // step 3b. call processBlock for every instrument,
+        // each graph is only touched by one thread at a time, and
+        // the runAndWait barrier makes sure all of them are done
+        const auto progress = float((currentFrame + bufferSize) / lastFrame);
+        workers.runAndWait(subBuffers.size(), [&subBuffers, progress, bufferSize](int i)
         {
+            auto *subBuffer = subBuffers.getUnchecked(i);
             auto *graph = subBuffer->instrument->getProcessorGraph();
             {
                 const ScopedLock lock(graph->getCallbackLock());
@@ -236,12 +343,27 @@ void RendererThread::run()
                 //DBG("processBlock num midi events: " + String(subBuffer->midiBuffer.getNumEvents()));
                 graph->processBlock(subBuffer->sampleBuffer, subBuffer->midiBuffer);
                 subBuffer->midiBuffer.clear();
+            }
 
-                //Thread::yield();
+            // only queues the data to be written by the stems writer thread,
+            // and only waits if that thread can't keep up with the rendering
+            if (subBuffer->stemWriter != nullptr)
+            {
+                while (!subBuffer->stemWriter->write(
+                    subBuffer->sampleBuffer.getArrayOfReadPointers(), bufferSize))
+                {
+                    Thread::sleep(1);
+                }
             }
-        }
 
-        // step 3c. mix them down to the render buffer.
+            // the instruments without any events of their own
+            // (e.g. only playing the tempo track) follow the overall progress
+            subBuffer->percentsDone = jmin(1.f, subBuffer->numEvents > 0 ?
+                float(subBuffer->numRenderedEvents) / float(subBuffer->numEvents) : progress);
+        });
+
+        // step 3c. mix them down to the render buffer,
+        // always in the same order, so that the result is bit-identical
         mixingBuffer.clear();
 
         for (auto *subBuffer : subBuffers)
@@ -282,6 +404,14 @@ void RendererThread::run()
         graph->reset();
         graph->releaseResources();
     }
+
+    // step 5. flush the stems, the threaded writers write all the pending data when deleted.
+    for (auto *subBuffer : subBuffers)
+    {
+        subBuffer->stemWriter = nullptr;
+    }
+
+    this->stemsWriterThread.stopThread(1000);
     
     {
         const ScopedLock sl(this->writerLock);
@@ -291,5 +421,5 @@ void RendererThread::run()
     // dispose the URL object, so that its security bookmark can be released by iOS
     this->renderTarget = {};
 
-    App::Workspace().getAudioCore().setAwake();
+    this->transport.sleepTimer.setAwake();
 }
@@ -29,8 +29,24 @@ public:
     
     float getPercentsComplete() const noexcept;
 
+    // the progress of each instrument is the share of its own events
+    // rendered so far, so the ones with the short parts finish earlier
+    float getPercentsComplete(const Instrument *instrument) const;
+    Array<const Instrument *> getRenderedInstruments() const;
+
+    // the instruments are processed in parallel, block by block, and
+    // mixed down after each block in the same order as in the serial mode,
+    // so the result is the same regardless of the number of threads;
+    // larger blocks mean less synchronization between the threads
+    static constexpr auto defaultBlockSize = 512;
+
+    // if renderStems is set, each instrument is also written into its own file
+    // next to the target one, e.g. "Song - Instrument.flac", from the same
+    // rendering pass as the master mix; only works for the local files
     void startRendering(const URL &target, RenderFormat format,
-        Transport::PlaybackContext::Ptr context);
+        Transport::PlaybackContext::Ptr context,
+        int blockSize = RendererThread::defaultBlockSize,
+        bool renderStems = false);
 
     void stop();
     bool isRendering() const;
@@ -43,11 +59,19 @@ private:
 
     void run() override;
 
+    void createStemWriters(double sampleRate, int numChannels);
+
 private:
 
     Transport &transport;
     Transport::PlaybackContext::Ptr context;
     RenderFormat format;
+    int blockSize = RendererThread::defaultBlockSize;
+    bool shouldRenderStems = false;
+
+    // the number of workers besides the rendering thread itself,
+    // picked by the number of instruments, unless set by the tests
+    int numWorkers = -1;
 
     // this needs to be kept alive while rendering (why - because iOS)
     URL renderTarget;
@@ -57,5 +81,29 @@ private:
 
     Atomic<float> percentsDone = 0.f;
 
+    // the stems are encoded and written on this thread, so that writing
+    // a dozen of files doesn't slow down the rendering itself
+    TimeSliceThread stemsWriterThread;
+
+    struct RenderBuffer final
+    {
+        Instrument *instrument;
+        AudioBuffer<float> sampleBuffer;
+        MidiBuffer midiBuffer;
+        Atomic<float> percentsDone = 0.f;
+        UniquePointer<AudioFormatWriter::ThreadedWriter> stemWriter;
+
+        // only accessed by the rendering thread and by the worker
+        // processing this buffer, which are separated by the barrier
+        int numEvents = 0;
+        int numRenderedEvents = 0;
+    };
+
+    // kept after the rendering is done, so that the progress can be checked
+    OwnedArray<RenderBuffer> subBuffers;
+    CriticalSection subBuffersLock;
+
+    friend class TransportTests;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RendererThread)
 };
@@ -0,0 +1,336 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "SequencedMidiStream.h"
+
+SequencedMidiStream::SequencedMidiStream(int64 startPosition,
+    int64 loopStartPosition, int64 endPosition, bool isLooped) :
+    startPosition(startPosition),
+    loopStartPosition(loopStartPosition),
+    endPosition(jmax(startPosition, endPosition)),
+    isLooped(isLooped),
+    position(startPosition),
+    playheadPosition(startPosition)
+{
+    memset(this->holdingNotes, 0, sizeof(this->holdingNotes));
+}
+
+void SequencedMidiStream::addInitialMessage(const MidiMessage &message)
+{
+    this->initialMessages.add(message);
+}
+
+void SequencedMidiStream::addEvent(int64 samplePosition, const MidiMessage &message)
+{
+    jassert(this->events.isEmpty() ||
+        this->events.getReference(this->events.size() - 1).samplePosition <= samplePosition);
+
+    this->events.add({ samplePosition, message });
+
+    if (samplePosition < this->startPosition)
+    {
+        this->startIndex = this->events.size();
+    }
+
+    if (samplePosition < this->loopStartPosition)
+    {
+        this->loopStartIndex = this->events.size();
+    }
+}
+
+int SequencedMidiStream::getNumEvents() const noexcept
+{
+    return this->events.size();
+}
+
+//===----------------------------------------------------------------------===//
+// Audio thread
+//===----------------------------------------------------------------------===//
+
+void SequencedMidiStream::renderNextBlock(MidiBuffer &target, int numSamples) noexcept
+{
+    if (!this->hasStarted)
+    {
+        this->hasStarted = true;
+        this->nextEventIndex = this->startIndex;
+
+        for (const auto &message : this->initialMessages)
+        {
+            target.addEvent(message, 0);
+        }
+    }
+
+    int blockOffset = 0;
+    while (blockOffset < numSamples && !this->finished.get())
+    {
+        if (this->position >= this->endPosition)
+        {
+            // the events exactly at the end are played before rewinding,
+            // e.g. the note-offs of the notes which end at the loop end
+            this->renderEventsBefore(target, this->endPosition + 1, blockOffset);
+
+            if (!this->isLooped || this->loopStartPosition >= this->endPosition)
+            {
+                this->finished = true;
+                break;
+            }
+
+            this->position = this->loopStartPosition;
+            this->nextEventIndex = this->loopStartIndex;
+        }
+
+        const auto segmentLength = int(jmin(int64(numSamples - blockOffset),
+            this->endPosition - this->position));
+
+        this->renderEventsBefore(target, this->position + segmentLength, blockOffset);
+
+        this->position += segmentLength;
+        blockOffset += segmentLength;
+    }
+
+    this->playheadPosition = this->position;
+}
+
+void SequencedMidiStream::renderEventsBefore(MidiBuffer &target,
+    int64 positionLimit, int blockOffset) noexcept
+{
+    while (this->nextEventIndex < this->events.size())
+    {
+        const auto &event = this->events.getReference(this->nextEventIndex);
+        if (event.samplePosition >= positionLimit)
+        {
+            return;
+        }
+
+        const auto eventOffset = blockOffset +
+            int(jmax(int64(0), event.samplePosition - this->position));
+
+        target.addEvent(event.message, eventOffset);
+
+        const auto &message = event.message;
+        if (message.isNoteOn())
+        {
+            this->holdingNotes[message.getChannel() - 1][message.getNoteNumber()] = true;
+        }
+        else if (message.isNoteOff())
+        {
+            this->holdingNotes[message.getChannel() - 1][message.getNoteNumber()] = false;
+        }
+
+        this->nextEventIndex++;
+    }
+}
+
+int64 SequencedMidiStream::getPlayheadPosition() const noexcept
+{
+    return this->playheadPosition.get();
+}
+
+bool SequencedMidiStream::hasFinished() const noexcept
+{
+    return this->finished.get();
+}
+
+Array<MidiMessage> SequencedMidiStream::getNoteOffsForHoldingNotes() const
+{
+    Array<MidiMessage> result;
+
+    for (int channel = 0; channel < SequencedMidiStream::numChannels; ++channel)
+    {
+        for (int key = 0; key < SequencedMidiStream::numKeys; ++key)
+        {
+            if (this->holdingNotes[channel][key])
+            {
+                result.add(MidiMessage::noteOff(channel + 1, key, 0.f));
+            }
+        }
+    }
+
+    return result;
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class SequencedMidiStreamTests final : public UnitTest
+{
+public:
+    SequencedMidiStreamTests() : UnitTest("Sequenced midi stream tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Sample-accurate event placement");
+
+        // dense 1/64 notes at 180 bpm and 44.1 kHz, which is ~919 samples per note,
+        // rendered with the block sizes which are not multiples of that
+        Array<int64> expectedPositions;
+        for (int i = 0; i < numNotes; ++i)
+        {
+            expectedPositions.add(getIdealSamplePosition(i));
+        }
+
+        for (const auto blockSize : { 64, 441, 512, 1024 })
+        {
+            SequencedMidiStream stream(0, 0, expectedPositions.getLast() + 1, false);
+            for (int i = 0; i < numNotes; ++i)
+            {
+                stream.addEvent(expectedPositions[i], MidiMessage::noteOn(1, 60, 0.5f));
+            }
+
+            const auto renderedPositions = renderAll(stream, blockSize, numNotes);
+            expectEquals(renderedPositions.size(), numNotes);
+
+            for (int i = 0; i < renderedPositions.size(); ++i)
+            {
+                expectEquals(renderedPositions[i], expectedPositions[i]);
+            }
+
+            // the stream should stop at the end, i.e. right after the last note
+            MidiBuffer buffer;
+            stream.renderNextBlock(buffer, blockSize);
+            expect(buffer.isEmpty());
+            expect(stream.hasFinished());
+        }
+
+        beginTest("Looping and holding notes");
+
+        {
+            SequencedMidiStream stream(150, 100, 300, true);
+            stream.addEvent(50, MidiMessage::noteOn(1, 60, 0.5f)); // before the loop
+            stream.addEvent(100, MidiMessage::noteOn(2, 62, 0.5f)); // loop start
+            stream.addEvent(200, MidiMessage::noteOn(3, 64, 0.5f));
+            stream.addEvent(300, MidiMessage::noteOff(3, 64)); // loop end
+
+            // starts at 150, so plays 200, 300, then 100, 200, 300, 100..
+            const auto renderedPositions = renderAll(stream, 128, 6);
+            expectEquals(renderedPositions.size(), 6);
+            expectEquals(renderedPositions[0], int64(50)); // block 0, offset 50
+            expectEquals(renderedPositions[1], int64(150)); // offset 150 from the start
+            expectEquals(renderedPositions[2], int64(150)); // rewound at the same sample
+            expectEquals(renderedPositions[3], int64(250));
+            expectEquals(renderedPositions[4], int64(350));
+            expectEquals(renderedPositions[5], int64(350));
+            expect(!stream.hasFinished());
+
+            const auto noteOffs = stream.getNoteOffsForHoldingNotes();
+            expectEquals(noteOffs.size(), 1);
+            expectEquals(noteOffs.getFirst().getChannel(), 2);
+            expectEquals(noteOffs.getFirst().getNoteNumber(), 62);
+        }
+
+        beginTest("Timing jitter, audio thread vs player thread");
+
+        {
+            SequencedMidiStream stream(0, 0, getIdealSamplePosition(numNotes), false);
+            for (int i = 0; i < numNotes; ++i)
+            {
+                stream.addEvent(getIdealSamplePosition(i), MidiMessage::noteOn(1, 60, 0.5f));
+            }
+
+            const auto renderedPositions = renderAll(stream, 512, numNotes);
+
+            int64 maxJitterSamples = 0;
+            for (int i = 0; i < renderedPositions.size(); ++i)
+            {
+                maxJitterSamples = jmax(maxJitterSamples,
+                    std::abs(renderedPositions[i] - getIdealSamplePosition(i)));
+            }
+
+            expectEquals(maxJitterSamples, int64(0));
+            logMessage("Audio thread sequencer, max jitter: " +
+                String(maxJitterSamples) + " samples");
+        }
+
+        {
+            // this mimics the way PlayerThread waits for the next event,
+            // and measures how late it wakes up compared to the ideal timing;
+            // note that the midi collector adds up to one more block of jitter
+            // on top of that, when it maps the timestamps to the sample offsets
+            const auto startTimeMs = Time::getMillisecondCounterHiRes();
+            double previousEventTimeMs = 0.0;
+            double totalJitterMs = 0.0;
+            double maxJitterMs = 0.0;
+
+            for (int i = 0; i < numNotes; ++i)
+            {
+                const auto eventTimeMs = i * noteLengthMs;
+                const auto nextEventTimeDelta = eventTimeMs - previousEventTimeMs;
+                previousEventTimeMs = eventTimeMs;
+
+                if (uint32(nextEventTimeDelta) != 0)
+                {
+                    Time::waitForMillisecondCounter(Time::getMillisecondCounter() +
+                        uint32(nextEventTimeDelta));
+                }
+
+                const auto jitterMs = std::abs(Time::getMillisecondCounterHiRes() -
+                    startTimeMs - eventTimeMs);
+
+                totalJitterMs += jitterMs;
+                maxJitterMs = jmax(maxJitterMs, jitterMs);
+            }
+
+            logMessage("Player thread, mean jitter: " +
+                String(totalJitterMs / numNotes * sampleRate * 0.001, 1) + " samples, max jitter: " +
+                String(maxJitterMs * sampleRate * 0.001, 1) + " samples");
+        }
+    }
+
+private:
+
+    static constexpr auto numNotes = 64;
+    static constexpr auto sampleRate = 44100.0;
+    static constexpr auto noteLengthMs = 60000.0 / 180.0 / 16.0;
+
+    static int64 getIdealSamplePosition(int noteIndex)
+    {
+        return int64(std::floor(noteIndex * noteLengthMs * sampleRate * 0.001 + 0.5));
+    }
+
+    // returns the absolute sample positions of the rendered events
+    static Array<int64> renderAll(SequencedMidiStream &stream, int blockSize, int maxEvents)
+    {
+        Array<int64> result;
+        MidiBuffer buffer;
+
+        for (int64 blockStart = 0; result.size() < maxEvents; blockStart += blockSize)
+        {
+            buffer.clear();
+            stream.renderNextBlock(buffer, blockSize);
+
+            for (const auto metadata : buffer)
+            {
+                result.add(blockStart + metadata.samplePosition);
+            }
+
+            if (stream.hasFinished())
+            {
+                break;
+            }
+        }
+
+        return result;
+    }
+};
+
+static SequencedMidiStreamTests sequencedMidiStreamTests;
+
+#endif
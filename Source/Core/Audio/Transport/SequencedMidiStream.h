@@ -0,0 +1,102 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// A pre-rendered stream of playback events for a single instrument,
+// with timestamps converted to sample positions in advance;
+// the stream is filled by the player thread before the playback starts,
+// and then it is read by the instrument's audio callback, which places
+// the events at the exact sample offsets within each block,
+// so that the timing no longer depends on how precisely
+// the player thread manages to wake up
+
+class SequencedMidiStream final : public ReferenceCountedObject
+{
+public:
+
+    // all positions are in samples, relative to the beginning of the stream;
+    // when looped, the stream rewinds to loopStartPosition after endPosition
+    SequencedMidiStream(int64 startPosition, int64 loopStartPosition,
+        int64 endPosition, bool isLooped);
+
+    // the messages to be sent in the very first block, before any events,
+    // like midi start and the controller states at the playback start
+    void addInitialMessage(const MidiMessage &message);
+
+    // the events are expected to be added in their playback order
+    void addEvent(int64 samplePosition, const MidiMessage &message);
+
+    int getNumEvents() const noexcept;
+
+    //===------------------------------------------------------------------===//
+    // Audio thread
+    //===------------------------------------------------------------------===//
+
+    // adds all events falling into the next block to the buffer, and
+    // advances the playhead; this is only called from the audio callback
+    void renderNextBlock(MidiBuffer &target, int numSamples) noexcept;
+
+    // the playhead position in samples, with the loop wraps applied
+    int64 getPlayheadPosition() const noexcept;
+
+    // true if the playback is not looped and has reached the end
+    bool hasFinished() const noexcept;
+
+    // note-off's for the notes which are still sounding at the playhead;
+    // only makes sense after the stream has been detached from the callback
+    Array<MidiMessage> getNoteOffsForHoldingNotes() const;
+
+    using Ptr = ReferenceCountedObjectPtr<SequencedMidiStream>;
+
+private:
+
+    void renderEventsBefore(MidiBuffer &target,
+        int64 positionLimit, int blockOffset) noexcept;
+
+    struct Event final
+    {
+        int64 samplePosition;
+        MidiMessage message;
+    };
+
+    Array<Event> events;
+    Array<MidiMessage> initialMessages;
+
+    const int64 startPosition;
+    const int64 loopStartPosition;
+    const int64 endPosition;
+    const bool isLooped;
+
+    // the indices of the first events at the start and at the loop start,
+    // kept up to date in addEvent, as the events are added in order
+    int startIndex = 0;
+    int loopStartIndex = 0;
+
+    // the audio thread's state:
+    int64 position = 0;
+    int nextEventIndex = 0;
+    bool hasStarted = false;
+    Atomic<int64> playheadPosition;
+    Atomic<bool> finished = false;
+
+    static constexpr auto numChannels = 16;
+    static constexpr auto numKeys = 128;
+    bool holdingNotes[numChannels][numKeys];
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SequencedMidiStream)
+};
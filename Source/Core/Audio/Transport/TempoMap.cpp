@@ -0,0 +1,185 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "TempoMap.h"
+
+TempoMap::TempoMap()
+{
+    this->clear();
+}
+
+void TempoMap::clear()
+{
+    this->segments.clearQuick();
+    this->segments.add({ 0.0, double(Globals::Defaults::msPerBeat), 0.0 });
+}
+
+void TempoMap::rebuild(const MidiMessageSequence &tempoEvents)
+{
+    this->segments.clearQuick();
+
+    for (int i = 0; i < tempoEvents.getNumEvents(); ++i)
+    {
+        const auto &message = tempoEvents.getEventPointer(i)->message;
+        if (!message.isTempoMetaEvent())
+        {
+            continue;
+        }
+
+        const auto beat = message.getTimeStamp();
+        const auto msPerBeat = message.getTempoSecondsPerQuarterNote() * 1000.0;
+
+        if (this->segments.isEmpty())
+        {
+            // the default tempo segment before the first tempo event
+            this->segments.add({ beat, double(Globals::Defaults::msPerBeat), 0.0 });
+        }
+
+        const auto &last = this->segments.getReference(this->segments.size() - 1);
+        jassert(beat >= last.beat);
+
+        if (last.msPerBeat == msPerBeat)
+        {
+            continue; // interpolated tempo curves often have repeating values
+        }
+
+        const auto timeMs = last.timeMs + (beat - last.beat) * last.msPerBeat;
+        this->segments.add({ beat, msPerBeat, timeMs });
+    }
+
+    if (this->segments.isEmpty())
+    {
+        this->clear();
+    }
+}
+
+double TempoMap::getTimeAt(double beat) const noexcept
+{
+    const auto &segment = this->segments.getReference(this->findSegmentIndexByBeat(beat));
+    return segment.timeMs + (beat - segment.beat) * segment.msPerBeat;
+}
+
+double TempoMap::getBeatAt(double timeMs) const noexcept
+{
+    const auto &segment = this->segments.getReference(this->findSegmentIndexByTime(timeMs));
+    return segment.beat + (timeMs - segment.timeMs) / segment.msPerBeat;
+}
+
+double TempoMap::getTempoAt(double beat) const noexcept
+{
+    return this->segments.getReference(this->findSegmentIndexByBeat(beat)).msPerBeat;
+}
+
+// Both return the last segment starting at or before the given position,
+// or the first segment, if the position is before the start of the map;
+// if several segments start at the same position, the last one wins,
+// same as when the events are applied one by one
+
+int TempoMap::findSegmentIndexByBeat(double beat) const noexcept
+{
+    int low = 1;
+    int high = this->segments.size();
+
+    while (low < high)
+    {
+        const int middle = (low + high) / 2;
+        if (this->segments.getReference(middle).beat <= beat)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low - 1;
+}
+
+int TempoMap::findSegmentIndexByTime(double timeMs) const noexcept
+{
+    int low = 1;
+    int high = this->segments.size();
+
+    while (low < high)
+    {
+        const int middle = (low + high) / 2;
+        if (this->segments.getReference(middle).timeMs <= timeMs)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low - 1;
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class TempoMapTests final : public UnitTest
+{
+public:
+    TempoMapTests() : UnitTest("Tempo map tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Beats to milliseconds and back");
+
+        TempoMap map;
+        expectEquals(map.getTimeAt(4.0) - map.getTimeAt(0.0), 2000.0);
+        expectEquals(map.getTempoAt(100.0), double(Globals::Defaults::msPerBeat));
+
+        MidiMessageSequence tempoEvents;
+        tempoEvents.addEvent(MidiMessage::tempoMetaEvent(250000), 4.0);
+        tempoEvents.addEvent(MidiMessage::tempoMetaEvent(1000000), 8.0);
+        map.rebuild(tempoEvents);
+
+        expectEquals(map.getNumSegments(), 3);
+        expectEquals(map.getTimeAt(10.0) - map.getTimeAt(0.0), 4 * 500.0 + 4 * 250.0 + 2 * 1000.0);
+        expectEquals(map.getTempoAt(3.0), 500.0);
+        expectEquals(map.getTempoAt(4.0), 250.0);
+        expectEquals(map.getTempoAt(9.0), 1000.0);
+
+        for (const auto beat : { -2.0, 0.0, 3.5, 4.0, 6.25, 8.0, 100.0 })
+        {
+            expectWithinAbsoluteError(map.getBeatAt(map.getTimeAt(beat)), beat, 0.000001);
+        }
+
+        beginTest("Tempo events at the same beat");
+
+        tempoEvents.clear();
+        tempoEvents.addEvent(MidiMessage::tempoMetaEvent(250000), 0.0);
+        tempoEvents.addEvent(MidiMessage::tempoMetaEvent(1000000), 0.0);
+        map.rebuild(tempoEvents);
+
+        expectEquals(map.getTempoAt(0.0), 1000.0);
+        expectEquals(map.getTimeAt(2.0) - map.getTimeAt(0.0), 2000.0);
+        expectEquals(map.getTimeAt(0.0) - map.getTimeAt(-1.0), 500.0);
+    }
+};
+
+static TempoMapTests tempoMapTests;
+
+#endif
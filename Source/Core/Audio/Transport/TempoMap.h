@@ -0,0 +1,67 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// A precomputed tempo map: a sorted list of tempo segments with
+// the cumulative time at the start of each segment, which allows
+// to convert beats to milliseconds and back with a binary search,
+// instead of replaying all the messages from the playback cache;
+// all beats here are absolute, i.e. not relative to the project start
+
+class TempoMap final
+{
+public:
+
+    TempoMap();
+
+    // Rebuilds the map from a sequence of tempo meta events
+    // timestamped in beats, all other messages are ignored
+    void rebuild(const MidiMessageSequence &tempoEvents);
+    void clear();
+
+    // Milliseconds from the start of the map, which is the first tempo event,
+    // so only the difference of two results makes sense; for the beats before
+    // the first tempo event the default tempo is used
+    double getTimeAt(double beat) const noexcept;
+    double getBeatAt(double timeMs) const noexcept;
+
+    // Milliseconds per beat at the given position
+    double getTempoAt(double beat) const noexcept;
+
+    inline int getNumSegments() const noexcept
+    {
+        return this->segments.size();
+    }
+
+private:
+
+    struct Segment final
+    {
+        double beat;
+        double msPerBeat;
+        double timeMs;
+    };
+
+    // always has at least one segment with the default tempo
+    Array<Segment> segments;
+
+    int findSegmentIndexByBeat(double beat) const noexcept;
+    int findSegmentIndexByTime(double timeMs) const noexcept;
+
+    JUCE_LEAK_DETECTOR(TempoMap)
+};
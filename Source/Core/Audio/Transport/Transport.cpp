@@ -22,6 +22,7 @@
 #include "PlayerThread.h"
 #include "PlayerThreadPool.h"
 #include "MidiSequence.h"
+#include "PianoSequence.h"
 #include "MidiTrack.h"
 #include "Pattern.h"
 #include "Workspace.h"
@@ -30,6 +31,7 @@
 #include "KeyboardMapping.h"
 #include "ProjectMetadata.h"
 #include "BuiltInSynthAudioPlugin.h"
+#include "Config.h"
 
 #define TIME_NOW (Time::getMillisecondCounterHiRes() * 0.001)
 #define SOUND_SLEEP_DELAY_MS (60000)
@@ -138,21 +140,34 @@ void Transport::probeSoundAtBeat(float beatPosition, const MidiSequence *limitTo
     this->sleepTimer.setAwake();
     this->recacheIfNeeded();
     
-    const auto targetRelBeat = beatPosition - this->projectFirstBeat.get();
     const auto sequencesToProbe(this->playbackCache.getAllFor(limitToLayer));
     
     for (const auto &seq : sequencesToProbe)
     {
-        for (int j = 0; j < seq->midiMessages.getNumEvents(); ++j)
+        // the cache is in absolute beats, and the notes are exported
+        // no longer than they are in the sequence, so only the ones starting
+        // within the longest note's length before the beat need to be checked
+        int firstIndex = 0;
+        if (const auto *pianoSequence = dynamic_cast<const PianoSequence *>(seq->track))
+        {
+            firstIndex = TransportPlaybackCache::getNextIndexAtTime(seq->midiMessages,
+                beatPosition - pianoSequence->getMaxNoteLength());
+        }
+
+        for (int j = firstIndex; j < seq->midiMessages.getNumEvents(); ++j)
         {
             auto *noteOnHolder = seq->midiMessages.getEventPointer(j);
-            
+            if (noteOnHolder->message.getTimeStamp() > beatPosition)
+            {
+                break;
+            }
+
             if (auto *noteOffHolder = noteOnHolder->noteOffObject)
             {
                 const double noteOn(noteOnHolder->message.getTimeStamp());
                 const double noteOff(noteOffHolder->message.getTimeStamp());
                 
-                if (noteOn <= targetRelBeat && noteOff > targetRelBeat)
+                if (noteOn <= beatPosition && noteOff > beatPosition)
                 {
                     MidiMessage messageTimestampedAsNow(noteOnHolder->message);
                     messageTimestampedAsNow.setTimeStamp(TIME_NOW);
@@ -324,7 +339,15 @@ void Transport::disableLoopPlayback()
 // Rendering
 //===----------------------------------------------------------------------===//
 
-void Transport::startRender(const URL &renderTarget, RenderFormat format)
+void Transport::startRender(const URL &renderTarget,
+    RenderFormat format, bool renderStems)
+{
+    this->startRender(renderTarget, format,
+        RendererThread::defaultBlockSize, renderStems);
+}
+
+void Transport::startRender(const URL &renderTarget, RenderFormat format,
+    int blockSize, bool renderStems)
 {
     if (this->renderer->isRendering())
     {
@@ -333,7 +356,7 @@ void Transport::startRender(const URL &renderTarget, RenderFormat format)
     
     this->sleepTimer.setCanSleepAfter(0);
     this->renderer->startRendering(renderTarget, format,
-        this->fillPlaybackContextAt(this->getProjectFirstBeat()));
+        this->fillPlaybackContextAt(this->getProjectFirstBeat()), blockSize, renderStems);
 }
 
 void Transport::stopRender()
@@ -358,6 +381,16 @@ float Transport::getRenderingPercentsComplete() const
     return this->renderer->getPercentsComplete();
 }
 
+float Transport::getRenderingPercentsComplete(const Instrument *instrument) const
+{
+    return this->renderer->getPercentsComplete(instrument);
+}
+
+Array<const Instrument *> Transport::getRenderedInstruments() const
+{
+    return this->renderer->getRenderedInstruments();
+}
+
 //===----------------------------------------------------------------------===//
 // Sending messages at real-time
 //===----------------------------------------------------------------------===//
@@ -573,7 +606,7 @@ void Transport::instrumentAdded(Instrument *instrument)
     this->stopPlaybackAndRecording();
 
     // invalidate cache as is uses pointers to the players too
-    this->playbackCacheIsOutdated = true;
+    this->invalidateAllCaches();
 
     for (int i = 0; i < this->tracksCache.size(); ++i)
     {
@@ -590,7 +623,7 @@ void Transport::instrumentRemoved(Instrument *instrument)
 
 void Transport::instrumentRemovedPostAction()
 {
-    this->playbackCacheIsOutdated = true;
+    this->invalidateAllCaches();
 
     for (int i = 0; i < this->tracksCache.size(); ++i)
     {
@@ -606,6 +639,7 @@ void Transport::instrumentRemovedPostAction()
 #define updateLengthAndTimeIfNeeded(event) \
     if (event->getTrackControllerNumber() == MidiTrack::tempoController) \
     { \
+        this->tempoMapIsOutdated = true; \
         this->seekToBeat(this->getSeekBeat()); \
     }
 
@@ -619,7 +653,7 @@ void Transport::onChangeMidiEvent(const MidiEvent &oldEvent, const MidiEvent &ne
     }
 
     updateLengthAndTimeIfNeeded((&newEvent));
-    this->playbackCacheIsOutdated = true;
+    this->invalidateCacheFor(newEvent.getSequence()->getTrack());
 }
 
 void Transport::onAddMidiEvent(const MidiEvent &event)
@@ -630,15 +664,51 @@ void Transport::onAddMidiEvent(const MidiEvent &event)
     }
 
     updateLengthAndTimeIfNeeded((&event));
-    this->playbackCacheIsOutdated = true;
+    this->invalidateCacheFor(event.getSequence()->getTrack());
 }
 
 void Transport::onRemoveMidiEvent(const MidiEvent &event) {}
+
+// the group edits always belong to the same track,
+// so the playback is stopped and the track is recached once
+
+void Transport::onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+    const Array<const MidiEvent *> &newEvents)
+{
+    if (newEvents.isEmpty())
+    {
+        return;
+    }
+
+    if (!this->isRecording())
+    {
+        this->stopPlayback();
+    }
+
+    updateLengthAndTimeIfNeeded(newEvents.getFirst());
+    this->invalidateCacheFor(newEvents.getFirst()->getSequence()->getTrack());
+}
+
+void Transport::onAddMidiEvents(const Array<const MidiEvent *> &events)
+{
+    if (events.isEmpty())
+    {
+        return;
+    }
+
+    if (!this->isRecording())
+    {
+        this->stopPlayback();
+    }
+
+    updateLengthAndTimeIfNeeded(events.getFirst());
+    this->invalidateCacheFor(events.getFirst()->getSequence()->getTrack());
+}
 void Transport::onPostRemoveMidiEvent(MidiSequence *const sequence)
 {
     this->stopPlaybackAndRecording();
     updateLengthAndTimeIfNeeded(sequence->getTrack());
-    this->playbackCacheIsOutdated = true;
+    this->invalidateCacheFor(sequence->getTrack());
 }
 
 void Transport::onAddClip(const Clip &clip)
@@ -649,22 +719,26 @@ void Transport::onAddClip(const Clip &clip)
     }
 
     updateLengthAndTimeIfNeeded((&clip));
-    this->playbackCacheIsOutdated = true;
+    this->invalidateCacheFor(clip);
 }
 
 void Transport::onChangeClip(const Clip &oldClip, const Clip &newClip)
 {
     this->stopPlaybackAndRecording();
     updateLengthAndTimeIfNeeded((&newClip));
-    this->playbackCacheIsOutdated = true;
+    this->invalidateCacheFor(newClip);
+}
+
+void Transport::onRemoveClip(const Clip &clip)
+{
+    // removed clips are cleaned up when the track is recached
+    this->invalidateCacheFor(clip);
 }
 
-void Transport::onRemoveClip(const Clip &clip) {}
 void Transport::onPostRemoveClip(Pattern *const pattern)
 {
     this->stopPlaybackAndRecording();
     updateLengthAndTimeIfNeeded(pattern->getTrack());
-    this->playbackCacheIsOutdated = true;
 }
 
 void Transport::onChangeTrackProperties(MidiTrack *const track)
@@ -679,9 +753,15 @@ void Transport::onChangeTrackProperties(MidiTrack *const track)
             this->stopPlayback();
         }
 
-        this->playbackCacheIsOutdated = true;
         this->updateLinkForTrack(track);
     }
+
+    // channel or controller number might have changed too,
+    // and re-exporting one track is cheap enough to not check that:
+    this->invalidateCacheFor(track);
+
+    // the track might have become a tempo track, or vice versa
+    this->tempoMapIsOutdated = true;
 }
 
 void Transport::updateTemperamentInfoForBuiltInSynth(int periodSize) const
@@ -707,7 +787,7 @@ void Transport::onActivateProjectSubtree(const ProjectMetadata *meta)
 
     // let's reset midi caches, just in case some instrument's keyboard mapping
     // has changed in the meanwhile (no idea how to observe kbm changes in transport)
-    this->playbackCacheIsOutdated = true;
+    this->invalidateAllCaches();
 }
 
 void Transport::onChangeProjectInfo(const ProjectMetadata *meta)
@@ -718,7 +798,7 @@ void Transport::onChangeProjectInfo(const ProjectMetadata *meta)
 void Transport::onReloadProjectContent(const Array<MidiTrack *> &tracks,
     const ProjectMetadata *meta)
 {
-    this->playbackCacheIsOutdated = true;
+    this->tempoMapIsOutdated = true;
 
     this->tracksCache.clearQuick();
     this->linksCache.clear();
@@ -729,6 +809,8 @@ void Transport::onReloadProjectContent(const Array<MidiTrack *> &tracks,
         this->updateLinkForTrack(track);
     }
 
+    this->invalidateAllCaches();
+
     this->stopPlaybackAndRecording();
 
     this->updateTemperamentInfoForBuiltInSynth(meta->getPeriodSize());
@@ -741,7 +823,8 @@ void Transport::onAddTrack(MidiTrack *const track)
         this->stopPlayback();
     }
 
-    this->playbackCacheIsOutdated = true;
+    this->invalidateCacheFor(track);
+    this->tempoMapIsOutdated = true;
     this->tracksCache.addIfNotAlreadyThere(track);
     this->updateLinkForTrack(track);
 }
@@ -750,7 +833,11 @@ void Transport::onRemoveTrack(MidiTrack *const track)
 {
     this->stopPlaybackAndRecording();
 
+    // the removed track's cache is dropped, nothing needs re-exporting
+    this->cachedTracks.erase(track);
     this->playbackCacheIsOutdated = true;
+    this->numTracksDirtiedByLastEdit = 0;
+    this->tempoMapIsOutdated = true;
     this->tracksCache.removeAllInstancesOf(track);
     this->removeLinkForTrack(track);
 }
@@ -778,48 +865,15 @@ void Transport::onChangeProjectBeatRange(float firstBeat, float lastBeat)
 
 double Transport::findTimeAt(float beat) const
 {
-    double resultTimeMs = 0.0;
-
-    this->recacheIfNeeded();
-    this->playbackCache.seekToZeroIndexes();
-
-    const auto targetRelativeBeat = beat - this->projectFirstBeat.get();
-
-    double tempo = Globals::Defaults::msPerBeat;
-    double prevTimestamp = 0.0;
-
-    CachedMidiMessage cached;
-    while (this->playbackCache.getNextMessage(cached))
-    {
-        const auto nextTimestamp = cached.message.getTimeStamp();
-
-        if (nextTimestamp > targetRelativeBeat)
-        {
-            break;
-        }
-
-        const auto nextEventTimeDelta = tempo * (nextTimestamp - prevTimestamp);
-        resultTimeMs += nextEventTimeDelta;
-        prevTimestamp = nextTimestamp;
-
-        if (cached.message.isTempoMetaEvent())
-        {
-            tempo = cached.message.getTempoSecondsPerQuarterNote() * 1000.f;
-        }
-    }
-
-    // add remainder, the time from the last event to the given beat:
-    resultTimeMs += (tempo * (targetRelativeBeat - prevTimestamp));
-
-    return resultTimeMs;
+    this->updateTempoMapIfNeeded();
+    return this->tempoMap.getTimeAt(beat) -
+        this->tempoMap.getTimeAt(this->projectFirstBeat.get());
 }
 
 Transport::PlaybackContext::Ptr Transport::fillPlaybackContextAt(float beat) const
 {
     this->recacheIfNeeded();
-    this->playbackCache.seekToZeroIndexes();
-
-    double tempo = Globals::Defaults::msPerBeat;
+    this->updateTempoMapIfNeeded();
 
     Transport::PlaybackContext::Ptr context(new Transport::PlaybackContext());
     context->projectFirstBeat = this->projectFirstBeat.get();
@@ -827,113 +881,217 @@ Transport::PlaybackContext::Ptr Transport::fillPlaybackContextAt(float beat) con
 
     context->startBeat = beat;
 
-    context->totalTimeMs = 0.0;
-    context->startBeatTimeMs = 0.0;
-    context->startBeatTempo = tempo;
+    context->tempoMap = this->tempoMap;
+    context->startBeatTempo = this->tempoMap.getTempoAt(beat);
+    context->startBeatTimeMs = this->findTimeAt(beat);
+    context->totalTimeMs = this->findTimeAt(context->projectLastBeat);
 
     context->sampleRate = this->playbackCache.getSampleRate();
     context->numOutputChannels = this->playbackCache.getNumOutputChannels();
     
-    const auto targetRelativeBeat = context->startBeat - context->projectFirstBeat;
-
-    double prevTimestamp = 0.0;
-    bool startBeatPassed = false;
+    // the timing is all in the tempo map, but CC states
+    // still need to be collected from all the messages before the start beat
+    this->playbackCache.seekToZeroIndexes();
 
     CachedMidiMessage cached;
     while (this->playbackCache.getNextMessage(cached))
     {
-        const auto nextTimestamp = cached.message.getTimeStamp();
-        const auto nextEventTimeDelta = tempo * (nextTimestamp - prevTimestamp);
+        if (cached.message.getTimeStamp() > context->startBeat)
+        {
+            break;
+        }
+
+        if (cached.message.isController() &&
+            cached.message.getControllerNumber() <= PlaybackContext::numCCs)
+        {
+            context->ccStates[cached.message.getControllerNumber()] =
+                cached.message.getControllerValue();
+        }
+    }
+
+    return context;
+}
+
+//===----------------------------------------------------------------------===//
+// Playback cache management
+//===----------------------------------------------------------------------===//
+
+void Transport::recacheIfNeeded() const
+{
+    if (!this->playbackCacheIsOutdated.get())
+    {
+        return;
+    }
 
-        if (nextTimestamp > targetRelativeBeat)
+    // Find solo clips, if any
+    bool hasSoloClips = false;
+    for (const auto *track : this->tracksCache)
+    {
+        if (track->getPattern() != nullptr &&
+            track->getPattern()->hasSoloClips())
         {
-            // the time from the last event to the given beat:
-            context->startBeatTimeMs += (tempo * (targetRelativeBeat - prevTimestamp));
-            startBeatPassed = true;
+            hasSoloClips = true;
+            break;
         }
+    }
 
-        if (!startBeatPassed)
+    // solo mode affects the export of every piano track
+    if (hasSoloClips != this->cachedWithSoloClips)
+    {
+        this->cachedWithSoloClips = hasSoloClips;
+        for (auto it = this->cachedTracks.begin(); it != this->cachedTracks.end(); ++it)
         {
-            context->startBeatTimeMs += nextEventTimeDelta;
+            it.value().isDirty = true;
         }
+    }
 
-        context->totalTimeMs += nextEventTimeDelta;
-        prevTimestamp = nextTimestamp;
+    static Clip noTransform;
+    this->playbackCache.clear();
 
-        if (cached.message.isTempoMetaEvent())
+    for (const auto *track : this->tracksCache)
+    {
+        auto &cachedTrack = this->cachedTracks[track];
+        if (cachedTrack.isDirty || !cachedTrack.dirtyClips.empty())
         {
-            tempo = cached.message.getTempoSecondsPerQuarterNote() * 1000.f;
+            this->recacheTrack(track, cachedTrack, hasSoloClips);
         }
-        else if (!startBeatPassed &&
-            cached.message.isController() &&
-            cached.message.getControllerNumber() <= PlaybackContext::numCCs)
+
+        if (track->getPattern() != nullptr)
         {
-            context->ccStates[cached.message.getControllerNumber()] =
-                cached.message.getControllerValue();
+            for (const auto *clip : track->getPattern()->getClips())
+            {
+                const auto found = cachedTrack.clips.find(clip->getId());
+                if (found != cachedTrack.clips.end())
+                {
+                    this->playbackCache.addWrapper(found->second);
+                }
+            }
         }
+        else
+        {
+            const auto found = cachedTrack.clips.find(noTransform.getId());
+            if (found != cachedTrack.clips.end())
+            {
+                this->playbackCache.addWrapper(found->second);
+            }
+        }
+    }
+
+    this->playbackCacheIsOutdated = false;
+}
 
-        if (!startBeatPassed)
+void Transport::recacheTrack(const MidiTrack *track,
+    CachedTrack &cachedTrack, bool hasSoloClips) const
+{
+    static Clip noTransform;
+
+    const auto instrument = this->linksCache[track->getTrackId()];
+    const auto &keyMap = *instrument->getKeyboardMapping();
+
+    // the cache uses absolute beats, so that changing
+    // the project's beat range doesn't invalidate it
+    auto exportClip = [&](const Clip &clip) -> CachedMidiSequence::Ptr
+    {
+        auto cached = CachedMidiSequence::createFrom(instrument, track->getSequence());
+        cached->track->exportMidi(cached->midiMessages, clip,
+            keyMap, hasSoloClips, 0.0, 1.0);
+        return cached;
+    };
+
+    if (track->getPattern() != nullptr)
+    {
+        // this also drops the clips which are not there anymore
+        FlatHashMap<Clip::Id, CachedMidiSequence::Ptr> updatedClips;
+        for (const auto *clip : track->getPattern()->getClips())
         {
-            context->startBeatTempo = tempo;
+            const auto found = cachedTrack.clips.find(clip->getId());
+            if (cachedTrack.isDirty ||
+                found == cachedTrack.clips.end() ||
+                cachedTrack.dirtyClips.contains(clip->getId()))
+            {
+                updatedClips[clip->getId()] = exportClip(*clip);
+            }
+            else
+            {
+                updatedClips[clip->getId()] = found->second;
+            }
         }
+
+        cachedTrack.clips = move(updatedClips);
+    }
+    else
+    {
+        cachedTrack.clips.clear();
+        cachedTrack.clips[noTransform.getId()] = exportClip(noTransform);
     }
 
-    context->totalTimeMs +=
-        (tempo * (context->projectLastBeat - prevTimestamp));
+    cachedTrack.isDirty = false;
+    cachedTrack.dirtyClips.clear();
+}
 
-    return context;
+void Transport::invalidateCacheFor(const MidiTrack *track)
+{
+    this->cachedTracks[track].isDirty = true;
+    this->playbackCacheIsOutdated = true;
+    this->numTracksDirtiedByLastEdit = 1;
 }
 
-//===----------------------------------------------------------------------===//
-// Playback cache management
-//===----------------------------------------------------------------------===//
+void Transport::invalidateCacheFor(const Clip &clip)
+{
+    if (auto *pattern = clip.getPattern())
+    {
+        this->cachedTracks[pattern->getTrack()].dirtyClips.insert(clip.getId());
+        this->numTracksDirtiedByLastEdit = 1;
+    }
 
-void Transport::recacheIfNeeded() const
+    this->playbackCacheIsOutdated = true;
+}
+
+void Transport::invalidateAllCaches()
 {
-    if (this->playbackCacheIsOutdated.get())
+    this->cachedTracks.clear();
+    this->playbackCacheIsOutdated = true;
+    this->numTracksDirtiedByLastEdit = this->tracksCache.size();
+}
+
+void Transport::updateTempoMapIfNeeded() const
+{
+    if (this->tempoMapIsOutdated.get())
     {
-        //DBG("Transport::recache");
-        this->playbackCache.clear();
         static Clip noTransform;
-        const double offset = -this->projectFirstBeat.get();
+        MidiMessageSequence tempoEvents;
 
-        // Find solo clips, if any
-        bool hasSoloClips = false;
         for (const auto *track : this->tracksCache)
         {
-            if (track->getPattern() != nullptr &&
-                track->getPattern()->hasSoloClips())
+            if (!track->isTempoTrack())
             {
-                hasSoloClips = true;
-                break;
+                continue;
             }
-        }
 
-        for (const auto *track : this->tracksCache)
-        {
+            // tempo events don't depend on keyboard mapping,
+            // but exportMidi still needs one:
             const auto instrument = this->linksCache[track->getTrackId()];
             const auto &keyMap = *instrument->getKeyboardMapping();
 
-            auto cached = CachedMidiSequence::createFrom(instrument, track->getSequence());
-
+            // tempo map uses absolute beats, so there's no time offset here,
+            // and automations are not supposed to be soloed
             if (track->getPattern() != nullptr)
             {
                 for (const auto *clip : track->getPattern()->getClips())
                 {
-                    cached->track->exportMidi(cached->midiMessages, *clip,
-                        keyMap, hasSoloClips, offset, 1.0);
+                    track->getSequence()->exportMidi(tempoEvents, *clip,
+                        keyMap, false, 0.0, 1.0);
                 }
             }
             else
             {
-                cached->track->exportMidi(cached->midiMessages, noTransform,
-                    keyMap, hasSoloClips, offset, 1.0);
+                track->getSequence()->exportMidi(tempoEvents, noTransform,
+                    keyMap, false, 0.0, 1.0);
             }
-
-            this->playbackCache.addWrapper(cached);
         }
-        
-        this->playbackCacheIsOutdated = false;
+
+        this->tempoMap.rebuild(tempoEvents);
+        this->tempoMapIsOutdated = false;
     }
 }
 
@@ -942,6 +1100,11 @@ TransportPlaybackCache Transport::getPlaybackCache()
     return this->playbackCache;
 }
 
+int Transport::getNumTracksDirtiedByLastEdit() const noexcept
+{
+    return this->numTracksDirtiedByLastEdit;
+}
+
 void Transport::updateLinkForTrack(const MidiTrack *track)
 {
     const auto instruments = this->orchestra.getInstruments();
@@ -1087,3 +1250,188 @@ void Transport::deserialize(const SerializedData &data)
 }
 
 void Transport::reset() {}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class TransportTests final : public UnitTest
+{
+public:
+    TransportTests() : UnitTest("Transport tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Each edit only dirties the tracks it affects");
+
+        EmptyOrchestraPit orchestra;
+        EmptySleepTimer sleepTimer;
+        Transport transport(orchestra, sleepTimer);
+
+        EmptyEventDispatcher dispatcher;
+        EmptyMidiTrack track1, track2;
+        PianoSequence sequence1(track1, dispatcher);
+        PianoSequence sequence2(track2, dispatcher);
+
+        transport.onAddTrack(&track1);
+        transport.onAddTrack(&track2);
+        expectEquals(transport.getNumTracksDirtiedByLastEdit(), 1);
+
+        // pretend both tracks are cached
+        transport.cachedTracks[&track1].isDirty = false;
+        transport.cachedTracks[&track2].isDirty = false;
+        transport.playbackCacheIsOutdated = false;
+
+        const Note note(&sequence1, 60, 0.f, 1.f, 0.5f);
+        transport.onAddMidiEvent(note);
+        expectEquals(transport.getNumTracksDirtiedByLastEdit(), 1);
+        expect(transport.cachedTracks[&track1].isDirty);
+        expect(!transport.cachedTracks[&track2].isDirty);
+        expect(transport.playbackCacheIsOutdated.get());
+
+        const Note note1(&sequence2, 60, 0.f, 1.f, 0.5f);
+        const Note note2(&sequence2, 62, 1.f, 1.f, 0.5f);
+        transport.onAddMidiEvents({ &note1, &note2 });
+        expectEquals(transport.getNumTracksDirtiedByLastEdit(), 1);
+        expect(transport.cachedTracks[&track2].isDirty);
+
+        transport.onRemoveTrack(&track1);
+        expectEquals(transport.getNumTracksDirtiedByLastEdit(), 0);
+        expect(!transport.cachedTracks.contains(&track1));
+
+        transport.invalidateAllCaches();
+        expectEquals(transport.getNumTracksDirtiedByLastEdit(), 1);
+
+        beginTest("Parallel rendering is bit-identical to the serial one");
+
+        {
+            const auto serialRender = render(0);
+            const auto parallelRender = render(numRenderedInstruments - 1);
+
+            expect(serialRender.getSize() > 0);
+            expect(serialRender == parallelRender);
+
+            UniquePointer<AudioFormatReader> reader(WavAudioFormat().createReaderFor(
+                new MemoryInputStream(serialRender, false), true));
+
+            expect(reader != nullptr);
+            if (reader != nullptr)
+            {
+                const auto numSamples = int(reader->lengthInSamples);
+                AudioBuffer<float> samples(int(reader->numChannels), numSamples);
+                reader->read(&samples, 0, numSamples, 0, true, true);
+                expect(samples.getMagnitude(0, numSamples) > 0.f);
+            }
+        }
+    }
+
+private:
+
+    static constexpr auto numRenderedInstruments = 3;
+    static constexpr auto renderSampleRate = 44100.0;
+    static constexpr auto renderBlockSize = 512;
+
+    static void addBuiltInSynth(Instrument &instrument)
+    {
+        using IOProcessor = AudioProcessorGraph::AudioGraphIOProcessor;
+
+        auto *graph = instrument.getProcessorGraph();
+        graph->setPlayConfigDetails(0, 2, renderSampleRate, renderBlockSize);
+
+        const auto synth = graph->addNode(make<BuiltInSynthAudioPlugin>());
+        const auto midiIn = graph->addNode(make<IOProcessor>(IOProcessor::midiInputNode));
+        const auto audioOut = graph->addNode(make<IOProcessor>(IOProcessor::audioOutputNode));
+
+        instrument.addConnection(midiIn->nodeID, Instrument::midiChannelNumber,
+            synth->nodeID, Instrument::midiChannelNumber);
+
+        for (int i = 0; i < 2; ++i)
+        {
+            instrument.addConnection(synth->nodeID, i, audioOut->nodeID, i);
+        }
+    }
+
+    // the instruments are created for each render, so that
+    // the synth voices left from the previous one don't affect it
+    MemoryBlock render(int numWorkers)
+    {
+        AudioPluginFormatManager formatManager;
+        OwnedArray<Instrument> instruments;
+        for (int i = 0; i < numRenderedInstruments; ++i)
+        {
+            instruments.add(new Instrument(formatManager, "Instrument " + String(i)));
+            addBuiltInSynth(*instruments.getLast());
+        }
+
+        EmptyOrchestraPit orchestra;
+        EmptySleepTimer sleepTimer;
+        Transport transport(orchestra, sleepTimer);
+        transport.projectLastBeat = 8.f;
+
+        // each instrument plays a part of its own length,
+        // the first one is the shortest and the last one is the longest
+        for (int i = 0; i < numRenderedInstruments; ++i)
+        {
+            auto sequence = CachedMidiSequence::createFrom(instruments[i]);
+            for (int beat = 0; beat < (i + 1) * 2; ++beat)
+            {
+                const auto key = 48 + i * 7 + beat;
+                sequence->midiMessages.addEvent(MidiMessage::noteOn(1, key, 0.5f), beat);
+                sequence->midiMessages.addEvent(MidiMessage::noteOff(1, key), beat + 0.75);
+            }
+
+            sequence->midiMessages.updateMatchedPairs();
+            transport.playbackCache.addWrapper(sequence);
+        }
+
+        transport.playbackCacheIsOutdated = false;
+
+        TemporaryFile file(".wav");
+        transport.renderer->numWorkers = numWorkers;
+        transport.startRender(URL(file.getFile()), RenderFormat::WAV, renderBlockSize);
+        expect(transport.isRendering());
+
+        const auto *shortestPart = instruments.getFirst();
+        const auto *longestPart = instruments.getLast();
+
+        while (transport.isRendering())
+        {
+            // the processor graphs are prepared asynchronously on the message thread
+            MessageManager::getInstance()->runDispatchLoopUntil(10);
+
+            // the progress only grows, so reading the longer part first is safe
+            const auto longestPartProgress = transport.getRenderingPercentsComplete(longestPart);
+            expect(transport.getRenderingPercentsComplete(shortestPart) >= longestPartProgress);
+        }
+
+        expectEquals(transport.getRenderedInstruments().size(), instruments.size());
+        for (const auto *instrument : instruments)
+        {
+            expectEquals(transport.getRenderingPercentsComplete(instrument), 1.f);
+        }
+
+        MemoryBlock result;
+        file.getFile().loadFileAsData(result);
+        return result;
+    }
+
+    struct EmptyOrchestraPit final : OrchestraPit
+    {
+        Array<Instrument *> getInstruments() const override { return {}; }
+        Instrument *findInstrumentById(const String &id) const override { return nullptr; }
+        Instrument *getDefaultInstrument() const override { return nullptr; }
+    };
+
+    struct EmptySleepTimer final : SleepTimer
+    {
+        bool canSleepNow() override { return false; }
+        void sleepNow() override {}
+        void awakeNow() override {}
+    };
+};
+
+static TransportTests transportTests;
+
+#endif
@@ -25,6 +25,7 @@ class RendererThread;
 
 #include "TransportListener.h"
 #include "TransportPlaybackCache.h"
+#include "TempoMap.h"
 #include "OrchestraListener.h"
 #include "ProjectListener.h"
 #include "RenderFormat.h"
@@ -71,7 +72,12 @@ public:
 
     void stopPlaybackAndRecording();
 
-    void startRender(const URL &renderTarget, RenderFormat format);
+    // if renderStems is set, each instrument is also rendered
+    // into its own file next to the target one, see RendererThread
+    void startRender(const URL &renderTarget, RenderFormat format,
+        bool renderStems = false);
+    void startRender(const URL &renderTarget, RenderFormat format,
+        int blockSize, bool renderStems = false);
     bool isRendering() const;
     void stopRender();
     
@@ -79,6 +85,8 @@ public:
     void disableLoopPlayback();
 
     float getRenderingPercentsComplete() const;
+    float getRenderingPercentsComplete(const Instrument *instrument) const;
+    Array<const Instrument *> getRenderedInstruments() const;
     
     //===------------------------------------------------------------------===//
     // Playback context and caches
@@ -111,6 +119,14 @@ public:
 
         bool playbackLoopMode = false;
 
+        // if set, the player pre-renders the events, and the instruments'
+        // audio callbacks place them at the exact sample offsets,
+        // instead of the player thread sending them in real time
+        bool sampleAccurate = false;
+
+        // a copy of the tempo map for the playback/rendering threads
+        TempoMap tempoMap;
+
         // computed CC values: -1 if not found in any track,
         // otherwise, the controller value at the time of playback start;
         // CC numbers 102119 are undefined, and numbers 120-127 are
@@ -123,6 +139,10 @@ public:
 
     TransportPlaybackCache getPlaybackCache();
 
+    // How many tracks had their cached sequences invalidated by the last edit,
+    // i.e. how many of them the next recache will re-export because of it
+    int getNumTracksDirtiedByLastEdit() const noexcept;
+
     float getProjectFirstBeat() const noexcept
     {
         return this->projectFirstBeat.get();
@@ -161,6 +181,10 @@ public:
     void onRemoveMidiEvent(const MidiEvent &event) override;
     void onPostRemoveMidiEvent(MidiSequence *const layer) override;
 
+    void onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents) override;
+    void onAddMidiEvents(const Array<const MidiEvent *> &events) override;
+
     void onAddClip(const Clip &clip) override;
     void onChangeClip(const Clip &oldClip, const Clip &newClip) override;
     void onRemoveClip(const Clip &clip) override;
@@ -211,6 +235,7 @@ private:
     friend class PlayerThread;
     friend class PlayerThreadPool;
     friend class RendererThread;
+    friend class TransportTests;
 
 private:
     
@@ -222,9 +247,38 @@ private:
 
 private:
 
+    // The playback cache is assembled from per-clip cached sequences,
+    // so that most of the edits only re-export the affected track or clip;
+    // cached sequences are never changed after they are exported,
+    // since the copies of the playback cache may still be used by the player
+    struct CachedTrack final
+    {
+        FlatHashMap<Clip::Id, CachedMidiSequence::Ptr> clips;
+        FlatHashSet<Clip::Id> dirtyClips;
+        bool isDirty = true;
+    };
+
+    mutable FlatHashMap<const MidiTrack *, CachedTrack> cachedTracks;
+    mutable bool cachedWithSoloClips = false;
+
     mutable TransportPlaybackCache playbackCache;
     mutable Atomic<bool> playbackCacheIsOutdated = true;
     void recacheIfNeeded() const;
+    void recacheTrack(const MidiTrack *track,
+        CachedTrack &cachedTrack, bool hasSoloClips) const;
+
+    void invalidateCacheFor(const MidiTrack *track);
+    void invalidateCacheFor(const Clip &clip);
+    void invalidateAllCaches();
+
+    // counted in the project listener callbacks
+    int numTracksDirtiedByLastEdit = 0;
+
+    // the tempo map only depends on tempo tracks,
+    // so it is rebuilt separately from the playback cache
+    mutable TempoMap tempoMap;
+    mutable Atomic<bool> tempoMapIsOutdated = true;
+    void updateTempoMapIfNeeded() const;
 
     // linksCache is <track id : instrument>
     mutable Array<const MidiTrack *> tracksCache;
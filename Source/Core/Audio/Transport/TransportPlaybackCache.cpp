@@ -0,0 +1,227 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "TransportPlaybackCache.h"
+
+void TransportPlaybackCache::seekToTime(double position)
+{
+    this->cursors.clearQuick();
+
+    for (int i = 0; i < this->sequences.size(); ++i)
+    {
+        const auto &midiMessages = this->sequences.getObjectPointerUnchecked(i)->midiMessages;
+        const auto eventIndex = TransportPlaybackCache::getNextIndexAtTime(midiMessages, position - DBL_MIN);
+        if (eventIndex < midiMessages.getNumEvents())
+        {
+            const auto timeStamp = midiMessages.getEventPointer(eventIndex)->message.getTimeStamp();
+            this->cursors.add({ timeStamp, i, eventIndex });
+        }
+    }
+
+    // heapify, O(n)
+    for (int i = this->cursors.size() / 2 - 1; i >= 0; --i)
+    {
+        this->siftDown(i);
+    }
+}
+
+void TransportPlaybackCache::seekToZeroIndexes()
+{
+    this->seekToTime(-DBL_MAX);
+}
+
+bool TransportPlaybackCache::getNextMessage(CachedMidiMessage &target)
+{
+    if (this->cursors.isEmpty())
+    {
+        return false;
+    }
+
+    auto &cursor = this->cursors.getReference(0);
+    const auto *wrapper = this->sequences.getObjectPointerUnchecked(cursor.sequenceIndex);
+    jassert(cursor.eventIndex < wrapper->midiMessages.getNumEvents());
+
+    target.message = wrapper->midiMessages.getEventPointer(cursor.eventIndex)->message;
+    target.listener = wrapper->listener;
+    target.instrument = wrapper->instrument;
+
+    cursor.eventIndex++;
+    if (cursor.eventIndex < wrapper->midiMessages.getNumEvents())
+    {
+        cursor.timeStamp = wrapper->midiMessages.getEventPointer(cursor.eventIndex)->message.getTimeStamp();
+    }
+    else
+    {
+        // this sequence is done, replace the heap top with the last cursor
+        this->cursors.swap(0, this->cursors.size() - 1);
+        this->cursors.removeLast();
+    }
+
+    this->siftDown(0);
+    return true;
+}
+
+void TransportPlaybackCache::siftDown(int index) noexcept
+{
+    const int size = this->cursors.size();
+    auto *data = this->cursors.getRawDataPointer();
+
+    while (true)
+    {
+        const int left = index * 2 + 1;
+        const int right = left + 1;
+        int earliest = index;
+
+        if (left < size && data[left].isEarlierThan(data[earliest]))
+        {
+            earliest = left;
+        }
+
+        if (right < size && data[right].isEarlierThan(data[earliest]))
+        {
+            earliest = right;
+        }
+
+        if (earliest == index)
+        {
+            return;
+        }
+
+        std::swap(data[index], data[earliest]);
+        index = earliest;
+    }
+}
+
+// Finds the first event with timestamp >= the given one, O(log(events))
+int TransportPlaybackCache::getNextIndexAtTime(const MidiMessageSequence &sequence, double timeStamp) noexcept
+{
+    int low = 0;
+    int high = sequence.getNumEvents();
+
+    while (low < high)
+    {
+        const int middle = (low + high) / 2;
+        if (sequence.getEventPointer(middle)->message.getTimeStamp() < timeStamp)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class TransportPlaybackCacheTests final : public UnitTest
+{
+public:
+    TransportPlaybackCacheTests() : UnitTest("Transport playback cache tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Merging and seeking");
+
+        auto cache = createCacheWithSequences(16, 100);
+
+        int numMessages = 0;
+        double lastTimeStamp = -DBL_MAX;
+        CachedMidiMessage message;
+
+        cache.seekToZeroIndexes();
+        while (cache.getNextMessage(message))
+        {
+            expect(message.message.getTimeStamp() >= lastTimeStamp);
+            lastTimeStamp = message.message.getTimeStamp();
+            numMessages++;
+        }
+
+        expectEquals(numMessages, 16 * 100 * 2);
+
+        cache.seekToTime(50.0);
+        expect(cache.getNextMessage(message));
+        expectEquals(message.message.getTimeStamp(), 50.0);
+
+        cache.seekToTime(1000.0);
+        expect(!cache.getNextMessage(message));
+
+        // the copies should be iterated independently
+        cache.seekToZeroIndexes();
+        TransportPlaybackCache copy(cache);
+        copy.seekToTime(50.0);
+        expect(cache.getNextMessage(message));
+        expectEquals(message.message.getTimeStamp(), 0.0);
+
+        beginTest("Merging performance");
+
+        for (const auto numTracks : { 1, 10, 100, 500 })
+        {
+            auto bigCache = createCacheWithSequences(numTracks, 100000 / numTracks);
+
+            const auto startTime = Time::getMillisecondCounterHiRes();
+
+            numMessages = 0;
+            bigCache.seekToZeroIndexes();
+            while (bigCache.getNextMessage(message))
+            {
+                numMessages++;
+            }
+
+            const auto elapsedMs = jmax(0.001, Time::getMillisecondCounterHiRes() - startTime);
+            logMessage(String(numTracks) + " tracks: " +
+                String(int(numMessages / elapsedMs * 1000.0)) + " events/sec");
+        }
+    }
+
+private:
+
+    static TransportPlaybackCache createCacheWithSequences(int numSequences, int numNotes)
+    {
+        TransportPlaybackCache cache;
+        for (int i = 0; i < numSequences; ++i)
+        {
+            CachedMidiSequence::Ptr sequence(new CachedMidiSequence());
+            sequence->track = nullptr;
+            sequence->listener = nullptr;
+            sequence->instrument = nullptr;
+
+            for (int j = 0; j < numNotes; ++j)
+            {
+                const auto beat = double(j + (i % 4) * 0.25);
+                sequence->midiMessages.addEvent(MidiMessage::noteOn(1, 60 + i % 12, 0.5f), beat);
+                sequence->midiMessages.addEvent(MidiMessage::noteOff(1, 60 + i % 12), beat + 0.5);
+            }
+
+            sequence->midiMessages.updateMatchedPairs();
+            cache.addWrapper(sequence);
+        }
+
+        return cache;
+    }
+};
+
+static TransportPlaybackCacheTests transportPlaybackCacheTests;
+
+#endif
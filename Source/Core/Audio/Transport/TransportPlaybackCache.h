@@ -24,7 +24,6 @@ class MidiSequence;
 struct CachedMidiSequence final : public ReferenceCountedObject
 {
     MidiMessageSequence midiMessages;
-    int currentIndex;
     MidiMessageCollector *listener;
     Instrument *instrument;
     const MidiSequence *track;
@@ -36,7 +35,6 @@ struct CachedMidiSequence final : public ReferenceCountedObject
         jassert(instrument != nullptr);
         CachedMidiSequence::Ptr wrapper(new CachedMidiSequence());
         wrapper->track = track;
-        wrapper->currentIndex = 0;
         wrapper->instrument = instrument;
         wrapper->listener = &instrument->getProcessorPlayer().getMidiMessageCollector();
         return wrapper;
@@ -65,6 +63,7 @@ public:
     {
         this->sequences.addArray(other.sequences);
         this->uniqueInstruments.addArray(other.uniqueInstruments);
+        this->cursors.addArray(other.cursors);
     }
 
     inline Array<Instrument *, CriticalSection> getUniqueInstruments() const noexcept
@@ -78,6 +77,7 @@ public:
         {
             this->uniqueInstruments.addIfNotAlreadyThere(newWrapper->instrument);
             this->sequences.add(newWrapper);
+            this->cursors.clearQuick(); // needs to seek again
         }
     }
     
@@ -85,6 +85,7 @@ public:
     {
         this->uniqueInstruments.clearQuick();
         this->sequences.clearQuick();
+        this->cursors.clearQuick();
     }
     
     inline bool isEmpty() const
@@ -140,76 +141,43 @@ public:
         return result;
     }
 
-    void seekToTime(double position)
-    {
-        for (auto *wrapper : this->sequences)
-        {
-            wrapper->currentIndex = this->getNextIndexAtTime(wrapper->midiMessages, (position - DBL_MIN));
-        }
-    }
-    
-    void seekToZeroIndexes()
-    {
-        for (auto *wrapper : this->sequences)
-        {
-            wrapper->currentIndex = 0;
-        }
-    }
-    
-    bool getNextMessage(CachedMidiMessage &target)
-    {
-        double minTimeStamp = DBL_MAX;
-        int targetSequenceIndex = -1;
-
-        for (int i = 0; i < this->sequences.size(); ++i)
-        {
-            const auto *wrapper = this->sequences.getObjectPointer(i);
-            if (wrapper->currentIndex < wrapper->midiMessages.getNumEvents())
-            {
-                const auto &message = wrapper->midiMessages.getEventPointer(wrapper->currentIndex)->message;
+    void seekToTime(double position);
+    void seekToZeroIndexes();
 
-                if (message.getTimeStamp() < minTimeStamp)
-                {
-                    minTimeStamp = message.getTimeStamp();
-                    targetSequenceIndex = i;
-                }
-            }
-        }
+    bool getNextMessage(CachedMidiMessage &target);
 
-        if (targetSequenceIndex < 0)
-        {
-            return false;
-        }
-
-        auto *foundWrapper = this->sequences.getObjectPointer(targetSequenceIndex);
-        jassert(foundWrapper->currentIndex < foundWrapper->midiMessages.getNumEvents());
-
-        auto &foundMessage = foundWrapper->midiMessages.getEventPointer(foundWrapper->currentIndex)->message;
-        foundWrapper->currentIndex++;
-
-        target.message = foundMessage;
-        target.listener = foundWrapper->listener;
-        target.instrument = foundWrapper->instrument;
-
-        return true;
-    }
+    static int getNextIndexAtTime(const MidiMessageSequence &sequence, double timeStamp) noexcept;
     
 private:
-    
-    int getNextIndexAtTime(const MidiMessageSequence &sequence, double timeStamp) const
+
+    // The playback cache merges all sequences into one stream of events;
+    // the merge is done with a binary min-heap of cursors, one per each
+    // sequence that still has some events left, so that picking the next
+    // message costs O(log(tracks)) instead of scanning all the tracks;
+    // note that cursors are owned by the cache copy, not by the shared
+    // sequences, so that the player thread, the renderer and the transport
+    // can all iterate the same cached sequences independently
+
+    struct Cursor final
     {
-        int i = 0;
-        for (; i < sequence.getNumEvents(); ++i)
+        double timeStamp;
+        int sequenceIndex;
+        int eventIndex;
+
+        // equal timestamps are ordered by sequence index, so that
+        // the order of simultaneous events is stable and doesn't depend
+        // on the heap layout (which is what the linear scan used to do)
+        inline bool isEarlierThan(const Cursor &other) const noexcept
         {
-            const double eventTs = sequence.getEventPointer(i)->message.getTimeStamp();
-            if (eventTs >= timeStamp)
-            {
-                break;
-            }
+            return this->timeStamp < other.timeStamp ||
+                (this->timeStamp == other.timeStamp &&
+                    this->sequenceIndex < other.sequenceIndex);
         }
-        
-        return i;
-    }
+    };
+
+    Array<Cursor> cursors;
+
+    void siftDown(int index) noexcept;
 
     JUCE_LEAK_DETECTOR(TransportPlaybackCache)
 };
@@ -20,6 +20,7 @@
 #include "DocumentHelpers.h"
 #include "XmlSerializer.h"
 #include "SerializationKeys.h"
+#include "RenderWorkerPool.h"
 
 Config::Config(int timeoutToSaveMs) :
     fileLock("Config Lock"),
@@ -89,9 +90,29 @@ void Config::initResources()
         }
     }
 
+    // parsing the resource files takes most of the time,
+    // so they are parsed in parallel, and then applied one by one
+    Array<ResourceManager *> managers;
     for (auto &manager : this->resources)
     {
-        manager.second->reloadResources();
+        managers.add(manager.second.get());
+    }
+
+    Array<ResourceManager::ParsedResources> parsedResources;
+    parsedResources.resize(managers.size());
+
+    // the message thread waits for them, so they are not low-priority
+    // like the other background workers: the startup would wait longer
+    RenderWorkerPool workers(RenderWorkerPool::getOptimalNumWorkers(managers.size()),
+        "ResourceParser", RenderWorkerPool::renderPriority);
+    workers.runAndWait(managers.size(), [&managers, &parsedResources](int i)
+    {
+        parsedResources.getReference(i) = managers.getUnchecked(i)->parseResources();
+    });
+
+    for (int i = 0; i < managers.size(); ++i)
+    {
+        managers.getUnchecked(i)->reloadResources(parsedResources.getReference(i));
     }
 
     this->load(this->uiFlags.get(), Serialization::Config::activeUiFlags);
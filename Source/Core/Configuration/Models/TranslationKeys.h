@@ -70,6 +70,7 @@ namespace I18n
         static const Identifier renderAbort = "dialog::render::abort";
         static const Identifier renderCaption = "dialog::render::caption";
         static const Identifier renderProceed = "dialog::render::proceed";
+        static const Identifier renderStems = "dialog::render::stems";
         static const Identifier scanFolderCaption = "dialog::scanfolder::caption";
         static const Identifier timeSignatureAddCaption = "dialog::timesignature::add::caption";
         static const Identifier timeSignatureEditCaption = "dialog::timesignature::edit::caption";
@@ -113,11 +113,12 @@ void ResourceManager::reset()
 
 void ResourceManager::reloadResources()
 {
-    bool shouldBroadcastChange = false;
+    this->reloadResources(this->parseResources());
+}
 
-    // Reset and store an empty tree to append user objects to
-    this->baseResources.clear();
-    this->userResources.clear();
+ResourceManager::ParsedResources ResourceManager::parseResources() const
+{
+    ParsedResources result;
 
     // load both built-in and downloaded resource:
     // downloaded extends and overrides built-in one,
@@ -130,13 +131,7 @@ void ResourceManager::reloadResources()
     const String builtInResource(this->getBuiltInResourceString());
     if (builtInResource.isNotEmpty())
     {
-        const auto tree(DocumentHelpers::load(builtInResource));
-        if (tree.isValid())
-        {
-            this->deserializeResources(tree, this->baseResources);
-            shouldBroadcastChange = true;
-        }
-
+        result.builtIn = DocumentHelpers::load(builtInResource);
         DBG("Loaded built-in " + this->resourceType.toString() + " in " + String(Time::getMillisecondCounter() - startTime) + " ms");
     }
 
@@ -148,13 +143,7 @@ void ResourceManager::reloadResources()
     const File downloadedResource(this->getDownloadedResourceFile());
     if (downloadedResource.existsAsFile())
     {
-        const auto tree(DocumentHelpers::load(downloadedResource));
-        if (tree.isValid())
-        {
-            this->deserializeResources(tree, this->baseResources);
-            shouldBroadcastChange = true;
-        }
-
+        result.downloaded = DocumentHelpers::load(downloadedResource);
         DBG("Loaded extended " + this->resourceType.toString() + " in " + String(Time::getMillisecondCounter() - startTime) + " ms");
     }
 
@@ -164,19 +153,41 @@ void ResourceManager::reloadResources()
 
     // Try to extend base config with user's settings
     const File usersResource(this->getUsersResourceFile());
-
     if (usersResource.existsAsFile())
     {
-        const auto tree(DocumentHelpers::load(usersResource));
-        if (tree.isValid())
-        {
-            this->deserializeResources(tree, this->userResources);
-            shouldBroadcastChange = true;
-        }
-
+        result.user = DocumentHelpers::load(usersResource);
         DBG("Loaded user's " + this->resourceType.toString() + " in " + String(Time::getMillisecondCounter() - startTime) + " ms");
     }
 
+    return result;
+}
+
+void ResourceManager::reloadResources(const ParsedResources &parsed)
+{
+    bool shouldBroadcastChange = false;
+
+    // Reset and store an empty tree to append user objects to
+    this->baseResources.clear();
+    this->userResources.clear();
+
+    if (parsed.builtIn.isValid())
+    {
+        this->deserializeResources(parsed.builtIn, this->baseResources);
+        shouldBroadcastChange = true;
+    }
+
+    if (parsed.downloaded.isValid())
+    {
+        this->deserializeResources(parsed.downloaded, this->baseResources);
+        shouldBroadcastChange = true;
+    }
+
+    if (parsed.user.isValid())
+    {
+        this->deserializeResources(parsed.user, this->userResources);
+        shouldBroadcastChange = true;
+    }
+
     if (shouldBroadcastChange)
     {
         this->sendChangeMessage();
@@ -28,6 +28,19 @@ public:
 
     void reloadResources();
 
+    // parsing the files doesn't touch the manager's state, so all
+    // the managers can parse their files in parallel, and then
+    // apply the results one by one on the message thread
+    struct ParsedResources final
+    {
+        SerializedData builtIn;
+        SerializedData downloaded;
+        SerializedData user;
+    };
+
+    ParsedResources parseResources() const;
+    void reloadResources(const ParsedResources &parsed);
+
     inline bool isEmpty() const noexcept
     {
         return this->baseResources.size() == 0 && this->userResources.size() == 0;
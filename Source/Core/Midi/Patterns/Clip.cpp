@@ -20,6 +20,7 @@
 #include "Pattern.h"
 #include "MidiTrack.h"
 #include "SerializationKeys.h"
+#include "SerializedDataReader.h"
 
 Clip::Clip() : pattern(nullptr) {}
 
@@ -238,6 +239,32 @@ void Clip::deserialize(const SerializedData &data)
     this->updateCaches();
 }
 
+void Clip::deserializeFromStream(SerializedDataReader &reader)
+{
+    using namespace Serialization;
+
+    var key(0), timestamp, id(this->id), volume(Globals::velocitySaveResolution), mute(0), solo(0);
+    while (reader.nextProperty())
+    {
+        const auto &name = reader.getName();
+        if (name == Midi::key) { key = reader.getValue(); }
+        else if (name == Midi::timestamp) { timestamp = reader.getValue(); }
+        else if (name == Midi::id) { id = reader.getValue(); }
+        else if (name == Midi::volume) { volume = reader.getValue(); }
+        else if (name == Midi::mute) { mute = reader.getValue(); }
+        else if (name == Midi::solo) { solo = reader.getValue(); }
+    }
+
+    this->key = key;
+    this->beat = float(timestamp) / Globals::ticksPerBeat;
+    this->id = unpackId(id);
+    const auto vol = float(volume) / Globals::velocitySaveResolution;
+    this->velocity = jmax(jmin(vol, 1.f), 0.f);
+    this->mute = bool(mute);
+    this->solo = bool(solo);
+    this->updateCaches();
+}
+
 void Clip::reset()
 {
     this->key = 0;
@@ -18,6 +18,7 @@
 #pragma once
 
 class Pattern;
+class SerializedDataReader;
 
 // Just an instance of a midi sequence on a certain position,
 // Optionally, with key delta, velocity multiplier, muted or soloed.
@@ -74,6 +75,9 @@ public:
     void deserialize(const SerializedData &data) override;
     void reset() override;
 
+    // reads the properties of the clip, at which the reader is, up to its end
+    void deserializeFromStream(SerializedDataReader &reader);
+
     //===------------------------------------------------------------------===//
     // Helpers
     //===------------------------------------------------------------------===//
@@ -22,6 +22,7 @@
 #include "UndoStack.h"
 #include "SerializationKeys.h"
 #include "MidiTrack.h"
+#include "SerializedDataReader.h"
 
 struct ClipIdGenerator final
 {
@@ -440,6 +441,35 @@ void Pattern::deserialize(const SerializedData &data)
     this->updateBeatRange(false);
 }
 
+void Pattern::deserializeFromStream(SerializedDataReader &reader)
+{
+    this->reset();
+
+    while (reader.nextChild())
+    {
+        if (reader.getName() == Serialization::Midi::clip)
+        {
+            auto clip = new Clip(this);
+            clip->deserializeFromStream(reader);
+            this->clips.add(clip); // sorted later
+            this->usedClipIds.insert(clip->getId());
+        }
+        else
+        {
+            reader.skipNode();
+        }
+    }
+
+    // Fallback to single clip at zero bar, if no clips found
+    if (this->clips.size() == 0)
+    {
+        this->clips.add(new Clip(this));
+    }
+
+    this->sort();
+    this->updateBeatRange(false);
+}
+
 void Pattern::reset()
 {
     this->clips.clear(true);
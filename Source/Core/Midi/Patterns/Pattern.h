@@ -24,6 +24,7 @@ class ProjectEventDispatcher;
 class ProjectNode;
 class UndoStack;
 class MidiTrack;
+class SerializedDataReader;
 
 class Pattern final : public Serializable
 {
@@ -104,6 +105,10 @@ public:
     void deserialize(const SerializedData &data) override;
     void reset() override;
 
+    // the streaming alternative to deserialize() for loading the project,
+    // called when the reader is at the start of the pattern node
+    void deserializeFromStream(SerializedDataReader &reader);
+
     //===------------------------------------------------------------------===//
     // Helpers
     //===------------------------------------------------------------------===//
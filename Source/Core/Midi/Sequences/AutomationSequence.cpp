@@ -18,6 +18,7 @@
 #include "Common.h"
 #include "AutomationSequence.h"
 #include "AutomationEventActions.h"
+#include "SerializedDataReader.h"
 
 #include "ProjectNode.h"
 #include "MidiTrackNode.h"
@@ -147,14 +148,21 @@ bool AutomationSequence::insertGroup(Array<AutomationEvent> &group, bool undoabl
     }
     else
     {
+        Array<const MidiEvent *> addedEvents;
+        addedEvents.ensureStorageAllocated(group.size());
+
+        const auto numSortedEvents = this->midiEvents.size();
+
         for (int i = 0; i < group.size(); ++i)
         {
             const auto &eventParams = group.getUnchecked(i);
             auto *ownedEvent = new AutomationEvent(this, eventParams);
-            this->midiEvents.addSorted(*ownedEvent, ownedEvent);
-            this->eventDispatcher.dispatchAddEvent(*ownedEvent);
+            this->midiEvents.add(ownedEvent);
+            addedEvents.add(ownedEvent);
         }
-        
+
+        this->mergeAddedEvents(numSortedEvents);
+        this->eventDispatcher.dispatchAddEvents(addedEvents);
         this->updateBeatRange(true);
     }
     
@@ -171,18 +179,24 @@ bool AutomationSequence::removeGroup(Array<AutomationEvent> &group, bool undoabl
     }
     else
     {
+        // the listeners get the removed events while these still exist
+        Array<const MidiEvent *> removedEvents;
+        removedEvents.ensureStorageAllocated(group.size());
+
         for (int i = 0; i < group.size(); ++i)
         {
             const AutomationEvent &autoEvent = group.getUnchecked(i);
             const int index = this->midiEvents.indexOfSorted(autoEvent, &autoEvent);
             if (index >= 0)
             {
-                const auto removedEvent = this->midiEvents[index];
-                this->eventDispatcher.dispatchRemoveEvent(*removedEvent);
-                this->midiEvents.remove(index, true);
+                removedEvents.add(this->midiEvents.getUnchecked(index));
             }
         }
-        
+
+        this->eventDispatcher.dispatchRemoveEvents(removedEvents);
+
+        this->removeEvents(removedEvents);
+
         this->updateBeatRange(true);
         this->eventDispatcher.dispatchPostRemoveEvent(this);
     }
@@ -203,21 +217,40 @@ bool AutomationSequence::changeGroup(const Array<AutomationEvent> groupBefore,
     }
     else
     {
+        Array<const MidiEvent *> oldEvents;
+        Array<const MidiEvent *> newEvents;
+        Array<AutomationEvent *> changedEvents;
+        Array<const AutomationEvent *> changes;
+        oldEvents.ensureStorageAllocated(groupBefore.size());
+        newEvents.ensureStorageAllocated(groupBefore.size());
+        changedEvents.ensureStorageAllocated(groupBefore.size());
+        changes.ensureStorageAllocated(groupBefore.size());
+
+        // all events are looked up before changing any of them,
+        // while the binary search still runs over the sorted array
         for (int i = 0; i < groupBefore.size(); ++i)
         {
-            const AutomationEvent &oldParams = groupBefore.getUnchecked(i);
-            const AutomationEvent &newParams = groupAfter.getUnchecked(i);
+            const AutomationEvent &oldParams = groupBefore.getReference(i);
+            const AutomationEvent &newParams = groupAfter.getReference(i);
             const int index = this->midiEvents.indexOfSorted(oldParams, &oldParams);
             if (index >= 0)
             {
-                const auto changedEvent = static_cast<AutomationEvent *>(this->midiEvents[index]);
-                changedEvent->applyChanges(newParams);
-                this->midiEvents.remove(index, false);
-                this->midiEvents.addSorted(*changedEvent, changedEvent);
-                this->eventDispatcher.dispatchChangeEvent(oldParams, *changedEvent);
+                oldEvents.add(&oldParams);
+                changedEvents.add(static_cast<AutomationEvent *>(this->midiEvents.getUnchecked(index)));
+                changes.add(&newParams);
             }
         }
-        
+
+        // then they are changed in place and re-sorted at once
+        for (int i = 0; i < changedEvents.size(); ++i)
+        {
+            auto *changedEvent = changedEvents.getUnchecked(i);
+            changedEvent->applyChanges(*changes.getUnchecked(i));
+            newEvents.add(changedEvent);
+        }
+
+        this->resortEvents(newEvents);
+        this->eventDispatcher.dispatchChangeEvents(oldEvents, newEvents);
         this->updateBeatRange(true);
     }
 
@@ -272,6 +305,30 @@ void AutomationSequence::deserialize(const SerializedData &data)
     this->updateBeatRange(false);
 }
 
+void AutomationSequence::deserializeFromStream(SerializedDataReader &reader)
+{
+    this->reset();
+
+    while (reader.nextChild())
+    {
+        if (reader.getName() == Serialization::Midi::automationEvent)
+        {
+            auto *event = new AutomationEvent(this, 0, 0);
+            event->deserializeFromStream(reader);
+
+            this->midiEvents.add(event); // sorted later
+            this->usedEventIds.insert(event->getId());
+        }
+        else
+        {
+            reader.skipNode();
+        }
+    }
+
+    this->sort();
+    this->updateBeatRange(false);
+}
+
 void AutomationSequence::reset()
 {
     this->midiEvents.clear();
@@ -56,6 +56,8 @@ public:
     SerializedData serialize() const override;
     void deserialize(const SerializedData &data) override;
     void reset() override;
+
+    void deserializeFromStream(SerializedDataReader &reader) override;
     
 private:
 
@@ -20,6 +20,7 @@
 #include "MidiSequence.h"
 #include "Transport.h"
 #include "SerializationKeys.h"
+#include "SerializedDataReader.h"
 #include "MidiTrack.h"
 
 AutomationEvent::AutomationEvent() noexcept :
@@ -276,6 +277,27 @@ void AutomationEvent::deserialize(const SerializedData &data)
     this->id = unpackId(data.getProperty(Midi::id));
 }
 
+void AutomationEvent::deserializeFromStream(SerializedDataReader &reader)
+{
+    this->reset();
+    using namespace Serialization;
+
+    var value, curve(Globals::Defaults::automationControllerCurve), timestamp, id;
+    while (reader.nextProperty())
+    {
+        const auto &name = reader.getName();
+        if (name == Midi::value) { value = reader.getValue(); }
+        else if (name == Midi::curve) { curve = reader.getValue(); }
+        else if (name == Midi::timestamp) { timestamp = reader.getValue(); }
+        else if (name == Midi::id) { id = reader.getValue(); }
+    }
+
+    this->controllerValue = float(value);
+    this->curvature = float(curve);
+    this->beat = float(timestamp) / Globals::ticksPerBeat;
+    this->id = unpackId(id);
+}
+
 void AutomationEvent::reset() noexcept {}
 
 void AutomationEvent::applyChanges(const AutomationEvent &parameters) noexcept
@@ -18,6 +18,9 @@
 #pragma once
 
 #include "MidiEvent.h"
+#include "MidiEventPool.h"
+
+class SerializedDataReader;
 
 class AutomationEvent final : public MidiEvent
 {
@@ -83,6 +86,9 @@ public:
     void deserialize(const SerializedData &data) override;
     void reset() noexcept override;
 
+    // reads the properties of the event, at which the reader is, up to its end
+    void deserializeFromStream(SerializedDataReader &reader);
+
     //===------------------------------------------------------------------===//
     // Helpers
     //===------------------------------------------------------------------===//
@@ -104,6 +110,16 @@ public:
     static int compareElements(const AutomationEvent *const first,
         const AutomationEvent *const second) noexcept;
 
+    //===------------------------------------------------------------------===//
+    // Allocation
+    //===------------------------------------------------------------------===//
+
+    // pooled like the notes, which are the other event type counted in thousands
+    static void *operator new(size_t size) { return MidiEventPool<AutomationEvent>::allocate(size); }
+    static void operator delete(void *ptr) noexcept { MidiEventPool<AutomationEvent>::deallocate(ptr); }
+    static void *operator new(size_t, void *ptr) noexcept { return ptr; }
+    static void operator delete(void *, void *) noexcept {}
+
 protected:
 
     float controllerValue = 0.f;
@@ -0,0 +1,115 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// The events owned by the sequences are allocated from this pool
+// in chunks of many events, instead of one by one on the heap:
+// most of the events are created at once, when loading a project,
+// importing a midi file or pasting, so the events of a sequence end up
+// lying next to each other in memory, and iterating the sequence
+// (exporting, diffing, painting) doesn't jump all over the heap.
+
+// The addresses never change, so the event pointers are still stable handles,
+// and OwnedArray works as usual, since deleting an event returns its slot here;
+// the slots of the deleted events are reused, but the chunks are never released.
+
+template <typename T>
+class MidiEventPool final
+{
+public:
+
+    static void *allocate(size_t size)
+    {
+        jassert(size == sizeof(T)); // only meant for the final event classes
+        ignoreUnused(size);
+        return getInstance().allocateSlot();
+    }
+
+    static void deallocate(void *ptr) noexcept
+    {
+        if (ptr != nullptr)
+        {
+            getInstance().freeSlot(ptr);
+        }
+    }
+
+    static constexpr auto slotsPerChunk = 1024;
+
+private:
+
+    MidiEventPool() = default;
+
+    // never destroyed on purpose, because some events, e.g. the ones
+    // in the undo stack, might still be deleted at the static deinitialization
+    static MidiEventPool &getInstance()
+    {
+        static auto *instance = new MidiEventPool();
+        return *instance;
+    }
+
+    union Slot
+    {
+        Slot *nextFree;
+        alignas(T) char storage[sizeof(T)];
+    };
+
+    // the events are also allocated by the threads rebuilding the vcs diff
+    void *allocateSlot()
+    {
+        const SpinLock::ScopedLockType lock(this->slotsLock);
+
+        if (this->freeSlots == nullptr)
+        {
+            this->addChunk();
+        }
+
+        auto *slot = this->freeSlots;
+        this->freeSlots = slot->nextFree;
+        return slot;
+    }
+
+    void freeSlot(void *ptr) noexcept
+    {
+        const SpinLock::ScopedLockType lock(this->slotsLock);
+
+        auto *slot = static_cast<Slot *>(ptr);
+        slot->nextFree = this->freeSlots;
+        this->freeSlots = slot;
+    }
+
+    // the new slots are linked in the order of their addresses,
+    // so that the subsequent allocations are adjacent in memory
+    void addChunk()
+    {
+        auto *chunk = this->chunks.add(new HeapBlock<Slot>(slotsPerChunk))->get();
+
+        for (int i = 0; i < slotsPerChunk - 1; ++i)
+        {
+            chunk[i].nextFree = &chunk[i + 1];
+        }
+
+        chunk[slotsPerChunk - 1].nextFree = this->freeSlots;
+        this->freeSlots = chunk;
+    }
+
+    SpinLock slotsLock;
+    Slot *freeSlots = nullptr;
+    OwnedArray<HeapBlock<Slot>> chunks;
+
+    JUCE_DECLARE_NON_COPYABLE(MidiEventPool)
+};
@@ -19,6 +19,7 @@
 #include "Note.h"
 #include "MidiSequence.h"
 #include "SerializationKeys.h"
+#include "SerializedDataReader.h"
 #include "KeyboardMapping.h"
 
 Note::Note() noexcept : MidiEvent(nullptr, Type::Note, 0.f) {}
@@ -240,6 +241,32 @@ void Note::deserialize(const SerializedData &data)
     this->tuplet = Tuplet(int(data.getProperty(Midi::tuplet, 1)));
 }
 
+void Note::deserializeFromStream(SerializedDataReader &reader)
+{
+    this->reset();
+    using namespace Serialization;
+
+    var id, key, timestamp, length, volume, tuplet(1);
+    while (reader.nextProperty())
+    {
+        const auto &name = reader.getName();
+        if (name == Midi::id) { id = reader.getValue(); }
+        else if (name == Midi::key) { key = reader.getValue(); }
+        else if (name == Midi::timestamp) { timestamp = reader.getValue(); }
+        else if (name == Midi::length) { length = reader.getValue(); }
+        else if (name == Midi::volume) { volume = reader.getValue(); }
+        else if (name == Midi::tuplet) { tuplet = reader.getValue(); }
+    }
+
+    this->id = unpackId(id);
+    this->key = key;
+    this->beat = float(timestamp) / Globals::ticksPerBeat;
+    this->length = float(length) / Globals::ticksPerBeat;
+    const auto vol = float(volume) / Globals::velocitySaveResolution;
+    this->velocity = jmax(jmin(vol, 1.f), 0.f);
+    this->tuplet = Tuplet(int(tuplet));
+}
+
 void Note::reset() noexcept {}
 
 void Note::applyChanges(const Note &other) noexcept
@@ -18,6 +18,9 @@
 #pragma once
 
 #include "MidiEvent.h"
+#include "MidiEventPool.h"
+
+class SerializedDataReader;
 
 class Note final : public MidiEvent
 {
@@ -73,6 +76,9 @@ public:
     void deserialize(const SerializedData &data) override;
     void reset() noexcept override;
 
+    // reads the properties of the note, at which the reader is, up to its end
+    void deserializeFromStream(SerializedDataReader &reader);
+
     //===------------------------------------------------------------------===//
     // Helpers
     //===------------------------------------------------------------------===//
@@ -91,6 +97,17 @@ public:
 
     static int compareElements(const Note *const first, const Note *const second) noexcept;
 
+    //===------------------------------------------------------------------===//
+    // Allocation
+    //===------------------------------------------------------------------===//
+
+    // the events owned by sequences are allocated in chunks, see MidiEventPool;
+    // the placement new is still needed for Array<Note> and such
+    static void *operator new(size_t size) { return MidiEventPool<Note>::allocate(size); }
+    static void operator delete(void *ptr) noexcept { MidiEventPool<Note>::deallocate(ptr); }
+    static void *operator new(size_t, void *ptr) noexcept { return ptr; }
+    static void operator delete(void *, void *) noexcept {}
+
 protected:
 
     Key key = 0;
@@ -159,14 +159,21 @@ bool KeySignaturesSequence::insertGroup(Array<KeySignatureEvent> &group, bool un
     }
     else
     {
+        Array<const MidiEvent *> addedEvents;
+        addedEvents.ensureStorageAllocated(group.size());
+
+        const auto numSortedEvents = this->midiEvents.size();
+
         for (int i = 0; i < group.size(); ++i)
         {
             const KeySignatureEvent &eventParams = group.getReference(i);
             auto *ownedEvent = new KeySignatureEvent(this, eventParams);
-            this->midiEvents.addSorted(*ownedEvent, ownedEvent);
-            this->eventDispatcher.dispatchAddEvent(*ownedEvent);
+            this->midiEvents.add(ownedEvent);
+            addedEvents.add(ownedEvent);
         }
-        
+
+        this->mergeAddedEvents(numSortedEvents);
+        this->eventDispatcher.dispatchAddEvents(addedEvents);
         this->updateBeatRange(true);
     }
     
@@ -183,18 +190,24 @@ bool KeySignaturesSequence::removeGroup(Array<KeySignatureEvent> &group, bool un
     }
     else
     {
+        // the listeners get the removed events while these still exist
+        Array<const MidiEvent *> removedEvents;
+        removedEvents.ensureStorageAllocated(group.size());
+
         for (int i = 0; i < group.size(); ++i)
         {
             const KeySignatureEvent &signature = group.getReference(i);
             const int index = this->midiEvents.indexOfSorted(signature, &signature);
             if (index >= 0)
             {
-                auto *removedEvent = this->midiEvents.getUnchecked(index);
-                this->eventDispatcher.dispatchRemoveEvent(*removedEvent);
-                this->midiEvents.remove(index, true);
+                removedEvents.add(this->midiEvents.getUnchecked(index));
             }
         }
-        
+
+        this->eventDispatcher.dispatchRemoveEvents(removedEvents);
+
+        this->removeEvents(removedEvents);
+
         this->updateBeatRange(true);
         this->eventDispatcher.dispatchPostRemoveEvent(this);
     }
@@ -215,6 +228,17 @@ bool KeySignaturesSequence::changeGroup(Array<KeySignatureEvent> &groupBefore,
     }
     else
     {
+        Array<const MidiEvent *> oldEvents;
+        Array<const MidiEvent *> newEvents;
+        Array<KeySignatureEvent *> changedEvents;
+        Array<const KeySignatureEvent *> changes;
+        oldEvents.ensureStorageAllocated(groupBefore.size());
+        newEvents.ensureStorageAllocated(groupBefore.size());
+        changedEvents.ensureStorageAllocated(groupBefore.size());
+        changes.ensureStorageAllocated(groupBefore.size());
+
+        // all events are looked up before changing any of them,
+        // while the binary search still runs over the sorted array
         for (int i = 0; i < groupBefore.size(); ++i)
         {
             const KeySignatureEvent &oldParams = groupBefore.getReference(i);
@@ -222,14 +246,22 @@ bool KeySignaturesSequence::changeGroup(Array<KeySignatureEvent> &groupBefore,
             const int index = this->midiEvents.indexOfSorted(oldParams, &oldParams);
             if (index >= 0)
             {
-                auto *changedEvent = static_cast<KeySignatureEvent *>(this->midiEvents.getUnchecked(index));
-                changedEvent->applyChanges(newParams);
-                this->midiEvents.remove(index, false);
-                this->midiEvents.addSorted(*changedEvent, changedEvent);
-                this->eventDispatcher.dispatchChangeEvent(oldParams, *changedEvent);
+                oldEvents.add(&oldParams);
+                changedEvents.add(static_cast<KeySignatureEvent *>(this->midiEvents.getUnchecked(index)));
+                changes.add(&newParams);
             }
         }
 
+        // then they are changed in place and re-sorted at once
+        for (int i = 0; i < changedEvents.size(); ++i)
+        {
+            auto *changedEvent = changedEvents.getUnchecked(i);
+            changedEvent->applyChanges(*changes.getUnchecked(i));
+            newEvents.add(changedEvent);
+        }
+
+        this->resortEvents(newEvents);
+        this->eventDispatcher.dispatchChangeEvents(oldEvents, newEvents);
         this->updateBeatRange(true);
     }
 
@@ -21,6 +21,7 @@
 #include "ProjectMetadata.h"
 #include "UndoStack.h"
 #include "MidiTrack.h"
+#include "SerializedDataReader.h"
 
 struct EventIdGenerator final
 {
@@ -52,6 +53,86 @@ void MidiSequence::sort()
     }
 }
 
+static inline bool isEventBefore(const MidiEvent *a, const MidiEvent *b) noexcept
+{
+    return MidiEvent::compareElements(a, b) < 0;
+}
+
+void MidiSequence::mergeAddedEvents(int numSortedEvents)
+{
+    jassert(numSortedEvents >= 0 && numSortedEvents <= this->midiEvents.size());
+
+    auto *begin = this->midiEvents.begin();
+    auto *middle = begin + numSortedEvents;
+    auto *end = this->midiEvents.end();
+
+    std::sort(middle, end, isEventBefore);
+    std::inplace_merge(begin, middle, end, isEventBefore);
+}
+
+// moves the given events to the end of the array in one pass,
+// keeping the order of the rest, and returns the number of the rest
+static int moveEventsToEnd(OwnedArray<MidiEvent> &events,
+    const Array<const MidiEvent *> &eventsToMove)
+{
+    FlatHashSet<const MidiEvent *> lookup;
+    lookup.reserve(size_t(eventsToMove.size()));
+    for (const auto *event : eventsToMove)
+    {
+        lookup.insert(event);
+    }
+
+    Array<MidiEvent *> movedEvents;
+    movedEvents.ensureStorageAllocated(int(lookup.size()));
+
+    auto *data = events.begin();
+    int numKeptEvents = 0;
+    for (int i = 0; i < events.size(); ++i)
+    {
+        auto *event = data[i];
+        if (lookup.contains(event))
+        {
+            movedEvents.add(event);
+        }
+        else
+        {
+            data[numKeptEvents++] = event;
+        }
+    }
+
+    // all of them should belong to this sequence
+    jassert(movedEvents.size() == int(lookup.size()));
+
+    for (int i = 0; i < movedEvents.size(); ++i)
+    {
+        data[numKeptEvents + i] = movedEvents.getUnchecked(i);
+    }
+
+    return numKeptEvents;
+}
+
+void MidiSequence::resortEvents(const Array<const MidiEvent *> &changedEvents)
+{
+    if (changedEvents.isEmpty())
+    {
+        return;
+    }
+
+    const auto numSortedEvents = moveEventsToEnd(this->midiEvents, changedEvents);
+    this->mergeAddedEvents(numSortedEvents);
+}
+
+void MidiSequence::removeEvents(const Array<const MidiEvent *> &eventsToRemove)
+{
+    if (eventsToRemove.isEmpty())
+    {
+        return;
+    }
+
+    const auto numKeptEvents = moveEventsToEnd(this->midiEvents, eventsToRemove);
+    this->midiEvents.removeLast(this->midiEvents.size() - numKeptEvents, true);
+}
+
 //===----------------------------------------------------------------------===//
 // Undoing
 //===----------------------------------------------------------------------===//
@@ -114,6 +195,11 @@ void MidiSequence::exportMidi(MidiMessageSequence &outSequence, const Clip &clip
     outSequence.updateMatchedPairs();
 }
 
+void MidiSequence::deserializeFromStream(SerializedDataReader &reader)
+{
+    this->deserialize(reader.readNode());
+}
+
 float MidiSequence::midiTicksToBeats(double ticks, int timeFormat) noexcept
 {
     const double secsPerQuarterNoteAt120BPM = 0.5;
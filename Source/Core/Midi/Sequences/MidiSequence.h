@@ -26,6 +26,7 @@ class ProjectNode;
 class MidiTrack;
 class UndoStack;
 class KeyboardMapping;
+class SerializedDataReader;
 
 class MidiSequence : public Serializable
 {
@@ -55,6 +56,11 @@ public:
         const KeyboardMapping &keyMap, bool soloPlaybackMode,
         double timeAdjustment, double timeFactor) const;
 
+    // the streaming alternative to deserialize() for loading the project,
+    // called when the reader is at the start of the sequence node;
+    // by default, just reads the whole node into a tree and deserializes it
+    virtual void deserializeFromStream(SerializedDataReader &reader);
+
     //===------------------------------------------------------------------===//
     // Track editing
     //===------------------------------------------------------------------===//
@@ -77,7 +83,9 @@ public:
         }
 
         static T comparator;
-        this->midiEvents.addSorted(comparator, new T(this, event));
+        auto *importedEvent = new T(this, event);
+        this->midiEvents.addSorted(comparator, importedEvent);
+        this->onEventAdded(*importedEvent);
     }
 
     template<typename T>
@@ -95,6 +103,7 @@ public:
 
         static T comparator;
         this->usedEventIds.insert(event->getId());
+        this->onEventAdded(*event);
         this->midiEvents.addSorted(comparator, event.release());
     }
 
@@ -107,6 +116,13 @@ public:
     float getLengthInBeats() const noexcept;
     MidiTrack *getTrack() const noexcept;
 
+    // bumped by the project on every change of the events,
+    // so that the views can cache whatever they render from the sequence;
+    // unlike the track's VCS change generation, it ignores the changes
+    // of the clips and the track properties, which don't affect the events
+    uint32 getChangeGeneration() const noexcept { return this->changeGeneration; }
+    void markChanged() noexcept { this->changeGeneration++; }
+
     //===------------------------------------------------------------------===//
     // OwnedArray wrapper
     //===------------------------------------------------------------------===//
@@ -160,11 +176,17 @@ private:
     float sequenceEndBeat = 0.f;
     float sequenceStartBeat = 0.f;
 
+    uint32 changeGeneration = 0;
+
 protected:
 
     virtual float findFirstBeat() const noexcept;
     virtual float findLastBeat() const noexcept;
 
+    // for the sequences keeping some index of their events up to date,
+    // which is the subclasses' job everywhere except the templates above
+    virtual void onEventAdded(const MidiEvent &) {}
+
     ProjectEventDispatcher &eventDispatcher;
     ProjectNode *getProject() const noexcept;
     UndoStack *getUndoStack() const noexcept;
@@ -172,6 +194,17 @@ protected:
 
     OwnedArray<MidiEvent> midiEvents;
     mutable FlatHashSet<MidiEvent::Id> usedEventIds;
+
+    // The group edits use these instead of addSorted or remove for each event,
+    // which shift the array every time, so that pasting, transposing or deleting
+    // thousands of events is linear in the sequence size:
+
+    // the events added after the first numSortedEvents ones are merged into them
+    void mergeAddedEvents(int numSortedEvents);
+    // the events of this sequence, changed in place, are moved to their new places
+    void resortEvents(const Array<const MidiEvent *> &changedEvents);
+    // the events of this sequence are removed and deleted
+    void removeEvents(const Array<const MidiEvent *> &eventsToRemove);
     
 private:
 
@@ -0,0 +1,92 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Note.h"
+
+// The end beats and the lengths of all notes in a sequence, counted in
+// ordered maps, which the sequence updates on every change in O(log n):
+// the notes are sorted by their start beats, so the last note doesn't
+// necessarily end last (think of a long pedal note somewhere before it),
+// and checking all notes after every edit would be linear;
+// the longest length also limits the search for the notes sounding at some beat
+
+class NoteRangesIndex final
+{
+public:
+
+    NoteRangesIndex() = default;
+
+    void add(const Note &note)
+    {
+        NoteRangesIndex::increment(this->endBeats, note.getBeat() + note.getLength());
+        NoteRangesIndex::increment(this->lengths, note.getLength());
+    }
+
+    // the note must have the same beat and length as when it was added
+    void remove(const Note &note)
+    {
+        NoteRangesIndex::decrement(this->endBeats, note.getBeat() + note.getLength());
+        NoteRangesIndex::decrement(this->lengths, note.getLength());
+    }
+
+    void clear() noexcept
+    {
+        this->endBeats.clear();
+        this->lengths.clear();
+    }
+
+    inline bool isEmpty() const noexcept
+    {
+        return this->endBeats.empty();
+    }
+
+    inline float getLastEndBeat() const noexcept
+    {
+        return this->endBeats.empty() ? 0.f : this->endBeats.rbegin()->first;
+    }
+
+    inline float getMaxLength() const noexcept
+    {
+        return this->lengths.empty() ? 0.f : this->lengths.rbegin()->first;
+    }
+
+private:
+
+    using CountedBeats = std::map<float, int>;
+
+    static void increment(CountedBeats &counts, float beat)
+    {
+        counts[beat]++;
+    }
+
+    static void decrement(CountedBeats &counts, float beat)
+    {
+        const auto found = counts.find(beat);
+        jassert(found != counts.end()); // the note has changed after adding?
+        if (found != counts.end() && --found->second == 0)
+        {
+            counts.erase(found);
+        }
+    }
+
+    CountedBeats endBeats;
+    CountedBeats lengths;
+
+    JUCE_LEAK_DETECTOR(NoteRangesIndex)
+};
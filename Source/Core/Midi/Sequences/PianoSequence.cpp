@@ -19,8 +19,11 @@
 #include "PianoSequence.h"
 
 #include "PianoRoll.h"
+#include "MidiTrack.h"
+#include "KeyboardMapping.h"
 #include "NoteActions.h"
 #include "SerializationKeys.h"
+#include "SerializedDataReader.h"
 #include "UndoStack.h"
 
 PianoSequence::PianoSequence(MidiTrack &track,
@@ -96,6 +99,7 @@ MidiEvent *PianoSequence::insert(const Note &eventParams, const bool undoable)
     {
         auto *ownedNote = new Note(this, eventParams);
         this->midiEvents.addSorted(*ownedNote, ownedNote);
+        this->noteRanges.add(*ownedNote);
         this->eventDispatcher.dispatchAddEvent(*ownedNote);
         this->updateBeatRange(true);
         return ownedNote;
@@ -118,9 +122,10 @@ bool PianoSequence::remove(const Note &eventParams, const bool undoable)
         jassert(index >= 0);
         if (index >= 0)
         {
-            auto *removedNote = this->midiEvents.getUnchecked(index);
+            auto *removedNote = static_cast<Note *>(this->midiEvents.getUnchecked(index));
             jassert(removedNote->isValid());
             this->eventDispatcher.dispatchRemoveEvent(*removedNote);
+            this->noteRanges.remove(*removedNote);
             this->midiEvents.remove(index, true);
             this->updateBeatRange(true);
             this->eventDispatcher.dispatchPostRemoveEvent(this);
@@ -149,7 +154,9 @@ bool PianoSequence::change(const Note &oldParams,
         if (index >= 0)
         {
             auto *changedNote = static_cast<Note *>(this->midiEvents.getUnchecked(index));
+            this->noteRanges.remove(*changedNote);
             changedNote->applyChanges(newParams);
+            this->noteRanges.add(*changedNote);
             this->midiEvents.remove(index, false);
             this->midiEvents.addSorted(*changedNote, changedNote);
             this->eventDispatcher.dispatchChangeEvent(oldParams, *changedNote);
@@ -173,14 +180,22 @@ bool PianoSequence::insertGroup(Array<Note> &group, bool undoable)
     }
     else
     {
+        Array<const MidiEvent *> addedEvents;
+        addedEvents.ensureStorageAllocated(group.size());
+
+        const auto numSortedEvents = this->midiEvents.size();
+
         for (int i = 0; i < group.size(); ++i)
         {
             const Note &eventParams = group.getUnchecked(i);
             auto *ownedNote = new Note(this, eventParams);
-            this->midiEvents.addSorted(*ownedNote, ownedNote);
-            this->eventDispatcher.dispatchAddEvent(*ownedNote);
+            this->midiEvents.add(ownedNote);
+            this->noteRanges.add(*ownedNote);
+            addedEvents.add(ownedNote);
         }
 
+        this->mergeAddedEvents(numSortedEvents);
+        this->eventDispatcher.dispatchAddEvents(addedEvents);
         this->updateBeatRange(true);
     }
 
@@ -197,6 +212,10 @@ bool PianoSequence::removeGroup(Array<Note> &group, bool undoable)
     }
     else
     {
+        // the listeners get the removed events while these still exist
+        Array<const MidiEvent *> removedEvents;
+        removedEvents.ensureStorageAllocated(group.size());
+
         for (int i = 0; i < group.size(); ++i)
         {
             const Note &note = group.getUnchecked(i);
@@ -208,12 +227,19 @@ bool PianoSequence::removeGroup(Array<Note> &group, bool undoable)
             jassert(index >= 0);
             if (index >= 0)
             {
-                auto *removedNote = this->midiEvents.getUnchecked(index);
-                this->eventDispatcher.dispatchRemoveEvent(*removedNote);
-                this->midiEvents.remove(index, true);
+                removedEvents.add(this->midiEvents.getUnchecked(index));
             }
         }
 
+        this->eventDispatcher.dispatchRemoveEvents(removedEvents);
+
+        for (const auto *removedNote : removedEvents)
+        {
+            this->noteRanges.remove(*static_cast<const Note *>(removedNote));
+        }
+
+        this->removeEvents(removedEvents);
+
         this->updateBeatRange(true);
         this->eventDispatcher.dispatchPostRemoveEvent(this);
     }
@@ -234,6 +260,17 @@ bool PianoSequence::changeGroup(Array<Note> &groupBefore,
     }
     else
     {
+        Array<const MidiEvent *> oldEvents;
+        Array<const MidiEvent *> newEvents;
+        Array<Note *> changedNotes;
+        Array<const Note *> changes;
+        oldEvents.ensureStorageAllocated(groupBefore.size());
+        newEvents.ensureStorageAllocated(groupBefore.size());
+        changedNotes.ensureStorageAllocated(groupBefore.size());
+        changes.ensureStorageAllocated(groupBefore.size());
+
+        // all events are looked up before changing any of them,
+        // while the binary search still runs over the sorted array
         for (int i = 0; i < groupBefore.size(); ++i)
         {
             const Note &oldParams = groupBefore.getReference(i);
@@ -247,14 +284,24 @@ bool PianoSequence::changeGroup(Array<Note> &groupBefore,
             jassert(index >= 0);
             if (index >= 0)
             {
-                auto *changedNote = static_cast<Note *>(this->midiEvents.getUnchecked(index));
-                changedNote->applyChanges(newParams);
-                this->midiEvents.remove(index, false);
-                this->midiEvents.addSorted(*changedNote, changedNote);
-                this->eventDispatcher.dispatchChangeEvent(oldParams, *changedNote);
+                oldEvents.add(&oldParams);
+                changedNotes.add(static_cast<Note *>(this->midiEvents.getUnchecked(index)));
+                changes.add(&newParams);
             }
         }
 
+        // then they are changed in place and re-sorted at once
+        for (int i = 0; i < changedNotes.size(); ++i)
+        {
+            auto *changedNote = changedNotes.getUnchecked(i);
+            this->noteRanges.remove(*changedNote);
+            changedNote->applyChanges(*changes.getUnchecked(i));
+            this->noteRanges.add(*changedNote);
+            newEvents.add(changedNote);
+        }
+
+        this->resortEvents(newEvents);
+        this->eventDispatcher.dispatchChangeEvents(oldEvents, newEvents);
         this->updateBeatRange(true);
     }
 
@@ -267,26 +314,54 @@ bool PianoSequence::changeGroup(Array<Note> &groupBefore,
 
 float PianoSequence::findLastBeat() const noexcept
 {
-    if (this->isEmpty())
+    // the last note by start beat is not necessarily the one that ends last
+    jassert(this->noteRanges.isEmpty() == this->isEmpty());
+    return this->noteRanges.getLastEndBeat();
+}
+
+float PianoSequence::getMaxNoteLength() const noexcept
+{
+    return this->noteRanges.getMaxLength();
+}
+
+void PianoSequence::findSoundingNotes(float beat, Array<const Note *> &result) const
+{
+    const auto searchStartBeat = beat - this->noteRanges.getMaxLength();
+
+    // the first note starting at or after the search start
+    int low = 0;
+    int high = this->midiEvents.size();
+    while (low < high)
     {
-        return 0.f;
+        const auto middle = (low + high) / 2;
+        if (this->midiEvents.getUnchecked(middle)->getBeat() < searchStartBeat)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
     }
 
-    // FIXME:
-    // sometimes the last event is not the one that lasts longer
-    // (as events *must* be sorted by start beat, not by end beat),
-    // so here we have to iterate through a number of last events
-    // to guess where the sequence really ends, with still no guarantee
-    // we'll end up with right event (not sure how to fix it at the moment):
-    float lastBeat = -FLT_MAX;
-    const int checkStart = jmax(0, this->midiEvents.size() - 20);
-    for (int i = checkStart; i < this->midiEvents.size(); ++i)
+    for (int i = low; i < this->midiEvents.size(); ++i)
     {
-        const auto *n = static_cast<const Note *>(this->midiEvents.getUnchecked(i));
-        lastBeat = jmax(lastBeat, n->getBeat() + n->getLength());
+        const auto *note = static_cast<const Note *>(this->midiEvents.getUnchecked(i));
+        if (note->getBeat() > beat)
+        {
+            break;
+        }
+
+        if (note->getBeat() + note->getLength() > beat)
+        {
+            result.add(note);
+        }
     }
+}
 
-    return lastBeat;
+void PianoSequence::onEventAdded(const MidiEvent &event)
+{
+    this->noteRanges.add(static_cast<const Note &>(event));
 }
 
 //===----------------------------------------------------------------------===//
@@ -325,6 +400,7 @@ void PianoSequence::deserialize(const SerializedData &data)
         note->deserialize(e);
 
         this->midiEvents.add(note); // sorted later
+        this->noteRanges.add(*note);
         this->usedEventIds.insert(note->getId());
     }
 
@@ -332,8 +408,221 @@ void PianoSequence::deserialize(const SerializedData &data)
     this->updateBeatRange(false);
 }
 
+void PianoSequence::deserializeFromStream(SerializedDataReader &reader)
+{
+    this->reset();
+
+    while (reader.nextChild())
+    {
+        if (reader.getName() == Serialization::Midi::note)
+        {
+            auto *note = new Note(this);
+            note->deserializeFromStream(reader);
+
+            this->midiEvents.add(note); // sorted later
+            this->noteRanges.add(*note);
+            this->usedEventIds.insert(note->getId());
+        }
+        else
+        {
+            reader.skipNode();
+        }
+    }
+
+    this->sort();
+    this->updateBeatRange(false);
+}
+
 void PianoSequence::reset()
 {
     this->midiEvents.clear();
     this->usedEventIds.clear();
+    this->noteRanges.clear();
 }
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class PianoSequenceBeatRangeTests final : public UnitTest
+{
+public:
+    PianoSequenceBeatRangeTests() : UnitTest("Piano sequence beat range tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        EmptyMidiTrack emptyTrack;
+        EmptyEventDispatcher dispatcher;
+        PianoSequence sequence(emptyTrack, dispatcher);
+
+        beginTest("The last beat is where the longest note ends");
+
+        // a long pedal note, followed by lots of short ones
+        const Note pedalNote(&sequence, 36, 0.f, 100.f);
+        sequence.insert(pedalNote, false);
+
+        Array<Note> shortNotes;
+        for (int i = 0; i < 50; ++i)
+        {
+            shortNotes.add(Note(&sequence, 60 + i % 12, float(i), 0.5f));
+        }
+
+        sequence.insertGroup(shortNotes, false);
+        expectEquals(sequence.getLastBeat(), 100.f);
+        expectEquals(sequence.getMaxNoteLength(), 100.f);
+
+        const auto longerPedalNote = pedalNote.withLength(120.f);
+        sequence.change(pedalNote, longerPedalNote, false);
+        expectEquals(sequence.getLastBeat(), 120.f);
+
+        beginTest("Finding the notes sounding at some beat");
+
+        Array<const Note *> soundingNotes;
+        sequence.findSoundingNotes(10.25f, soundingNotes);
+        expectEquals(soundingNotes.size(), 2);
+        expectEquals(soundingNotes.getFirst()->getKey(), 36);
+        expectEquals(soundingNotes.getLast()->getKey(), 60 + 10 % 12);
+
+        soundingNotes.clearQuick();
+        sequence.findSoundingNotes(10.75f, soundingNotes);
+        expectEquals(soundingNotes.size(), 1);
+
+        beginTest("The beat range is restored after removing the longest note");
+
+        sequence.remove(longerPedalNote, false);
+        expectEquals(sequence.getLastBeat(), 49.5f);
+        expectEquals(sequence.getMaxNoteLength(), 0.5f);
+
+        soundingNotes.clearQuick();
+        sequence.findSoundingNotes(10.75f, soundingNotes);
+        expect(soundingNotes.isEmpty());
+
+        sequence.removeGroup(shortNotes, false);
+        expect(sequence.isEmpty());
+        expectEquals(sequence.getLastBeat(), 0.f);
+    }
+};
+
+static PianoSequenceBeatRangeTests pianoSequenceBeatRangeTests;
+
+class PianoSequenceBenchmarkTests final : public UnitTest
+{
+public:
+    PianoSequenceBenchmarkTests() : UnitTest("Piano sequence benchmark", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        EmptyMidiTrack emptyTrack;
+        EmptyEventDispatcher dispatcher;
+        Random random(42);
+
+        beginTest("Group edits on a large sequence");
+
+        PianoSequence sequence(emptyTrack, dispatcher);
+
+        Array<Note> notes;
+        for (int i = 0; i < numNotes; ++i)
+        {
+            notes.add(Note(&sequence, random.nextInt(128),
+                float(random.nextInt(numNotes)) / 4.f, 0.25f, 0.75f));
+        }
+
+        auto startTime = Time::getMillisecondCounterHiRes();
+        sequence.insertGroup(notes, false);
+        const auto insertTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+
+        expectEquals(sequence.size(), numNotes);
+        expect(isSorted(sequence));
+
+        // shift every other note, so that these have to be moved around
+        Array<Note> notesBefore;
+        Array<Note> notesAfter;
+        for (int i = 0; i < numNotes; i += 2)
+        {
+            notesBefore.add(notes.getReference(i));
+            notesAfter.add(notes.getReference(i).withDeltaBeat(-3.5f).withDeltaKey(1));
+        }
+
+        startTime = Time::getMillisecondCounterHiRes();
+        sequence.changeGroup(notesBefore, notesAfter, false);
+        const auto changeTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+
+        expectEquals(sequence.size(), numNotes);
+        expect(isSorted(sequence));
+
+        startTime = Time::getMillisecondCounterHiRes();
+        sequence.removeGroup(notesAfter, false);
+        const auto removeTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+
+        expectEquals(sequence.size(), numNotes - notesAfter.size());
+        expect(isSorted(sequence));
+
+        logMessage("Group insert: " + String(insertTimeMs, 1) +
+            " ms, change: " + String(changeTimeMs, 1) +
+            " ms, remove: " + String(removeTimeMs, 1) + " ms");
+
+        beginTest("Loading, iterating and exporting a large sequence");
+
+        sequence.insertGroup(notesAfter, false);
+        const auto serialized = sequence.serialize();
+
+        PianoSequence loadedSequence(emptyTrack, dispatcher);
+
+        startTime = Time::getMillisecondCounterHiRes();
+        loadedSequence.deserialize(serialized);
+        const auto loadTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+
+        expectEquals(loadedSequence.size(), numNotes);
+        expect(isSorted(loadedSequence));
+
+        startTime = Time::getMillisecondCounterHiRes();
+        float totalLength = 0.f;
+        for (int i = 0; i < numIterations; ++i)
+        {
+            for (const auto *event : loadedSequence)
+            {
+                totalLength += static_cast<const Note *>(event)->getLength();
+            }
+        }
+        const auto iterationTimeMs = (Time::getMillisecondCounterHiRes() - startTime) / numIterations;
+
+        expectWithinAbsoluteError(totalLength, numNotes * numIterations * 0.25f, 1.f);
+
+        MidiMessageSequence exported;
+
+        startTime = Time::getMillisecondCounterHiRes();
+        loadedSequence.exportMidi(exported, Clip(), KeyboardMapping(), false, 0.0, 1.0);
+        const auto exportTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+
+        expectEquals(exported.getNumEvents(), numNotes * 2);
+
+        logMessage("Load: " + String(loadTimeMs, 1) +
+            " ms, iteration: " + String(iterationTimeMs, 2) +
+            " ms, export: " + String(exportTimeMs, 1) + " ms");
+    }
+
+private:
+
+    static bool isSorted(const PianoSequence &sequence)
+    {
+        for (int i = 1; i < sequence.size(); ++i)
+        {
+            if (MidiEvent::compareElements(sequence.getUnchecked(i - 1),
+                sequence.getUnchecked(i)) > 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static constexpr auto numNotes = 20000;
+    static constexpr auto numIterations = 10;
+};
+
+static PianoSequenceBenchmarkTests pianoSequenceBenchmarkTests;
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "MidiSequence.h"
 #include "Note.h"
+#include "NoteRangesIndex.h"
 
 class PianoRoll;
 
@@ -60,10 +61,28 @@ public:
     void deserialize(const SerializedData &data) override;
     void reset() override;
 
+    void deserializeFromStream(SerializedDataReader &reader) override;
+
+    //===------------------------------------------------------------------===//
+    // Accessors
+    //===------------------------------------------------------------------===//
+
+    // only the notes starting within this many beats
+    // before some beat might be still sounding at it
+    float getMaxNoteLength() const noexcept;
+
+    void findSoundingNotes(float beat, Array<const Note *> &result) const;
+
+protected:
+
+    void onEventAdded(const MidiEvent &event) override;
+
 private:
 
     float findLastBeat() const noexcept override;
 
+    NoteRangesIndex noteRanges;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PianoSequence);
     JUCE_DECLARE_WEAK_REFERENCEABLE(PianoSequence);
 };
@@ -142,14 +142,21 @@ bool TimeSignaturesSequence::insertGroup(Array<TimeSignatureEvent> &signatures,
     }
     else
     {
+        Array<const MidiEvent *> addedEvents;
+        addedEvents.ensureStorageAllocated(signatures.size());
+
+        const auto numSortedEvents = this->midiEvents.size();
+
         for (int i = 0; i < signatures.size(); ++i)
         {
             const TimeSignatureEvent &eventParams = signatures.getReference(i);
             auto *ownedEvent = new TimeSignatureEvent(this, eventParams);
-            this->midiEvents.addSorted(*ownedEvent, ownedEvent);
-            this->eventDispatcher.dispatchAddEvent(*ownedEvent);
+            this->midiEvents.add(ownedEvent);
+            addedEvents.add(ownedEvent);
         }
-        
+
+        this->mergeAddedEvents(numSortedEvents);
+        this->eventDispatcher.dispatchAddEvents(addedEvents);
         this->updateBeatRange(true);
     }
     
@@ -166,18 +173,24 @@ bool TimeSignaturesSequence::removeGroup(Array<TimeSignatureEvent> &signatures,
     }
     else
     {
+        // the listeners get the removed events while these still exist
+        Array<const MidiEvent *> removedEvents;
+        removedEvents.ensureStorageAllocated(signatures.size());
+
         for (int i = 0; i < signatures.size(); ++i)
         {
             const TimeSignatureEvent &signature = signatures.getReference(i);
             const int index = this->midiEvents.indexOfSorted(signature, &signature);
             if (index >= 0)
             {
-                auto *removedSignature = this->midiEvents.getUnchecked(index);
-                this->eventDispatcher.dispatchRemoveEvent(*removedSignature);
-                this->midiEvents.remove(index, true);
+                removedEvents.add(this->midiEvents.getUnchecked(index));
             }
         }
-        
+
+        this->eventDispatcher.dispatchRemoveEvents(removedEvents);
+
+        this->removeEvents(removedEvents);
+
         this->updateBeatRange(true);
         this->eventDispatcher.dispatchPostRemoveEvent(this);
     }
@@ -198,6 +211,17 @@ bool TimeSignaturesSequence::changeGroup(Array<TimeSignatureEvent> &groupBefore,
     }
     else
     {
+        Array<const MidiEvent *> oldEvents;
+        Array<const MidiEvent *> newEvents;
+        Array<TimeSignatureEvent *> changedEvents;
+        Array<const TimeSignatureEvent *> changes;
+        oldEvents.ensureStorageAllocated(groupBefore.size());
+        newEvents.ensureStorageAllocated(groupBefore.size());
+        changedEvents.ensureStorageAllocated(groupBefore.size());
+        changes.ensureStorageAllocated(groupBefore.size());
+
+        // all events are looked up before changing any of them,
+        // while the binary search still runs over the sorted array
         for (int i = 0; i < groupBefore.size(); ++i)
         {
             const TimeSignatureEvent &oldParams = groupBefore.getReference(i);
@@ -205,14 +229,22 @@ bool TimeSignaturesSequence::changeGroup(Array<TimeSignatureEvent> &groupBefore,
             const int index = this->midiEvents.indexOfSorted(oldParams, &oldParams);
             if (index >= 0)
             {
-                auto *changedEvent = static_cast<TimeSignatureEvent *>(this->midiEvents.getUnchecked(index));
-                changedEvent->applyChanges(newParams);
-                this->midiEvents.remove(index, false);
-                this->midiEvents.addSorted(*changedEvent, changedEvent);
-                this->eventDispatcher.dispatchChangeEvent(oldParams, *changedEvent);
+                oldEvents.add(&oldParams);
+                changedEvents.add(static_cast<TimeSignatureEvent *>(this->midiEvents.getUnchecked(index)));
+                changes.add(&newParams);
             }
         }
 
+        // then they are changed in place and re-sorted at once
+        for (int i = 0; i < changedEvents.size(); ++i)
+        {
+            auto *changedEvent = changedEvents.getUnchecked(i);
+            changedEvent->applyChanges(*changes.getUnchecked(i));
+            newEvents.add(changedEvent);
+        }
+
+        this->resortEvents(newEvents);
+        this->eventDispatcher.dispatchChangeEvents(oldEvents, newEvents);
         this->updateBeatRange(true);
     }
 
@@ -17,10 +17,780 @@
 
 #include "Common.h"
 #include "BinarySerializer.h"
+#include "SerializedDataReader.h"
 
 static const char *kHelioHeaderV2String = "Helio2::";
 static const uint64 kHelioHeaderV2 = ByteOrder::littleEndianInt64(kHelioHeaderV2String);
 
+// Helio3 format stores all type and property names once, in a table after the header,
+// and then refers to them by varint indices; besides, the runs of the children
+// of the same type with the same properties and without children of their own
+// (like notes and automation events) are stored as packed fixed-width records
+// with the names and the value types written once for the whole run
+static const char *kHelioHeaderV3String = "Helio3::";
+static const uint64 kHelioHeaderV3 = ByteOrder::littleEndianInt64(kHelioHeaderV3String);
+
+// the shorter runs are not worth the record header
+static constexpr auto minPackedRunLength = 4;
+
+enum class PackedColumn : uint8
+{
+    Int = 1,
+    Int64 = 2,
+    Double = 3,
+    Bool = 4,
+    ShortString = 5 // up to 4 bytes of utf8, e.g. the packed event ids
+};
+
+static constexpr auto shortStringSize = 4;
+
+static bool getPackedColumn(const var &value, PackedColumn &outColumn)
+{
+    if (value.isInt()) { outColumn = PackedColumn::Int; return true; }
+    if (value.isInt64()) { outColumn = PackedColumn::Int64; return true; }
+    if (value.isDouble()) { outColumn = PackedColumn::Double; return true; }
+    if (value.isBool()) { outColumn = PackedColumn::Bool; return true; }
+    if (value.isString() &&
+        value.toString().getNumBytesAsUTF8() <= shortStringSize)
+    {
+        outColumn = PackedColumn::ShortString;
+        return true;
+    }
+
+    return false;
+}
+
+struct PackedRecordShape final
+{
+    Identifier type;
+    Array<Identifier> keys;
+    Array<PackedColumn> columns;
+
+    bool initWith(const SerializedData &node)
+    {
+        if (node.getNumChildren() > 0)
+        {
+            return false;
+        }
+
+        this->type = node.getType();
+        this->keys.clearQuick();
+        this->columns.clearQuick();
+
+        for (int i = 0; i < node.getNumProperties(); ++i)
+        {
+            PackedColumn column;
+            const auto key = node.getPropertyName(i);
+            if (!getPackedColumn(node.getProperty(key), column))
+            {
+                return false;
+            }
+
+            this->keys.add(key);
+            this->columns.add(column);
+        }
+
+        return true;
+    }
+
+    bool matches(const SerializedData &node) const
+    {
+        if (node.getType() != this->type ||
+            node.getNumChildren() > 0 ||
+            node.getNumProperties() != this->keys.size())
+        {
+            return false;
+        }
+
+        for (int i = 0; i < this->keys.size(); ++i)
+        {
+            PackedColumn column;
+            const auto key = node.getPropertyName(i);
+            if (key != this->keys.getUnchecked(i) ||
+                !getPackedColumn(node.getProperty(key), column) ||
+                column != this->columns.getUnchecked(i))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+class CompactTreeWriter final
+{
+public:
+
+    explicit CompactTreeWriter(OutputStream &output) : output(output) {}
+
+    void write(const SerializedData &tree)
+    {
+        this->collectNames(tree);
+
+        this->output.writeCompressedInt(this->names.size());
+        for (const auto &name : this->names)
+        {
+            this->output.writeString(name.toString());
+        }
+
+        this->writeNode(tree);
+    }
+
+private:
+
+    void collectNames(const SerializedData &node)
+    {
+        this->addName(node.getType());
+
+        for (int i = 0; i < node.getNumProperties(); ++i)
+        {
+            this->addName(node.getPropertyName(i));
+        }
+
+        for (const auto &child : node)
+        {
+            this->collectNames(child);
+        }
+    }
+
+    void addName(const Identifier &name)
+    {
+        if (this->nameIndices.find(name.toString()) == this->nameIndices.end())
+        {
+            this->nameIndices[name.toString()] = this->names.size();
+            this->names.add(name);
+        }
+    }
+
+    inline int getNameIndex(const Identifier &name) const
+    {
+        const auto found = this->nameIndices.find(name.toString());
+        jassert(found != this->nameIndices.end());
+        return found->second;
+    }
+
+    void writeNode(const SerializedData &node)
+    {
+        this->output.writeCompressedInt(this->getNameIndex(node.getType()));
+
+        const auto numProperties = node.getNumProperties();
+        this->output.writeCompressedInt(numProperties);
+        for (int i = 0; i < numProperties; ++i)
+        {
+            const auto key = node.getPropertyName(i);
+            this->output.writeCompressedInt(this->getNameIndex(key));
+            node.getProperty(key).writeToStream(this->output);
+        }
+
+        const auto numChildren = node.getNumChildren();
+        this->output.writeCompressedInt(numChildren);
+
+        // the children are written as blocks, each starting with the number of children in it:
+        // 1 means a regular node, and anything larger means a run of packed records
+        PackedRecordShape shape;
+        for (int i = 0; i < numChildren;)
+        {
+            const auto child = node.getChild(i);
+
+            int runLength = 1;
+            if (shape.initWith(child))
+            {
+                while (i + runLength < numChildren &&
+                    shape.matches(node.getChild(i + runLength)))
+                {
+                    runLength++;
+                }
+            }
+
+            if (runLength >= minPackedRunLength)
+            {
+                this->writePackedRun(node, i, runLength, shape);
+            }
+            else
+            {
+                for (int j = i; j < i + runLength; ++j)
+                {
+                    this->output.writeCompressedInt(1);
+                    this->writeNode(node.getChild(j));
+                }
+            }
+
+            i += runLength;
+        }
+    }
+
+    void writePackedRun(const SerializedData &parent,
+        int start, int runLength, const PackedRecordShape &shape)
+    {
+        this->output.writeCompressedInt(runLength);
+        this->output.writeCompressedInt(this->getNameIndex(shape.type));
+        this->output.writeCompressedInt(shape.keys.size());
+        for (int i = 0; i < shape.keys.size(); ++i)
+        {
+            this->output.writeCompressedInt(this->getNameIndex(shape.keys.getUnchecked(i)));
+            this->output.writeByte(char(shape.columns.getUnchecked(i)));
+        }
+
+        for (int i = start; i < start + runLength; ++i)
+        {
+            const auto record = parent.getChild(i);
+            for (int j = 0; j < shape.keys.size(); ++j)
+            {
+                const auto &value = record.getProperty(shape.keys.getUnchecked(j));
+                switch (shape.columns.getUnchecked(j))
+                {
+                case PackedColumn::Int:
+                    this->output.writeInt(int(value));
+                    break;
+                case PackedColumn::Int64:
+                    this->output.writeInt64(int64(value));
+                    break;
+                case PackedColumn::Double:
+                    this->output.writeDouble(double(value));
+                    break;
+                case PackedColumn::Bool:
+                    this->output.writeBool(bool(value));
+                    break;
+                case PackedColumn::ShortString:
+                {
+                    char buffer[shortStringSize + 1] = { 0 }; // + null terminator
+                    value.toString().copyToUTF8(buffer, sizeof(buffer));
+                    this->output.write(buffer, shortStringSize);
+                    break;
+                }
+                default:
+                    jassertfalse;
+                    break;
+                }
+            }
+        }
+    }
+
+    OutputStream &output;
+
+    Array<Identifier> names;
+    FlatHashMap<String, int, StringHash> nameIndices;
+};
+
+//===----------------------------------------------------------------------===//
+// Streaming readers
+//===----------------------------------------------------------------------===//
+
+// Both readers work on the whole file loaded into memory, see the comment in loadFromFile()
+class BinaryDataReader : public SerializedDataReader
+{
+public:
+
+    explicit BinaryDataReader(MemoryBlock &&fileData) :
+        data(move(fileData)),
+        input(this->data, false)
+    {
+        this->input.setPosition(sizeof(uint64)); // the header
+    }
+
+protected:
+
+    // for each node being read, the number of its children left to read
+    Array<int> childrenLeft;
+
+    int numPropertiesLeft = 0;
+    bool isReadingProperties = false;
+    bool hasStarted = false;
+
+    inline Event startNode(const Identifier &type)
+    {
+        this->name = type;
+        this->numPropertiesLeft = this->input.readCompressedInt();
+        this->isReadingProperties = true;
+        this->depth++;
+        return Event::NodeStart;
+    }
+
+    inline Event endNode()
+    {
+        this->childrenLeft.removeLast();
+        this->depth--;
+        return Event::NodeEnd;
+    }
+
+    MemoryBlock data;
+    MemoryInputStream input;
+
+    JUCE_DECLARE_NON_COPYABLE(BinaryDataReader)
+};
+
+class HelioV2Reader final : public BinaryDataReader
+{
+public:
+
+    explicit HelioV2Reader(MemoryBlock &&fileData) :
+        BinaryDataReader(move(fileData)) {}
+
+    Event next() override
+    {
+        if (this->isReadingProperties)
+        {
+            if (this->numPropertiesLeft > 0)
+            {
+                this->numPropertiesLeft--;
+                this->name = this->readIdentifier();
+                this->value = var::readFromStream(this->input);
+                return this->input.isExhausted() ? Event::Error : Event::Property;
+            }
+
+            this->isReadingProperties = false;
+            this->childrenLeft.add(this->input.readCompressedInt());
+        }
+
+        if (this->childrenLeft.isEmpty())
+        {
+            if (this->hasStarted)
+            {
+                return Event::EndOfData;
+            }
+
+            this->hasStarted = true;
+            return this->startNextNode();
+        }
+
+        auto &numChildrenLeft = this->childrenLeft.getReference(this->childrenLeft.size() - 1);
+        if (numChildrenLeft > 0)
+        {
+            numChildrenLeft--;
+            return this->startNextNode();
+        }
+
+        return this->endNode();
+    }
+
+private:
+
+    Event startNextNode()
+    {
+        const auto type = this->readIdentifier();
+        if (!type.isValid() || this->input.isExhausted())
+        {
+            return Event::Error;
+        }
+
+        return this->startNode(type);
+    }
+
+    Identifier readIdentifier()
+    {
+        this->buffer.reset();
+
+        for (;;)
+        {
+            const auto c = this->input.readByte();
+            this->buffer.writeByte(c);
+
+            if (c == 0)
+            {
+                return this->buffer.toUTF8();
+            }
+        }
+    }
+
+    MemoryOutputStream buffer { 32 };
+};
+
+class HelioV3Reader final : public BinaryDataReader
+{
+public:
+
+    explicit HelioV3Reader(MemoryBlock &&fileData) :
+        BinaryDataReader(move(fileData)) {}
+
+    Event next() override
+    {
+        if (this->isReadingRecord)
+        {
+            const auto column = this->nextColumn;
+            if (column < this->run.keys.size())
+            {
+                this->nextColumn++;
+                this->name = this->run.keys.getReference(column);
+                return this->readColumn(this->run.columns.getUnchecked(column)) ?
+                    Event::Property : Event::Error;
+            }
+
+            this->isReadingRecord = false;
+            this->depth--;
+            return Event::NodeEnd;
+        }
+
+        if (this->isReadingProperties)
+        {
+            if (this->numPropertiesLeft > 0)
+            {
+                this->numPropertiesLeft--;
+                if (!this->readName(this->name))
+                {
+                    return Event::Error;
+                }
+
+                this->value = var::readFromStream(this->input);
+                return this->input.isExhausted() ? Event::Error : Event::Property;
+            }
+
+            this->isReadingProperties = false;
+            this->childrenLeft.add(this->input.readCompressedInt());
+        }
+
+        if (this->childrenLeft.isEmpty())
+        {
+            if (this->hasStarted)
+            {
+                return Event::EndOfData;
+            }
+
+            this->hasStarted = true;
+            return this->readNames() ? this->startNextNode() : Event::Error;
+        }
+
+        auto &numChildrenLeft = this->childrenLeft.getReference(this->childrenLeft.size() - 1);
+
+        // the packed records have no children, so the run
+        // being read always belongs to the innermost node
+        if (this->numRecordsLeft > 0)
+        {
+            numChildrenLeft--;
+            return this->startRecord();
+        }
+
+        if (numChildrenLeft > 0)
+        {
+            // 1 means a regular node, and anything larger means a run of packed records
+            const auto blockSize = this->input.readCompressedInt();
+            if (blockSize <= 0 || blockSize > numChildrenLeft)
+            {
+                jassertfalse;
+                return Event::Error;
+            }
+
+            numChildrenLeft--;
+
+            if (blockSize == 1)
+            {
+                return this->startNextNode();
+            }
+
+            if (!this->readRunHeader())
+            {
+                return Event::Error;
+            }
+
+            this->numRecordsLeft = blockSize;
+            return this->startRecord();
+        }
+
+        return this->endNode();
+    }
+
+private:
+
+    bool readNames()
+    {
+        const auto numNames = this->input.readCompressedInt();
+        if (numNames <= 0)
+        {
+            return false;
+        }
+
+        // every name is interned only once for the whole file
+        this->names.ensureStorageAllocated(numNames);
+        for (int i = 0; i < numNames; ++i)
+        {
+            const auto name = this->input.readString();
+            if (name.isEmpty())
+            {
+                return false;
+            }
+
+            this->names.add(name);
+        }
+
+        return true;
+    }
+
+    inline bool readName(Identifier &outName)
+    {
+        const auto index = this->input.readCompressedInt();
+        if (!isPositiveAndBelow(index, this->names.size()))
+        {
+            jassertfalse;
+            return false;
+        }
+
+        outName = this->names.getReference(index);
+        return true;
+    }
+
+    Event startNextNode()
+    {
+        Identifier type;
+        if (!this->readName(type))
+        {
+            return Event::Error;
+        }
+
+        return this->startNode(type);
+    }
+
+    bool readRunHeader()
+    {
+        this->run.keys.clearQuick();
+        this->run.columns.clearQuick();
+
+        if (!this->readName(this->run.type))
+        {
+            return false;
+        }
+
+        const auto numColumns = this->input.readCompressedInt();
+        for (int i = 0; i < numColumns; ++i)
+        {
+            Identifier key;
+            if (!this->readName(key))
+            {
+                return false;
+            }
+
+            const auto column = PackedColumn(this->input.readByte());
+            if (column < PackedColumn::Int || column > PackedColumn::ShortString)
+            {
+                jassertfalse;
+                return false;
+            }
+
+            this->run.keys.add(key);
+            this->run.columns.add(column);
+        }
+
+        return true;
+    }
+
+    inline Event startRecord()
+    {
+        this->numRecordsLeft--;
+        this->nextColumn = 0;
+        this->isReadingRecord = true;
+        this->name = this->run.type;
+        this->depth++;
+        return Event::NodeStart;
+    }
+
+    bool readColumn(PackedColumn column)
+    {
+        switch (column)
+        {
+        case PackedColumn::Int:
+            this->value = this->input.readInt();
+            break;
+        case PackedColumn::Int64:
+            this->value = this->input.readInt64();
+            break;
+        case PackedColumn::Double:
+            this->value = this->input.readDouble();
+            break;
+        case PackedColumn::Bool:
+            this->value = this->input.readBool();
+            break;
+        case PackedColumn::ShortString:
+        {
+            char buffer[shortStringSize];
+            if (this->input.read(buffer, shortStringSize) != shortStringSize)
+            {
+                return false;
+            }
+
+            int length = 0;
+            while (length < shortStringSize && buffer[length] != 0)
+            {
+                length++;
+            }
+
+            this->value = String::fromUTF8(buffer, length);
+            break;
+        }
+        }
+
+        return true;
+    }
+
+    Array<Identifier> names;
+
+    PackedRecordShape run;
+    int numRecordsLeft = 0;
+    int nextColumn = 0;
+    bool isReadingRecord = false;
+};
+        }
+
+        // every name is interned only once for the whole file
+        this->names.ensureStorageAllocated(numNames);
+        for (int i = 0; i < numNames; ++i)
+        {
+            const auto name = this->input.readString();
+            if (name.isEmpty())
+            {
+                return {};
+            }
+
+            this->names.add(name);
+        }
+
+        return this->readNode();
+    }
+
+private:
+
+    inline bool readName(Identifier &outName)
+    {
+        const auto index = this->input.readCompressedInt();
+        if (!isPositiveAndBelow(index, this->names.size()))
+        {
+            jassertfalse;
+            return false;
+        }
+
+        outName = this->names.getReference(index);
+        return true;
+    }
+
+    SerializedData readNode()
+    {
+        Identifier type;
+        if (!this->readName(type))
+        {
+            return {};
+        }
+
+        SerializedData node(type);
+
+        const auto numProperties = this->input.readCompressedInt();
+        for (int i = 0; i < numProperties; ++i)
+        {
+            Identifier key;
+            if (!this->readName(key))
+            {
+                return {};
+            }
+
+            node.setProperty(key, var::readFromStream(this->input));
+        }
+
+        const auto numChildren = this->input.readCompressedInt();
+        for (int numRead = 0; numRead < numChildren;)
+        {
+            const auto blockSize = this->input.readCompressedInt();
+            if (blockSize <= 0 || numRead + blockSize > numChildren)
+            {
+                jassertfalse;
+                return {};
+            }
+
+            if (blockSize == 1)
+            {
+                const auto child = this->readNode();
+                if (!child.isValid())
+                {
+                    return {};
+                }
+
+                node.appendChild(child);
+            }
+            else if (!this->readPackedRun(node, blockSize))
+            {
+                return {};
+            }
+
+            numRead += blockSize;
+        }
+
+        return node;
+    }
+
+    bool readPackedRun(SerializedData &parent, int runLength)
+    {
+        PackedRecordShape shape;
+        if (!this->readName(shape.type))
+        {
+            return false;
+        }
+
+        const auto numColumns = this->input.readCompressedInt();
+        for (int i = 0; i < numColumns; ++i)
+        {
+            Identifier key;
+            if (!this->readName(key))
+            {
+                return false;
+            }
+
+            const auto column = PackedColumn(this->input.readByte());
+            if (column < PackedColumn::Int || column > PackedColumn::ShortString)
+            {
+                jassertfalse;
+                return false;
+            }
+
+            shape.keys.add(key);
+            shape.columns.add(column);
+        }
+
+        for (int i = 0; i < runLength; ++i)
+        {
+            SerializedData record(shape.type);
+            for (int j = 0; j < numColumns; ++j)
+            {
+                const auto &key = shape.keys.getReference(j);
+                switch (shape.columns.getUnchecked(j))
+                {
+                case PackedColumn::Int:
+                    record.setProperty(key, this->input.readInt());
+                    break;
+                case PackedColumn::Int64:
+                    record.setProperty(key, this->input.readInt64());
+                    break;
+                case PackedColumn::Double:
+                    record.setProperty(key, this->input.readDouble());
+                    break;
+                case PackedColumn::Bool:
+                    record.setProperty(key, this->input.readBool());
+                    break;
+                case PackedColumn::ShortString:
+                {
+                    char buffer[shortStringSize];
+                    if (this->input.read(buffer, shortStringSize) != shortStringSize)
+                    {
+                        return false;
+                    }
+
+                    size_t length = 0;
+                    while (length < shortStringSize && buffer[length] != 0)
+                    {
+                        length++;
+                    }
+
+                    record.setProperty(key, String::fromUTF8(buffer, int(length)));
+                    break;
+                }
+                }
+            }
+
+            parent.appendChild(record);
+        }
+
+        return true;
+    }
+
+    InputStream &input;
+    Array<Identifier> names;
+};
+
 Result BinarySerializer::saveToFile(File file, const SerializedData &tree) const
 {
     FileOutputStream fileStream(file);
@@ -28,8 +798,18 @@ Result BinarySerializer::saveToFile(File file, const SerializedData &tree) const
     {
         fileStream.setPosition(0);
         fileStream.truncate();
-        fileStream.writeInt64(kHelioHeaderV2);
-        tree.writeToStream(fileStream);
+
+        if (this->format == Format::Helio3)
+        {
+            fileStream.writeInt64(kHelioHeaderV3);
+            CompactTreeWriter(fileStream).write(tree);
+        }
+        else
+        {
+            fileStream.writeInt64(kHelioHeaderV2);
+            tree.writeToStream(fileStream);
+        }
+
         return Result::ok();
     }
 
@@ -46,12 +826,17 @@ SerializedData BinarySerializer::loadFromFile(const File &file) const
     // so instead we'll just read the whole file into memory and deserialize from it;
     // somewhat ugly, but works, and saved files should never be really large anyway.
     MemoryBlock mb;
-    if (file.loadFileAsData(mb))
+    if (file.loadFileAsData(mb) && mb.getSize() >= sizeof(uint64))
     {
-        MemoryInputStream inputStream(mb, false);
-        const auto magicNumber = static_cast<uint64>(inputStream.readInt64());
-        if (magicNumber == kHelioHeaderV2)
+        const auto magicNumber = ByteOrder::littleEndianInt64(mb.getData());
+        if (magicNumber == kHelioHeaderV3)
+        {
+            return HelioV3Reader(move(mb)).readTree();
+        }
+        else if (magicNumber == kHelioHeaderV2)
         {
+            MemoryInputStream inputStream(mb, false);
+            inputStream.setPosition(sizeof(uint64));
             return SerializedData::readFromStream(inputStream);
         }
     }
@@ -59,6 +844,25 @@ SerializedData BinarySerializer::loadFromFile(const File &file) const
     return {};
 }
 
+UniquePointer<SerializedDataReader> BinarySerializer::createReader(const File &file) const
+{
+    MemoryBlock mb;
+    if (file.loadFileAsData(mb) && mb.getSize() >= sizeof(uint64))
+    {
+        const auto magicNumber = ByteOrder::littleEndianInt64(mb.getData());
+        if (magicNumber == kHelioHeaderV3)
+        {
+            return make<HelioV3Reader>(move(mb));
+        }
+        else if (magicNumber == kHelioHeaderV2)
+        {
+            return make<HelioV2Reader>(move(mb));
+        }
+    }
+
+    return nullptr;
+}
+
 Result BinarySerializer::saveToString(String &string, const SerializedData &tree) const
 {
     MemoryOutputStream memStream;
@@ -86,5 +890,131 @@ bool BinarySerializer::supportsFileWithExtension(const String &extension) const
 
 bool BinarySerializer::supportsFileWithHeader(const String &header) const
 {
-    return header.startsWith(kHelioHeaderV2String);
+    return header.startsWith(kHelioHeaderV3String) ||
+        header.startsWith(kHelioHeaderV2String);
 }
+
+#if JUCE_UNIT_TESTS
+
+class BinarySerializerBenchmark final : public UnitTest
+{
+public:
+    BinarySerializerBenchmark() : UnitTest("Binary serializer benchmark", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Helio3 format is smaller and faster to load than Helio2");
+
+        const auto tree = makeProject(50000, 5000);
+
+        TemporaryFile v2File(".helio");
+        TemporaryFile v3File(".helio");
+
+        const BinarySerializer v2Serializer(BinarySerializer::Format::Helio2);
+        expect(v2Serializer.saveToFile(v2File.getFile(), tree).wasOk());
+
+        const BinarySerializer serializer(BinarySerializer::Format::Helio3);
+        expect(serializer.saveToFile(v3File.getFile(), tree).wasOk());
+
+        const auto v2Time = measureLoadTime(serializer, v2File.getFile(), tree);
+        const auto v3Time = measureLoadTime(serializer, v3File.getFile(), tree);
+
+        const auto v2Size = v2File.getFile().getSize();
+        const auto v3Size = v3File.getFile().getSize();
+
+        logMessage("Helio2: " + File::descriptionOfSizeInBytes(v2Size) +
+            ", loaded in " + String(v2Time, 2) + "ms");
+        logMessage("Helio3: " + File::descriptionOfSizeInBytes(v3Size) +
+            ", loaded in " + String(v3Time, 2) + "ms");
+
+        expect(v3Size < v2Size);
+
+        beginTest("Helio3 format keeps the irregular nodes");
+
+        SerializedData mixed(Serialization::Core::project);
+        mixed.setProperty(Serialization::Midi::text, "a long string value");
+        for (int i = 0; i < 10; ++i)
+        {
+            SerializedData child(Serialization::Midi::annotation);
+            child.setProperty(Serialization::Midi::id, String(i));
+            if (i % 3 == 0)
+            {
+                child.setProperty(Serialization::Midi::text, "longer than four bytes");
+            }
+            else if (i % 3 == 1)
+            {
+                child.setProperty(Serialization::Midi::mute, true);
+                child.setProperty(Serialization::Midi::timestamp, int64(i) << 40);
+            }
+
+            mixed.appendChild(child);
+        }
+
+        expect(serializer.saveToFile(v3File.getFile(), mixed).wasOk());
+        expect(serializer.loadFromFile(v3File.getFile()).isEquivalentTo(mixed));
+    }
+
+private:
+
+    double measureLoadTime(const BinarySerializer &serializer,
+        const File &file, const SerializedData &expected)
+    {
+        static constexpr auto numLoads = 5;
+
+        SerializedData loaded;
+        const auto startTime = Time::getMillisecondCounterHiRes();
+        for (int i = 0; i < numLoads; ++i)
+        {
+            loaded = serializer.loadFromFile(file);
+        }
+
+        const auto averageTime = (Time::getMillisecondCounterHiRes() - startTime) / numLoads;
+        expect(loaded.isEquivalentTo(expected));
+        return averageTime;
+    }
+
+    static SerializedData makeProject(int numNotes, int numAutomationEvents)
+    {
+        using namespace Serialization;
+        Random random(42);
+
+        SerializedData project(Core::project);
+
+        SerializedData pianoTrack(Midi::track);
+        for (int i = 0; i < numNotes; ++i)
+        {
+            SerializedData note(Midi::note);
+            note.setProperty(Midi::id, String::toHexString(i % 0xffff));
+            note.setProperty(Midi::key, random.nextInt(128));
+            note.setProperty(Midi::timestamp, i * 8);
+            note.setProperty(Midi::length, 8 + random.nextInt(64));
+            note.setProperty(Midi::volume, random.nextInt(1024));
+            if (i % 100 == 0)
+            {
+                note.setProperty(Midi::tuplet, 3); // breaks the packed runs
+            }
+
+            pianoTrack.appendChild(note);
+        }
+
+        project.appendChild(pianoTrack);
+
+        SerializedData automationTrack(Midi::automation);
+        for (int i = 0; i < numAutomationEvents; ++i)
+        {
+            SerializedData event(Midi::automationEvent);
+            event.setProperty(Midi::id, String::toHexString(i % 0xffff));
+            event.setProperty(Midi::value, random.nextFloat());
+            event.setProperty(Midi::curve, 0.5f);
+            event.setProperty(Midi::timestamp, i * 16);
+            automationTrack.appendChild(event);
+        }
+
+        project.appendChild(automationTrack);
+        return project;
+    }
+};
+
+static BinarySerializerBenchmark binarySerializerBenchmark;
+
+#endif
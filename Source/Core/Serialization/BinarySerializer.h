@@ -23,8 +23,23 @@ class BinarySerializer final : public Serializer
 {
 public:
 
+    // Helio3 is the compact format with the interned key table,
+    // which the versions before it cannot open; until these are gone,
+    // files are saved as Helio2 by default, and the documents choose
+    // Helio3 explicitly (see Document::getBinaryFormat);
+    // both formats are always readable
+    enum class Format : int8
+    {
+        Helio2,
+        Helio3
+    };
+
+    BinarySerializer() = default;
+    explicit BinarySerializer(Format format) noexcept : format(format) {}
+
     Result saveToFile(File file, const SerializedData &tree) const override;
     SerializedData loadFromFile(const File &file) const override;
+    UniquePointer<SerializedDataReader> createReader(const File &file) const override;
 
     Result saveToString(String &string, const SerializedData &tree) const override;
     SerializedData loadFromString(const String &string) const override;
@@ -32,4 +47,8 @@ public:
     bool supportsFileWithExtension(const String &extension) const override;
     bool supportsFileWithHeader(const String &header) const override;
 
+private:
+
+    Format format = Format::Helio2;
+
 };
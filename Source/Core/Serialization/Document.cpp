@@ -19,7 +19,9 @@
 #include "Document.h"
 #include "DocumentOwner.h"
 #include "DocumentHelpers.h"
+#include "DocumentWriter.h"
 #include "MainLayout.h"
+#include "Config.h"
 
 Document::Document(DocumentOwner &documentOwner,
     const String &defaultName,
@@ -52,6 +54,15 @@ Document::Document(DocumentOwner &documentOwner, const File &existingFile) :
 Document::~Document()
 {
     this->owner.removeChangeListener(this);
+
+    // the owner is being destroyed, and can't be serialized again,
+    // so the tree which failed to write is written synchronously
+    if (this->writer != nullptr && !this->writer->retryFailedWrite())
+    {
+        DBG("Document save failed: " + this->workingFile.getFullPathName());
+    }
+
+    this->writer = nullptr;
 }
 
 void Document::changeListenerCallback(ChangeBroadcaster *source)
@@ -78,6 +89,9 @@ void Document::renameFile(const String &newName)
 
     const auto safeNewName = File::createLegalFileName(newName).trimCharactersAtEnd(".");
 
+    // the file must not be moved while it's being written
+    this->waitForBackgroundSave();
+
     jassert(!this->extension.startsWithChar('.'));
     File newFile(this->workingFile.getSiblingFile(safeNewName + "." + this->extension));
 
@@ -99,23 +113,21 @@ void Document::renameFile(const String &newName)
 
 void Document::save()
 {
-    if (this->hasChanges &&
-        this->workingFile.getFullPathName().isNotEmpty())
-    {
-        const String fullPath = this->workingFile.getFullPathName();
-        const auto firstCharAfterLastSlash = fullPath.lastIndexOfChar(File::getSeparatorChar()) + 1;
-        const auto lastDot = fullPath.lastIndexOfChar('.');
-        const bool hasEmptyName = (lastDot == firstCharAfterLastSlash);
-        if (hasEmptyName)
-        {
-            return;
-        }
+    // a pending background write must not overwrite this one
+    this->waitForBackgroundSave();
 
+    if (this->canSave())
+    {
+        const auto startTime = Time::getMillisecondCounterHiRes();
         const bool savedOk = this->owner.onDocumentSave(this->workingFile);
 
         if (savedOk)
         {
             this->hasChanges = false;
+            this->isLastSaveInBackground = false;
+            this->lastSaveStats = {};
+            this->lastSaveStats.writeTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+            this->lastSaveStats.numBytesWritten = this->workingFile.getSize();
             DBG("Document saved: " + this->workingFile.getFullPathName());
             return;
         }
@@ -124,6 +136,93 @@ void Document::save()
     }
 }
 
+void Document::saveInBackground()
+{
+    // the changes of the failed write are still not saved, so retry them;
+    // this doesn't wait for the pending write, if any
+    if (this->writer != nullptr && this->writer->hasLastWriteFailed())
+    {
+        DBG("Document background save failed: " + this->workingFile.getFullPathName());
+        this->hasChanges = true;
+    }
+
+    if (!this->canSave())
+    {
+        return;
+    }
+
+    const auto startTime = Time::getMillisecondCounterHiRes();
+    const auto tree = this->owner.onDocumentSerialize();
+    if (!tree.isValid())
+    {
+        this->save();
+        return;
+    }
+
+    this->lastSaveStats.serializationTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+
+    if (this->writer == nullptr)
+    {
+        this->writer = make<DocumentWriter>();
+    }
+
+    // the tree has all the changes so far, even though it's not written yet;
+    // if the write fails, hasChanges is restored on the next save attempt,
+    // be it the next autosave or an explicit save
+    this->writer->write(this->workingFile, tree, Document::getBinaryFormat());
+    this->hasChanges = false;
+    this->isLastSaveInBackground = true;
+}
+
+Document::SaveStats Document::getLastSaveStats() const
+{
+    auto stats = this->lastSaveStats;
+    if (this->isLastSaveInBackground && this->writer != nullptr)
+    {
+        const auto writeStats = this->writer->getLastWriteStats();
+        stats.writeTimeMs = writeStats.writeTimeMs;
+        stats.numBytesWritten = writeStats.numBytesWritten;
+    }
+
+    return stats;
+}
+
+BinarySerializer::Format Document::getBinaryFormat()
+{
+    jassert(MessageManager::getInstance()->isThisTheMessageThread());
+    return App::Config().getUiFlags()->areExperimentalFeaturesEnabled() ?
+        BinarySerializer::Format::Helio3 : BinarySerializer::Format::Helio2;
+}
+
+bool Document::canSave() const
+{
+    if (this->hasChanges &&
+        this->workingFile.getFullPathName().isNotEmpty())
+    {
+        const String fullPath = this->workingFile.getFullPathName();
+        const auto firstCharAfterLastSlash = fullPath.lastIndexOfChar(File::getSeparatorChar()) + 1;
+        const auto lastDot = fullPath.lastIndexOfChar('.');
+        const bool hasEmptyName = (lastDot == firstCharAfterLastSlash);
+        return !hasEmptyName;
+    }
+
+    return false;
+}
+
+void Document::waitForBackgroundSave()
+{
+    if (this->writer != nullptr)
+    {
+        this->writer->waitForPendingWrites();
+        if (this->writer->hasLastWriteFailed())
+        {
+            DBG("Document background save failed: " + this->workingFile.getFullPathName());
+            this->hasChanges = true;
+            this->writer = nullptr; // start over with the next save
+        }
+    }
+}
+
 void Document::exportAs(const String &exportExtension,
     const String &defaultFilenameWithExtension)
 {
@@ -178,6 +277,8 @@ bool Document::load(const File &file)
         return false;
     }
 
+    this->waitForBackgroundSave();
+
     if (this->owner.onDocumentLoad(file))
     {
         this->workingFile = file;
@@ -214,3 +315,85 @@ void Document::import(const String &filePattern)
         }
     });
 }
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class DocumentTests final : public UnitTest
+{
+public:
+    DocumentTests() : UnitTest("Document tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        TemporaryFile target(".helio");
+
+        beginTest("Saving in background writes the serialized tree");
+
+        {
+            TestOwner owner(target.getFile());
+            owner.getDocument()->saveInBackground();
+            owner.getDocument()->save(); // only waits for the write, no changes left
+
+            expectEquals(owner.numSerializations, 1);
+            expectEquals(owner.numSaves, 0);
+
+            const auto stats = owner.getDocument()->getLastSaveStats();
+            expectEquals(stats.numBytesWritten, target.getFile().getSize());
+            expect(DocumentHelpers::load<BinarySerializer>(target.getFile()).isEquivalentTo(owner.tree));
+        }
+
+        beginTest("A failed background write is retried by the next background save");
+
+        {
+            // nothing can be written into a file's subdirectory
+            TestOwner owner(target.getFile().getChildFile("test.helio"));
+            auto *document = owner.getDocument();
+
+            document->saveInBackground();
+            document->writer->waitForPendingWrites();
+            expect(document->writer->hasLastWriteFailed());
+
+            document->saveInBackground();
+            expectEquals(owner.numSerializations, 2);
+        }
+    }
+
+private:
+
+    struct TestOwner final : DocumentOwner
+    {
+        explicit TestOwner(const File &file) : DocumentOwner(file)
+        {
+            this->tree.setProperty(Serialization::Core::projectId, "test");
+        }
+
+        bool onDocumentLoad(const File &file) override { return false; }
+
+        bool onDocumentSave(const File &file) override
+        {
+            this->numSaves++;
+            return DocumentHelpers::save<BinarySerializer>(file, this->tree);
+        }
+
+        SerializedData onDocumentSerialize() const override
+        {
+            this->numSerializations++;
+            return this->tree;
+        }
+
+        void onDocumentImport(InputStream &stream) override {}
+        bool onDocumentExport(OutputStream &stream) override { return false; }
+
+        SerializedData tree { Serialization::Core::project };
+        mutable int numSerializations = 0;
+        int numSaves = 0;
+    };
+};
+
+static DocumentTests documentTests;
+
+#endif
@@ -18,6 +18,9 @@
 #pragma once
 
 class DocumentOwner;
+class DocumentWriter;
+
+#include "BinarySerializer.h"
 
 class Document : public ChangeListener
 {
@@ -37,7 +40,6 @@ public:
 
     void renameFile(const String &newName);
 
-
     //===------------------------------------------------------------------===//
     // Save
     //===------------------------------------------------------------------===//
@@ -46,6 +48,23 @@ public:
     void exportAs(const String &exportExtension,
         const String &defaultFilename = "");
 
+    // only serializes the document on the calling thread,
+    // and then writes it on a background one, if the owner supports that
+    void saveInBackground();
+
+    struct SaveStats final
+    {
+        double serializationTimeMs = 0.0; // on the message thread
+        double writeTimeMs = 0.0; // the encoding and the file writing
+        int64 numBytesWritten = 0;
+    };
+
+    SaveStats getLastSaveStats() const;
+
+    // the binary format to save with, which is chosen here, on the message thread,
+    // since the compact one is only used with the experimental features enabled
+    static BinarySerializer::Format getBinaryFormat();
+
     //===------------------------------------------------------------------===//
     // Load
     //===------------------------------------------------------------------===//
@@ -63,9 +82,18 @@ private:
     bool hasChanges = true;
     File workingFile;
 
+    bool canSave() const;
+    void waitForBackgroundSave();
+
+    UniquePointer<DocumentWriter> writer;
+    SaveStats lastSaveStats;
+    bool isLastSaveInBackground = false;
+
     // async-launched file choosers must have long enough lifetime
     UniquePointer<FileChooser> exportFileChooser;
     UniquePointer<FileChooser> importFileChooser;
 
+    friend class DocumentTests;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Document)
 };
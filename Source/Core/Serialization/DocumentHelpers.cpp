@@ -21,6 +21,7 @@
 #include "JsonSerializer.h"
 #include "XmlSerializer.h"
 #include "BinarySerializer.h"
+#include "SerializedDataReader.h"
 
 String DocumentHelpers::getTemporaryFolder()
 {
@@ -146,13 +147,16 @@ File DocumentHelpers::getTempSlot(const String &fileName)
 
 static const OwnedArray<Serializer> &getSerializers()
 {
-    static OwnedArray<Serializer> serializers;
-    if (serializers.isEmpty())
+    // initialized once in a thread-safe way,
+    // since the documents might be loaded from several threads
+    static const OwnedArray<Serializer> serializers = []()
     {
-        serializers.add(new XmlSerializer());
-        serializers.add(new JsonSerializer());
-        serializers.add(new BinarySerializer());
-    }
+        OwnedArray<Serializer> result;
+        result.add(new XmlSerializer());
+        result.add(new JsonSerializer());
+        result.add(new BinarySerializer());
+        return result;
+    }();
 
     return serializers;
 }
@@ -187,20 +191,17 @@ static const Array<Serializer *> getSerializersForHeader(const String &header)
     return result;
 }
 
-SerializedData DocumentHelpers::load(const File &file)
+// Tries to auto-detect the serializer by the file extension or the header,
+// returns nullptr if nothing fits (then the binary serializer is the default)
+static Serializer *findSerializerForFile(const File &file)
 {
-    if (!file.existsAsFile())
-    {
-        return {};
-    }
-
     const String extension(file.getFileExtension());
     const auto onesThatSupportExtension(getSerializersForExtension(extension));
 
     // if exactly one serializer reports to support target file extension, then use that one
     if (onesThatSupportExtension.size() == 1)
     {
-        return onesThatSupportExtension.getFirst()->loadFromFile(file);
+        return onesThatSupportExtension.getFirst();
     }
 
     // if none of more that one of serializers support that extension, try to check file header
@@ -220,13 +221,44 @@ SerializedData DocumentHelpers::load(const File &file)
     const auto onesThatSupportHeader(getSerializersForHeader(header.toUTF8()));
     if (!onesThatSupportHeader.isEmpty())
     {
-        return onesThatSupportHeader.getFirst()->loadFromFile(file);
+        return onesThatSupportHeader.getFirst();
+    }
+
+    return nullptr;
+}
+
+SerializedData DocumentHelpers::load(const File &file)
+{
+    if (!file.existsAsFile())
+    {
+        return {};
+    }
+
+    if (auto *serializer = findSerializerForFile(file))
+    {
+        return serializer->loadFromFile(file);
     }
 
     // Default to binary serialization
     return DocumentHelpers::load<BinarySerializer>(file);
 }
 
+UniquePointer<SerializedDataReader> DocumentHelpers::createReader(const File &file)
+{
+    if (!file.existsAsFile())
+    {
+        return nullptr;
+    }
+
+    if (auto *serializer = findSerializerForFile(file))
+    {
+        return serializer->createReader(file);
+    }
+
+    static BinarySerializer binarySerializer;
+    return binarySerializer.createReader(file);
+}
+
 SerializedData DocumentHelpers::load(const String &string)
 {
     const String header(string.substring(0, 8));
@@ -17,6 +17,8 @@
 
 #pragma once
 
+class SerializedDataReader;
+
 class DocumentHelpers final
 {
 public:
@@ -38,6 +40,10 @@ public:
     static SerializedData load(const File &file);
     static SerializedData load(const String &string);
 
+    // Same as above, but for reading the file straight into the models,
+    // see SerializedDataReader; returns nullptr if the file is not supported
+    static UniquePointer<SerializedDataReader> createReader(const File &file);
+
     template<typename T>
     static SerializedData load(const File &file)
     {
@@ -65,6 +71,19 @@ public:
         return false;
     }
 
+    // Same as above, but with the given serializer, e.g. the one set up for a format
+    template<typename T>
+    static bool save(const File &file, const SerializedData &tree, const T &serializer)
+    {
+        TempDocument tempDoc(file);
+        if (serializer.saveToFile(tempDoc.getFile(), tree).wasOk())
+        {
+            return tempDoc.overwriteTargetFileWithTemporary();
+        }
+
+        return false;
+    }
+
     template<typename T>
     static bool save(const File &file, const Serializable &serializable)
     {
@@ -38,6 +38,10 @@ protected:
 
     virtual bool onDocumentLoad(const File &file) = 0;
     virtual bool onDocumentSave(const File &file) = 0;
+
+    // the tree to be written in the background, see Document::saveInBackground;
+    // if not valid, the document is saved synchronously via onDocumentSave
+    virtual SerializedData onDocumentSerialize() const { return {}; }
     virtual void onDocumentImport(InputStream &stream) = 0;
     virtual bool onDocumentExport(OutputStream &stream) = 0;
 
@@ -0,0 +1,221 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "DocumentWriter.h"
+#include "DocumentHelpers.h"
+
+DocumentWriter::DocumentWriter() :
+    Thread("Document Writer")
+{
+    this->startThread(5);
+}
+
+DocumentWriter::~DocumentWriter()
+{
+    this->waitForPendingWrites();
+    this->signalThreadShouldExit();
+    this->hasPendingWrite.signal();
+    this->stopThread(1000);
+}
+
+void DocumentWriter::write(const File &file, const SerializedData &tree,
+    BinarySerializer::Format format)
+{
+    {
+        const ScopedLock sl(this->lock);
+        this->pendingFile = file;
+        this->pendingTree = tree;
+        this->pendingFormat = format;
+        this->writtenTrees.clearQuick();
+
+        // the new tree supersedes the one which failed to write
+        this->lastWriteFailed = false;
+        this->failedTree = {};
+    }
+
+    this->hasPendingWrite.signal();
+}
+
+void DocumentWriter::waitForPendingWrites()
+{
+    while (true)
+    {
+        {
+            const ScopedLock sl(this->lock);
+            if (!this->isWriting && !this->pendingTree.isValid())
+            {
+                this->writtenTrees.clearQuick();
+                return;
+            }
+        }
+
+        this->hasFinishedWrite.wait(100);
+    }
+}
+
+bool DocumentWriter::hasLastWriteFailed() const
+{
+    const ScopedLock sl(this->lock);
+    return this->lastWriteFailed;
+}
+
+DocumentWriter::Stats DocumentWriter::getLastWriteStats() const
+{
+    const ScopedLock sl(this->lock);
+    return this->lastWriteStats;
+}
+
+bool DocumentWriter::retryFailedWrite()
+{
+    this->waitForPendingWrites();
+
+    const ScopedLock sl(this->lock);
+    if (!this->lastWriteFailed)
+    {
+        return true;
+    }
+
+    if (DocumentHelpers::save(this->failedFile,
+        this->failedTree, BinarySerializer(this->failedFormat)))
+    {
+        this->lastWriteFailed = false;
+        this->failedTree = {};
+        return true;
+    }
+
+    return false;
+}
+
+void DocumentWriter::run()
+{
+    while (!this->threadShouldExit())
+    {
+        this->hasPendingWrite.wait(-1);
+
+        File file;
+        SerializedData tree;
+        auto format = BinarySerializer::Format::Helio2;
+
+        {
+            const ScopedLock sl(this->lock);
+            if (!this->pendingTree.isValid())
+            {
+                continue;
+            }
+
+            file = this->pendingFile;
+            tree = this->pendingTree;
+            format = this->pendingFormat;
+            this->pendingTree = {};
+            this->isWriting = true;
+        }
+
+        const auto startTime = Time::getMillisecondCounterHiRes();
+        const bool savedOk = DocumentHelpers::save(file, tree, BinarySerializer(format));
+
+        Stats stats;
+        stats.writeTimeMs = Time::getMillisecondCounterHiRes() - startTime;
+        stats.numBytesWritten = savedOk ? file.getSize() : 0;
+
+        {
+            const ScopedLock sl(this->lock);
+            this->writtenTrees.add(tree);
+            this->lastWriteFailed = !savedOk;
+            this->lastWriteStats = stats;
+            if (!savedOk)
+            {
+                // the previous failed tree is released on the message thread too
+                this->writtenTrees.add(this->failedTree);
+                this->failedFile = file;
+                this->failedTree = tree;
+                this->failedFormat = format;
+            }
+            this->isWriting = false;
+        }
+
+        tree = {}; // not the last reference, see writtenTrees
+        this->hasFinishedWrite.signal();
+    }
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class DocumentWriterTests final : public UnitTest
+{
+public:
+    DocumentWriterTests() : UnitTest("Document writer tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        TemporaryFile target(".helio");
+
+        beginTest("The latest written tree is the one in the file");
+
+        {
+            DocumentWriter writer;
+            for (int i = 0; i < 10; ++i)
+            {
+                writer.write(target.getFile(), makeTree(i), BinarySerializer::Format::Helio3);
+            }
+
+            writer.waitForPendingWrites();
+
+            expect(!writer.hasLastWriteFailed());
+            expectEquals(writer.getLastWriteStats().numBytesWritten, target.getFile().getSize());
+
+            const auto loaded = DocumentHelpers::load<BinarySerializer>(target.getFile());
+            expect(loaded.isEquivalentTo(makeTree(9)));
+        }
+
+        beginTest("The pending write is done before the writer is deleted");
+
+        {
+            {
+                DocumentWriter writer;
+                writer.write(target.getFile(), makeTree(42), BinarySerializer::Format::Helio2);
+            }
+
+            const auto loaded = DocumentHelpers::load<BinarySerializer>(target.getFile());
+            expect(loaded.isEquivalentTo(makeTree(42)));
+        }
+    }
+
+private:
+
+    static SerializedData makeTree(int version)
+    {
+        SerializedData tree(Serialization::Core::project);
+        tree.setProperty(Serialization::Core::projectId, version);
+        for (int i = 0; i < 1000; ++i)
+        {
+            SerializedData child(Serialization::Core::track);
+            child.setProperty(Serialization::Core::trackId, String(i));
+            tree.appendChild(child);
+        }
+
+        return tree;
+    }
+};
+
+static DocumentWriterTests documentWriterTests;
+
+#endif
@@ -0,0 +1,82 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "BinarySerializer.h"
+
+// Writes the documents on a background thread, so that saving
+// a large project doesn't freeze the UI: the message thread only takes
+// the serialized tree, which is then encoded into a temporary file
+// and swapped with the target one; the writes are done in the order
+// they were requested, and a newer request replaces the one not started yet
+
+class DocumentWriter final : private Thread
+{
+public:
+
+    DocumentWriter();
+    ~DocumentWriter() override;
+
+    struct Stats final
+    {
+        double writeTimeMs = 0.0;
+        int64 numBytesWritten = 0;
+    };
+
+    // the tree must not be modified after it is passed here;
+    // the format is chosen by the caller on the message thread
+    void write(const File &file, const SerializedData &tree,
+        BinarySerializer::Format format);
+
+    // blocks until all requested writes are done
+    void waitForPendingWrites();
+
+    bool hasLastWriteFailed() const;
+    Stats getLastWriteStats() const;
+
+    // writes the tree of the last failed write again on the calling thread,
+    // for the cases when the document can't be serialized anymore
+    bool retryFailedWrite();
+
+private:
+
+    void run() override;
+
+    CriticalSection lock;
+    WaitableEvent hasPendingWrite;
+    WaitableEvent hasFinishedWrite;
+
+    File pendingFile;
+    SerializedData pendingTree;
+    BinarySerializer::Format pendingFormat = BinarySerializer::Format::Helio2;
+    bool isWriting = false;
+
+    bool lastWriteFailed = false;
+    Stats lastWriteStats;
+
+    File failedFile;
+    SerializedData failedTree;
+    BinarySerializer::Format failedFormat = BinarySerializer::Format::Helio2;
+
+    // some nodes of the tree might be shared with the revision items,
+    // (see RevisionItem::serialize) which check their parents on the message thread,
+    // so the written trees are kept here to be released on the message thread
+    Array<SerializedData> writtenTrees;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DocumentWriter)
+};
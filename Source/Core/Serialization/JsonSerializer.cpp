@@ -17,203 +17,346 @@
 
 #include "Common.h"
 #include "JsonSerializer.h"
+#include "SerializedDataReader.h"
 
 //===----------------------------------------------------------------------===//
 // Json parser
 //===----------------------------------------------------------------------===//
 
-// Slightly modified JSONParser from JUCE classes,
-// but returns SerializedData instead of var, and supports comments like `//` and `/* */`.
+// Initially based on JSONParser from JUCE classes, but returns SerializedData
+// instead of var, and supports comments like `//` and `/* */`.
 // Parses arrays and objects as nodes/children, and all others as properties.
 
-struct JsonParser final
+// The parser reads utf-8 bytes as they are, without decoding them into characters:
+// all the structural characters are ascii, so the multi-byte sequences only matter
+// within the strings, which are copied as whole spans. The whitespace runs and
+// the strings are scanned 8 bytes at a time with the word-sized bit tricks,
+// which work the same on all platforms, unlike the SIMD intrinsics.
+// The parser keeps no static state, so that the files can be parsed in parallel.
+
+namespace JsonScanning
 {
-    static Result parseObjectOrArray(String::CharPointerType t, SerializedData &result)
+    static constexpr uint64 lowBits = 0x0101010101010101ULL;
+    static constexpr uint64 highBits = 0x8080808080808080ULL;
+    static constexpr uint64 allSpaces = lowBits * uint64(' ');
+
+    static inline uint64 loadWord(const char *ptr) noexcept
+    {
+        uint64 word;
+        memcpy(&word, ptr, sizeof(word));
+        return word;
+    }
+
+    // non-zero, if any of the word's bytes is zero
+    static inline uint64 hasZeroByte(uint64 word) noexcept
+    {
+        return (word - lowBits) & ~word & highBits;
+    }
+
+    static inline uint64 hasByte(uint64 word, uint8 byte) noexcept
+    {
+        return hasZeroByte(word ^ (lowBits * byte));
+    }
+
+    static inline bool isDigit(char c) noexcept
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    static inline bool isWhitespace(char c) noexcept
+    {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+    }
+}
+
+class JsonParser final
+{
+public:
+
+    JsonParser(const char *data, size_t numBytes) noexcept :
+        t(data), end(data + numBytes)
+    {
+        // skip the byte order mark, if any
+        if (numBytes >= 3 && uint8(data[0]) == 0xef &&
+            uint8(data[1]) == 0xbb && uint8(data[2]) == 0xbf)
+        {
+            this->t += 3;
+        }
+    }
+
+    Result parseObjectOrArray(SerializedData &result)
     {
-        skipCommentsAndWhitespaces(t);
+        this->skipCommentsAndWhitespaces();
 
-        switch (t.getAndAdvance())
+        switch (this->getAndAdvance())
         {
         case 0:      result = SerializedData(); return Result::ok();
-        case '{':    return parseObject(t, result);
-        case '[':    return parseArray(t, result, result.getType());
+        case '{':    return this->parseObject(result);
+        case '[':    return this->parseArray(result, result.getType());
         }
 
-        return createFail("Expected '{' or '['", &t);
+        return this->createFail("Expected '{' or '['", this->t - 1);
     }
 
-    static Result parseStringProperty(const juce_wchar quoteChar, String::CharPointerType &t, const Identifier &propertyName, SerializedData &tree)
+    inline char peek() const noexcept
     {
-        String property;
-        const auto r = parseString(quoteChar, t, property);
-        if (r.wasOk())
+        return this->t < this->end ? *this->t : 0;
+    }
+
+    inline char getAndAdvance() noexcept
+    {
+        return this->t < this->end ? *this->t++ : 0;
+    }
+
+    void skipCommentsAndWhitespaces() noexcept
+    {
+        using namespace JsonScanning;
+
+        while (this->t < this->end)
         {
-            tree.setProperty(propertyName, property);
-        }
+            const auto c = *this->t;
+            if (c == ' ' && this->end - this->t >= 8 && loadWord(this->t) == allSpaces)
+            {
+                this->t += 8; // the indentation mostly
+            }
+            else if (isWhitespace(c))
+            {
+                this->t++;
+            }
+            else if (c == '/' && this->end - this->t >= 2 && this->t[1] == '/')
+            {
+                this->t += 2;
+                while (this->t < this->end && *this->t != '\n' && *this->t != '\r')
+                {
+                    this->t++;
+                }
+            }
+            else if (c == '/' && this->end - this->t >= 2 && this->t[1] == '*')
+            {
+                this->t += 2;
+                while (this->t < this->end &&
+                    !(*this->t == '*' && this->end - this->t >= 2 && this->t[1] == '/'))
+                {
+                    this->t++;
+                }
 
-        return r;
+                this->t = jmin(this->t + 2, this->end);
+            }
+            else
+            {
+                break;
+            }
+        }
     }
 
-    static Result parseString(const juce_wchar quoteChar, String::CharPointerType &t, String &result)
+    // expects t to point right after the opening quote
+    Result parseString(char quoteChar, String &result)
     {
-        static MemoryOutputStream buffer(256);
-        buffer.reset();
+        using namespace JsonScanning;
+
+        const auto *spanStart = this->t;
+        bool hasEscapes = false;
 
         for (;;)
         {
-            auto c = t.getAndAdvance();
+            // skip the plain characters, 8 at a time
+            while (this->end - this->t >= 8)
+            {
+                const auto word = loadWord(this->t);
+                if ((hasByte(word, uint8(quoteChar)) |
+                    hasByte(word, uint8('\\')) | hasZeroByte(word)) != 0)
+                {
+                    break;
+                }
+
+                this->t += 8;
+            }
+
+            const auto c = this->getAndAdvance();
 
             if (c == quoteChar)
             {
                 break;
             }
 
-            if (c == '\\')
+            if (c == 0)
             {
-                c = t.getAndAdvance();
+                return this->createFail("Unexpected end-of-input in string constant");
+            }
 
-                switch (c)
-                {
-                case '"':
-                case '\'':
-                case '\\':
-                case '/':  break;
-
-                case 'a':  c = '\a'; break;
-                case 'b':  c = '\b'; break;
-                case 'f':  c = '\f'; break;
-                case 'n':  c = '\n'; break;
-                case 'r':  c = '\r'; break;
-                case 't':  c = '\t'; break;
-
-                case 'u':
-                {
-                    c = 0;
+            if (c != '\\')
+            {
+                continue;
+            }
 
-                    for (int i = 4; --i >= 0;)
-                    {
-                        auto digitValue = CharacterFunctions::getHexDigitValue(t.getAndAdvance());
-                        if (digitValue < 0) { return createFail("Syntax error in Unicode escape sequence"); }
-                        c = (juce_wchar)((c << 4) + static_cast<juce_wchar> (digitValue));
-                    }
+            if (!hasEscapes)
+            {
+                hasEscapes = true;
+                this->buffer.reset();
+            }
 
-                    break;
-                }
+            this->buffer.write(spanStart, size_t(this->t - 1 - spanStart));
+
+            auto decoded = juce_wchar(uint8(this->getAndAdvance()));
+            if (decoded >= 0x80)
+            {
+                // an escaped multi-byte character is kept as is
+                spanStart = this->t - 1;
+                continue;
+            }
+
+            switch (decoded)
+            {
+            case '"':
+            case '\'':
+            case '\\':
+            case '/':  break;
+
+            case 'a':  decoded = '\a'; break;
+            case 'b':  decoded = '\b'; break;
+            case 'f':  decoded = '\f'; break;
+            case 'n':  decoded = '\n'; break;
+            case 'r':  decoded = '\r'; break;
+            case 't':  decoded = '\t'; break;
+
+            case 'u':
+            {
+                decoded = 0;
+
+                for (int i = 4; --i >= 0;)
+                {
+                    const auto digitValue = CharacterFunctions::getHexDigitValue(juce_wchar(uint8(this->getAndAdvance())));
+                    if (digitValue < 0) { return this->createFail("Syntax error in Unicode escape sequence"); }
+                    decoded = juce_wchar((decoded << 4) + juce_wchar(digitValue));
                 }
+
+                break;
+            }
+            }
+
+            if (decoded == 0)
+            {
+                return this->createFail("Unexpected end-of-input in string constant");
             }
 
-            if (c == 0) { return createFail("Unexpected end-of-input in string constant"); }
-            buffer.appendUTF8Char(c);
+            this->buffer.appendUTF8Char(decoded);
+            spanStart = this->t;
         }
 
-        result = buffer.toUTF8();
-        return Result::ok();
-    }
+        const auto *spanEnd = this->t - 1; // the closing quote
 
-    static void findNextNewline(String::CharPointerType &t)
-    {
-        juce_wchar c = 0;
-        do { c = t.getAndAdvance(); } while (c != '\n' && c != '\r');
-    }
+        if (!hasEscapes)
+        {
+            result = String::fromUTF8(spanStart, int(spanEnd - spanStart));
+            return Result::ok();
+        }
 
-    static void findEndOfMultilineComment(String::CharPointerType &t)
-    {
-        juce_wchar c1 = 0;
-        juce_wchar c2 = 0;
-        do
-        { 
-            c1 = c2;
-            c2 = t.getAndAdvance();
-            if (c2 == 0) { return; }
-        } while (c1 != '*' || c2 != '/');
+        this->buffer.write(spanStart, size_t(spanEnd - spanStart));
+        result = this->buffer.toUTF8();
+        return Result::ok();
     }
 
-    static void skipCommentsAndWhitespaces(String::CharPointerType &t)
+    // expects t to point right after the opening quote;
+    // all objects of the same type have the same member names,
+    // so these are only converted into identifiers once per parser
+    Result parseMemberName(Identifier &result)
     {
-        t = t.findEndOfWhitespace();
-        auto t2 = t;
-        switch (t2.getAndAdvance())
+        const auto *nameStart = this->t;
+        while (this->t < this->end && *this->t != '"' && *this->t != '\\' && *this->t != 0)
         {
-        case '/':
-            const auto c = t2.getAndAdvance();
-            if (c == '/')
+            this->t++;
+        }
+
+        if (this->t < this->end && *this->t == '"')
+        {
+            const auto length = size_t(this->t - nameStart);
+            this->t++;
+
+            if (length == 0)
             {
-                t = t2;
-                findNextNewline(t);
-                skipCommentsAndWhitespaces(t);
+                return this->createFail("Expected object member declaration, but found", nameStart - 1);
             }
-            else if (c == '*')
+
+            const auto hash = hashBytes(nameStart, length);
+            const auto found = this->memberNames.find(hash);
+            if (found != this->memberNames.end() && matches(found->second, nameStart, length))
             {
-                t = t2;
-                findEndOfMultilineComment(t);
-                skipCommentsAndWhitespaces(t);
+                result = found->second;
+                return Result::ok();
             }
+
+            result = Identifier(String::fromUTF8(nameStart, int(length)));
+            this->memberNames[hash] = result;
+            return Result::ok();
         }
-    }
 
-    static Result parseAny(String::CharPointerType &t, SerializedData &result, const Identifier &nodeOrProperty)
-    {
-        skipCommentsAndWhitespaces(t);
-        auto t2 = t;
+        // the names with escapes are not worth caching
+        this->t = nameStart;
+        String name;
+        const auto r = this->parseString('"', name);
+        if (r.failed())
+        {
+            return r;
+        }
 
-        switch (t2.getAndAdvance())
+        if (name.isEmpty())
         {
-        case '{':
-            {
-                t = t2;
-                SerializedData child(nodeOrProperty);
-                result.appendChild(child);
-                return parseObject(t, child);
-            }
+            return this->createFail("Expected object member declaration, but found", nameStart - 1);
+        }
 
-        case '[':
-            t = t2;
-            return parseArray(t, result, nodeOrProperty);
+        result = name;
+        return Result::ok();
+    }
 
-        case '"':
-            t = t2;
-            return parseStringProperty('"', t, nodeOrProperty, result);
+    // parses a string, a number or a literal, at which t points; null is a void var
+    Result parseScalar(var &result)
+    {
+        const auto *start = this->t;
+        const auto c = this->getAndAdvance();
 
+        switch (c)
+        {
+        case '"':
         case '\'':
-            t = t2;
-            return parseStringProperty('\'', t, nodeOrProperty, result);
+        {
+            String string;
+            const auto r = this->parseString(c, string);
+            result = string;
+            return r;
+        }
 
         case '-':
-            skipCommentsAndWhitespaces(t2);
-            if (!CharacterFunctions::isDigit(*t2))
+            this->skipCommentsAndWhitespaces();
+            if (!JsonScanning::isDigit(this->peek()))
                 break;
 
-            t = t2;
-            return parseNumberProperty(t, nodeOrProperty, result, true);
+            return this->parseNumber(result, true);
 
         case '0': case '1': case '2': case '3': case '4':
         case '5': case '6': case '7': case '8': case '9':
-            return parseNumberProperty(t, nodeOrProperty, result, false);
+            this->t = start;
+            return this->parseNumber(result, false);
 
-        case 't':   // "true"
-            if (t2.getAndAdvance() == 'r' && t2.getAndAdvance() == 'u' && t2.getAndAdvance() == 'e')
+        case 't':
+            if (this->skipLiteral("rue"))
             {
-                t = t2;
-                result.setProperty(nodeOrProperty, true);
+                result = true;
                 return Result::ok();
             }
             break;
 
-        case 'f':   // "false"
-            if (t2.getAndAdvance() == 'a' && t2.getAndAdvance() == 'l'
-                && t2.getAndAdvance() == 's' && t2.getAndAdvance() == 'e')
+        case 'f':
+            if (this->skipLiteral("alse"))
             {
-                t = t2;
-                result.setProperty(nodeOrProperty, false);
+                result = false;
                 return Result::ok();
             }
             break;
 
-        case 'n':   // "null"
-            if (t2.getAndAdvance() == 'u' && t2.getAndAdvance() == 'l' && t2.getAndAdvance() == 'l')
+        case 'n':
+            if (this->skipLiteral("ull"))
             {
-                t = t2;
-                // no need to set any property in this case?
+                result = var();
                 return Result::ok();
             }
             break;
@@ -222,139 +365,214 @@ struct JsonParser final
             break;
         }
 
-        return createFail("Syntax error", &t);
+        this->t = start;
+        return this->createFail("Syntax error", start);
     }
 
 private:
-    static Result createFail(const char *const message, const String::CharPointerType *location = nullptr)
+
+    const char *t;
+    const char *const end;
+
+    // only used for the strings with escape sequences
+    MemoryOutputStream buffer { 256 };
+
+    FlatHashMap<uint64, Identifier> memberNames;
+
+    static inline uint64 hashBytes(const char *data, size_t length) noexcept
+    {
+        uint64 hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < length; ++i)
+        {
+            hash = (hash ^ uint8(data[i])) * 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    static inline bool matches(const Identifier &identifier, const char *data, size_t length) noexcept
+    {
+        const auto *chars = identifier.getCharPointer().getAddress();
+        return strncmp(chars, data, length) == 0 && chars[length] == 0;
+    }
+
+    bool skipLiteral(const char *rest) noexcept
+    {
+        const auto length = strlen(rest);
+        if (size_t(this->end - this->t) >= length && memcmp(this->t, rest, length) == 0)
+        {
+            this->t += length;
+            return true;
+        }
+
+        return false;
+    }
+
+    Result createFail(const char *const message, const char *location = nullptr) const
     {
         String m(message);
         if (location != nullptr)
-            m << ": \"" << String(*location, 20) << '"';
+            m << ": \"" << String::fromUTF8(location, int(jmin(this->end - location, ptrdiff_t(20)))) << '"';
 
         return Result::fail(m);
     }
 
-    static Result parseNumberProperty(String::CharPointerType &t, const Identifier &propertyName, SerializedData &result, const bool isNegative)
+    Result parseNumber(var &result, const bool isNegative)
     {
-        auto oldT = t;
+        using namespace JsonScanning;
 
-        int64 intValue = t.getAndAdvance() - '0';
-        jassert(intValue >= 0 && intValue < 10);
+        const auto *numberStart = this->t;
 
-        for (;;)
+        int64 intValue = 0;
+        while (this->t < this->end && isDigit(*this->t))
         {
-            auto previousChar = t;
-            auto c = t.getAndAdvance();
-            auto digit = ((int)c) - '0';
+            intValue = intValue * 10 + (*this->t - '0');
+            this->t++;
+        }
 
-            if (isPositiveAndBelow(digit, 10))
-            {
-                intValue = intValue * 10 + digit;
-                continue;
-            }
+        const auto c = this->peek();
 
-            if (c == 'e' || c == 'E' || c == '.')
+        if (c == 'e' || c == 'E' || c == '.')
+        {
+            // the doubles are rare, so they are just handed over
+            // to juce as a null-terminated copy of the number
+            char number[64];
+            size_t length = 0;
+            for (const auto *n = numberStart; n < this->end && length < sizeof(number) - 1; ++n)
             {
-                t = oldT;
-                auto asDouble = CharacterFunctions::readDoubleValue(t);
-                result.setProperty(propertyName, isNegative ? -asDouble : asDouble);
-                return Result::ok();
-            }
+                const auto nc = *n;
+                if (!isDigit(nc) && nc != '.' && nc != 'e' && nc != 'E' && nc != '+' && nc != '-')
+                {
+                    break;
+                }
 
-            if (CharacterFunctions::isWhitespace(c)
-                || c == ',' || c == '}' || c == ']' || c == 0)
-            {
-                t = previousChar;
-                break;
+                number[length++] = nc;
             }
 
-            return createFail("Syntax error in number", &oldT);
+            number[length] = 0;
+
+            CharPointer_ASCII numberPtr(number);
+            const auto asDouble = CharacterFunctions::readDoubleValue(numberPtr);
+            this->t = numberStart + (numberPtr.getAddress() - number);
+            result = isNegative ? -asDouble : asDouble;
+            return Result::ok();
+        }
+
+        if (!(isWhitespace(c) || c == ',' || c == '}' || c == ']' || c == 0))
+        {
+            return this->createFail("Syntax error in number", numberStart);
         }
 
-        auto correctedValue = isNegative ? -intValue : intValue;
+        const auto correctedValue = isNegative ? -intValue : intValue;
 
         if ((intValue >> 31) != 0)
-            result.setProperty(propertyName, correctedValue);
+            result = correctedValue;
         else
-            result.setProperty(propertyName, (int)correctedValue);
+            result = (int)correctedValue;
 
         return Result::ok();
     }
 
-    static Result parseObject(String::CharPointerType &t, SerializedData &result)
+    Result parseAny(SerializedData &result, const Identifier &nodeOrProperty)
+    {
+        this->skipCommentsAndWhitespaces();
+
+        switch (this->peek())
+        {
+        case '{':
+            {
+                this->t++;
+                SerializedData child(nodeOrProperty);
+                result.appendChild(child);
+                return this->parseObject(child);
+            }
+
+        case '[':
+            this->t++;
+            return this->parseArray(result, nodeOrProperty);
+
+        default:
+            break;
+        }
+
+        var value;
+        const auto r = this->parseScalar(value);
+
+        // no need to set any property for null
+        if (r.wasOk() && !value.isVoid())
+        {
+            result.setProperty(nodeOrProperty, value);
+        }
+
+        return r;
+    }
+
+    Result parseObject(SerializedData &result)
     {
         for (;;)
         {
-            skipCommentsAndWhitespaces(t);
+            this->skipCommentsAndWhitespaces();
 
-            auto oldT = t;
-            auto c = t.getAndAdvance();
+            auto *oldT = this->t;
+            const auto c = this->getAndAdvance();
 
             if (c == '}') { break; }
-            if (c == 0) { return createFail("Unexpected end-of-input in object declaration"); }
+            if (c == 0) { return this->createFail("Unexpected end-of-input in object declaration"); }
             if (c == '"')
             {
-                String nodeNameVar;
-                const auto r = parseString('"', t, nodeNameVar);
+                Identifier nodeName;
+                const auto r = this->parseMemberName(nodeName);
                 if (r.failed()) { return r; }
 
-                const Identifier nodeName(nodeNameVar);
-                if (nodeName.isValid())
-                {
-                    skipCommentsAndWhitespaces(t);
-                    oldT = t;
-
-                    auto c2 = t.getAndAdvance();
+                this->skipCommentsAndWhitespaces();
+                oldT = this->t;
 
-                    if (c2 != ':') { return createFail("Expected ':', but found", &oldT); }
+                if (this->getAndAdvance() != ':') { return this->createFail("Expected ':', but found", oldT); }
 
-                    const auto r2 = parseAny(t, result, nodeName);
-                    if (r2.failed()) { return r2; }
+                const auto r2 = this->parseAny(result, nodeName);
+                if (r2.failed()) { return r2; }
 
-                    skipCommentsAndWhitespaces(t);
-                    oldT = t;
+                this->skipCommentsAndWhitespaces();
+                oldT = this->t;
 
-                    auto nextChar = t.getAndAdvance();
-                    if (nextChar == ',') { continue; }
-                    if (nextChar == '}') { break; }
-                }
+                const auto nextChar = this->getAndAdvance();
+                if (nextChar == ',') { continue; }
+                if (nextChar == '}') { break; }
             }
 
-            return createFail("Expected object member declaration, but found", &oldT);
+            return this->createFail("Expected object member declaration, but found", oldT);
         }
 
         return Result::ok();
     }
 
-    static Result parseArray(String::CharPointerType &t, SerializedData &result, const Identifier &nodeName)
+    Result parseArray(SerializedData &result, const Identifier &nodeName)
     {
         for (;;)
         {
-            skipCommentsAndWhitespaces(t);
+            this->skipCommentsAndWhitespaces();
 
-            auto oldT = t;
-            auto c = t.getAndAdvance();
+            const auto c = this->peek();
 
-            if (c == ']') { break; }
-            if (c == 0) { return createFail("Unexpected end-of-input in array declaration"); }
-
-            t = oldT;
-            auto r = parseAny(t, result, nodeName);
+            if (c == ']') { this->t++; break; }
+            if (c == 0) { return this->createFail("Unexpected end-of-input in array declaration"); }
 
+            const auto r = this->parseAny(result, nodeName);
             if (r.failed()) { return r; }
 
-            skipCommentsAndWhitespaces(t);
-            oldT = t;
+            this->skipCommentsAndWhitespaces();
+            const auto *oldT = this->t;
 
-            auto nextChar = t.getAndAdvance();
+            const auto nextChar = this->getAndAdvance();
             if (nextChar == ',') { continue; }
             if (nextChar == ']') { break; }
-            return createFail("Expected object array item, but found", &oldT);
+            return this->createFail("Expected object array item, but found", oldT);
         }
 
         return Result::ok();
     }
+
+    JUCE_DECLARE_NON_COPYABLE(JsonParser)
 };
 
 //===----------------------------------------------------------------------===//
@@ -622,6 +840,193 @@ struct JsonFormatter final
 
 static const Identifier fakeRoot = "root";
 
+// The file's contents, memory-mapped when possible,
+// so that the parser doesn't need to copy them into a string first
+class JsonFileData final
+{
+public:
+
+    explicit JsonFileData(const File &file)
+    {
+        this->mappedFile = make<MemoryMappedFile>(file, MemoryMappedFile::readOnly);
+        if (this->mappedFile->getData() == nullptr)
+        {
+            this->mappedFile = nullptr;
+            file.loadFileAsData(this->fileData);
+        }
+    }
+
+    inline const char *getData() const noexcept
+    {
+        return this->mappedFile != nullptr ?
+            static_cast<const char *>(this->mappedFile->getData()) :
+            static_cast<const char *>(this->fileData.getData());
+    }
+
+    inline size_t getSize() const noexcept
+    {
+        return this->mappedFile != nullptr ?
+            this->mappedFile->getSize() : this->fileData.getSize();
+    }
+
+private:
+
+    UniquePointer<MemoryMappedFile> mappedFile;
+    MemoryBlock fileData;
+
+    JUCE_DECLARE_NON_COPYABLE(JsonFileData)
+};
+
+// The pull-style version of JsonParser: just like the parser, it reports the objects
+// as nodes and flattens the arrays into the sibling nodes with the array's name,
+// and the top-level object is the fake root, which itself is not reported
+class JsonDataReader final : public SerializedDataReader
+{
+public:
+
+    explicit JsonDataReader(const File &file) :
+        fileData(file),
+        parser(this->fileData.getData(), this->fileData.getSize()) {}
+
+    Event next() override
+    {
+        for (;;)
+        {
+            if (this->hasFailed)
+            {
+                return Event::Error;
+            }
+
+            this->parser.skipCommentsAndWhitespaces();
+
+            if (this->scopes.isEmpty())
+            {
+                if (this->hasStarted)
+                {
+                    return Event::EndOfData;
+                }
+
+                this->hasStarted = true;
+                const auto c = this->parser.getAndAdvance();
+                if (c == '{' || c == '[')
+                {
+                    this->scopes.add({ fakeRoot, c == '[', false });
+                    continue;
+                }
+
+                return c == 0 ? Event::EndOfData : this->fail();
+            }
+
+            auto &scope = this->scopes.getReference(this->scopes.size() - 1);
+            const auto closingChar = scope.isArray ? ']' : '}';
+
+            if (this->parser.peek() == closingChar)
+            {
+                this->parser.getAndAdvance();
+                const auto wasNode = scope.isNode;
+                this->scopes.removeLast();
+
+                if (wasNode)
+                {
+                    this->depth--;
+                    return Event::NodeEnd;
+                }
+
+                continue;
+            }
+
+            if (!scope.isFirst)
+            {
+                if (this->parser.getAndAdvance() != ',')
+                {
+                    return this->fail();
+                }
+
+                this->parser.skipCommentsAndWhitespaces();
+                if (this->parser.peek() == closingChar)
+                {
+                    continue; // a trailing comma
+                }
+            }
+
+            scope.isFirst = false;
+
+            auto memberName = scope.name;
+            if (!scope.isArray)
+            {
+                if (this->parser.getAndAdvance() != '"' ||
+                    this->parser.parseMemberName(memberName).failed())
+                {
+                    return this->fail();
+                }
+
+                this->parser.skipCommentsAndWhitespaces();
+                if (this->parser.getAndAdvance() != ':')
+                {
+                    return this->fail();
+                }
+
+                this->parser.skipCommentsAndWhitespaces();
+            }
+
+            // scope is not valid after this point
+            const auto c = this->parser.peek();
+            if (c == '{')
+            {
+                this->parser.getAndAdvance();
+                this->scopes.add({ memberName, false, true });
+                this->name = memberName;
+                this->depth++;
+                return Event::NodeStart;
+            }
+            else if (c == '[')
+            {
+                this->parser.getAndAdvance();
+                this->scopes.add({ memberName, true, false });
+                continue;
+            }
+
+            if (this->parser.parseScalar(this->value).failed())
+            {
+                return this->fail();
+            }
+
+            // nulls are skipped, just like the fake root's properties
+            if (!this->value.isVoid() && this->depth > 0)
+            {
+                this->name = memberName;
+                return Event::Property;
+            }
+        }
+    }
+
+private:
+
+    inline Event fail() noexcept
+    {
+        this->hasFailed = true;
+        return Event::Error;
+    }
+
+    struct Scope final
+    {
+        Identifier name; // for the array items
+        bool isArray = false;
+        bool isNode = false;
+        bool isFirst = true;
+    };
+
+    Array<Scope> scopes;
+
+    JsonFileData fileData;
+    JsonParser parser;
+
+    bool hasStarted = false;
+    bool hasFailed = false;
+
+    JUCE_DECLARE_NON_COPYABLE(JsonDataReader)
+};
+
 JsonSerializer::JsonSerializer(bool allOnOneLine) noexcept :
     allOnOneLine(allOnOneLine) {}
 
@@ -647,9 +1052,11 @@ Result JsonSerializer::saveToFile(File file, const SerializedData &tree) const
 
 SerializedData JsonSerializer::loadFromFile(const File &file) const
 {
-    const String text(file.loadFileAsString());
+    const JsonFileData data(file);
+    JsonParser parser(data.getData(), data.getSize());
+
     SerializedData root(fakeRoot);
-    const auto result = JsonParser::parseObjectOrArray(text.getCharPointer(), root);
+    const auto result = parser.parseObjectOrArray(root);
     if (result.wasOk())
     {
         return root.getChild(0);
@@ -658,6 +1065,16 @@ SerializedData JsonSerializer::loadFromFile(const File &file) const
     return {};
 }
 
+UniquePointer<SerializedDataReader> JsonSerializer::createReader(const File &file) const
+{
+    if (file.getSize() > 0)
+    {
+        return make<JsonDataReader>(file);
+    }
+
+    return nullptr;
+}
+
 Result JsonSerializer::saveToString(String &string, const SerializedData &tree) const
 {
     MemoryOutputStream mo(1024);
@@ -668,8 +1085,10 @@ Result JsonSerializer::saveToString(String &string, const SerializedData &tree)
 
 SerializedData JsonSerializer::loadFromString(const String &string) const
 {
+    JsonParser parser(string.toRawUTF8(), string.getNumBytesAsUTF8());
+
     SerializedData root(fakeRoot);
-    const auto result = JsonParser::parseObjectOrArray(string.getCharPointer(), root);
+    const auto result = parser.parseObjectOrArray(root);
     if (result.wasOk())
     {
         if (root.getNumChildren() == 1 && root.getNumProperties() == 0)
@@ -697,3 +1116,158 @@ bool JsonSerializer::supportsFileWithHeader(const String &header) const
     // Enough for all our cases:
     return header.startsWithChar('[') || header.startsWithChar('{');
 }
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+#include "RenderWorkerPool.h"
+
+class JsonSerializerTests final : public UnitTest
+{
+public:
+    JsonSerializerTests() : UnitTest("Json serializer tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        const JsonSerializer serializer;
+
+        beginTest("Json parser handles comments, escapes and literals");
+
+        const String json = String::fromUTF8("\xef\xbb\xbf") + // bom
+            "{ /* header\n comment */ \"test\": {\n"
+            "  // a line comment\n"
+            "  \"text\": \"quote \\\" slash \\\\ tab \\t unicode \\u00e9 \xc3\xa9 long enough to be scanned\",\n"
+            "  \"single\": 'single quoted',\n"
+            "  \"int\": -42, \"int64\": 8589934592, \"double\": 1.5e2,\n"
+            "  \"yes\": true, \"no\": false, \"nothing\": null,\n"
+            "  \"item\": [ { \"id\": 1 }, { \"id\": 2 }, ],\n"
+            "}}";
+
+        const auto tree = serializer.loadFromString(json);
+        expect(tree.hasType(Identifier("test")));
+        expectEquals(tree.getProperty("text").toString(),
+            String::fromUTF8("quote \" slash \\ tab \t unicode \xc3\xa9 \xc3\xa9 long enough to be scanned"));
+        expectEquals(tree.getProperty("single").toString(), String("single quoted"));
+        expect(tree.getProperty("int").isInt());
+        expectEquals(int(tree.getProperty("int")), -42);
+        expect(tree.getProperty("int64").isInt64());
+        expectEquals(int64(tree.getProperty("int64")), int64(8589934592));
+        expectEquals(double(tree.getProperty("double")), 150.0);
+        expect(bool(tree.getProperty("yes")));
+        expect(!bool(tree.getProperty("no")));
+        expect(!tree.hasProperty("nothing"));
+        expectEquals(tree.getNumChildren(), 2);
+        expectEquals(int(tree.getChild(1).getProperty("id")), 2);
+
+        expect(!serializer.loadFromString("{ \"test\": { \"text\": \"unterminated } }").isValid());
+        expect(!serializer.loadFromString("{ \"test\": { \"\": 1 } }").isValid());
+        expect(!serializer.loadFromString("{ \"test\": { \"int\": 12x } }").isValid());
+
+        beginTest("Json parser is faster than the generic one");
+
+        const auto project = makeProject(50000);
+        String text;
+        expect(serializer.saveToString(text, project).wasOk());
+        const auto numMegabytes = double(text.getNumBytesAsUTF8()) / (1024.0 * 1024.0);
+
+        static constexpr auto numLoads = 5;
+
+        SerializedData loaded;
+        auto startTime = Time::getMillisecondCounterHiRes();
+        for (int i = 0; i < numLoads; ++i)
+        {
+            loaded = serializer.loadFromString(text);
+        }
+
+        const auto parserTime = (Time::getMillisecondCounterHiRes() - startTime) / numLoads;
+        expect(loaded.isEquivalentTo(project));
+
+        // juce's parser is what this one was initially based on,
+        // it decodes each character and builds a var instead of a tree
+        var genericResult;
+        startTime = Time::getMillisecondCounterHiRes();
+        for (int i = 0; i < numLoads; ++i)
+        {
+            genericResult = JSON::parse(text);
+        }
+
+        const auto genericTime = (Time::getMillisecondCounterHiRes() - startTime) / numLoads;
+        expect(genericResult.isObject());
+
+        TemporaryFile file(".json");
+        expect(file.getFile().replaceWithText(text));
+
+        startTime = Time::getMillisecondCounterHiRes();
+        for (int i = 0; i < numLoads; ++i)
+        {
+            loaded = serializer.loadFromFile(file.getFile());
+        }
+
+        const auto mappedFileTime = (Time::getMillisecondCounterHiRes() - startTime) / numLoads;
+        expect(loaded.isEquivalentTo(project));
+
+        logMessage("Json: " + File::descriptionOfSizeInBytes(text.getNumBytesAsUTF8()));
+        logMessage("Parsed from string at " + getThroughput(numMegabytes, parserTime));
+        logMessage("Parsed from mapped file at " + getThroughput(numMegabytes, mappedFileTime));
+        logMessage("Parsed by JSON::parse at " + getThroughput(numMegabytes, genericTime));
+
+        beginTest("Json parser is thread-safe");
+
+        static constexpr auto numTasks = 8;
+        Array<SerializedData> results;
+        results.resize(numTasks);
+
+        RenderWorkerPool workers(RenderWorkerPool::getOptimalNumWorkers(numTasks));
+        workers.runAndWait(numTasks, [&](int i)
+        {
+            results.getReference(i) = i % 2 == 0 ?
+                serializer.loadFromString(text) :
+                serializer.loadFromFile(file.getFile());
+        });
+
+        for (const auto &result : results)
+        {
+            expect(result.isEquivalentTo(project));
+        }
+    }
+
+private:
+
+    static String getThroughput(double numMegabytes, double timeMs)
+    {
+        return String(numMegabytes / jmax(0.001, timeMs / 1000.0), 1) +
+            " MB/s (" + String(timeMs, 2) + "ms)";
+    }
+
+    // only ints and strings, which survive the round trip exactly
+    static SerializedData makeProject(int numNotes)
+    {
+        using namespace Serialization;
+        Random random(42);
+
+        SerializedData project(Core::project);
+        project.setProperty(Core::projectId, "Json \"benchmark\"");
+
+        SerializedData track(Midi::track);
+        for (int i = 0; i < numNotes; ++i)
+        {
+            SerializedData note(Midi::note);
+            note.setProperty(Midi::id, String::toHexString(i % 0xffff));
+            note.setProperty(Midi::key, random.nextInt(128));
+            note.setProperty(Midi::timestamp, i * 8);
+            note.setProperty(Midi::length, 8 + random.nextInt(64));
+            note.setProperty(Midi::volume, random.nextInt(1024));
+            track.appendChild(note);
+        }
+
+        project.appendChild(track);
+        return project;
+    }
+};
+
+static JsonSerializerTests jsonSerializerTests;
+
+#endif
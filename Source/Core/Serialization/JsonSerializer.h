@@ -29,6 +29,7 @@ public:
 
     Result saveToFile(File file, const SerializedData &tree) const override;
     SerializedData loadFromFile(const File &file) const override;
+    UniquePointer<SerializedDataReader> createReader(const File &file) const override;
 
     Result saveToString(String &string, const SerializedData &tree) const override;
     SerializedData loadFromString(const String &string) const override;
@@ -196,6 +196,8 @@ namespace Serialization
         static const Identifier lastUsedFont = "lastUsedFont";
         static const Identifier lastSearch = "lastSearch";
 
+        static const Identifier renderBlockSize = "renderBlockSize";
+
         // obsolete, to be removed in future versions (moved to global ui flags):
         static const Identifier nativeTitleBar = "nativeTitleBar";
         static const Identifier openGLState = "openGL";
@@ -400,6 +402,7 @@ namespace Serialization
         static const Identifier revision = "revision";
         static const Identifier head = "head";
         static const Identifier snapshot = "snapshot";
+        static const Identifier snapshotRevisionId = "revisionId";
         static const Identifier headRevisionId = "headRevisionId";
         static const Identifier commitMessage = "message";
         static const Identifier commitTimeStamp = "date";
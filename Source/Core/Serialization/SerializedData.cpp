@@ -395,8 +395,9 @@ inline static Identifier readIdentifier(InputStream &input)
     // avoid re-allocating a buffer *every* time we read an object or property type
     // (using JUCE's readString() on deserialization sucks really hard);
     // also preallocated size of 32 should be enough for all identifiers I ever use,
-    // and for all string values var::readFromStream() will be called, but far less frequently 
-    static MemoryOutputStream buffer(32);
+    // and for all string values var::readFromStream() will be called, but far less frequently;
+    // one buffer per thread, since the resources are loaded in parallel
+    static thread_local MemoryOutputStream buffer(32);
     buffer.reset();
 
     for (;;)
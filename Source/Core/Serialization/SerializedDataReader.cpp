@@ -0,0 +1,517 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "SerializedDataReader.h"
+
+#if JUCE_UNIT_TESTS
+#   include "BinarySerializer.h"
+#   include "JsonSerializer.h"
+#   include "XmlSerializer.h"
+#   include "TreeNodeSerializer.h"
+#   include "TrackGroupNode.h"
+#   include "PianoTrackNode.h"
+#   include "PianoSequence.h"
+#   include "AutomationTrackNode.h"
+#   include "AutomationSequence.h"
+#   include "Pattern.h"
+#endif
+
+bool SerializedDataReader::nextProperty()
+{
+    for (;;)
+    {
+        switch (this->next())
+        {
+        case Event::Property:
+            return true;
+        case Event::NodeStart:
+            if (!this->skipNode())
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+}
+
+bool SerializedDataReader::nextChild()
+{
+    for (;;)
+    {
+        switch (this->next())
+        {
+        case Event::NodeStart:
+            return true;
+        case Event::Property:
+            break;
+        default:
+            return false;
+        }
+    }
+}
+
+SerializedData SerializedDataReader::readNode()
+{
+    SerializedData node(this->name);
+
+    for (;;)
+    {
+        switch (this->next())
+        {
+        case Event::Property:
+            node.setProperty(this->name, this->value);
+            break;
+        case Event::NodeStart:
+        {
+            const auto child = this->readNode();
+            if (!child.isValid())
+            {
+                return {};
+            }
+
+            node.appendChild(child);
+            break;
+        }
+        case Event::NodeEnd:
+            return node;
+        default:
+            jassertfalse; // unexpected end of data
+            return {};
+        }
+    }
+}
+
+bool SerializedDataReader::skipNode()
+{
+    const auto nodeDepth = this->depth;
+
+    for (;;)
+    {
+        switch (this->next())
+        {
+        case Event::NodeEnd:
+            if (this->depth < nodeDepth)
+            {
+                return true;
+            }
+            break;
+        case Event::EndOfData:
+        case Event::Error:
+            return false;
+        default:
+            break;
+        }
+    }
+}
+
+SerializedData SerializedDataReader::readTree()
+{
+    jassert(this->depth == 0);
+    if (this->next() == Event::NodeStart)
+    {
+        return this->readNode();
+    }
+
+    return {};
+}
+
+//===----------------------------------------------------------------------===//
+// SerializedDataTreeReader
+//===----------------------------------------------------------------------===//
+
+SerializedDataTreeReader::SerializedDataTreeReader(const SerializedData &tree) :
+    root(tree) {}
+
+SerializedDataReader::Event SerializedDataTreeReader::next()
+{
+    if (this->stack.isEmpty())
+    {
+        if (this->hasStarted || !this->root.isValid())
+        {
+            return Event::EndOfData;
+        }
+
+        this->hasStarted = true;
+        this->stack.add({ this->root });
+        this->name = this->root.getType();
+        this->depth = 1;
+        return Event::NodeStart;
+    }
+
+    auto &position = this->stack.getReference(this->stack.size() - 1);
+
+    if (position.nextProperty < position.node.getNumProperties())
+    {
+        this->name = position.node.getPropertyName(position.nextProperty++);
+        this->value = position.node.getProperty(this->name);
+        return Event::Property;
+    }
+
+    if (position.nextChild < position.node.getNumChildren())
+    {
+        const auto child = position.node.getChild(position.nextChild++);
+        this->stack.add({ child }); // invalidates the position reference
+        this->name = child.getType();
+        this->depth = this->stack.size();
+        return Event::NodeStart;
+    }
+
+    this->stack.removeLast();
+    this->depth = this->stack.size();
+    return Event::NodeEnd;
+}
+
+#if JUCE_UNIT_TESTS
+
+class SerializedDataReaderTests final : public UnitTest
+{
+public:
+    SerializedDataReaderTests() : UnitTest("Serialized data reader tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        const auto track = makeTrack(1000);
+        TemporaryFile file;
+
+        beginTest("Binary readers produce the same trees as the binary serializer");
+
+        {
+            const BinarySerializer serializer(BinarySerializer::Format::Helio3);
+            expect(serializer.saveToFile(file.getFile(), track).wasOk());
+            expectReadsSameTree(serializer, file.getFile());
+            expect(serializer.createReader(file.getFile())->readTree().isEquivalentTo(track));
+
+            {
+                FileOutputStream stream(file.getFile());
+                stream.setPosition(0);
+                stream.truncate();
+                stream.writeInt64(ByteOrder::littleEndianInt64("Helio2::"));
+                track.writeToStream(stream);
+            }
+
+            expectReadsSameTree(serializer, file.getFile());
+            expect(serializer.createReader(file.getFile())->readTree().isEquivalentTo(track));
+        }
+
+        beginTest("Json reader produces the same trees as the json serializer");
+
+        {
+            const JsonSerializer serializer;
+            expect(serializer.saveToFile(file.getFile(), track).wasOk());
+            expectReadsSameTree(serializer, file.getFile());
+        }
+
+        beginTest("Xml reader produces the same trees as the xml serializer");
+
+        {
+            const XmlSerializer serializer;
+            expect(serializer.saveToFile(file.getFile(), track).wasOk());
+            expectReadsSameTree(serializer, file.getFile());
+        }
+
+        beginTest("Streaming the notes straight into the sequence");
+
+        {
+            static constexpr auto numNotes = 50000;
+
+            const BinarySerializer serializer(BinarySerializer::Format::Helio3);
+            expect(serializer.saveToFile(file.getFile(), makeTrack(numNotes)).wasOk());
+
+            PianoTrackNode treeTrack("");
+            auto startTime = Time::getMillisecondCounterHiRes();
+            treeTrack.getSequence()->deserialize(serializer.loadFromFile(file.getFile()));
+            const auto treeTime = Time::getMillisecondCounterHiRes() - startTime;
+
+            PianoTrackNode streamTrack("");
+            startTime = Time::getMillisecondCounterHiRes();
+            auto reader = serializer.createReader(file.getFile());
+            expect(reader->next() == SerializedDataReader::Event::NodeStart);
+            streamTrack.getSequence()->deserializeFromStream(*reader);
+            const auto streamTime = Time::getMillisecondCounterHiRes() - startTime;
+
+            expectEquals(streamTrack.getSequence()->size(), numNotes);
+            expect(streamTrack.getSequence()->serialize()
+                .isEquivalentTo(treeTrack.getSequence()->serialize()));
+
+            logMessage("Loading " + String(numNotes) + " notes via the tree: " +
+                String(treeTime, 2) + "ms, streaming: " + String(streamTime, 2) + "ms");
+        }
+
+        beginTest("Loading a project through the reader is the same as via the tree");
+
+        {
+            const auto project = makeProject();
+
+            const BinarySerializer binarySerializer(BinarySerializer::Format::Helio3);
+            expect(binarySerializer.saveToFile(file.getFile(), project).wasOk());
+            expectLoadsSameProject(binarySerializer, file.getFile(), true);
+
+            const XmlSerializer xmlSerializer;
+            expect(xmlSerializer.saveToFile(file.getFile(), project).wasOk());
+            expectLoadsSameProject(xmlSerializer, file.getFile(), true);
+
+            // json groups the children by type, so the tree nodes might not go last
+            const JsonSerializer jsonSerializer;
+            expect(jsonSerializer.saveToFile(file.getFile(), project).wasOk());
+            expectLoadsSameProject(jsonSerializer, file.getFile(), false);
+        }
+    }
+
+private:
+
+    void expectReadsSameTree(const Serializer &serializer, const File &file)
+    {
+        const auto expected = serializer.loadFromFile(file);
+        expect(expected.isValid());
+
+        auto reader = serializer.createReader(file);
+        expect(reader != nullptr);
+        if (reader != nullptr)
+        {
+            expect(reader->readTree().isEquivalentTo(expected));
+            expect(reader->next() == SerializedDataReader::Event::EndOfData);
+        }
+    }
+
+    // mimics ProjectNode::load for both the tree and the reader, with a track group
+    // standing in for the project node, which can't be created without the workspace;
+    // note that the version control node won't restore its history without a project,
+    // so this only checks that the reader gets past it and loads the rest correctly
+    void expectLoadsSameProject(const Serializer &serializer,
+        const File &file, bool keepsChildrenOrder)
+    {
+        using namespace Serialization;
+
+        const auto tree = serializer.loadFromFile(file);
+        expect(tree.hasType(Core::project));
+
+        TrackGroupNode treeProject("");
+        TreeNodeSerializer::deserializeChildren(treeProject, tree);
+
+        TrackGroupNode streamProject("");
+        Array<SerializedData> loadedData;
+        auto reader = serializer.createReader(file);
+        expect(reader->next() == SerializedDataReader::Event::NodeStart);
+        const auto root = TreeNodeSerializer::deserializeChildren(streamProject, *reader,
+            Core::project, [&loadedData](const SerializedData &data)
+        {
+            loadedData.add(data.createCopy());
+        });
+
+        expect(reader->next() == SerializedDataReader::Event::EndOfData);
+
+        // everything but the tree nodes is collected for the project itself
+        SerializedData expectedRoot(Core::project);
+        for (int i = 0; i < tree.getNumProperties(); ++i)
+        {
+            const auto name = tree.getPropertyName(i);
+            expectedRoot.setProperty(name, tree.getProperty(name));
+        }
+
+        for (const auto child : tree)
+        {
+            if (!child.hasType(Core::treeNode))
+            {
+                expectedRoot.appendChild(child.createCopy());
+            }
+        }
+
+        expect(root.isEquivalentTo(expectedRoot));
+
+        // the project's own data is loaded before any tracks, when the format allows,
+        // since the tracks need the timeline by then; otherwise, it's reloaded in the end
+        expect(!loadedData.isEmpty());
+        expect(loadedData.getLast().isEquivalentTo(expectedRoot));
+        if (keepsChildrenOrder)
+        {
+            expectEquals(loadedData.size(), 1);
+            expect(loadedData.getFirst().getChildWithName(Core::projectTimeline).isValid());
+        }
+
+        SerializedData treeNodes(Core::project);
+        TreeNodeSerializer::serializeChildren(treeProject, treeNodes);
+
+        SerializedData streamNodes(Core::project);
+        TreeNodeSerializer::serializeChildren(streamProject, streamNodes);
+
+        expectEquals(streamProject.getNumChildren(), 4);
+        expect(streamNodes.isEquivalentTo(treeNodes));
+
+        const auto pianoTracks = streamProject.findChildrenOfType<PianoTrackNode>();
+        expectEquals(pianoTracks.size(), 1);
+        if (!pianoTracks.isEmpty())
+        {
+            expectEquals(pianoTracks.getFirst()->getSequence()->size(), numProjectNotes);
+            expectEquals(pianoTracks.getFirst()->getPattern()->size(), numProjectClips);
+        }
+
+        const auto automationTracks = streamProject.findChildrenOfType<AutomationTrackNode>();
+        expectEquals(automationTracks.size(), 1);
+        if (!automationTracks.isEmpty())
+        {
+            expectEquals(automationTracks.getFirst()->getSequence()->size(), numProjectNotes);
+            expectEquals(automationTracks.getFirst()->getPattern()->size(), numProjectClips);
+        }
+    }
+
+    static constexpr auto numProjectNotes = 500;
+    static constexpr auto numProjectClips = 4;
+
+    // laid out like ProjectNode::save: the properties, the project's own data,
+    // and then the tree nodes, i.e. the version control, the patterns and the tracks
+    static SerializedData makeProject()
+    {
+        using namespace Serialization;
+
+        SerializedData project(Core::project);
+        project.setProperty(Core::treeNodeName, "project");
+        project.setProperty(Core::projectId, "projectId");
+        project.setProperty(UI::trackGrouping, 1);
+
+        SerializedData timeline(Core::projectTimeline);
+        timeline.setProperty(Core::annotationsTrackId, "annotations");
+        SerializedData annotations(Midi::annotations);
+        SerializedData annotation(Midi::annotation);
+        annotation.setProperty(Midi::text, "intro");
+        annotations.appendChild(annotation);
+        timeline.appendChild(annotations);
+        project.appendChild(timeline);
+
+        project.appendChild(SerializedData(Audio::transport));
+
+        PianoTrackNode pianoTrack("piano");
+        {
+            auto *pattern = pianoTrack.getPattern();
+            for (int i = 0; i < numProjectClips; ++i)
+            {
+                pattern->insert(Clip(pattern, float(i * 16), i), false);
+            }
+
+            auto *sequence = static_cast<PianoSequence *>(pianoTrack.getSequence());
+            Array<Note> notes;
+            for (int i = 0; i < numProjectNotes; ++i)
+            {
+                notes.add(Note(sequence, i % 128, float(i) * 0.5f, 0.5f, 0.75f));
+            }
+
+            sequence->insertGroup(notes, false);
+        }
+
+        AutomationTrackNode automationTrack("automation");
+        {
+            auto *pattern = automationTrack.getPattern();
+            for (int i = 0; i < numProjectClips; ++i)
+            {
+                pattern->insert(Clip(pattern, float(i * 16)), false);
+            }
+
+            auto *sequence = static_cast<AutomationSequence *>(automationTrack.getSequence());
+            Array<AutomationEvent> events;
+            for (int i = 0; i < numProjectNotes; ++i)
+            {
+                events.add(AutomationEvent(sequence, float(i), float(i % 2)));
+            }
+
+            sequence->insertGroup(events, false);
+        }
+
+        // the history, as the version control node would have saved it
+        SerializedData versionControlNode(Core::treeNode);
+        versionControlNode.setProperty(Core::treeNodeType, Core::versionControl.toString());
+        SerializedData vcs(Core::versionControl);
+        SerializedData revision(VCS::revision);
+        revision.setProperty(VCS::commitMessage, "initial");
+        SerializedData revisionItem(VCS::revisionItem);
+        revisionItem.setProperty(VCS::revisionItemName, "piano");
+        SerializedData delta(VCS::delta);
+        delta.appendChild(pianoTrack.getSequence()->serialize());
+        revisionItem.appendChild(delta);
+        revision.appendChild(revisionItem);
+        vcs.appendChild(revision);
+        versionControlNode.appendChild(vcs);
+        project.appendChild(versionControlNode);
+
+        SerializedData patternSetNode(Core::treeNode);
+        patternSetNode.setProperty(Core::treeNodeType, Core::patternSet.toString());
+        project.appendChild(patternSetNode);
+
+        SerializedData trackGroupNode(Core::treeNode);
+        trackGroupNode.setProperty(Core::treeNodeType, Core::trackGroup.toString());
+        trackGroupNode.setProperty(Core::treeNodeName, "group");
+        trackGroupNode.appendChild(pianoTrack.serialize());
+        project.appendChild(trackGroupNode);
+
+        project.appendChild(automationTrack.serialize());
+
+        return project;
+    }
+
+    static SerializedData makeTrack(int numNotes)
+    {
+        using namespace Serialization;
+        Random random(42);
+
+        SerializedData track(Midi::track);
+        track.setProperty(Midi::text, "track");
+        track.setProperty(Midi::mute, true);
+
+        for (int i = 0; i < numNotes; ++i)
+        {
+            SerializedData note(Midi::note);
+            note.setProperty(Midi::id, makeId(i));
+            note.setProperty(Midi::key, random.nextInt(128));
+            note.setProperty(Midi::timestamp, i * 8);
+            note.setProperty(Midi::length, 8 + random.nextInt(64));
+            note.setProperty(Midi::volume, random.nextInt(1024));
+            if (i % 100 == 0)
+            {
+                note.setProperty(Midi::tuplet, 3);
+            }
+
+            track.appendChild(note);
+        }
+
+        SerializedData annotation(Midi::annotation);
+        annotation.setProperty(Midi::text, "a node which is not a note");
+        annotation.appendChild(SerializedData(Midi::note));
+        track.appendChild(annotation);
+
+        return track;
+    }
+
+    // unique ids made of the valid id characters, like the sequences generate
+    static String makeId(int index)
+    {
+        static const char idChars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+        String id;
+        for (int i = 0; i < 3; ++i)
+        {
+            id << idChars[index % 62];
+            index /= 62;
+        }
+
+        return id;
+    }
+};
+
+static SerializedDataReaderTests serializedDataReaderTests;
+
+#endif
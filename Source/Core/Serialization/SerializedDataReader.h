@@ -0,0 +1,102 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// A pull-style reader over a serialized tree, which lets the models
+// build themselves straight from the file, without creating the whole
+// SerializedData tree first; the events come in the document order:
+// the node start, its properties, its children, and then the node end
+// (the binary formats keep the properties before the children,
+// and the json reader reports them in the order they appear in the file)
+
+class SerializedDataReader
+{
+public:
+
+    virtual ~SerializedDataReader() = default;
+
+    enum class Event : int8
+    {
+        NodeStart,
+        Property,
+        NodeEnd,
+        EndOfData,
+        Error
+    };
+
+    virtual Event next() = 0;
+
+    // the node type after NodeStart, or the property name after Property
+    inline const Identifier &getName() const noexcept { return this->name; }
+
+    // the property value after Property
+    inline const var &getValue() const noexcept { return this->value; }
+
+    // the number of the nodes started and not yet ended, 1 for the root
+    inline int getDepth() const noexcept { return this->depth; }
+
+    // moves to the next property of the current node, skipping its children,
+    // returns false at the end of the node, or if anything goes wrong
+    bool nextProperty();
+
+    // moves to the start of the next child of the current node, skipping its properties,
+    // returns false at the end of the node, or if anything goes wrong
+    bool nextChild();
+
+    // after NodeStart, reads the node with all its children into a tree,
+    // returns an invalid tree if the data is broken
+    SerializedData readNode();
+
+    // after NodeStart, skips everything up to the end of the node
+    bool skipNode();
+
+    // reads the root node, if nothing has been read yet
+    SerializedData readTree();
+
+protected:
+
+    Identifier name;
+    var value;
+    int depth = 0;
+
+};
+
+// Walks the existing tree, for the formats which are not streamed
+class SerializedDataTreeReader final : public SerializedDataReader
+{
+public:
+
+    explicit SerializedDataTreeReader(const SerializedData &tree);
+
+    Event next() override;
+
+private:
+
+    struct Position final
+    {
+        SerializedData node;
+        int nextProperty = 0;
+        int nextChild = 0;
+    };
+
+    SerializedData root;
+    Array<Position> stack;
+    bool hasStarted = false;
+
+    JUCE_DECLARE_NON_COPYABLE(SerializedDataTreeReader)
+};
@@ -19,6 +19,7 @@
 
 class Serializable;
 class SerializedData;
+class SerializedDataReader;
 
 class Serializer
 {
@@ -29,6 +30,10 @@ public:
     virtual Result saveToFile(File file, const SerializedData &tree) const = 0;
     virtual SerializedData loadFromFile(const File &file) const = 0;
 
+    // for reading the large documents straight into the models,
+    // see SerializedDataReader; returns nullptr if the file is not supported
+    virtual UniquePointer<SerializedDataReader> createReader(const File &file) const = 0;
+
     virtual Result saveToString(String &string, const SerializedData &tree) const = 0;
     virtual SerializedData loadFromString(const String &string) const = 0;
 
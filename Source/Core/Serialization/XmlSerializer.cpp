@@ -17,6 +17,7 @@
 
 #include "Common.h"
 #include "XmlSerializer.h"
+#include "SerializedDataReader.h"
 
 static const String xmlEncoding = "UTF-8";
 
@@ -53,6 +54,17 @@ SerializedData XmlSerializer::loadFromFile(const File &file) const
     return {};
 }
 
+UniquePointer<SerializedDataReader> XmlSerializer::createReader(const File &file) const
+{
+    const auto tree = this->loadFromFile(file);
+    if (tree.isValid())
+    {
+        return make<SerializedDataTreeReader>(tree);
+    }
+
+    return nullptr;
+}
+
 Result XmlSerializer::saveToString(String &string, const SerializedData &tree) const
 {
     UniquePointer<XmlElement> xml(tree.writeToXml());
@@ -19,6 +19,7 @@
 #include "AutomationTrackNode.h"
 #include "AutomationSequence.h"
 #include "TreeNodeSerializer.h"
+#include "SerializedDataReader.h"
 #include "Icons.h"
 #include "Pattern.h"
 
@@ -203,6 +204,24 @@ void AutomationTrackNode::deserialize(const SerializedData &data)
     TreeNode::deserialize(data);
 }
 
+// the events are the bulk of the project, so they don't need
+// to be read into a tree first; deserialize() then skips them
+bool AutomationTrackNode::deserializeChildFromStream(SerializedDataReader &reader)
+{
+    if (reader.getName() == Serialization::Midi::automation)
+    {
+        this->sequence->deserializeFromStream(reader);
+        return true;
+    }
+    else if (reader.getName() == Serialization::Midi::pattern)
+    {
+        this->pattern->deserializeFromStream(reader);
+        return true;
+    }
+
+    return false;
+}
+
 
 //===----------------------------------------------------------------------===//
 // Deltas
@@ -82,6 +82,11 @@ public:
     void dispatchRemoveEvent(const MidiEvent &event) override;
     void dispatchPostRemoveEvent(MidiSequence *const layer) override;
 
+    void dispatchAddEvents(const Array<const MidiEvent *> &events) override;
+    void dispatchChangeEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents) override;
+    void dispatchRemoveEvents(const Array<const MidiEvent *> &events) override;
+
     void dispatchAddClip(const Clip &clip) override;
     void dispatchChangeClip(const Clip &oldClip, const Clip &newClip) override;
     void dispatchRemoveClip(const Clip &clip) override;
@@ -20,6 +20,7 @@
 #include "PianoSequence.h"
 #include "ProjectNode.h"
 #include "TreeNodeSerializer.h"
+#include "SerializedDataReader.h"
 #include "Icons.h"
 #include "Pattern.h"
 #include "MainLayout.h"
@@ -202,6 +203,24 @@ void PianoTrackNode::deserialize(const SerializedData &data)
     TreeNode::deserialize(data);
 }
 
+// the events are the bulk of the project, so they don't need
+// to be read into a tree first; deserialize() then skips them
+bool PianoTrackNode::deserializeChildFromStream(SerializedDataReader &reader)
+{
+    if (reader.getName() == Serialization::Midi::track)
+    {
+        this->sequence->deserializeFromStream(reader);
+        return true;
+    }
+    else if (reader.getName() == Serialization::Midi::pattern)
+    {
+        this->pattern->deserializeFromStream(reader);
+        return true;
+    }
+
+    return false;
+}
+
 
 //===----------------------------------------------------------------------===//
 // Deltas
@@ -44,6 +44,7 @@ public:
 
     SerializedData serialize() const override;
     void deserialize(const SerializedData &data) override;
+    bool deserializeChildFromStream(SerializedDataReader &reader) override;
 
     //===------------------------------------------------------------------===//
     // Deltas
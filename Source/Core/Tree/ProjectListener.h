@@ -36,6 +36,36 @@ public:
     virtual void onRemoveMidiEvent(const MidiEvent &event) = 0;
     virtual void onPostRemoveMidiEvent(MidiSequence *const layer) {}
 
+    // Group edits, like quantizing or transposing the selection, are sent
+    // once for the whole group, and all its events belong to the same sequence;
+    // by default, these just fall back to the single-event callbacks,
+    // the listeners doing something costly on each change should override them
+    virtual void onAddMidiEvents(const Array<const MidiEvent *> &events)
+    {
+        for (const auto *event : events)
+        {
+            this->onAddMidiEvent(*event);
+        }
+    }
+
+    virtual void onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents)
+    {
+        jassert(oldEvents.size() == newEvents.size());
+        for (int i = 0; i < oldEvents.size(); ++i)
+        {
+            this->onChangeMidiEvent(*oldEvents.getUnchecked(i), *newEvents.getUnchecked(i));
+        }
+    }
+
+    virtual void onRemoveMidiEvents(const Array<const MidiEvent *> &events)
+    {
+        for (const auto *event : events)
+        {
+            this->onRemoveMidiEvent(*event);
+        }
+    }
+
     virtual void onAddClip(const Clip &clip) = 0;
     virtual void onChangeClip(const Clip &oldClip, const Clip &newClip) = 0;
     virtual void onRemoveClip(const Clip &clip) = 0;
@@ -19,6 +19,7 @@
 #include "ProjectNode.h"
 
 #include "TreeNodeSerializer.h"
+#include "SerializedDataReader.h"
 #include "TrackGroupNode.h"
 #include "PianoTrackNode.h"
 #include "AutomationTrackNode.h"
@@ -559,17 +560,62 @@ void ProjectNode::load(const SerializedData &tree)
 
     if (!root.isValid()) { return; }
 
+    this->loadProperties(root);
+    TreeNodeSerializer::deserializeChildren(*this, root);
+    this->onLoaded(root);
+}
+
+// The tree nodes, which are the bulk of the project, go after everything else,
+// so the rest is collected into a tree, and the tree nodes are read straight
+// into the new child nodes, without building the whole project tree first
+bool ProjectNode::load(SerializedDataReader &reader)
+{
+    using Event = SerializedDataReader::Event;
+
+    if (reader.next() != Event::NodeStart)
+    {
+        return false;
+    }
+
+    if (reader.getName() != Serialization::Core::project)
+    {
+        const auto tree = reader.readNode();
+        if (!tree.isValid())
+        {
+            return false;
+        }
+
+        this->load(tree);
+        return true;
+    }
+
+    this->broadcastBeforeReloadProjectContent();
+    this->reset();
+
+    const auto root = TreeNodeSerializer::deserializeChildren(*this, reader,
+        Serialization::Core::project, [this](const SerializedData &data)
+    {
+        this->loadProperties(data);
+    });
+
+    this->onLoaded(root);
+    return true;
+}
+
+void ProjectNode::loadProperties(const SerializedData &root)
+{
     this->id = root.getProperty(Serialization::Core::projectId, Uuid().toString());
-    
+    this->name = root.getProperty(Serialization::Core::treeNodeName);
+
     const auto grouping = root.getProperty(Serialization::UI::trackGrouping, int(this->trackGroupingMode));
     this->trackGroupingMode = MidiTrack::Grouping(int(grouping));
 
     this->metadata->deserialize(root);
     this->timeline->deserialize(root);
+}
 
-    // Proceed with basic properties and children
-    TreeNode::deserialize(root);
-
+void ProjectNode::onLoaded(const SerializedData &root)
+{
     // Legacy support: if no pattern set manager found, create one
     if (nullptr == this->findChildOfType<PatternEditorNode>())
     {
@@ -725,6 +771,8 @@ void ProjectNode::broadcastChangeEvent(const MidiEvent &oldEvent, const MidiEven
 {
     //jassert(oldEvent.isValid()); // old event is allowed to be un-owned
     jassert(newEvent.isValid());
+    newEvent.getSequence()->markChanged();
+    this->markVCSItemChanged(newEvent.getSequence()->getTrack());
     this->changeListeners.call(&ProjectListener::onChangeMidiEvent, oldEvent, newEvent);
     this->sendChangeMessage();
 }
@@ -732,6 +780,8 @@ void ProjectNode::broadcastChangeEvent(const MidiEvent &oldEvent, const MidiEven
 void ProjectNode::broadcastAddEvent(const MidiEvent &event)
 {
     jassert(event.isValid());
+    event.getSequence()->markChanged();
+    this->markVCSItemChanged(event.getSequence()->getTrack());
     this->changeListeners.call(&ProjectListener::onAddMidiEvent, event);
     this->sendChangeMessage();
 }
@@ -739,16 +789,67 @@ void ProjectNode::broadcastAddEvent(const MidiEvent &event)
 void ProjectNode::broadcastRemoveEvent(const MidiEvent &event)
 {
     jassert(event.isValid());
+    event.getSequence()->markChanged();
+    this->markVCSItemChanged(event.getSequence()->getTrack());
     this->changeListeners.call(&ProjectListener::onRemoveMidiEvent, event);
     this->sendChangeMessage();
 }
 
 void ProjectNode::broadcastPostRemoveEvent(MidiSequence *const layer)
 {
+    layer->markChanged();
+    this->markVCSItemChanged(layer->getTrack());
     this->changeListeners.call(&ProjectListener::onPostRemoveMidiEvent, layer);
     this->sendChangeMessage();
 }
 
+// all events of a group belong to the same track,
+// so it is marked as changed once, and the listeners are called once
+
+void ProjectNode::broadcastAddEvents(const Array<const MidiEvent *> &events)
+{
+    if (events.isEmpty())
+    {
+        return;
+    }
+
+    jassert(events.getFirst()->isValid());
+    events.getFirst()->getSequence()->markChanged();
+    this->markVCSItemChanged(events.getFirst()->getSequence()->getTrack());
+    this->changeListeners.call(&ProjectListener::onAddMidiEvents, events);
+    this->sendChangeMessage();
+}
+
+void ProjectNode::broadcastChangeEvents(const Array<const MidiEvent *> &oldEvents,
+    const Array<const MidiEvent *> &newEvents)
+{
+    jassert(oldEvents.size() == newEvents.size());
+    if (newEvents.isEmpty())
+    {
+        return;
+    }
+
+    jassert(newEvents.getFirst()->isValid());
+    newEvents.getFirst()->getSequence()->markChanged();
+    this->markVCSItemChanged(newEvents.getFirst()->getSequence()->getTrack());
+    this->changeListeners.call(&ProjectListener::onChangeMidiEvents, oldEvents, newEvents);
+    this->sendChangeMessage();
+}
+
+void ProjectNode::broadcastRemoveEvents(const Array<const MidiEvent *> &events)
+{
+    if (events.isEmpty())
+    {
+        return;
+    }
+
+    jassert(events.getFirst()->isValid());
+    events.getFirst()->getSequence()->markChanged();
+    this->markVCSItemChanged(events.getFirst()->getSequence()->getTrack());
+    this->changeListeners.call(&ProjectListener::onRemoveMidiEvents, events);
+    this->sendChangeMessage();
+}
+
 void ProjectNode::broadcastAddTrack(MidiTrack *const track)
 {
     this->isTracksCacheOutdated = true;
@@ -757,6 +858,7 @@ void ProjectNode::broadcastAddTrack(MidiTrack *const track)
     {
         const ScopedWriteLock lock(this->vcsInfoLock);
         this->vcsItems.addIfNotAlreadyThere(tracked);
+        tracked->markVCSChanged();
     }
 
     this->changeListeners.call(&ProjectListener::onAddTrack, track);
@@ -779,6 +881,7 @@ void ProjectNode::broadcastRemoveTrack(MidiTrack *const track)
 
 void ProjectNode::broadcastChangeTrackProperties(MidiTrack *const track)
 {
+    this->markVCSItemChanged(track);
     this->changeListeners.call(&ProjectListener::onChangeTrackProperties, track);
     this->sendChangeMessage();
 }
@@ -791,30 +894,35 @@ void ProjectNode::broadcastChangeTrackBeatRange(MidiTrack *const track)
 
 void ProjectNode::broadcastAddClip(const Clip &clip)
 {
+    this->markVCSItemChanged(clip.getPattern()->getTrack());
     this->changeListeners.call(&ProjectListener::onAddClip, clip);
     this->sendChangeMessage();
 }
 
 void ProjectNode::broadcastChangeClip(const Clip &oldClip, const Clip &newClip)
 {
+    this->markVCSItemChanged(newClip.getPattern()->getTrack());
     this->changeListeners.call(&ProjectListener::onChangeClip, oldClip, newClip);
     this->sendChangeMessage();
 }
 
 void ProjectNode::broadcastRemoveClip(const Clip &clip)
 {
+    this->markVCSItemChanged(clip.getPattern()->getTrack());
     this->changeListeners.call(&ProjectListener::onRemoveClip, clip);
     this->sendChangeMessage();
 }
 
 void ProjectNode::broadcastPostRemoveClip(Pattern *const pattern)
 {
+    this->markVCSItemChanged(pattern->getTrack());
     this->changeListeners.call(&ProjectListener::onPostRemoveClip, pattern);
     this->sendChangeMessage();
 }
 
 void ProjectNode::broadcastChangeProjectInfo(const ProjectMetadata *info)
 {
+    this->metadata->markVCSChanged();
     this->changeListeners.call(&ProjectListener::onChangeProjectInfo, info);
     this->sendChangeMessage();
 }
@@ -850,6 +958,17 @@ void ProjectNode::broadcastBeforeReloadProjectContent()
 
 void ProjectNode::broadcastReloadProjectContent()
 {
+    // all items might have been reset by the vcs or reloaded
+    this->markAllVCSItemsChanged();
+
+    for (auto *track : this->getTracks())
+    {
+        if (auto *sequence = track->getSequence())
+        {
+            sequence->markChanged();
+        }
+    }
+
     this->changeListeners.call(&ProjectListener::onReloadProjectContent,
         this->getTracks(), this->metadata.get());
 
@@ -872,18 +991,43 @@ void ProjectNode::broadcastChangeViewBeatRange(float firstBeat, float lastBeat)
     // this->sendChangeMessage(); the project itself didn't change, so dont call this
 }
 
+void ProjectNode::markVCSItemChanged(MidiTrack *const track)
+{
+    if (auto *tracked = dynamic_cast<VCS::TrackedItem *>(track))
+    {
+        tracked->markVCSChanged();
+    }
+    else if (track != nullptr)
+    {
+        // the timeline tracks are not tracked by themselves, the timeline is
+        this->timeline->markVCSChanged();
+    }
+    else
+    {
+        this->markAllVCSItemsChanged();
+    }
+}
+
+void ProjectNode::markAllVCSItemsChanged()
+{
+    const ScopedReadLock lock(this->vcsInfoLock);
+    for (auto *item : this->vcsItems)
+    {
+        const_cast<VCS::TrackedItem *>(item)->markVCSChanged();
+    }
+}
+
 //===----------------------------------------------------------------------===//
 // DocumentOwner
 //===----------------------------------------------------------------------===//
 
 bool ProjectNode::onDocumentLoad(const File &file)
 {
-    const auto tree = DocumentHelpers::load(file);
+    // reads the tracks straight from the file, without building the whole tree first
+    auto reader = DocumentHelpers::createReader(file);
 
-    if (tree.isValid())
+    if (reader != nullptr && this->load(*reader))
     {
-        this->load(tree);
-
         App::Workspace().getUserProfile()
             .onProjectLocalInfoUpdated(this->getId(), this->getName(),
                 this->getDocument()->getFullPath());
@@ -894,13 +1038,19 @@ bool ProjectNode::onDocumentLoad(const File &file)
     return false;
 }
 
+SerializedData ProjectNode::onDocumentSerialize() const
+{
+    return this->save();
+}
+
 bool ProjectNode::onDocumentSave(const File &file)
 {
     const auto projectNode = this->save();
 #if DEBUG
     DocumentHelpers::save<XmlSerializer>(file.withFileExtension("xml"), projectNode);
 #endif
-    return DocumentHelpers::save<BinarySerializer>(file, projectNode);
+    return DocumentHelpers::save(file, projectNode,
+        BinarySerializer(Document::getBinaryFormat()));
 }
 
 void ProjectNode::onDocumentImport(InputStream &stream)
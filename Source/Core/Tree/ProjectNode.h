@@ -32,6 +32,7 @@ class CommandPaletteTimelineEvents;
 class UndoStack;
 class Pattern;
 class Clip;
+class SerializedDataReader;
 
 #include "TreeNode.h"
 #include "DocumentOwner.h"
@@ -143,6 +144,11 @@ public:
     void broadcastRemoveEvent(const MidiEvent &event);
     void broadcastPostRemoveEvent(MidiSequence *const layer);
 
+    void broadcastAddEvents(const Array<const MidiEvent *> &events);
+    void broadcastChangeEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents);
+    void broadcastRemoveEvents(const Array<const MidiEvent *> &events);
+
     void broadcastAddTrack(MidiTrack *const track);
     void broadcastRemoveTrack(MidiTrack *const track);
     void broadcastChangeTrackProperties(MidiTrack *const track);
@@ -197,6 +203,7 @@ protected:
 
     bool onDocumentLoad(const File &file) override;
     bool onDocumentSave(const File &file) override;
+    SerializedData onDocumentSerialize() const override;
     void onDocumentImport(InputStream &stream) override;
     bool onDocumentExport(OutputStream &stream) override;
 
@@ -235,6 +242,9 @@ private:
     void initialize();
     SerializedData save() const;
     void load(const SerializedData &tree);
+    bool load(SerializedDataReader &reader);
+    void loadProperties(const SerializedData &root);
+    void onLoaded(const SerializedData &root);
 
 private:
 
@@ -243,6 +253,11 @@ private:
     ReadWriteLock vcsInfoLock;
     Array<const VCS::TrackedItem *> vcsItems;
 
+    // bump the change generations, which the vcs head
+    // uses to only rebuild the diffs of the changed items
+    void markVCSItemChanged(MidiTrack *const track);
+    void markAllVCSItemsChanged();
+
     UniquePointer<UndoStack> undoStack;
 
     MidiTrack::Grouping trackGroupingMode = MidiTrack::Grouping::GroupByName;
@@ -19,6 +19,8 @@
 
 #include "HeadlineItemDataSource.h"
 
+class SerializedDataReader;
+
 class TreeNodeBase
 {
 public:
@@ -213,6 +215,12 @@ public:
     SerializedData serialize() const override;
     void deserialize(const SerializedData &data) override;
 
+    // when loading a project, the nodes are read straight from the file,
+    // see TreeNodeSerializer::deserializeChild(); here the node can read its heavy
+    // children by itself, if the reader is at the start of such a child,
+    // and then deserialize() is called without them, so it must leave them intact
+    virtual bool deserializeChildFromStream(SerializedDataReader &reader) { return false; }
+
 protected:
 
     void dispatchChangeTreeNodeViews();
@@ -26,6 +26,7 @@
 #include "VersionControlNode.h"
 #include "PatternEditorNode.h"
 #include "SettingsNode.h"
+#include "SerializedDataReader.h"
 
 void TreeNodeSerializer::serializeChildren(const TreeNode &parentItem, SerializedData &parent)
 {
@@ -39,30 +40,172 @@ void TreeNodeSerializer::serializeChildren(const TreeNode &parentItem, Serialize
     }
 }
 
+static TreeNode *createNode(const SerializedData &data)
+{
+    using namespace Serialization;
+
+    const auto type = Identifier(data.getProperty(Core::treeNodeType));
+
+    TreeNode *child = nullptr;
+
+    if (type == Core::project)              { child = new ProjectNode(); }
+    else if (type == Core::settings)        { child = new SettingsNode(); }
+    else if (type == Core::trackGroup)      { child = new TrackGroupNode(""); }
+    else if (type == Core::pianoTrack)      { child = new PianoTrackNode(""); }
+    else if (type == Core::automationTrack) { child = new AutomationTrackNode(""); }
+    else if (type == Core::instrumentsList) { child = new OrchestraPitNode(); }
+    else if (type == Core::instrumentRoot)  { child = new InstrumentNode(); }
+    else if (type == Core::versionControl)  { child = new VersionControlNode(); }
+    else if (type == Core::patternSet)      { child = new PatternEditorNode(); }
+
+    return child;
+}
+
 void TreeNodeSerializer::deserializeChildren(TreeNode &parentItem, const SerializedData &parent)
 {
     using namespace Serialization;
 
     forEachChildWithType(parent, e, Core::treeNode)
     {
-        const auto type = Identifier(e.getProperty(Core::treeNodeType));
+        auto *child = createNode(e);
+        if (child != nullptr)
+        {
+            parentItem.addChildNode(child);
+            child->deserialize(e);
+        }
+    }
+}
+
+void TreeNodeSerializer::deserializeChild(TreeNode &parentItem, SerializedDataReader &reader)
+{
+    using namespace Serialization;
+    using Event = SerializedDataReader::Event;
+
+    SerializedData data(Core::treeNode);
+
+    TreeNode *child = nullptr;
+    bool hasCreatedChild = false;
+    bool hasDeserializedChild = false;
+
+    for (auto event = reader.next(); event != Event::NodeEnd; event = reader.next())
+    {
+        if (event == Event::Property)
+        {
+            jassert(!hasCreatedChild); // the properties go before the children
+            data.setProperty(reader.getName(), reader.getValue());
+            continue;
+        }
+        else if (event != Event::NodeStart)
+        {
+            break; // the data is broken
+        }
+
+        if (!hasCreatedChild)
+        {
+            hasCreatedChild = true;
+            child = createNode(data);
+            if (child != nullptr)
+            {
+                parentItem.addChildNode(child);
+            }
+        }
+
+        if (child == nullptr)
+        {
+            reader.skipNode();
+        }
+        else if (reader.getName() == Core::treeNode)
+        {
+            if (!hasDeserializedChild)
+            {
+                hasDeserializedChild = true;
+                child->deserialize(data);
+            }
 
-        TreeNode *child = nullptr;
+            deserializeChild(*child, reader);
+        }
+        else if (!child->deserializeChildFromStream(reader))
+        {
+            if (hasDeserializedChild)
+            {
+                jassertfalse; // the nested tree nodes are supposed to go last
+                reader.skipNode();
+                continue;
+            }
+
+            const auto node = reader.readNode();
+            if (!node.isValid())
+            {
+                break;
+            }
 
-        if (type == Core::project)              { child = new ProjectNode(); }
-        else if (type == Core::settings)        { child = new SettingsNode(); }
-        else if (type == Core::trackGroup)      { child = new TrackGroupNode(""); }
-        else if (type == Core::pianoTrack)      { child = new PianoTrackNode(""); }
-        else if (type == Core::automationTrack) { child = new AutomationTrackNode(""); }
-        else if (type == Core::instrumentsList) { child = new OrchestraPitNode(); }
-        else if (type == Core::instrumentRoot)  { child = new InstrumentNode(); }
-        else if (type == Core::versionControl)  { child = new VersionControlNode(); }
-        else if (type == Core::patternSet)      { child = new PatternEditorNode(); }
+            data.appendChild(node);
+        }
+    }
 
+    if (!hasCreatedChild)
+    {
+        child = createNode(data);
         if (child != nullptr)
         {
             parentItem.addChildNode(child);
-            child->deserialize(e);
         }
     }
+
+    if (child != nullptr && !hasDeserializedChild)
+    {
+        child->deserialize(data);
+    }
+}
+
+SerializedData TreeNodeSerializer::deserializeChildren(TreeNode &parentItem,
+    SerializedDataReader &reader, const Identifier &type, const DataCallback &loadData)
+{
+    using namespace Serialization;
+    using Event = SerializedDataReader::Event;
+
+    SerializedData data(type);
+    int numLoadedChildren = -1;
+
+    for (auto event = reader.next(); event != Event::NodeEnd; event = reader.next())
+    {
+        if (event == Event::Property)
+        {
+            data.setProperty(reader.getName(), reader.getValue());
+            continue;
+        }
+        else if (event != Event::NodeStart)
+        {
+            break; // the data is broken, but let's keep what's been read
+        }
+
+        if (reader.getName() == Core::treeNode)
+        {
+            if (numLoadedChildren < 0)
+            {
+                loadData(data);
+                numLoadedChildren = data.getNumChildren();
+            }
+
+            deserializeChild(parentItem, reader);
+        }
+        else
+        {
+            const auto node = reader.readNode();
+            if (!node.isValid())
+            {
+                break;
+            }
+
+            data.appendChild(node);
+        }
+    }
+
+    // no tree nodes at all, or the format doesn't keep the children order, like json
+    if (numLoadedChildren != data.getNumChildren())
+    {
+        loadData(data);
+    }
+
+    return data;
 }
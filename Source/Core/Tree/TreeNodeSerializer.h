@@ -18,6 +18,7 @@
 #pragma once
 
 class TreeNode;
+class SerializedDataReader;
 
 class TreeNodeSerializer
 {
@@ -25,4 +26,19 @@ public:
 
     static void serializeChildren(const TreeNode &parentItem, SerializedData &parent);
     static void deserializeChildren(TreeNode &parentItem, const SerializedData &parent);
+
+    // Reads the tree node, at which the reader is, into a new child of the given parent:
+    // its properties and children are collected into a tree as usual, except for the ones
+    // the node reads by itself (see TreeNode::deserializeChildFromStream), and the nested
+    // tree nodes, which go last, are read the same way after the node is deserialized
+    static void deserializeChild(TreeNode &parentItem, SerializedDataReader &reader);
+
+    // Reads the rest of the node, at which the reader is, the way the projects are loaded:
+    // the nested tree nodes are read into the new children of the given parent as they come,
+    // and everything else is collected into the returned tree; since the parent might need
+    // its own data to load the children, the tree is passed to loadData before the first
+    // tree node, and once again in the end, if anything else has been read after it
+    using DataCallback = Function<void(const SerializedData &data)>;
+    static SerializedData deserializeChildren(TreeNode &parentItem, SerializedDataReader &reader,
+        const Identifier &type, const DataCallback &loadData);
 };
@@ -19,6 +19,7 @@
 #include "AutomationTrackDiffLogic.h"
 #include "AutomationTrackNode.h"
 #include "PatternDiffHelpers.h"
+#include "EventDiffHelpers.h"
 #include "AutomationEvent.h"
 #include "AutomationSequence.h"
 
@@ -346,32 +347,7 @@ SerializedData mergeAutoEventsAdded(const SerializedData &state, const Serialize
     OwnedArray<MidiEvent> changesNotes;
     deserializeAutoTrackChanges(state, changes, stateNotes, changesNotes);
 
-    Array<const MidiEvent *> result;
-    result.addArray(stateNotes);
-
-    // на всякий пожарный, ищем, нет ли в состоянии нот с теми же id, где нет - добавляем
-    for (int i = 0; i < changesNotes.size(); ++i)
-    {
-        bool foundNoteInState = false;
-        const AutomationEvent *changesNote = static_cast<AutomationEvent *>(changesNotes.getUnchecked(i));
-
-        for (int j = 0; j < stateNotes.size(); ++j)
-        {
-            const AutomationEvent *stateNote = static_cast<AutomationEvent *>(stateNotes.getUnchecked(j));
-
-            if (stateNote->getId() == changesNote->getId())
-            {
-                foundNoteInState = true;
-                break;
-            }
-        }
-
-        if (! foundNoteInState)
-        {
-            result.add(changesNote);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsAdded(stateNotes, changesNotes);
     return serializeAutoSequence(result, AutoSequenceDeltas::eventsAdded);
 }
 
@@ -383,31 +359,7 @@ SerializedData mergeAutoEventsRemoved(const SerializedData &state, const Seriali
     OwnedArray<MidiEvent> changesNotes;
     deserializeAutoTrackChanges(state, changes, stateNotes, changesNotes);
 
-    Array<const MidiEvent *> result;
-
-    // добавляем все ноты из состояния, которых нет в изменениях
-    for (int i = 0; i < stateNotes.size(); ++i)
-    {
-        bool foundNoteInChanges = false;
-        const AutomationEvent *stateNote = static_cast<AutomationEvent *>(stateNotes.getUnchecked(i));
-
-        for (int j = 0; j < changesNotes.size(); ++j)
-        {
-            const AutomationEvent *changesNote = static_cast<AutomationEvent *>(changesNotes.getUnchecked(j));
-
-            if (stateNote->getId() == changesNote->getId())
-            {
-                foundNoteInChanges = true;
-                break;
-            }
-        }
-
-        if (! foundNoteInChanges)
-        {
-            result.add(stateNote);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsRemoved(stateNotes, changesNotes);
     return serializeAutoSequence(result, AutoSequenceDeltas::eventsAdded);
 }
 
@@ -419,32 +371,7 @@ SerializedData mergeAutoEventsChanged(const SerializedData &state, const Seriali
     OwnedArray<MidiEvent> changesNotes;
     deserializeAutoTrackChanges(state, changes, stateNotes, changesNotes);
 
-    Array<const MidiEvent *> result;
-    result.addArray(stateNotes);
-
-    // снова ищем по id и заменяем
-    for (int i = 0; i < stateNotes.size(); ++i)
-    {
-        bool foundNoteInChanges = false;
-        const AutomationEvent *stateNote = static_cast<AutomationEvent *>(stateNotes.getUnchecked(i));
-
-        for (int j = 0; j < changesNotes.size(); ++j)
-        {
-            const AutomationEvent *changesNote = static_cast<AutomationEvent *>(changesNotes.getUnchecked(j));
-
-            if (stateNote->getId() == changesNote->getId())
-            {
-                foundNoteInChanges = true;
-                result.removeAllInstancesOf(stateNote);
-                result.addIfNotAlreadyThere(changesNote);
-
-                break;
-            }
-        }
-
-        //jassert(foundNoteInChanges);
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsChanged(stateNotes, changesNotes);
     return serializeAutoSequence(result, AutoSequenceDeltas::eventsAdded);
 }
 
@@ -508,64 +435,16 @@ Array<DeltaDiff> createAutoEventsDiffs(const SerializedData &state, const Serial
     Array<const MidiEvent *> removedEvents;
     Array<const MidiEvent *> changedEvents;
 
-    // собственно, само сравнение
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundNoteInChanges = false;
-        const AutomationEvent *stateEvent = static_cast<AutomationEvent *>(stateEvents.getUnchecked(i));
-
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const AutomationEvent *changesEvent = static_cast<AutomationEvent *>(changesEvents.getUnchecked(j));
-
-            // нота из состояния - существует в изменениях. добавляем запись changed, если нужно.
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundNoteInChanges = true;
-
-                const bool eventHasChanged = (stateEvent->getBeat() != changesEvent->getBeat() ||
-                                              stateEvent->getCurvature() != changesEvent->getCurvature() ||
-                                              stateEvent->getControllerValue() != changesEvent->getControllerValue());
-
-                if (eventHasChanged)
-                {
-                    changedEvents.add(changesEvent);
-                }
-
-                break;
-            }
-        }
-
-        // нота из состояния - в изменениях не найдена. добавляем запись removed.
-        if (! foundNoteInChanges)
+    EventDiffHelpers::createEventsDiff(stateEvents, changesEvents,
+        [](const MidiEvent &before, const MidiEvent &after)
         {
-            removedEvents.add(stateEvent);
-        }
-    }
-
-    // теперь ищем в изменениях ноты, которые отсутствуют в состоянии
-    for (int i = 0; i < changesEvents.size(); ++i)
-    {
-        bool foundNoteInState = false;
-        const AutomationEvent *changesNote = static_cast<AutomationEvent *>(changesEvents.getUnchecked(i));
-
-        for (int j = 0; j < stateEvents.size(); ++j)
-        {
-            const AutomationEvent *stateNote = static_cast<AutomationEvent *>(stateEvents.getUnchecked(j));
-
-            if (stateNote->getId() == changesNote->getId())
-            {
-                foundNoteInState = true;
-                break;
-            }
-        }
-
-        // и пишем ее в список добавленных
-        if (! foundNoteInState)
-        {
-            addedEvents.add(changesNote);
-        }
-    }
+            const auto &stateEvent = static_cast<const AutomationEvent &>(before);
+            const auto &changesEvent = static_cast<const AutomationEvent &>(after);
+            return stateEvent.getBeat() != changesEvent.getBeat() ||
+                stateEvent.getCurvature() != changesEvent.getCurvature() ||
+                stateEvent.getControllerValue() != changesEvent.getControllerValue();
+        },
+        addedEvents, removedEvents, changedEvents);
 
     // сериализуем диффы, если таковые есть
 
@@ -599,25 +478,13 @@ Array<DeltaDiff> createAutoEventsDiffs(const SerializedData &state, const Serial
 void deserializeAutoTrackChanges(const SerializedData &state, const SerializedData &changes,
         OwnedArray<MidiEvent> &stateNotes, OwnedArray<MidiEvent> &changesNotes)
 {
-    if (state.isValid())
-    {
-        forEachChildWithType(state, e, Serialization::Midi::automationEvent)
-        {
-            auto *event = new AutomationEvent();
-            event->deserialize(e);
-            stateNotes.addSorted(*event, event);
-        }
-    }
+    using namespace Serialization;
 
-    if (changes.isValid())
-    {
-        forEachChildWithType(changes, e, Serialization::Midi::automationEvent)
-        {
-            auto *event = new AutomationEvent();
-            event->deserialize(e);
-            changesNotes.addSorted(*event, event);
-        }
-    }
+    EventDiffHelpers::deserializeEvents<AutomationEvent>(state, Midi::automationEvent, stateNotes);
+    EventDiffHelpers::sortEvents(stateNotes);
+
+    EventDiffHelpers::deserializeEvents<AutomationEvent>(changes, Midi::automationEvent, changesNotes);
+    EventDiffHelpers::sortEvents(changesNotes);
 }
 
 DeltaDiff serializeAutoTrackChanges(Array<const MidiEvent *> changes,
@@ -0,0 +1,188 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "MidiEvent.h"
+
+namespace VCS
+{
+    // The id-based joins shared by all the sequence diff logics:
+    // the events are matched through a hash map of ids built once,
+    // so the diff and merge costs are linear in the number of events,
+    // instead of comparing each event in the state with each event in the changes
+
+    class EventDiffHelpers final
+    {
+    public:
+
+        // appends all events of the given type, not sorted yet,
+        // see sortEvents(), which is to be called when all types are loaded
+        template <typename EventType, typename BaseType>
+        static void deserializeEvents(const SerializedData &data,
+            const Identifier &type, OwnedArray<BaseType> &result)
+        {
+            if (!data.isValid())
+            {
+                return;
+            }
+
+            forEachChildWithType(data, e, type)
+            {
+                auto *event = new EventType();
+                event->deserialize(e);
+                result.add(event);
+            }
+        }
+
+        // a single sort is way cheaper than addSorted for each event,
+        // which shifts the array on every insertion
+        template <typename BaseType>
+        static void sortEvents(OwnedArray<BaseType> &events)
+        {
+            if (events.size() > 1)
+            {
+                events.sort(*events.getFirst());
+            }
+        }
+
+        // the state and the events from changes, which are missing in the state
+        template <typename BaseType>
+        static Array<const MidiEvent *> mergeEventsAdded(const OwnedArray<BaseType> &state,
+            const OwnedArray<BaseType> &changes)
+        {
+            const auto stateIds = collectIds(state);
+
+            Array<const MidiEvent *> result;
+            result.addArray(state);
+
+            for (const auto *changesEvent : changes)
+            {
+                if (!stateIds.contains(changesEvent->getId()))
+                {
+                    result.add(changesEvent);
+                }
+            }
+
+            return result;
+        }
+
+        // the state without the events from changes
+        template <typename BaseType>
+        static Array<const MidiEvent *> mergeEventsRemoved(const OwnedArray<BaseType> &state,
+            const OwnedArray<BaseType> &changes)
+        {
+            const auto changesIds = collectIds(changes);
+
+            Array<const MidiEvent *> result;
+            for (const auto *stateEvent : state)
+            {
+                if (!changesIds.contains(stateEvent->getId()))
+                {
+                    result.add(stateEvent);
+                }
+            }
+
+            return result;
+        }
+
+        // the state with the events replaced by the ones from changes
+        template <typename BaseType>
+        static Array<const MidiEvent *> mergeEventsChanged(const OwnedArray<BaseType> &state,
+            const OwnedArray<BaseType> &changes)
+        {
+            const auto changesById = mapByIds(changes);
+
+            Array<const MidiEvent *> result;
+            result.ensureStorageAllocated(state.size());
+
+            for (const auto *stateEvent : state)
+            {
+                const auto found = changesById.find(stateEvent->getId());
+                result.add(found != changesById.end() ? found->second : stateEvent);
+            }
+
+            return result;
+        }
+
+        // the added events are the ones from changes missing in the state,
+        // the removed ones are from the state missing in changes,
+        // and the changed ones are from changes, if hasChanged(before, after)
+        template <typename BaseType, typename HasChangedCheck>
+        static void createEventsDiff(const OwnedArray<BaseType> &state,
+            const OwnedArray<BaseType> &changes, HasChangedCheck hasChanged,
+            Array<const MidiEvent *> &outAdded,
+            Array<const MidiEvent *> &outRemoved,
+            Array<const MidiEvent *> &outChanged)
+        {
+            const auto changesById = mapByIds(changes);
+
+            for (const auto *stateEvent : state)
+            {
+                const auto found = changesById.find(stateEvent->getId());
+                if (found == changesById.end())
+                {
+                    outRemoved.add(stateEvent);
+                }
+                else if (hasChanged(*stateEvent, *found->second))
+                {
+                    outChanged.add(found->second);
+                }
+            }
+
+            const auto stateIds = collectIds(state);
+
+            for (const auto *changesEvent : changes)
+            {
+                if (!stateIds.contains(changesEvent->getId()))
+                {
+                    outAdded.add(changesEvent);
+                }
+            }
+        }
+
+    private:
+
+        template <typename BaseType>
+        static FlatHashSet<MidiEvent::Id> collectIds(const OwnedArray<BaseType> &events)
+        {
+            FlatHashSet<MidiEvent::Id> ids;
+            ids.reserve(size_t(events.size()));
+            for (const auto *event : events)
+            {
+                ids.insert(event->getId());
+            }
+
+            return ids;
+        }
+
+        // if the ids are duplicated for some reason,
+        // the first event wins, like it used to be with the linear search
+        template <typename BaseType>
+        static FlatHashMap<MidiEvent::Id, const BaseType *> mapByIds(const OwnedArray<BaseType> &events)
+        {
+            FlatHashMap<MidiEvent::Id, const BaseType *> map;
+            map.reserve(size_t(events.size()));
+            for (const auto *event : events)
+            {
+                map.emplace(event->getId(), event);
+            }
+
+            return map;
+        }
+    };
+} // namespace VCS
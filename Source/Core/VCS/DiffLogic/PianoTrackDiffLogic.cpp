@@ -19,6 +19,7 @@
 #include "PianoTrackDiffLogic.h"
 #include "PianoTrackNode.h"
 #include "PatternDiffHelpers.h"
+#include "EventDiffHelpers.h"
 #include "Note.h"
 #include "PianoSequence.h"
 
@@ -329,30 +330,7 @@ SerializedData mergeNotesAdded(const SerializedData &state, const SerializedData
     OwnedArray<Note> changesNotes;
     deserializeLayerChanges(state, changes, stateNotes, changesNotes);
 
-    Array<const MidiEvent *> result;
-
-    result.addArray(stateNotes);
-
-    // на всякий пожарный, ищем, нет ли в состоянии нот с теми же id, где нет - добавляем
-    FlatHashSet<MidiEvent::Id> stateIDs;
-    
-    for (int j = 0; j < stateNotes.size(); ++j)
-    {
-        const Note *stateNote = stateNotes.getUnchecked(j);
-        stateIDs.insert(stateNote->getId());
-    }
-
-    for (int i = 0; i < changesNotes.size(); ++i)
-    {
-        const Note *changesNote = changesNotes.getUnchecked(i);
-        const bool foundNoteInState = stateIDs.contains(changesNote->getId());
-
-        if (! foundNoteInState)
-        {
-            result.add(changesNote);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsAdded(stateNotes, changesNotes);
     return serializePianoSequence(result, PianoSequenceDeltas::notesAdded);
 }
 
@@ -364,27 +342,7 @@ SerializedData mergeNotesRemoved(const SerializedData &state, const SerializedDa
     OwnedArray<Note> changesNotes;
     deserializeLayerChanges(state, changes, stateNotes, changesNotes);
 
-    Array<const MidiEvent *> result;
-
-    // добавляем все ноты из состояния, которых нет в изменениях
-    FlatHashSet<MidiEvent::Id> changesIDs;
-
-    for (int j = 0; j < changesNotes.size(); ++j)
-    {
-        const Note *changesNote = changesNotes.getUnchecked(j);
-        changesIDs.insert(changesNote->getId());
-    }
-    
-    for (int i = 0; i < stateNotes.size(); ++i)
-    {
-        const Note *stateNote =stateNotes.getUnchecked(i);
-        const bool foundNoteInChanges = changesIDs.contains(stateNote->getId());
-        if (! foundNoteInChanges)
-        {
-            result.add(stateNote);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsRemoved(stateNotes, changesNotes);
     return serializePianoSequence(result, PianoSequenceDeltas::notesAdded);
 }
 
@@ -396,30 +354,7 @@ SerializedData mergeNotesChanged(const SerializedData &state, const SerializedDa
     OwnedArray<Note> changesNotes;
     deserializeLayerChanges(state, changes, stateNotes, changesNotes);
 
-    Array<const MidiEvent *> result;
-
-    result.addArray(stateNotes);
-
-    // снова ищем по id и заменяем
-    FlatHashMap<MidiEvent::Id, const Note *> changesIDs;
-    
-    for (int j = 0; j < changesNotes.size(); ++j)
-    {
-        const Note *changesNote = changesNotes.getUnchecked(j);
-        changesIDs[changesNote->getId()] = changesNote;
-    }
-
-    for (int i = 0; i < stateNotes.size(); ++i)
-    {
-        const auto *stateNote = stateNotes.getUnchecked(i);
-        if (changesIDs.contains(stateNote->getId()))
-        {
-            const auto *changesNote = changesIDs[stateNote->getId()];
-            result.removeAllInstancesOf(stateNote);
-            result.addIfNotAlreadyThere(changesNote);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsChanged(stateNotes, changesNotes);
     return serializePianoSequence(result, PianoSequenceDeltas::notesAdded);
 }
 
@@ -477,67 +412,16 @@ Array<DeltaDiff> createEventsDiffs(const SerializedData &state, const Serialized
     Array<const MidiEvent *> removedNotes;
     Array<const MidiEvent *> changedNotes;
 
-    // собственно, само сравнение
-    for (int i = 0; i < stateNotes.size(); ++i)
-    {
-        bool foundNoteInChanges = false;
-        const Note *stateNote(stateNotes.getUnchecked(i));
-
-        for (int j = 0; j < changesNotes.size(); ++j)
-        {
-            const Note *changesNote = changesNotes.getUnchecked(j);
-
-            // нота из состояния - существует в изменениях. добавляем запись changed, если нужно.
-            if (stateNote->getId() == changesNote->getId())
-            {
-                foundNoteInChanges = true;
-
-                const bool noteHasChanged =
-                    stateNote->getKey() != changesNote->getKey() ||
-                    stateNote->getBeat() != changesNote->getBeat() ||
-                    stateNote->getLength() != changesNote->getLength() ||
-                    stateNote->getVelocity() != changesNote->getVelocity() ||
-                    stateNote->getTuplet() != changesNote->getTuplet();
-
-                if (noteHasChanged)
-                {
-                    changedNotes.add(changesNote);
-                }
-
-                break;
-            }
-        }
-
-        // нота из состояния - в изменениях не найдена. добавляем запись removed.
-        if (! foundNoteInChanges)
-        {
-            removedNotes.add(stateNote);
-        }
-    }
-
-    // теперь ищем в изменениях ноты, которые отсутствуют в состоянии
-    for (int i = 0; i < changesNotes.size(); ++i)
-    {
-        bool foundNoteInState = false;
-        const Note *changesNote = changesNotes.getUnchecked(i);
-
-        for (int j = 0; j < stateNotes.size(); ++j)
-        {
-            const Note *stateNote(stateNotes.getUnchecked(j));
-
-            if (stateNote->getId() == changesNote->getId())
-            {
-                foundNoteInState = true;
-                break;
-            }
-        }
-
-        // и пишем ее в список добавленных
-        if (! foundNoteInState)
+    EventDiffHelpers::createEventsDiff(stateNotes, changesNotes,
+        [](const Note &stateNote, const Note &changesNote)
         {
-            addedNotes.add(changesNote);
-        }
-    }
+            return stateNote.getKey() != changesNote.getKey() ||
+                stateNote.getBeat() != changesNote.getBeat() ||
+                stateNote.getLength() != changesNote.getLength() ||
+                stateNote.getVelocity() != changesNote.getVelocity() ||
+                stateNote.getTuplet() != changesNote.getTuplet();
+        },
+        addedNotes, removedNotes, changedNotes);
 
     // сериализуем диффы, если таковые есть
 
@@ -572,25 +456,11 @@ Array<DeltaDiff> createEventsDiffs(const SerializedData &state, const Serialized
 void deserializeLayerChanges(const SerializedData &state, const SerializedData &changes,
         OwnedArray<Note> &stateNotes, OwnedArray<Note> &changesNotes)
 {
-    if (state.isValid())
-    {
-        forEachChildWithType(state, e, Serialization::Midi::note)
-        {
-            auto *note = new Note();
-            note->deserialize(e);
-            stateNotes.addSorted(*note, note);
-        }
-    }
+    EventDiffHelpers::deserializeEvents<Note>(state, Serialization::Midi::note, stateNotes);
+    EventDiffHelpers::sortEvents(stateNotes);
 
-    if (changes.isValid())
-    {
-        forEachChildWithType(changes, e, Serialization::Midi::note)
-        {
-            auto *note = new Note();
-            note->deserialize(e);
-            changesNotes.addSorted(*note, note);
-        }
-    }
+    EventDiffHelpers::deserializeEvents<Note>(changes, Serialization::Midi::note, changesNotes);
+    EventDiffHelpers::sortEvents(changesNotes);
 }
 
 DeltaDiff serializePianoTrackChanges(Array<const MidiEvent *> changes,
@@ -624,3 +494,98 @@ bool checkIfDeltaIsNotesType(const Delta *d)
 }
 
 }
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class PianoTrackDiffBenchmark final : public UnitTest
+{
+public:
+    PianoTrackDiffBenchmark() : UnitTest("Piano track diff benchmark", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        using namespace Serialization;
+
+        for (const auto numNotes : { 1000, 5000, 20000, 50000 })
+        {
+            beginTest("Notes diff, " + String(numNotes) + " notes");
+
+            // every 20th note is removed, every 10th is changed,
+            // and the same number of new notes is added at the end
+            SerializedData state(VCS::PianoSequenceDeltas::notesAdded);
+            SerializedData changes(VCS::PianoSequenceDeltas::notesAdded);
+
+            for (int i = 0; i < numNotes; ++i)
+            {
+                const auto key = i % 128;
+                const auto beat = float(i / 4);
+                state.appendChild(makeNote(i, key, beat));
+
+                if (i % 20 == 0)
+                {
+                    continue;
+                }
+
+                changes.appendChild(makeNote(i, (i % 10 == 5) ? key + 1 : key, beat));
+            }
+
+            const auto numAddedNotes = numNotes / 20;
+            for (int i = 0; i < numAddedNotes; ++i)
+            {
+                changes.appendChild(makeNote(numNotes + i, 60, float(numNotes / 4 + i)));
+            }
+
+            const auto startTime = Time::getMillisecondCounterHiRes();
+            const auto diffs = VCS::createEventsDiffs(state, changes);
+            const auto diffTime = Time::getMillisecondCounterHiRes() - startTime;
+
+            expectEquals(diffs.size(), 3);
+            if (diffs.size() == 3)
+            {
+                expect(diffs.getReference(0).delta->hasType(VCS::PianoSequenceDeltas::notesAdded));
+                expectEquals(diffs.getReference(0).deltaData.getNumChildren(), numAddedNotes);
+
+                expect(diffs.getReference(1).delta->hasType(VCS::PianoSequenceDeltas::notesRemoved));
+                expectEquals(diffs.getReference(1).deltaData.getNumChildren(), numNotes / 20);
+
+                expect(diffs.getReference(2).delta->hasType(VCS::PianoSequenceDeltas::notesChanged));
+                expectEquals(diffs.getReference(2).deltaData.getNumChildren(), numNotes / 10);
+            }
+
+            logMessage("Diff time: " + String(diffTime, 2) + "ms, " +
+                String(diffTime * 1000.0 / numNotes, 3) + "us per note");
+        }
+    }
+
+private:
+
+    // unique ids made of the valid id characters, like the sequences generate
+    static MidiEvent::Id makeId(int index)
+    {
+        static const char idChars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+        MidiEvent::Id id = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            id |= idChars[index % 62] << (i * CHAR_BIT);
+            index /= 62;
+        }
+
+        return id;
+    }
+
+    static SerializedData makeNote(int index, Note::Key key, float beat)
+    {
+        auto data = Note(nullptr, key, beat, 0.5f, 0.75f).serialize();
+        data.setProperty(Serialization::Midi::id, MidiEvent::packId(makeId(index)));
+        return data;
+    }
+};
+
+static PianoTrackDiffBenchmark pianoTrackDiffBenchmark;
+
+#endif
@@ -21,6 +21,7 @@
 #include "AnnotationsSequence.h"
 #include "TimeSignaturesSequence.h"
 #include "KeySignaturesSequence.h"
+#include "EventDiffHelpers.h"
 
 // TODO refactor, lots of duplicated code
 namespace VCS
@@ -385,35 +386,7 @@ SerializedData mergeAnnotationsAdded(const SerializedData &state, const Serializ
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
 
-    Array<const MidiEvent *> result;
-
-    result.addArray(stateEvents);
-
-    // check if state doesn't already have events with the same ids, then add
-    for (int i = 0; i < changesEvents.size(); ++i)
-    {
-        bool foundEventInState = false;
-        const AnnotationEvent *changesEvent =
-            static_cast<AnnotationEvent *>(changesEvents.getUnchecked(i));
-
-        for (int j = 0; j < stateEvents.size(); ++j)
-        {
-            const AnnotationEvent *stateEvent =
-                static_cast<AnnotationEvent *>(stateEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInState = true;
-                break;
-            }
-        }
-
-        if (! foundEventInState)
-        {
-            result.add(changesEvent);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsAdded(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::annotationsAdded);
 }
 
@@ -425,32 +398,7 @@ SerializedData mergeAnnotationsRemoved(const SerializedData &state, const Serial
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
 
-    Array<const MidiEvent *> result;
-
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const AnnotationEvent *stateEvent =
-            static_cast<AnnotationEvent *>(stateEvents.getUnchecked(i));
-
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const AnnotationEvent *changesEvent =
-                static_cast<AnnotationEvent *>(changesEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-                break;
-            }
-        }
-
-        if (! foundEventInChanges)
-        {
-            result.add(stateEvent);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsRemoved(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::annotationsAdded);
 }
 
@@ -462,34 +410,7 @@ SerializedData mergeAnnotationsChanged(const SerializedData &state, const Serial
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
 
-    Array<const MidiEvent *> result;
-
-    result.addArray(stateEvents);
-
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const AnnotationEvent *stateEvent =
-            static_cast<AnnotationEvent *>(stateEvents.getUnchecked(i));
-
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const AnnotationEvent *changesEvent =
-                static_cast<AnnotationEvent *>(changesEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-                result.removeAllInstancesOf(stateEvent);
-                result.addIfNotAlreadyThere(changesEvent);
-
-                break;
-            }
-        }
-
-        //jassert(foundEventInChanges);
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsChanged(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::annotationsAdded);
 }
 
@@ -504,36 +425,8 @@ SerializedData mergeTimeSignaturesAdded(const SerializedData &state, const Seria
     OwnedArray<MidiEvent> stateEvents;
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
-    
-    Array<const MidiEvent *> result;
-    
-    result.addArray(stateEvents);
-    
-    // check if state doesn't already have events with the same ids, then add
-    for (int i = 0; i < changesEvents.size(); ++i)
-    {
-        bool foundEventInState = false;
-        const TimeSignatureEvent *changesEvent =
-            static_cast<TimeSignatureEvent *>(changesEvents.getUnchecked(i));
-        
-        for (int j = 0; j < stateEvents.size(); ++j)
-        {
-            const TimeSignatureEvent *stateEvent =
-                static_cast<TimeSignatureEvent *>(stateEvents.getUnchecked(j));
-            
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInState = true;
-                break;
-            }
-        }
-        
-        if (! foundEventInState)
-        {
-            result.add(changesEvent);
-        }
-    }
-    
+
+    const auto result = EventDiffHelpers::mergeEventsAdded(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::timeSignaturesAdded);
 }
 
@@ -544,34 +437,8 @@ SerializedData mergeTimeSignaturesRemoved(const SerializedData &state, const Ser
     OwnedArray<MidiEvent> stateEvents;
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
-    
-    Array<const MidiEvent *> result;
-    
-    // add all events that are missing in changes
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const TimeSignatureEvent *stateEvent =
-            static_cast<TimeSignatureEvent *>(stateEvents.getUnchecked(i));
-        
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const TimeSignatureEvent *changesEvent =
-                static_cast<TimeSignatureEvent *>(changesEvents.getUnchecked(j));
-            
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-                break;
-            }
-        }
-        
-        if (! foundEventInChanges)
-        {
-            result.add(stateEvent);
-        }
-    }
-    
+
+    const auto result = EventDiffHelpers::mergeEventsRemoved(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::timeSignaturesAdded);
 }
 
@@ -582,34 +449,8 @@ SerializedData mergeTimeSignaturesChanged(const SerializedData &state, const Ser
     OwnedArray<MidiEvent> stateEvents;
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
-    
-    Array<const MidiEvent *> result;
-    result.addArray(stateEvents);
-    
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const TimeSignatureEvent *stateEvent =
-            static_cast<TimeSignatureEvent *>(stateEvents.getUnchecked(i));
-        
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const TimeSignatureEvent *changesEvent =
-                static_cast<TimeSignatureEvent *>(changesEvents.getUnchecked(j));
-            
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-                result.removeAllInstancesOf(stateEvent);
-                result.addIfNotAlreadyThere(changesEvent);
-                
-                break;
-            }
-        }
-        
-        //jassert(foundEventInChanges);
-    }
-    
+
+    const auto result = EventDiffHelpers::mergeEventsChanged(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::timeSignaturesAdded);
 }
 
@@ -625,35 +466,7 @@ SerializedData mergeKeySignaturesAdded(const SerializedData &state, const Serial
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
 
-    Array<const MidiEvent *> result;
-
-    result.addArray(stateEvents);
-
-    // check if state doesn't already have events with the same ids, then add
-    for (int i = 0; i < changesEvents.size(); ++i)
-    {
-        bool foundEventInState = false;
-        const KeySignatureEvent *changesEvent =
-            static_cast<KeySignatureEvent *>(changesEvents.getUnchecked(i));
-
-        for (int j = 0; j < stateEvents.size(); ++j)
-        {
-            const KeySignatureEvent *stateEvent =
-                static_cast<KeySignatureEvent *>(stateEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInState = true;
-                break;
-            }
-        }
-
-        if (!foundEventInState)
-        {
-            result.add(changesEvent);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsAdded(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::keySignaturesAdded);
 }
 
@@ -665,33 +478,7 @@ SerializedData mergeKeySignaturesRemoved(const SerializedData &state, const Seri
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
 
-    Array<const MidiEvent *> result;
-
-    // add all events that are missing in changes
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const KeySignatureEvent *stateEvent =
-            static_cast<KeySignatureEvent *>(stateEvents.getUnchecked(i));
-
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const KeySignatureEvent *changesEvent =
-                static_cast<KeySignatureEvent *>(changesEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-                break;
-            }
-        }
-
-        if (!foundEventInChanges)
-        {
-            result.add(stateEvent);
-        }
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsRemoved(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::keySignaturesAdded);
 }
 
@@ -703,33 +490,7 @@ SerializedData mergeKeySignaturesChanged(const SerializedData &state, const Seri
     OwnedArray<MidiEvent> changesEvents;
     deserializeTimelineChanges(state, changes, stateEvents, changesEvents);
 
-    Array<const MidiEvent *> result;
-    result.addArray(stateEvents);
-
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const KeySignatureEvent *stateEvent =
-            static_cast<KeySignatureEvent *>(stateEvents.getUnchecked(i));
-
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const KeySignatureEvent *changesEvent =
-                static_cast<KeySignatureEvent *>(changesEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-                result.removeAllInstancesOf(stateEvent);
-                result.addIfNotAlreadyThere(changesEvent);
-
-                break;
-            }
-        }
-
-        //jassert(foundEventInChanges);
-    }
-
+    const auto result = EventDiffHelpers::mergeEventsChanged(stateEvents, changesEvents);
     return serializeTimelineSequence(result, ProjectTimelineDeltas::keySignaturesAdded);
 }
 
@@ -751,68 +512,17 @@ Array<DeltaDiff> createAnnotationsDiffs(const SerializedData &state, const Seria
     Array<const MidiEvent *> removedEvents;
     Array<const MidiEvent *> changedEvents;
 
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const AnnotationEvent *stateEvent =
-            static_cast<AnnotationEvent *>(stateEvents.getUnchecked(i));
-
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const AnnotationEvent *changesEvent =
-                static_cast<AnnotationEvent *>(changesEvents.getUnchecked(j));
-
-            // state event was found in changes, add `changed` records
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-
-                const bool eventHasChanged =
-                    (stateEvent->getBeat() != changesEvent->getBeat() ||
-                     stateEvent->getLength() != changesEvent->getLength() ||
-                     stateEvent->getColour() != changesEvent->getColour() ||
-                     stateEvent->getDescription() != changesEvent->getDescription());
-
-                if (eventHasChanged)
-                {
-                    changedEvents.add(changesEvent);
-                }
-
-                break;
-            }
-        }
-
-        // state event was not found in changes, add `removed` record
-        if (! foundEventInChanges)
+    EventDiffHelpers::createEventsDiff(stateEvents, changesEvents,
+        [](const MidiEvent &before, const MidiEvent &after)
         {
-            removedEvents.add(stateEvent);
-        }
-    }
-
-    // search for the new events missing in state
-    for (int i = 0; i < changesEvents.size(); ++i)
-    {
-        bool foundEventInState = false;
-        const AnnotationEvent *changesEvent =
-            static_cast<AnnotationEvent *>(changesEvents.getUnchecked(i));
-
-        for (int j = 0; j < stateEvents.size(); ++j)
-        {
-            const AnnotationEvent *stateEvent =
-                static_cast<AnnotationEvent *>(stateEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInState = true;
-                break;
-            }
-        }
-
-        if (! foundEventInState)
-        {
-            addedEvents.add(changesEvent);
-        }
-    }
+            const auto &stateEvent = static_cast<const AnnotationEvent &>(before);
+            const auto &changesEvent = static_cast<const AnnotationEvent &>(after);
+            return stateEvent.getBeat() != changesEvent.getBeat() ||
+                stateEvent.getLength() != changesEvent.getLength() ||
+                stateEvent.getColour() != changesEvent.getColour() ||
+                stateEvent.getDescription() != changesEvent.getDescription();
+        },
+        addedEvents, removedEvents, changedEvents);
 
     // serialize deltas, if any
     if (addedEvents.size() > 0)
@@ -856,68 +566,17 @@ Array<DeltaDiff> createTimeSignaturesDiffs(const SerializedData &state, const Se
     Array<const MidiEvent *> removedEvents;
     Array<const MidiEvent *> changedEvents;
     
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const TimeSignatureEvent *stateEvent =
-            static_cast<TimeSignatureEvent *>(stateEvents.getUnchecked(i));
-        
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const TimeSignatureEvent *changesEvent =
-                static_cast<TimeSignatureEvent *>(changesEvents.getUnchecked(j));
-            
-            // state event was found in changes, add `changed` records
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-                
-                const bool eventHasChanged =
-                    (stateEvent->getBeat() != changesEvent->getBeat() ||
-                     stateEvent->getNumerator() != changesEvent->getNumerator() ||
-                     stateEvent->getDenominator() != changesEvent->getDenominator());
-                
-                if (eventHasChanged)
-                {
-                    changedEvents.add(changesEvent);
-                }
-                
-                break;
-            }
-        }
-        
-        // state event was not found in changes, add `removed` record
-        if (! foundEventInChanges)
-        {
-            removedEvents.add(stateEvent);
-        }
-    }
-    
-    // search for the new events missing in state
-    for (int i = 0; i < changesEvents.size(); ++i)
-    {
-        bool foundEventInState = false;
-        const TimeSignatureEvent *changesEvent =
-            static_cast<TimeSignatureEvent *>(changesEvents.getUnchecked(i));
-        
-        for (int j = 0; j < stateEvents.size(); ++j)
+    EventDiffHelpers::createEventsDiff(stateEvents, changesEvents,
+        [](const MidiEvent &before, const MidiEvent &after)
         {
-            const TimeSignatureEvent *stateEvent =
-                static_cast<TimeSignatureEvent *>(stateEvents.getUnchecked(j));
-            
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInState = true;
-                break;
-            }
-        }
-        
-        if (! foundEventInState)
-        {
-            addedEvents.add(changesEvent);
-        }
-    }
-    
+            const auto &stateEvent = static_cast<const TimeSignatureEvent &>(before);
+            const auto &changesEvent = static_cast<const TimeSignatureEvent &>(after);
+            return stateEvent.getBeat() != changesEvent.getBeat() ||
+                stateEvent.getNumerator() != changesEvent.getNumerator() ||
+                stateEvent.getDenominator() != changesEvent.getDenominator();
+        },
+        addedEvents, removedEvents, changedEvents);
+
     // serialize deltas, if any
     if (addedEvents.size() > 0)
     {
@@ -959,67 +618,16 @@ Array<DeltaDiff> createKeySignaturesDiffs(const SerializedData &state, const Ser
     Array<const MidiEvent *> removedEvents;
     Array<const MidiEvent *> changedEvents;
 
-    for (int i = 0; i < stateEvents.size(); ++i)
-    {
-        bool foundEventInChanges = false;
-        const KeySignatureEvent *stateEvent =
-            static_cast<KeySignatureEvent *>(stateEvents.getUnchecked(i));
-
-        for (int j = 0; j < changesEvents.size(); ++j)
-        {
-            const KeySignatureEvent *changesEvent =
-                static_cast<KeySignatureEvent *>(changesEvents.getUnchecked(j));
-
-            // state event was found in changes, add `changed` records
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInChanges = true;
-
-                const bool eventHasChanged =
-                    (stateEvent->getBeat() != changesEvent->getBeat() ||
-                        stateEvent->getRootKey() != changesEvent->getRootKey() ||
-                        ! stateEvent->getScale()->isEquivalentTo(changesEvent->getScale()));
-
-                if (eventHasChanged)
-                {
-                    changedEvents.add(changesEvent);
-                }
-
-                break;
-            }
-        }
-
-        // state event was not found in changes, add `removed` record
-        if (!foundEventInChanges)
-        {
-            removedEvents.add(stateEvent);
-        }
-    }
-
-    // search for the new events missing in state
-    for (int i = 0; i < changesEvents.size(); ++i)
-    {
-        bool foundEventInState = false;
-        const KeySignatureEvent *changesEvent =
-            static_cast<KeySignatureEvent *>(changesEvents.getUnchecked(i));
-
-        for (int j = 0; j < stateEvents.size(); ++j)
+    EventDiffHelpers::createEventsDiff(stateEvents, changesEvents,
+        [](const MidiEvent &before, const MidiEvent &after)
         {
-            const KeySignatureEvent *stateEvent =
-                static_cast<KeySignatureEvent *>(stateEvents.getUnchecked(j));
-
-            if (stateEvent->getId() == changesEvent->getId())
-            {
-                foundEventInState = true;
-                break;
-            }
-        }
-
-        if (!foundEventInState)
-        {
-            addedEvents.add(changesEvent);
-        }
-    }
+            const auto &stateEvent = static_cast<const KeySignatureEvent &>(before);
+            const auto &changesEvent = static_cast<const KeySignatureEvent &>(after);
+            return stateEvent.getBeat() != changesEvent.getBeat() ||
+                stateEvent.getRootKey() != changesEvent.getRootKey() ||
+                !stateEvent.getScale()->isEquivalentTo(changesEvent.getScale());
+        },
+        addedEvents, removedEvents, changedEvents);
 
     // serialize deltas, if any
     if (addedEvents.size() > 0)
@@ -1059,53 +667,15 @@ void deserializeTimelineChanges(const SerializedData &state, const SerializedDat
 {
     using namespace Serialization;
 
-    if (state.isValid())
-    {
-        forEachChildWithType(state, e, Midi::annotation)
-        {
-            AnnotationEvent *event = new AnnotationEvent();
-            event->deserialize(e);
-            stateEvents.addSorted(*event, event);
-        }
-
-        forEachChildWithType(state, e, Midi::timeSignature)
-        {
-            TimeSignatureEvent *event = new TimeSignatureEvent();
-            event->deserialize(e);
-            stateEvents.addSorted(*event, event);
-        }
+    EventDiffHelpers::deserializeEvents<AnnotationEvent>(state, Midi::annotation, stateEvents);
+    EventDiffHelpers::deserializeEvents<TimeSignatureEvent>(state, Midi::timeSignature, stateEvents);
+    EventDiffHelpers::deserializeEvents<KeySignatureEvent>(state, Midi::keySignature, stateEvents);
+    EventDiffHelpers::sortEvents(stateEvents);
 
-        forEachChildWithType(state, e, Midi::keySignature)
-        {
-            KeySignatureEvent *event = new KeySignatureEvent();
-            event->deserialize(e);
-            stateEvents.addSorted(*event, event);
-        }
-    }
-
-    if (changes.isValid())
-    {
-        forEachChildWithType(changes, e, Midi::annotation)
-        {
-            AnnotationEvent *event = new AnnotationEvent();
-            event->deserialize(e);
-            changesEvents.addSorted(*event, event);
-        }
-        
-        forEachChildWithType(changes, e, Midi::timeSignature)
-        {
-            TimeSignatureEvent *event = new TimeSignatureEvent();
-            event->deserialize(e);
-            changesEvents.addSorted(*event, event);
-        }
-
-        forEachChildWithType(changes, e, Midi::keySignature)
-        {
-            KeySignatureEvent *event = new KeySignatureEvent();
-            event->deserialize(e);
-            changesEvents.addSorted(*event, event);
-        }
-    }
+    EventDiffHelpers::deserializeEvents<AnnotationEvent>(changes, Midi::annotation, changesEvents);
+    EventDiffHelpers::deserializeEvents<TimeSignatureEvent>(changes, Midi::timeSignature, changesEvents);
+    EventDiffHelpers::deserializeEvents<KeySignatureEvent>(changes, Midi::keySignature, changesEvents);
+    EventDiffHelpers::sortEvents(changesEvents);
 }
 
 DeltaDiff serializeTimelineChanges(Array<const MidiEvent *> changes,
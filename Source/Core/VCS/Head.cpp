@@ -18,6 +18,8 @@
 #include "Common.h"
 #include "Head.h"
 #include "Diff.h"
+#include "ProjectInfoDiffLogic.h"
+#include "RenderWorkerPool.h"
 
 namespace VCS
 {
@@ -31,7 +33,8 @@ Head::Head(const Head &other) :
     rebuildingDiffMode(false),
     diff(other.diff),
     headingAt(other.headingAt),
-    state(make<Snapshot>(other.state.get())) {}
+    state(make<Snapshot>(other.state.get())),
+    stateRevisionId(other.stateRevisionId) {}
 
 Head::Head(TrackedItemsSource &targetProject) :
     Thread("Diff Thread"),
@@ -99,6 +102,9 @@ void Head::mergeStateWith(Revision::Ptr changes)
 {
     DBG("Head::mergeStateWith " + changes->getUuid());
 
+    // the state doesn't match any revision anymore
+    this->stateRevisionId = {};
+
     Revision::Ptr headRevision(this->getHeadingRevision());
     for (auto *changesItem : changes->getItems())
     {
@@ -137,12 +143,6 @@ bool Head::moveTo(const Revision::Ptr revision)
         this->stopThread(DIFF_BUILD_THREAD_STOP_TIMEOUT);
     }
 
-    // first, reset the snapshot state
-    {
-        const ScopedWriteLock lock(this->stateLock);
-        this->state = make<Snapshot>();
-    }
-
     // a path from the root to current revision
     ReferenceCountedArray<Revision> treePath;
     Revision::Ptr currentRevision(revision);
@@ -152,44 +152,143 @@ bool Head::moveTo(const Revision::Ptr revision)
         currentRevision = currentRevision->getParent();
     }
 
-    // then move from the root back to target revision
-    for (const auto *rev : treePath)
+    // first, find the closest revision on the path with a known state:
+    // either the one the current state is built for (e.g. when committing,
+    // the head moves to a child revision), or the nearest keyframe;
+    // if none found, the state is rebuilt from scratch
+    int replayFrom = 0;
+    bool keepsCurrentState = false;
+    UniquePointer<Snapshot> newState;
+
+    for (int i = treePath.size() - 1; i >= 0; --i)
+    {
+        const auto revisionId = treePath.getUnchecked(i)->getUuid();
+        if (this->stateRevisionId.isNotEmpty() && this->stateRevisionId == revisionId)
+        {
+            keepsCurrentState = true;
+            replayFrom = i + 1;
+            break;
+        }
+
+        const auto keyframe = this->keyframes.find(revisionId);
+        if (keyframe != this->keyframes.end())
+        {
+            newState = make<Snapshot>(keyframe->second.get());
+            replayFrom = i + 1;
+            break;
+        }
+    }
+
     {
+        const ScopedWriteLock lock(this->stateLock);
+        if (!keepsCurrentState)
+        {
+            this->state = (newState != nullptr) ? move(newState) : make<Snapshot>();
+        }
+    }
+
+    // the keyframes are only built from the revisions with all deltas
+    // in place, so the ones after a shallow copy on the path are skipped
+    // (note that an empty revision also looks like a shallow copy)
+    bool hasAllDeltas = true;
+
+    // then move from the known state to target revision
+    for (int i = replayFrom; i < treePath.size(); ++i)
+    {
+        const auto *rev = treePath.getUnchecked(i);
         DBG("VCS head moved to " + rev->getUuid());
 
-        // picking all deltas and applying them to current state
-        for (auto *item : rev->getItems())
+        this->applyRevisionItems(rev);
+
+        hasAllDeltas = hasAllDeltas && !rev->isShallowCopy();
+        if (hasAllDeltas && (i + 1) % Head::snapshotKeyframeInterval == 0 &&
+            !this->keyframes.contains(rev->getUuid()))
         {
-            if (item->getType() == RevisionItem::Type::Added)
-            {
-                this->state->addItem(item);
-            }
-            else if (item->getType() == RevisionItem::Type::Removed)
-            {
-                this->state->removeItem(item);
-            }
-            else if (item->getType() == RevisionItem::Type::Changed)
-            {
-                this->state->mergeItem(item);
-            }
-            else
-            {
-                jassertfalse;
-            }
+            // a shallow copy of the items list, the items themselves are shared
+            this->keyframes.emplace(rev->getUuid(), make<Snapshot>(this->state.get()));
         }
     }
 
+    this->stateRevisionId = hasAllDeltas ? revision->getUuid() : String();
     this->headingAt = revision;
     this->setDiffOutdated(true);
     return true;
 }
 
+void Head::applyRevisionItems(const Revision *revision)
+{
+    // picking all deltas and applying them to current state
+    for (auto *item : revision->getItems())
+    {
+        if (item->getType() == RevisionItem::Type::Added)
+        {
+            this->state->addItem(item);
+        }
+        else if (item->getType() == RevisionItem::Type::Removed)
+        {
+            this->state->removeItem(item);
+        }
+        else if (item->getType() == RevisionItem::Type::Changed)
+        {
+            this->state->mergeItem(item);
+        }
+        else
+        {
+            jassertfalse;
+        }
+    }
+}
+
 void Head::pointTo(const Revision::Ptr revision)
 {
+    // the deserialized state is kept as a keyframe, if it was saved
+    // for this revision, so that the first checkout doesn't start over
+    if (this->stateRevisionId.isNotEmpty() &&
+        this->stateRevisionId == revision->getUuid())
+    {
+        this->keyframes.erase(this->stateRevisionId);
+        this->keyframes.emplace(this->stateRevisionId, make<Snapshot>(this->state.get()));
+    }
+    else
+    {
+        this->stateRevisionId = {};
+    }
+
     this->headingAt = revision;
     this->setDiffOutdated(true);
 }
 
+void Head::invalidateKeyframes(const Revision::Ptr revision)
+{
+    this->invalidateKeyframesRecursively(revision.get());
+}
+
+void Head::invalidateKeyframesRecursively(const Revision *revision)
+{
+    if (revision->getUuid() == this->stateRevisionId)
+    {
+        this->stateRevisionId = {};
+    }
+
+    this->keyframes.erase(revision->getUuid());
+
+    for (const auto *child : revision->getChildren())
+    {
+        this->invalidateKeyframesRecursively(child);
+    }
+}
+
+void Head::resetKeyframes()
+{
+    this->keyframes.clear();
+    this->stateRevisionId = {};
+}
+
+int Head::getNumKeyframes() const noexcept
+{
+    return int(this->keyframes.size());
+}
+
 
 bool Head::resetChangedItemToState(const RevisionItem::Ptr diffItem)
 {
@@ -446,6 +545,12 @@ SerializedData Head::serialize() const
     SerializedData tree(Serialization::VCS::head);
     SerializedData snapshotNode(Serialization::VCS::snapshot);
 
+    // lets the state be used as a keyframe when loaded
+    if (this->stateRevisionId.isNotEmpty())
+    {
+        snapshotNode.setProperty(Serialization::VCS::snapshotRevisionId, this->stateRevisionId);
+    }
+
     {
         const ScopedReadLock lock(this->stateLock);
         
@@ -473,6 +578,8 @@ void Head::deserialize(const SerializedData &data)
     const auto snapshotNode = root.getChildWithName(Serialization::VCS::snapshot);
     if (!snapshotNode.isValid()) { return; }
 
+    this->stateRevisionId = snapshotNode.getProperty(Serialization::VCS::snapshotRevisionId);
+
     forEachChildWithType(snapshotNode, stateElement, Serialization::VCS::revisionItem)
     {
         RevisionItem::Ptr snapshotItem(new RevisionItem(RevisionItem::Type::Added, nullptr));
@@ -484,6 +591,7 @@ void Head::deserialize(const SerializedData &data)
 void Head::reset()
 {
     this->state = make<Snapshot>();
+    this->resetKeyframes();
     this->setDiffOutdated(true);
 }
 
@@ -510,196 +618,356 @@ void Head::run()
     this->setRebuildingDiffMode(true);
     this->sendChangeMessage();
 
+    if (this->rebuildDiff(true))
+    {
+        this->setDiffOutdated(false);
+    }
+
+    this->setRebuildingDiffMode(false);
+    this->sendChangeMessage();
+}
+
+void Head::rebuildDiffSynchronously()
+{
+    if (this->state == nullptr)
+    { return; }
+    
+    if (this->isRebuildingDiff())
+    { return; }
+    
+    this->setRebuildingDiffMode(true);
+    this->rebuildDiff(false);
+    this->setDiffOutdated(false);
+    this->setRebuildingDiffMode(false);
+    this->sendChangeMessage();
+}
+
+// One record of the diff being built, in the order of the diff
+struct DiffRecord final
+{
+    RevisionItem::Type type;
+    TrackedItem *targetItem; // nullptr for `removed` records
+    RevisionItem::Ptr stateItem; // nullptr, if missing in the state
+    uint32 itemGeneration;
+    RevisionItem::Ptr changes;
+};
+
+static RevisionItem::Ptr createChanges(const DiffRecord &record)
+{
+    if (record.type == RevisionItem::Type::Changed)
+    {
+        UniquePointer<Diff> itemDiff(record.targetItem->getDiffLogic()->createDiff(*record.stateItem));
+        if (itemDiff->hasAnyChanges())
+        {
+            return new RevisionItem(RevisionItem::Type::Changed, itemDiff.get());
+        }
+
+        return nullptr;
+    }
+    else if (record.type == RevisionItem::Type::Added)
+    {
+        // copy deltas from targetItem
+        return new RevisionItem(RevisionItem::Type::Added, record.targetItem);
+    }
+    else if (record.type == RevisionItem::Type::Removed)
+    {
+        auto emptyDiff = make<Diff>(*record.stateItem);
+        return new RevisionItem(RevisionItem::Type::Removed, emptyDiff.get());
+    }
+
+    jassertfalse;
+    return nullptr;
+}
+
+bool Head::rebuildDiff(bool canBeInterrupted)
+{
     {
         const ScopedWriteLock lock(this->diffLock);
         this->diff->reset();
     }
 
-    const ScopedReadLock threadStateLock(this->stateLock);
+    const ScopedReadLock rebuildStateLock(this->stateLock);
 
-    for (int i = 0; i < this->state->getNumTrackedItems(); ++i)
+    // project items by uuid, so that matching them
+    // against the state items is not a nested loop
+    Array<TrackedItem *> targetItems;
+    FlatHashMap<Uuid, TrackedItem *, UuidHash> targetItemsIndex;
+    for (int i = 0; i < this->targetVcsItemsSource.getNumTrackedItems(); ++i)
     {
-        if (this->threadShouldExit())
+        if (auto *targetItem = this->targetVcsItemsSource.getTrackedItem(i)) // i.e. LayerTreeItem
         {
-            this->setRebuildingDiffMode(false);
-            this->sendChangeMessage();
-            return;
+            targetItems.add(targetItem);
+            targetItemsIndex[targetItem->getUuid()] = targetItem;
         }
+    }
 
-        bool foundItemInTarget = false;
+    Array<DiffRecord> records;
+
+    for (int i = 0; i < this->state->getNumTrackedItems(); ++i)
+    {
         const RevisionItem::Ptr stateItem = static_cast<RevisionItem *>(this->state->getTrackedItem(i));
 
         // will check `removed` records later
         if (stateItem->getType() == RevisionItem::Type::Removed) { continue; }
 
-        for (int j = 0; j < this->targetVcsItemsSource.getNumTrackedItems(); ++j)
+        const auto target = targetItemsIndex.find(stateItem->getUuid());
+        if (target == targetItemsIndex.end())
         {
-            if (this->threadShouldExit())
-            {
-                this->setRebuildingDiffMode(false);
-                this->sendChangeMessage();
-                return;
-            }
-
-            TrackedItem *targetItem = this->targetVcsItemsSource.getTrackedItem(j); // i.e. LayerTreeItem
-
-            // state item exists in project, adding `changed` record, if needed
-            if (stateItem->getUuid() == targetItem->getUuid())
-            {
-                foundItemInTarget = true;
-
-                UniquePointer<Diff> itemDiff(targetItem->getDiffLogic()->createDiff(*stateItem));
-
-                if (itemDiff->hasAnyChanges())
-                {
-                    RevisionItem::Ptr revisionRecord(new RevisionItem(RevisionItem::Type::Changed, itemDiff.get()));
-                    const ScopedWriteLock itemDiffLock(this->diffLock);
-                    this->diff->addItem(revisionRecord);
-                }
-
-                break;
-            }
+            // state item was not found in project, adding `removed` record
+            records.add({ RevisionItem::Type::Removed, nullptr, stateItem, 0, nullptr });
         }
-
-        // state item was not found in project, adding `removed` record
-        if (! foundItemInTarget)
+        else
         {
-            auto emptyDiff = make<Diff>(*stateItem);
-            RevisionItem::Ptr revisionRecord(new RevisionItem(RevisionItem::Type::Removed, emptyDiff.get()));
-            const ScopedWriteLock emptyDiffLock(this->diffLock);
-            this->diff->addItem(revisionRecord);
+            // state item exists in project, adding `changed` record, if needed;
+            // the generation is read before the diff is built, so that
+            // if the item changes meanwhile, the next rebuild will catch that
+            records.add({ RevisionItem::Type::Changed, target->second, stateItem,
+                target->second->getVCSChangeGeneration(), nullptr });
         }
     }
 
     // search for project item that are missing (or deleted) in the state
-    for (int i = 0; i < this->targetVcsItemsSource.getNumTrackedItems(); ++i)
+    for (auto *targetItem : targetItems)
     {
-        if (this->threadShouldExit())
+        const auto stateItem = this->state->getItemWithUuid(targetItem->getUuid());
+        if (stateItem == nullptr || stateItem->getType() == RevisionItem::Type::Removed)
         {
-            this->setRebuildingDiffMode(false);
-            this->sendChangeMessage();
-            return;
+            records.add({ RevisionItem::Type::Added, targetItem, stateItem,
+                targetItem->getVCSChangeGeneration(), nullptr });
         }
+    }
 
-        bool foundItemInState = false;
-        TrackedItem *targetItem = this->targetVcsItemsSource.getTrackedItem(i);
+    // reuse the changes of the items that haven't changed since the last time
+    Array<int> outdatedRecords;
+    for (int i = 0; i < records.size(); ++i)
+    {
+        auto &record = records.getReference(i);
+        if (record.targetItem == nullptr)
+        {
+            outdatedRecords.add(i);
+            continue;
+        }
 
-        for (int j = 0; j < this->state->getNumTrackedItems(); ++j)
+        const auto cached = this->changesCache.find(record.targetItem->getUuid());
+        if (cached != this->changesCache.end() &&
+            cached->second.itemGeneration == record.itemGeneration &&
+            cached->second.stateItem == record.stateItem)
         {
-            const RevisionItem::Ptr stateItem = static_cast<RevisionItem *>(this->state->getTrackedItem(j));
+            record.changes = cached->second.changes;
+        }
+        else
+        {
+            outdatedRecords.add(i);
+        }
+    }
 
-            if (stateItem->getType() == RevisionItem::Type::Removed) { continue; }
+    // the diffs of different items are independent, so they are built in parallel,
+    // each one into its own record, which keeps the resulting order deterministic
+    {
+        RenderWorkerPool workers(jmin(Head::maxDiffWorkers,
+            RenderWorkerPool::getOptimalNumWorkers(outdatedRecords.size())),
+            "DiffWorker", RenderWorkerPool::backgroundPriority);
 
-            if (stateItem->getUuid() == targetItem->getUuid())
+        workers.runAndWait(outdatedRecords.size(), [&](int taskIndex)
+        {
+            if (canBeInterrupted && this->threadShouldExit())
             {
-                foundItemInState = true;
-                break;
+                return;
             }
+
+            auto &record = records.getReference(outdatedRecords.getUnchecked(taskIndex));
+            record.changes = createChanges(record);
+        });
+    }
+
+    if (canBeInterrupted && this->threadShouldExit())
+    {
+        return false;
+    }
+
+    // this also drops the records of the items which are gone
+    ChangesCache updatedCache;
+    updatedCache.reserve(size_t(records.size()));
+
+    const ScopedWriteLock lock(this->diffLock);
+    for (const auto &record : records)
+    {
+        if (record.targetItem != nullptr)
+        {
+            updatedCache[record.targetItem->getUuid()] =
+                { record.itemGeneration, record.stateItem, record.changes };
         }
 
-        // copy deltas from targetItem and add `added` record
-        if (! foundItemInState)
+        if (record.changes != nullptr)
         {
-            RevisionItem::Ptr revisionRecord(new RevisionItem(RevisionItem::Type::Added, targetItem));
-            const ScopedWriteLock lock(this->diffLock);
-            this->diff->addItem(revisionRecord);
+            this->diff->addItem(record.changes);
         }
     }
 
-    this->setDiffOutdated(false);
-    this->setRebuildingDiffMode(false);
-    this->sendChangeMessage();
+    this->changesCache = move(updatedCache);
+    return true;
 }
 
-// FIXME: lots of duplicate code from Head::run
-void Head::rebuildDiffSynchronously()
+#if JUCE_UNIT_TESTS
+
+class HeadCheckoutBenchmark final : public UnitTest
 {
-    if (this->state == nullptr)
-    { return; }
-    
-    if (this->isRebuildingDiff())
-    { return; }
-    
-    this->setRebuildingDiffMode(true);
-    
-    {
-        const ScopedWriteLock lock(this->diffLock);
-        this->diff->reset();
-    }
-    
-    const ScopedReadLock rebuildStateLock(this->stateLock);
-    
-    for (int i = 0; i < this->state->getNumTrackedItems(); ++i)
+public:
+    HeadCheckoutBenchmark() : UnitTest("VCS head checkout benchmark", UnitTestCategories::helio) {}
+
+    void runTest() override
     {
-        bool foundItemInTarget = false;
-        const RevisionItem::Ptr stateItem = static_cast<RevisionItem *>(this->state->getTrackedItem(i));
-        
-        // will check `removed` records later
-        if (stateItem->getType() == RevisionItem::Type::Removed) { continue; }
-        
-        for (int j = 0; j < this->targetVcsItemsSource.getNumTrackedItems(); ++j)
+        for (const auto historyDepth : { 100, 1000, 5000 })
         {
-            TrackedItem *targetItem = this->targetVcsItemsSource.getTrackedItem(j); // i.e. LayerTreeItem
-            
-            // state item exists in project, adding `changed` record, if needed
-            if (stateItem->getUuid() == targetItem->getUuid())
+            beginTest("Checkout, " + String(historyDepth) + " revisions deep");
+
+            // a linear history, where the root adds a few items,
+            // and each next revision changes one of them
+            Array<Uuid> itemIds;
+            for (int i = 0; i < numItems; ++i)
             {
-                foundItemInTarget = true;
-                
-                UniquePointer<Diff> itemDiff(targetItem->getDiffLogic()->createDiff(*stateItem));
-                
-                if (itemDiff->hasAnyChanges())
-                {
-                    RevisionItem::Ptr revisionRecord(new RevisionItem(RevisionItem::Type::Changed, itemDiff.get()));
-                    const ScopedWriteLock lock(this->diffLock);
-                    this->diff->addItem(revisionRecord);
-                }
-                
-                break;
+                itemIds.add(Uuid());
+            }
+
+            ReferenceCountedArray<VCS::Revision> history;
+            history.add(new VCS::Revision());
+            for (const auto &id : itemIds)
+            {
+                TitleItem item(id, makeTitle(id, 0));
+                history.getFirst()->addItem(new VCS::RevisionItem(VCS::RevisionItem::Type::Added, &item));
+            }
+
+            for (int i = 1; i < historyDepth; ++i)
+            {
+                const auto &id = itemIds.getReference(i % numItems);
+                TitleItem item(id, makeTitle(id, i));
+
+                VCS::Revision::Ptr revision(new VCS::Revision());
+                revision->addItem(new VCS::RevisionItem(VCS::RevisionItem::Type::Changed, &item));
+                history.getLast()->addChild(revision);
+                history.add(revision);
+            }
+
+            TitlesSource project;
+            VCS::Head head(project);
+
+            // the first checkout replays the whole history and builds the keyframes
+            auto startTime = Time::getMillisecondCounterHiRes();
+            head.moveTo(history.getLast());
+            const auto coldCheckoutTime = Time::getMillisecondCounterHiRes() - startTime;
+
+            expectEquals(head.getNumKeyframes(), historyDepth / VCS::Head::snapshotKeyframeInterval);
+            this->expectCheckedOutRevision(head, project, itemIds, historyDepth - 1);
+
+            // the next ones only replay the revisions after the nearest keyframe
+            Random random(historyDepth);
+            int lastRevisionIndex = 0;
+            startTime = Time::getMillisecondCounterHiRes();
+            for (int i = 0; i < numCheckouts; ++i)
+            {
+                lastRevisionIndex = random.nextInt(historyDepth);
+                head.moveTo(history[lastRevisionIndex]);
             }
+            const auto cachedCheckoutTime = (Time::getMillisecondCounterHiRes() - startTime) / numCheckouts;
+
+            this->expectCheckedOutRevision(head, project, itemIds, lastRevisionIndex);
+
+            // without the keyframes, the same checkout replays everything again
+            head.resetKeyframes();
+            startTime = Time::getMillisecondCounterHiRes();
+            head.moveTo(history[lastRevisionIndex]);
+            const auto uncachedCheckoutTime = Time::getMillisecondCounterHiRes() - startTime;
+
+            this->expectCheckedOutRevision(head, project, itemIds, lastRevisionIndex);
+
+            logMessage("First checkout: " + String(coldCheckoutTime, 2) + "ms, " +
+                "with keyframes: " + String(cachedCheckoutTime, 3) + "ms on average, " +
+                "without keyframes: " + String(uncachedCheckoutTime, 2) + "ms");
         }
-        
-        // state item was not found in project, adding `removed` record
-        if (! foundItemInTarget)
+    }
+
+private:
+
+    static constexpr auto numItems = 8;
+    static constexpr auto numCheckouts = 100;
+
+    // a tracked item with a single delta and the project info diff logic,
+    // which merges the title delta by just taking the new one
+    class TitleItem final : public VCS::TrackedItem
+    {
+    public:
+
+        TitleItem(const Uuid &id, const String &title) :
+            delta(make<VCS::Delta>(VCS::DeltaDescription(),
+                Serialization::VCS::ProjectInfoDeltas::projectTitle)),
+            data(Serialization::VCS::ProjectInfoDeltas::projectTitle)
         {
-            auto emptyDiff = make<Diff>(*stateItem);
-            RevisionItem::Ptr revisionRecord(new RevisionItem(RevisionItem::Type::Removed, emptyDiff.get()));
-            const ScopedWriteLock lock(this->diffLock);
-            this->diff->addItem(revisionRecord);
+            this->vcsUuid = id;
+            this->data.setProperty(Serialization::VCS::ProjectInfoDeltas::projectTitle, title);
+            this->logic = make<VCS::ProjectInfoDiffLogic>(*this);
         }
-    }
-    
-    // search for project item that are missing (or deleted) in the state
-    for (int i = 0; i < this->targetVcsItemsSource.getNumTrackedItems(); ++i)
+
+        int getNumDeltas() const override { return 1; }
+        VCS::Delta *getDelta(int index) const override { return this->delta.get(); }
+        SerializedData getDeltaData(int deltaIndex) const override { return this->data; }
+        String getVCSName() const override { return "title"; }
+        VCS::DiffLogic *getDiffLogic() const override { return this->logic.get(); }
+        void resetStateTo(const VCS::TrackedItem &newState) override {}
+
+    private:
+
+        UniquePointer<VCS::Delta> delta;
+        SerializedData data;
+        UniquePointer<VCS::ProjectInfoDiffLogic> logic;
+    };
+
+    // only collects the titles of the checked out items
+    class TitlesSource final : public VCS::TrackedItemsSource
     {
-        bool foundItemInState = false;
-        TrackedItem *targetItem = this->targetVcsItemsSource.getTrackedItem(i);
-        
-        for (int j = 0; j < this->state->getNumTrackedItems(); ++j)
+    public:
+
+        String getVCSId() const override { return "benchmark"; }
+        String getVCSName() const override { return "benchmark"; }
+
+        int getNumTrackedItems() override { return 0; }
+        VCS::TrackedItem *getTrackedItem(int index) override { return nullptr; }
+
+        VCS::TrackedItem *initTrackedItem(const Identifier &type,
+            const Uuid &id, const VCS::TrackedItem &newState) override
         {
-            const RevisionItem::Ptr stateItem = static_cast<RevisionItem *>(this->state->getTrackedItem(j));
-            
-            if (stateItem->getType() == RevisionItem::Type::Removed) { continue; }
-            
-            if (stateItem->getUuid() == targetItem->getUuid())
-            {
-                foundItemInState = true;
-                break;
-            }
+            this->titles.set(id.toString(), newState.getDeltaData(0)
+                .getProperty(Serialization::VCS::ProjectInfoDeltas::projectTitle));
+            return nullptr;
         }
-        
-        // copy deltas from targetItem and add `added` record
-        if (! foundItemInState)
+
+        void onBeforeResetState() override { this->titles.clear(); }
+        void onResetState() override {}
+
+        HashMap<String, String> titles;
+    };
+
+    static String makeTitle(const Uuid &id, int revisionIndex)
+    {
+        return id.toString() + ":" + String(revisionIndex);
+    }
+
+    // each item should have the title set by the latest revision changing it,
+    // i.e. the one with the index n, where n % numItems == item index
+    void expectCheckedOutRevision(VCS::Head &head, const TitlesSource &project,
+        const Array<Uuid> &itemIds, int revisionIndex)
+    {
+        head.checkout();
+
+        expectEquals(project.titles.size(), itemIds.size());
+        for (int i = 0; i < itemIds.size(); ++i)
         {
-            RevisionItem::Ptr revisionRecord(new RevisionItem(RevisionItem::Type::Added, targetItem));
-            const ScopedWriteLock lock(this->diffLock);
-            this->diff->addItem(revisionRecord);
+            const auto lastChange = jmax(0, revisionIndex - (revisionIndex - i + numItems) % numItems);
+            const auto &id = itemIds.getReference(i);
+            expectEquals(project.titles[id.toString()], makeTitle(id, lastChange));
         }
     }
-    
-    this->setDiffOutdated(false);
-    this->setRebuildingDiffMode(false);
-    this->sendChangeMessage();
-}
+};
 
-}
+static HeadCheckoutBenchmark headCheckoutBenchmark;
+
+#endif
@@ -52,6 +52,14 @@ namespace VCS
         bool moveTo(const Revision::Ptr revision); // rebuilds state index
         void pointTo(const Revision::Ptr revision); // does not rebuild index
 
+        // moveTo() keeps the materialized states of every Nth revision
+        // on the way, and then only replays the revisions after the nearest one;
+        // these must be invalidated when the revision's items are changed
+        static constexpr auto snapshotKeyframeInterval = 32;
+        void invalidateKeyframes(const Revision::Ptr revision); // and descendants
+        void resetKeyframes();
+        int getNumKeyframes() const noexcept;
+
         void checkout();
         void cherryPick(const Array<Uuid> uuids);
         void cherryPickAll();
@@ -82,6 +90,7 @@ namespace VCS
         //===--------------------------------------------------------------===//
 
         void run() override;
+        bool rebuildDiff(bool canBeInterrupted); // false if interrupted
         void checkoutItem(RevisionItem::Ptr stateItem);
         bool resetChangedItemToState(const RevisionItem::Ptr diffItem);
 
@@ -94,12 +103,39 @@ namespace VCS
         ReadWriteLock rebuildingDiffLock;
         bool rebuildingDiffMode;
 
+        // the last computed changes of each item, reused while
+        // neither the item, nor its record in the state has changed,
+        // so that a single edit doesn't re-diff the whole project;
+        // only accessed when rebuilding the diff
+        struct CachedChanges final
+        {
+            uint32 itemGeneration = 0;
+            RevisionItem::Ptr stateItem; // nullptr, if missing in the state
+            RevisionItem::Ptr changes; // nullptr, if nothing has changed
+        };
+
+        using ChangesCache = FlatHashMap<Uuid, CachedChanges, UuidHash>;
+        ChangesCache changesCache;
+
+        // the outdated items are diffed in parallel, on up to this many
+        // worker threads plus the thread rebuilding the diff
+        static constexpr auto maxDiffWorkers = 7;
+
     private:
 
         Revision::Ptr headingAt;
         ReadWriteLock stateLock;
         UniquePointer<Snapshot> state;
 
+        // the revision the state is built for, if known,
+        // so that moving to its descendant doesn't need to start over
+        String stateRevisionId;
+
+        FlatHashMap<String, UniquePointer<Snapshot>, StringHash> keyframes;
+
+        void applyRevisionItems(const Revision *revision);
+        void invalidateKeyframesRecursively(const Revision *revision);
+
     private:
 
         TrackedItemsSource &targetVcsItemsSource;
@@ -23,10 +23,12 @@ namespace VCS
 {
 
 Snapshot::Snapshot(const Snapshot &other) :
-    items(other.items) {}
+    items(other.items),
+    itemsIndex(other.itemsIndex) {}
 
 Snapshot::Snapshot(const Snapshot *other) :
-    items(other->items) {}
+    items(other->items),
+    itemsIndex(other->itemsIndex) {}
 
 void Snapshot::addItem(RevisionItem::Ptr item)
 {
@@ -42,11 +44,14 @@ void Snapshot::addItem(RevisionItem::Ptr item)
         this->items.removeAllInstancesOf(ownItem);
         this->items.addIfNotAlreadyThere(item);
     }
+
+    this->addToIndex(item);
 }
 
 void Snapshot::removeItem(RevisionItem::Ptr item)
 {
     this->items.removeAllInstancesOf(item);
+    this->removeFromIndex(item);
 
     RevisionItem::Ptr ownItem = this->getItemWithSameUuid(item);
 
@@ -57,6 +62,7 @@ void Snapshot::removeItem(RevisionItem::Ptr item)
 
     // removed-запись
     this->items.addIfNotAlreadyThere(item);
+    this->addToIndex(item);
 }
 
 void Snapshot::mergeItem(RevisionItem::Ptr newItem)
@@ -72,6 +78,7 @@ void Snapshot::mergeItem(RevisionItem::Ptr newItem)
             RevisionItem::Ptr mergedItem(new RevisionItem(stateItem->getType(), diff.get()));
             this->items.removeAllInstancesOf(stateItem);
             this->items.add(mergedItem);
+            this->addToIndex(mergedItem);
         }
     }
     else
@@ -102,15 +109,27 @@ RevisionItem::Ptr Snapshot::getItemWithSameUuid(RevisionItem::Ptr item) const
 
 RevisionItem::Ptr Snapshot::getItemWithUuid(const Uuid &uuid) const
 {
-    for (auto &item : this->items)
+    const auto found = this->itemsIndex.find(uuid);
+    if (found != this->itemsIndex.end())
     {
-        if (item->getUuid() == uuid)
-        {
-            return item;
-        }
+        return found->second;
     }
 
     return nullptr;
 }
 
+void Snapshot::addToIndex(RevisionItem::Ptr item)
+{
+    this->itemsIndex[item->getUuid()] = item.get();
+}
+
+void Snapshot::removeFromIndex(RevisionItem::Ptr item)
+{
+    const auto found = this->itemsIndex.find(item->getUuid());
+    if (found != this->itemsIndex.end() && found->second == item.get())
+    {
+        this->itemsIndex.erase(found);
+    }
+}
+
 }
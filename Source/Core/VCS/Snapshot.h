@@ -55,8 +55,15 @@ namespace VCS
 
         RevisionItem::Ptr getItemWithSameUuid(RevisionItem::Ptr item) const;
 
+        void addToIndex(RevisionItem::Ptr item);
+        void removeFromIndex(RevisionItem::Ptr item);
+
         Array<RevisionItem::Ptr> items;
 
+        // the snapshot keeps at most one record per uuid,
+        // but the lookups happen for each item when building the diff
+        FlatHashMap<Uuid, RevisionItem *, UuidHash> itemsIndex;
+
         JUCE_LEAK_DETECTOR(Snapshot);
     };
 } // namespace VCS
@@ -52,9 +52,19 @@ namespace VCS
             this->vcsUuid = tree.getProperty(Serialization::VCS::vcsItemId, this->vcsUuid.toString());
         }
 
+        // the project bumps the generation on every change of the item,
+        // so that the head only has to re-diff the items that have changed
+        uint32 getVCSChangeGeneration() const noexcept { return this->vcsChangeGeneration.get(); }
+        void markVCSChanged() noexcept { this->vcsChangeGeneration += 1; }
+
     protected:
 
         Uuid vcsUuid; // needs to be serialized by subclasses
 
+    private:
+
+        // read from the diff thread
+        Atomic<uint32> vcsChangeGeneration = 0;
+
     };
 } // namespace VCS
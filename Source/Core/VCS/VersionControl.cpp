@@ -84,6 +84,8 @@ void VersionControl::replaceHistory(const VCS::Revision::Ptr root)
     // which means we're cloning project and replacing stub root with valid one:
     DBG("Replacing history tree");
     this->rootRevision = root;
+    // the cached states belong to the old history:
+    this->head.resetKeyframes();
     // make sure head doesn't point to replaced revision:
     this->head.moveTo(this->rootRevision);
     this->sendChangeMessage();
@@ -122,6 +124,7 @@ void VersionControl::quickAmendItem(VCS::TrackedItem *targetItem)
     // changes and deletions to committed items will not work:
     VCS::RevisionItem::Ptr revisionRecord(new VCS::RevisionItem(VCS::RevisionItem::Type::Added, targetItem));
     this->head.getHeadingRevision()->addItem(revisionRecord);
+    this->head.invalidateKeyframes(this->head.getHeadingRevision());
     this->head.moveTo(this->head.getHeadingRevision());
     this->sendChangeMessage();
 }
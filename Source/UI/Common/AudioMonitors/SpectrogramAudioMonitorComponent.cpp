@@ -50,6 +50,7 @@ SpectrogramAudioMonitorComponent::SpectrogramAudioMonitorComponent(WeakReference
 
     if (this->audioMonitor != nullptr)
     {
+        this->setAnalysisParameters();
         this->startThread(5);
     }
 }
@@ -59,10 +60,18 @@ void SpectrogramAudioMonitorComponent::setTargetAnalyzer(WeakReference<AudioMoni
     if (monitor != nullptr)
     {
         this->audioMonitor = monitor;
+        this->setAnalysisParameters();
         this->startThread(5);
     }
 }
 
+void SpectrogramAudioMonitorComponent::setAnalysisParameters()
+{
+    this->audioMonitor->setSpectrumAnalysisParameters(
+        SpectrogramAudioMonitorComponent::analysisFftSize,
+        1000 / SpectrogramAudioMonitorComponent::refreshIntervalMs);
+}
+
 SpectrogramAudioMonitorComponent::~SpectrogramAudioMonitorComponent()
 { 
     this->stopThread(1000);
@@ -72,7 +81,8 @@ void SpectrogramAudioMonitorComponent::run()
 {
     while (! this->threadShouldExit())
     {
-        Thread::sleep(jlimit(10, 100, 35 - this->skewTime));
+        Thread::sleep(jlimit(10, 100,
+            SpectrogramAudioMonitorComponent::refreshIntervalMs - this->skewTime));
         const double b = Time::getMillisecondCounterHiRes();
 
         if (this->isVisible())
@@ -72,6 +72,13 @@ private:
     UniquePointer<SpectrumBand> rPeakBand;
 
     static constexpr auto numBands = 11;
+
+    // the monitor only needs to update the spectrum as often as it is polled;
+    // the lowest band is at 63 Hz, so the analysis window is a bit longer
+    // than the minimal one to keep the low end steadier
+    static constexpr auto refreshIntervalMs = 35;
+    static constexpr auto analysisFftSize = 1024;
+    void setAnalysisParameters();
     Atomic<float> values[SpectrogramAudioMonitorComponent::numBands];
 
     Atomic<float> lPeak;
@@ -21,6 +21,8 @@
 #include "ProjectNode.h"
 #include "ProgressIndicator.h"
 #include "MenuItemComponent.h"
+#include "RendererThread.h"
+#include "Config.h"
 
 RenderDialog::RenderDialog(ProjectNode &parentProject,
     const URL &target, RenderFormat format) :
@@ -79,10 +81,20 @@ RenderDialog::RenderDialog(ProjectNode &parentProject,
     this->addAndMakeVisible(this->separator.get());
     this->separator->setBounds(32, 121, 456, 8);
 
+    // each instrument can also be rendered into a file of its own
+    this->stemsToggle = make<ToggleButton>(TRANS(I18n::Dialog::renderStems));
+    this->addAndMakeVisible(this->stemsToggle.get());
+
+    // while rendering, shows the instruments which are not done yet
+    this->instrumentsProgressLabel = make<Label>();
+    this->addChildComponent(this->instrumentsProgressLabel.get());
+    this->instrumentsProgressLabel->setFont({ 16.f });
+    this->instrumentsProgressLabel->setJustificationType(Justification::centredLeft);
+
     // just in case..
     this->project.getTransport().stopPlaybackAndRecording();
 
-    this->setSize(520, 224);
+    this->setSize(520, 252);
     this->updatePosition();
     this->updateRenderTargetLabels();
 }
@@ -98,6 +110,8 @@ void RenderDialog::resized()
     indicator->setBounds((getWidth() / 2) + -212 - (32 / 2), 139 + 12 / 2 + -2 - (32 / 2), 32, 32);
     browseButton->setBounds(getWidth() - 448 - 48, 59, 48, 48);
     pathEditor->setBounds((getWidth() / 2) + 25 - (406 / 2), 48, 406, 24);
+    stemsToggle->setBounds((getWidth() / 2) + 24 - (392 / 2), 163, 392, 24);
+    instrumentsProgressLabel->setBounds(stemsToggle->getBounds());
 
     this->renderButton->setBounds(this->getButtonsBounds());
 }
@@ -177,7 +191,16 @@ void RenderDialog::startOrAbortRender()
     auto &transport = this->project.getTransport();
     if (! transport.isRendering())
     {
-        transport.startRender(this->renderTarget, this->format);
+        // larger blocks mean less synchronization between the rendering threads,
+        // there's no UI for this, but the value is kept in the config to be tweaked
+        const auto blockSize = jlimit(32, 8192,
+            App::Config().getProperty(Serialization::Config::renderBlockSize,
+                String(RendererThread::defaultBlockSize)).getIntValue());
+
+        App::Config().setProperty(Serialization::Config::renderBlockSize, blockSize);
+
+        transport.startRender(this->renderTarget, this->format,
+            blockSize, this->stemsToggle->getToggleState());
         this->startTrackingProgress();
     }
     else
@@ -210,6 +233,7 @@ void RenderDialog::timerCallback(int timerId)
     {
         const float percentsDone = transport.getRenderingPercentsComplete();
         this->slider->setValue(percentsDone, dontSendNotification);
+        this->updateInstrumentsProgress();
     }
     else
     {
@@ -225,6 +249,10 @@ void RenderDialog::startTrackingProgress()
     this->indicator->startAnimating();
     this->animator.fadeIn(this->indicator.get(), Globals::UI::fadeInLong);
     this->renderButton->setButtonText(TRANS(I18n::Dialog::renderAbort));
+    this->stemsToggle->setEnabled(false);
+    this->stemsToggle->setVisible(false);
+    this->instrumentsProgressLabel->setText({}, dontSendNotification);
+    this->instrumentsProgressLabel->setVisible(true);
 }
 
 void RenderDialog::stopTrackingProgress()
@@ -238,4 +266,26 @@ void RenderDialog::stopTrackingProgress()
     this->animator.fadeOut(this->indicator.get(), Globals::UI::fadeOutLong);
     this->indicator->stopAnimating();
     this->renderButton->setButtonText(TRANS(I18n::Dialog::renderProceed));
+    this->stemsToggle->setEnabled(true);
+    this->stemsToggle->setVisible(true);
+    this->instrumentsProgressLabel->setVisible(false);
+}
+
+void RenderDialog::updateInstrumentsProgress()
+{
+    const auto &transport = this->project.getTransport();
+
+    StringArray pendingInstruments;
+    for (const auto *instrument : transport.getRenderedInstruments())
+    {
+        const auto percentsDone = transport.getRenderingPercentsComplete(instrument);
+        if (percentsDone < 1.f)
+        {
+            pendingInstruments.add(instrument->getName() +
+                " " + String(roundToInt(percentsDone * 100.f)) + "%");
+        }
+    }
+
+    this->instrumentsProgressLabel->setText(pendingInstruments.joinIntoString(", "),
+        dontSendNotification);
 }
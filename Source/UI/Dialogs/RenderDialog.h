@@ -48,6 +48,7 @@ private:
 
     void startTrackingProgress();
     void stopTrackingProgress();
+    void updateInstrumentsProgress();
 
     ComponentAnimator animator;
     ProjectNode &project;
@@ -71,6 +72,8 @@ private:
     UniquePointer<MenuItemComponent> browseButton;
     UniquePointer<Label> pathEditor;
     UniquePointer<SeparatorHorizontalFading> separator;
+    UniquePointer<ToggleButton> stemsToggle;
+    UniquePointer<Label> instrumentsProgressLabel;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RenderDialog)
 };
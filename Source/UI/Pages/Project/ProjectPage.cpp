@@ -302,7 +302,7 @@ void ProjectPage::updateContent()
     this->licenseEditor->setText(license.isEmpty() ? TRANS(I18n::Page::projectDefaultLicense) : license, dontSendNotification);
 
     this->startTimeText->setText(startTime, dontSendNotification);
-    this->locationText->setText(this->project.getDocument()->getFullPath(), dontSendNotification);
+    this->locationText->setText(this->getLocationString(), dontSendNotification);
     this->contentStatsText->setText(this->project.getStats(), dontSendNotification);
     this->temperamentText->setText(temperamentName, dontSendNotification);
 
@@ -312,6 +312,21 @@ void ProjectPage::updateContent()
     }
 }
 
+String ProjectPage::getLocationString() const
+{
+    const auto *document = this->project.getDocument();
+    const auto saveStats = document->getLastSaveStats();
+    if (saveStats.numBytesWritten == 0)
+    {
+        return document->getFullPath();
+    }
+
+    // the file size and the time it took to serialize and write it
+    return document->getFullPath() + " (" +
+        File::descriptionOfSizeInBytes(saveStats.numBytesWritten) + ", " +
+        String(saveStats.serializationTimeMs + saveStats.writeTimeMs, 0) + " ms)";
+}
+
 void ProjectPage::onSeek(float beatPosition, double currentTimeMs, double totalTimeMs)
 {
     this->totalTimeMs = totalTimeMs;
@@ -49,6 +49,8 @@ private:
 
     void changeListenerCallback(ChangeBroadcaster *source) override;
 
+    String getLocationString() const;
+
     //===----------------------------------------------------------------------===//
     // TransportListener
     //===----------------------------------------------------------------------===//
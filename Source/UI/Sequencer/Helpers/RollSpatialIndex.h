@@ -0,0 +1,182 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// A uniform grid over the beats and rows (keys in the piano roll),
+// which helps to find the items in the visible area or under the mouse
+// by only looking at a few cells instead of checking all the items;
+// each item is stored in every cell its beat range overlaps, and the index
+// only knows the coordinates the item was added with, so the owner has to
+// remove it with the same coordinates before the item changes
+
+template <typename T>
+class RollSpatialIndex final
+{
+public:
+
+    RollSpatialIndex() = default;
+
+    RollSpatialIndex(float cellLengthInBeats, int cellHeightInRows) noexcept :
+        cellLength(cellLengthInBeats), cellHeight(cellHeightInRows) {}
+
+    void add(const T &item, float startBeat, float endBeat, int row)
+    {
+        const auto firstColumn = this->getColumn(startBeat);
+        const auto lastColumn = this->getColumn(jmax(startBeat, endBeat));
+        const auto cellRow = this->getCellRow(row);
+
+        for (int column = firstColumn; column <= lastColumn; ++column)
+        {
+            this->cells[getCellKey(column, cellRow)].add({ item, firstColumn });
+        }
+
+        this->numItems++;
+    }
+
+    bool remove(const T &item, float startBeat, float endBeat, int row)
+    {
+        const auto firstColumn = this->getColumn(startBeat);
+        const auto lastColumn = this->getColumn(jmax(startBeat, endBeat));
+        const auto cellRow = this->getCellRow(row);
+
+        bool found = false;
+        for (int column = firstColumn; column <= lastColumn; ++column)
+        {
+            const auto cell = this->cells.find(getCellKey(column, cellRow));
+            if (cell == this->cells.end())
+            {
+                continue;
+            }
+
+            auto &entries = cell.value();
+            for (int i = 0; i < entries.size(); ++i)
+            {
+                if (entries.getReference(i).item == item)
+                {
+                    entries.remove(i);
+                    found = true;
+                    break;
+                }
+            }
+
+            if (entries.isEmpty())
+            {
+                this->cells.erase(cell);
+            }
+        }
+
+        if (found)
+        {
+            this->numItems--;
+        }
+
+        jassert(found); // the coordinates are not the ones the item was added with?
+        return found;
+    }
+
+    void clear()
+    {
+        this->cells.clear();
+        this->numItems = 0;
+    }
+
+    // Collects each item, which might intersect the given range, exactly once;
+    // the items are only filtered by cells, the precise check is up to the caller
+    void findItems(Array<T> &result, float startBeat, float endBeat,
+        int minRow, int maxRow) const
+    {
+        if (this->numItems == 0)
+        {
+            return;
+        }
+
+        const auto firstColumn = this->getColumn(startBeat);
+        const auto lastColumn = this->getColumn(jmax(startBeat, endBeat));
+        const auto firstCellRow = this->getCellRow(minRow);
+        const auto lastCellRow = this->getCellRow(jmax(minRow, maxRow));
+
+        for (int cellRow = firstCellRow; cellRow <= lastCellRow; ++cellRow)
+        {
+            for (int column = firstColumn; column <= lastColumn; ++column)
+            {
+                const auto cell = this->cells.find(getCellKey(column, cellRow));
+                if (cell == this->cells.end())
+                {
+                    continue;
+                }
+
+                // an item spanning several cells is only reported
+                // in its first cell which falls into the search range
+                for (const auto &entry : cell->second)
+                {
+                    if (entry.firstColumn == column ||
+                        (column == firstColumn && entry.firstColumn < firstColumn))
+                    {
+                        result.add(entry.item);
+                    }
+                }
+            }
+        }
+    }
+
+    inline int size() const noexcept
+    {
+        return this->numItems;
+    }
+
+    inline int getNumCells() const noexcept
+    {
+        return int(this->cells.size());
+    }
+
+    // one cell is four bars wide and one octave high by default
+    static constexpr auto defaultCellLength = 16.f;
+    static constexpr auto defaultCellHeight = 12;
+
+private:
+
+    struct Entry final
+    {
+        T item;
+        int firstColumn;
+    };
+
+    inline int getColumn(float beat) const noexcept
+    {
+        return int(floorf(beat / this->cellLength));
+    }
+
+    inline int getCellRow(int row) const noexcept
+    {
+        return row >= 0 ? row / this->cellHeight :
+            (row - this->cellHeight + 1) / this->cellHeight;
+    }
+
+    static inline int64 getCellKey(int column, int cellRow) noexcept
+    {
+        return (int64(column) << 32) | int64(uint32(cellRow));
+    }
+
+    float cellLength = RollSpatialIndex::defaultCellLength;
+    int cellHeight = RollSpatialIndex::defaultCellHeight;
+
+    FlatHashMap<int64, Array<Entry>> cells;
+    int numItems = 0;
+
+    JUCE_LEAK_DETECTOR(RollSpatialIndex)
+};
@@ -369,7 +369,7 @@ void HybridRoll::longTapEvent(const Point<float> &position,
     if (target == this &&
         !this->project.getEditMode().forbidsSelectionMode())
     {
-        this->lassoComponent->beginLasso(position, this);
+        this->beginLasso(position);
         return;
     }
 }
@@ -1017,7 +1017,7 @@ void HybridRoll::mouseDown(const MouseEvent &e)
 
     if (this->isLassoEvent(e))
     {
-        this->lassoComponent->beginLasso(e.position, this);
+        this->beginLasso(e.position);
     }
     else if (this->isViewportDragEvent(e))
     {
@@ -1638,6 +1638,14 @@ bool HybridRoll::isAddEvent(const MouseEvent &e) const
     return false;
 }
 
+void HybridRoll::beginLasso(const Point<float> &position)
+{
+    // otherwise the first drag step would also search
+    // the area left over from the previous lasso
+    this->lastLassoArea = {};
+    this->lassoComponent->beginLasso(position, this);
+}
+
 bool HybridRoll::isLassoEvent(const MouseEvent &e) const
 {
     if (this->project.getEditMode().forbidsSelectionMode()) { return false; }
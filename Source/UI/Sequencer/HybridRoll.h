@@ -393,6 +393,11 @@ protected:
     UniquePointer<SelectionComponent> lassoComponent;
 
 protected:
+
+    // the lasso area at the previous drag step, so that the subclasses only
+    // update the items under it or under the current one; reset for each new lasso
+    Rectangle<int> lastLassoArea;
+    void beginLasso(const Point<float> &position);
     
     Array<float> visibleBars;
     Array<float> visibleBeats;
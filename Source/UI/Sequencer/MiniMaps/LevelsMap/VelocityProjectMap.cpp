@@ -29,156 +29,6 @@
 #include "NoteComponent.h"
 #include "FineTuningValueIndicator.h"
 
-#define VELOCITY_MAP_BULK_REPAINT_START \
-    if (this->isEnabled()) { this->setVisible(false); }
-
-#define VELOCITY_MAP_BULK_REPAINT_END \
-    if (this->isEnabled()) { this->setVisible(true); }
-
-//===----------------------------------------------------------------------===//
-// Child level component
-//===----------------------------------------------------------------------===//
-
-class VelocityMapNoteComponent final : public Component
-{
-public:
-
-    VelocityMapNoteComponent(const Note &note, const Clip &clip) :
-        note(note),
-        clip(clip)
-    {
-        this->updateColour();
-        this->setInterceptsMouseClicks(true, false);
-        this->setMouseClickGrabsKeyboardFocus(false);
-        this->setPaintingIsUnclipped(true);
-        this->setMouseCursor(MouseCursor::UpDownResizeCursor);
-    }
-
-    inline float getBeat() const noexcept
-    {
-        return this->note.getBeat() + this->clip.getBeat();
-    }
-
-    inline float getLength() const noexcept
-    {
-        return this->note.getLength();
-    }
-
-    inline float getVelocity() const noexcept
-    {
-        return this->note.getVelocity() * this->clip.getVelocity();
-    }
-
-    Line<float> getStartLine() const noexcept
-    {
-        const float x = this->getX() + this->dx;
-        return { x, 0.f, x, float(Globals::UI::levelsMapHeight) };
-    }
-
-    Line<float> getEndLine() const noexcept
-    {
-        const float x = this->getX() + this->dx + this->getWidth() + this->dw;
-        return { x, 0.f, x, float(Globals::UI::levelsMapHeight) };
-    }
-
-    inline void updateColour()
-    {
-        const Colour baseColour(findDefaultColour(ColourIDs::Roll::noteFill));
-        this->colour = this->note.getTrackColour().
-            interpolatedWith(baseColour, this->editable ? .4f : .55f).
-            withAlpha(this->editable ? 0.7f : .1f);
-    }
-
-    void setRealBounds(float x, int y, float w, int h) noexcept
-    {
-        this->dx = x - floorf(x);
-        this->dw = w - ceilf(w);
-        this->setBounds(int(floorf(x)), y, int(ceilf(w)), h);
-    }
-
-    bool isEditable() const noexcept
-    {
-        return this->editable;
-    }
-
-    void setEditable(bool editable)
-    {
-        if (this->editable == editable)
-        {
-            return;
-        }
-
-        this->editable = editable;
-
-        this->setEnabled(editable);
-        this->updateColour();
-
-        if (this->editable)
-        {
-            // toBack() and toFront() use indexOf(this) so calling them sucks
-            this->toFront(false);
-        }
-    }
-
-    //===------------------------------------------------------------------===//
-    // Component
-    //===------------------------------------------------------------------===//
-
-    void paint(Graphics &g) noexcept override
-    {
-        g.setColour(this->colour);
-        g.fillRect(this->dx, 0.f, float(this->getWidth()) + this->dw, float(this->getHeight()));
-        g.fillRect(this->dx, 0.f, float(this->getWidth()) + this->dw, 2.f);
-    }
-
-    bool hitTest(int, int y) noexcept override
-    {
-        // can be dragged individually by header line
-        return this->editable && y <= 4;
-    }
-
-    void mouseDown(const MouseEvent &e) override
-    {
-        if (e.mods.isLeftButtonDown())
-        {
-            this->note.getSequence()->checkpoint();
-            this->velocityAnchor = this->getVelocity();
-        }
-    }
-
-    void mouseDrag(const MouseEvent &e) override
-    {
-        const auto newVelocity = jlimit(0.f, 1.f, this->velocityAnchor -
-            float(e.getDistanceFromDragStartY()) / float(Globals::UI::levelsMapHeight));
-
-        static_cast<PianoSequence *>(this->note.getSequence())->
-            change(this->note, this->note.withVelocity(newVelocity), true);
-    }
-
-private:
-
-    friend class VelocityProjectMap;
-
-    VelocityProjectMap *getParentMap() const
-    {
-        jassert(this->getParentComponent());
-        return static_cast<VelocityProjectMap *>(this->getParentComponent());
-    }
-
-    const Note &note;
-    const Clip &clip;
-
-    Colour colour;
-
-    float dx = 0.f;
-    float dw = 0.f;
-
-    float velocityAnchor = 0.f;
-    bool editable = true;
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VelocityMapNoteComponent)
-};
-
 //===----------------------------------------------------------------------===//
 // Dragging helper
 //===----------------------------------------------------------------------===//
@@ -302,6 +152,7 @@ private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VelocityLevelDraggingHelper);
 };
 
+
 //===----------------------------------------------------------------------===//
 // The map itself
 //===----------------------------------------------------------------------===//
@@ -336,38 +187,102 @@ VelocityProjectMap::~VelocityProjectMap()
 
 void VelocityProjectMap::resized()
 {
-    VELOCITY_MAP_BULK_REPAINT_START
+    if (this->dragHelper != nullptr)
+    {
+        this->dragHelper->updateBounds();
+    }
+
+    this->repaint();
+}
+
+void VelocityProjectMap::paint(Graphics &g)
+{
+    const auto paintArea = g.getClipBounds().toFloat();
+    const auto startBeat = this->getBeatByX(paintArea.getX());
+    const auto endBeat = this->getBeatByX(paintArea.getRight());
 
-    for (const auto &c : this->patternMap)
+    const Colour baseColour(findDefaultColour(ColourIDs::Roll::noteFill));
+
+    // the editable levels are painted on top of the rest,
+    // so the active clip goes last, and its editable notes go last in it
+    auto paintLevels = [&](const Clip &clip, bool editablePass)
     {
-        const auto sequenceMap = c.second.get();
-        for (const auto &e : *sequenceMap)
+        const auto *sequence = clip.getPattern()->getTrack()->getSequence();
+        const auto range = this->findNotesInRange(clip, startBeat, endBeat);
+        if (range.isEmpty())
         {
-            jassert(e.second.get());
-            this->applyNoteBounds(e.second.get());
+            return;
+        }
+
+        g.setColour(clip.getTrackColour().
+            interpolatedWith(baseColour, editablePass ? .4f : .55f).
+            withAlpha(editablePass ? 0.7f : .1f));
+
+        for (int i = range.getStart(); i < range.getEnd(); ++i)
+        {
+            const auto &note = static_cast<const Note &>(*sequence->getUnchecked(i));
+            if (this->isEditable(clip, note) != editablePass)
+            {
+                continue;
+            }
+
+            const auto bounds = this->getLevelBounds(clip, note);
+            g.fillRect(bounds);
+            g.fillRect(bounds.withHeight(2.f));
+        }
+    };
+
+    const Clip *activeClip = nullptr;
+    for (const auto *track : this->pianoTracks)
+    {
+        for (const auto *clip : track->getPattern()->getClips())
+        {
+            if (*clip == this->activeClip)
+            {
+                activeClip = clip;
+                continue;
+            }
+
+            paintLevels(*clip, false);
         }
     }
 
-    if (this->dragHelper != nullptr)
+    if (activeClip != nullptr)
     {
-        this->dragHelper->updateBounds();
+        paintLevels(*activeClip, false);
+        paintLevels(*activeClip, true);
     }
+}
 
-    VELOCITY_MAP_BULK_REPAINT_END
+void VelocityProjectMap::mouseMove(const MouseEvent &e)
+{
+    this->setMouseCursor(this->findEditableNoteAt(e.position) != nullptr ?
+        MouseCursor::UpDownResizeCursor : MouseCursor::NormalCursor);
 }
 
 void VelocityProjectMap::mouseDown(const MouseEvent &e)
 {
-    if (e.mods.isLeftButtonDown())
+    if (!e.mods.isLeftButtonDown())
     {
-        this->volumeBlendingIndicator->toFront(false);
-        this->updateVolumeBlendingIndicator(e.getPosition());
+        return;
+    }
 
-        this->dragHelper = make<VelocityLevelDraggingHelper>(*this);
-        this->addAndMakeVisible(this->dragHelper.get());
-        this->dragHelper->setStartPosition(e.position);
-        this->dragHelper->setEndPosition(e.position);
+    if (const auto *note = this->findEditableNoteAt(e.position))
+    {
+        this->isDraggingNote = true;
+        this->draggedNote = *note;
+        this->draggedNoteVelocityAnchor = note->getVelocity() * this->activeClip.getVelocity();
+        this->draggedNote.getSequence()->checkpoint();
+        return;
     }
+
+    this->volumeBlendingIndicator->toFront(false);
+    this->updateVolumeBlendingIndicator(e.getPosition());
+
+    this->dragHelper = make<VelocityLevelDraggingHelper>(*this);
+    this->addAndMakeVisible(this->dragHelper.get());
+    this->dragHelper->setStartPosition(e.position);
+    this->dragHelper->setEndPosition(e.position);
 }
 
 constexpr float getVelocityByIntersection(const Point<float> &intersection)
@@ -377,7 +292,18 @@ constexpr float getVelocityByIntersection(const Point<float> &intersection)
 
 void VelocityProjectMap::mouseDrag(const MouseEvent &e)
 {
-    if (this->dragHelper != nullptr)
+    if (this->isDraggingNote)
+    {
+        const auto newVelocity = jlimit(0.f, 1.f, this->draggedNoteVelocityAnchor -
+            float(e.getDistanceFromDragStartY()) / float(Globals::UI::levelsMapHeight));
+
+        const auto newNote = this->draggedNote.withVelocity(newVelocity);
+        static_cast<PianoSequence *>(this->draggedNote.getSequence())->
+            change(this->draggedNote, newNote, true);
+
+        this->draggedNote = newNote;
+    }
+    else if (this->dragHelper != nullptr)
     {
         this->updateVolumeBlendingIndicator(e.getPosition());
         this->dragHelper->setEndPosition(e.position);
@@ -388,6 +314,8 @@ void VelocityProjectMap::mouseDrag(const MouseEvent &e)
 
 void VelocityProjectMap::mouseUp(const MouseEvent &e)
 {
+    this->isDraggingNote = false;
+
     if (this->dragHelper != nullptr)
     {
         this->volumeBlendingIndicator->setVisible(false);
@@ -420,28 +348,14 @@ void VelocityProjectMap::mouseWheelMove(const MouseEvent &e, const MouseWheelDet
 // ProjectListener
 //===----------------------------------------------------------------------===//
 
-#define forEachSequenceMapOfGivenTrack(map, child, track) \
-    for (const auto &child : map) \
-        if (child.first.getPattern()->getTrack() == track)
+// nothing is cached per note, so any edit only needs a repaint,
+// which is coalesced for all the edits until the next message loop cycle
 
-void VelocityProjectMap::onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2)
+void VelocityProjectMap::onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &)
 {
     if (e1.isTypeOf(MidiEvent::Type::Note))
     {
-        const Note &note = static_cast<const Note &>(e1);
-        const Note &newNote = static_cast<const Note &>(e2);
-        const auto *track = newNote.getSequence()->getTrack();
-
-        forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
-        {
-            auto &sequenceMap = *c.second.get();
-            if (auto *component = sequenceMap[note].release())
-            {
-                sequenceMap.erase(note);
-                sequenceMap[newNote] = UniquePointer<VelocityMapNoteComponent>(component);
-                this->triggerBatchRepaintFor(component);
-            }
-        }
+        this->triggerAsyncUpdate();
     }
 }
 
@@ -449,25 +363,7 @@ void VelocityProjectMap::onAddMidiEvent(const MidiEvent &event)
 {
     if (event.isTypeOf(MidiEvent::Type::Note))
     {
-        const Note &note = static_cast<const Note &>(event);
-        const auto *track = note.getSequence()->getTrack();
-
-        VELOCITY_MAP_BULK_REPAINT_START
-
-        forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
-        {
-            auto &componentsMap = *c.second.get();
-            const int i = track->getPattern()->indexOfSorted(&c.first);
-            jassert(i >= 0);
-
-            const Clip *clip = track->getPattern()->getUnchecked(i);
-            auto *component = new VelocityMapNoteComponent(note, *clip);
-            componentsMap[note] = UniquePointer<VelocityMapNoteComponent>(component);
-            this->addAndMakeVisible(component);
-            this->triggerBatchRepaintFor(component);
-        }
-
-        VELOCITY_MAP_BULK_REPAINT_END
+        this->triggerAsyncUpdate();
     }
 }
 
@@ -475,74 +371,56 @@ void VelocityProjectMap::onRemoveMidiEvent(const MidiEvent &event)
 {
     if (event.isTypeOf(MidiEvent::Type::Note))
     {
-        const Note &note = static_cast<const Note &>(event);
-        const auto *track = note.getSequence()->getTrack();
-
-        VELOCITY_MAP_BULK_REPAINT_START
-
-        forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
-        {
-            auto &sequenceMap = *c.second.get();
-            if (sequenceMap.contains(note))
-            {
-                sequenceMap.erase(note);
-            }
-        }
-
-        VELOCITY_MAP_BULK_REPAINT_END
+        this->selectedNotes.erase(event.getId());
+        this->triggerAsyncUpdate();
     }
 }
 
-void VelocityProjectMap::onAddClip(const Clip &clip)
+void VelocityProjectMap::onChangeMidiEvents(const Array<const MidiEvent *> &,
+    const Array<const MidiEvent *> &newEvents)
 {
-    const SequenceMap *referenceMap = nullptr;
-    const auto *track = clip.getPattern()->getTrack();
-    if (!dynamic_cast<const PianoSequence *>(track->getSequence())) { return; }
-
-    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
+    if (!newEvents.isEmpty() && newEvents.getFirst()->isTypeOf(MidiEvent::Type::Note))
     {
-        // Found a sequence map for the same track
-        referenceMap = c.second.get();
-        break;
+        this->triggerAsyncUpdate();
     }
+}
 
-    if (referenceMap == nullptr)
+void VelocityProjectMap::onAddMidiEvents(const Array<const MidiEvent *> &events)
+{
+    if (!events.isEmpty() && events.getFirst()->isTypeOf(MidiEvent::Type::Note))
     {
-        jassertfalse;
-        return;
+        this->triggerAsyncUpdate();
     }
+}
 
-    auto *sequenceMap = new SequenceMap();
-    this->patternMap[clip] = UniquePointer<SequenceMap>(sequenceMap);
+void VelocityProjectMap::onRemoveMidiEvents(const Array<const MidiEvent *> &events)
+{
+    if (!events.isEmpty() && events.getFirst()->isTypeOf(MidiEvent::Type::Note))
+    {
+        for (const auto *event : events)
+        {
+            this->selectedNotes.erase(event->getId());
+        }
 
-    VELOCITY_MAP_BULK_REPAINT_START
+        this->triggerAsyncUpdate();
+    }
+}
 
-    for (const auto &e : *referenceMap)
+void VelocityProjectMap::onAddClip(const Clip &clip)
+{
+    if (this->pianoTracks.contains(clip.getPattern()->getTrack()))
     {
-        // reference the same note as neighbor components:
-        const auto &note = e.second.get()->note;
-        auto *noteComponent = new VelocityMapNoteComponent(note, clip);
-        (*sequenceMap)[note] = UniquePointer<VelocityMapNoteComponent>(noteComponent);
-        this->addAndMakeVisible(noteComponent);
-        this->applyNoteBounds(noteComponent);
+        this->triggerAsyncUpdate();
     }
-
-    VELOCITY_MAP_BULK_REPAINT_END
 }
 
 void VelocityProjectMap::onChangeClip(const Clip &clip, const Clip &newClip)
 {
-    if (this->patternMap.contains(clip))
+    if (this->pianoTracks.contains(newClip.getPattern()->getTrack()))
     {
-        // Set new key for existing sequence map
-        auto *sequenceMap = this->patternMap[clip].release();
-        this->patternMap.erase(clip);
-        this->patternMap[newClip] = UniquePointer<SequenceMap>(sequenceMap);
-
-        // And update all components within it, as their beats should change
-        for (const auto &e : *sequenceMap)
+        if (this->activeClip == clip)
         {
-            this->batchRepaintList.add(e.second.get());
+            this->activeClip = newClip;
         }
 
         this->triggerAsyncUpdate();
@@ -551,34 +429,18 @@ void VelocityProjectMap::onChangeClip(const Clip &clip, const Clip &newClip)
 
 void VelocityProjectMap::onRemoveClip(const Clip &clip)
 {
-    VELOCITY_MAP_BULK_REPAINT_START
-
-    if (this->patternMap.contains(clip))
+    if (this->pianoTracks.contains(clip.getPattern()->getTrack()))
     {
-        this->patternMap.erase(clip);
+        this->triggerAsyncUpdate();
     }
-
-    VELOCITY_MAP_BULK_REPAINT_END
 }
 
 void VelocityProjectMap::onChangeTrackProperties(MidiTrack *const track)
 {
-    if (!dynamic_cast<const PianoSequence *>(track->getSequence())) { return; }
-
-    VELOCITY_MAP_BULK_REPAINT_START
-
-    for (const auto &c : this->patternMap)
+    if (this->pianoTracks.contains(track))
     {
-        const auto &componentsMap = *c.second.get();
-        for (const auto &e : componentsMap)
-        {
-            e.second->updateColour();
-        }
+        this->repaint();
     }
-
-    VELOCITY_MAP_BULK_REPAINT_END
-
-    this->repaint();
 }
 
 void VelocityProjectMap::onReloadProjectContent(const Array<MidiTrack *> &tracks,
@@ -591,23 +453,19 @@ void VelocityProjectMap::onAddTrack(MidiTrack *const track)
 {
     if (!dynamic_cast<const PianoSequence *>(track->getSequence())) { return; }
 
-    VELOCITY_MAP_BULK_REPAINT_START
-    this->loadTrack(track);
-    VELOCITY_MAP_BULK_REPAINT_END
+    if (track->getPattern() != nullptr)
+    {
+        this->pianoTracks.addIfNotAlreadyThere(track);
+        this->triggerAsyncUpdate();
+    }
 }
 
 void VelocityProjectMap::onRemoveTrack(MidiTrack *const track)
 {
     if (!dynamic_cast<const PianoSequence *>(track->getSequence())) { return; }
 
-    for (int i = 0; i < track->getPattern()->size(); ++i)
-    {
-        const auto &clip = *track->getPattern()->getUnchecked(i);
-        if (this->patternMap.contains(clip))
-        {
-            this->patternMap.erase(clip);
-        }
-    }
+    this->pianoTracks.removeFirstMatchingValue(track);
+    this->triggerAsyncUpdate();
 }
 
 void VelocityProjectMap::onChangeProjectBeatRange(float firstBeat, float lastBeat)
@@ -639,20 +497,8 @@ void VelocityProjectMap::onChangeViewEditableScope(MidiTrack *const, const Clip
     }
 
     this->activeClip = clip;
-
-    VELOCITY_MAP_BULK_REPAINT_START
-
-    for (const auto &c : this->patternMap)
-    {
-        const bool editable = this->activeClip == c.first;
-        const auto &componentsMap = *c.second.get();
-        for (const auto &e : componentsMap)
-        {
-            e.second->setEditable(editable);
-        }
-    }
-
-    VELOCITY_MAP_BULK_REPAINT_END
+    this->selectedNotes.clear();
+    this->repaint();
 }
 
 void VelocityProjectMap::changeListenerCallback(ChangeBroadcaster *source)
@@ -662,46 +508,102 @@ void VelocityProjectMap::changeListenerCallback(ChangeBroadcaster *source)
     jassert(dynamic_cast<Lasso *>(source));
     const auto *selection = static_cast<Lasso *>(source);
 
-    const auto activeMapIt = this->patternMap.find(this->activeClip);
-    if (activeMapIt == this->patternMap.end())
+    this->selectedNotes.clear();
+
+    for (const auto *e : *selection)
     {
-        jassertfalse;
-        return;
+        // assuming we've subscribed only on a piano roll's lasso changes
+        const auto *nc = static_cast<const NoteComponent *>(e);
+        this->selectedNotes.insert(nc->getNote().getId());
     }
 
-    const auto *activeMap = activeMapIt->second.get();
+    this->repaint();
+}
 
-    VELOCITY_MAP_BULK_REPAINT_START
+//===----------------------------------------------------------------------===//
+// Private
+//===----------------------------------------------------------------------===//
+
+Range<int> VelocityProjectMap::findNotesInRange(const Clip &clip, float startBeat, float endBeat) const
+{
+    const auto *sequence = static_cast<const PianoSequence *>(clip.getPattern()->getTrack()->getSequence());
+
+    // the sequence is sorted by the notes start beats, relative to the clip
+    const auto firstStartBeat = startBeat - clip.getBeat() - sequence->getMaxNoteLength();
+    const auto lastStartBeat = endBeat - clip.getBeat();
+
+    const auto *begin = sequence->begin();
+    const auto *end = sequence->end();
+
+    const auto *first = std::lower_bound(begin, end, firstStartBeat,
+        [](const MidiEvent *event, float beat) { return event->getBeat() < beat; });
+
+    const auto *last = std::upper_bound(first, end, lastStartBeat,
+        [](float beat, const MidiEvent *event) { return beat < event->getBeat(); });
+
+    return { int(first - begin), int(last - begin) };
+}
 
-    if (selection->getNumSelected() == 0)
+bool VelocityProjectMap::isEditable(const Clip &clip, const Note &note) const noexcept
+{
+    return clip == this->activeClip &&
+        (this->selectedNotes.empty() || this->selectedNotes.contains(note.getId()));
+}
+
+float VelocityProjectMap::getXByBeat(float beat) const noexcept
+{
+    const auto rollLengthInBeats = this->rollLastBeat - this->rollFirstBeat;
+    return float(this->getWidth()) * ((beat - this->rollFirstBeat) / rollLengthInBeats);
+}
+
+float VelocityProjectMap::getBeatByX(float x) const noexcept
+{
+    const auto rollLengthInBeats = this->rollLastBeat - this->rollFirstBeat;
+    return this->rollFirstBeat + (x / float(jmax(1, this->getWidth()))) * rollLengthInBeats;
+}
+
+Rectangle<float> VelocityProjectMap::getLevelBounds(const Clip &clip, const Note &note) const noexcept
+{
+    const auto rollLengthInBeats = this->rollLastBeat - this->rollFirstBeat;
+
+    const auto x = this->getXByBeat(note.getBeat() + clip.getBeat());
+    const auto w = float(this->getWidth()) * (note.getLength() / rollLengthInBeats);
+
+    // at least 4 pixels are visible for 0 volume events:
+    const auto velocity = note.getVelocity() * clip.getVelocity();
+    const int h = jmax(4, int(this->getHeight() * velocity));
+    return { x, float(this->getHeight() - h), jmax(1.f, w), float(h) };
+}
+
+const Note *VelocityProjectMap::findEditableNoteAt(const Point<float> &position) const
+{
+    const auto &activeClip = this->activeClip;
+    if (activeClip.getPattern() == nullptr ||
+        !this->pianoTracks.contains(activeClip.getPattern()->getTrack()))
     {
-        for (const auto &e : *activeMap)
-        {
-            e.second->setEditable(true);
-        }
+        return nullptr;
     }
-    else
-    {
-        for (const auto &e : *activeMap)
-        {
-            e.second->setEditable(false);
-        }
 
-        for (const auto *e : *selection)
+    const auto beat = this->getBeatByX(position.x);
+    const auto range = this->findNotesInRange(activeClip, beat, beat);
+    const auto *sequence = activeClip.getPattern()->getTrack()->getSequence();
+
+    // the last one is painted on top
+    for (int i = range.getEnd() - 1; i >= range.getStart(); --i)
+    {
+        const auto &note = static_cast<const Note &>(*sequence->getUnchecked(i));
+        const auto bounds = this->getLevelBounds(activeClip, note);
+        if (position.x >= bounds.getX() && position.x <= bounds.getRight() &&
+            position.y >= bounds.getY() && position.y <= bounds.getY() + 4.f &&
+            this->isEditable(activeClip, note))
         {
-            // assuming we've subscribed only on a piano roll's lasso changes
-            const auto *nc = static_cast<const NoteComponent *>(e);
-            activeMap->at(nc->getNote())->setEditable(true);
+            return &note;
         }
     }
 
-    VELOCITY_MAP_BULK_REPAINT_END
+    return nullptr;
 }
 
-//===----------------------------------------------------------------------===//
-// Private
-//===----------------------------------------------------------------------===//
-
 void VelocityProjectMap::updateVolumeBlendingIndicator(const Point<int> &pos)
 {
     if (this->volumeBlendingAmount == 1.f && this->volumeBlendingIndicator->isVisible())
@@ -720,9 +622,6 @@ void VelocityProjectMap::updateVolumeBlendingIndicator(const Point<int> &pos)
 
 void VelocityProjectMap::applyVolumeChanges()
 {
-    const auto *activeMap = this->patternMap.at(this->activeClip).get();
-    jassert(activeMap);
-
     // this is where things start looking a bit dirty:
     // to update notes velocities on the fly, we use undo/redo actions (as always),
     // but we don't want to have lots of those actions in undo transaction in the end,
@@ -732,7 +631,16 @@ void VelocityProjectMap::applyVolumeChanges()
     // which may - and will - change as the user drags the helper around,
     // so we are to track moments when the group changes and undo the current transaction
 
-    bool shouldUndo = false;
+    const auto &activeClip = this->activeClip;
+    if (activeClip.getPattern() == nullptr ||
+        !this->pianoTracks.contains(activeClip.getPattern()->getTrack()))
+    {
+        jassertfalse;
+        return;
+    }
+
+    auto *sequence = static_cast<PianoSequence *>(activeClip.getPattern()->getTrack()->getSequence());
+
     Point<float> intersectionA;
     Point<float> intersectionB;
 
@@ -742,62 +650,80 @@ void VelocityProjectMap::applyVolumeChanges()
     const bool ascending = (dragLine.getStartX() <= dragLine.getEndX() && dragLine.getStartY() >= dragLine.getEndY())
         || (dragLine.getStartX() > dragLine.getEndX() && dragLine.getStartY() < dragLine.getEndY());
 
-    for (const auto &i : *activeMap)
+    // only the levels starting or ending under the dragged line can intersect it
+    const auto startBeat = this->getBeatByX(jmin(dragLine.getStartX(), dragLine.getEndX()));
+    const auto endBeat = this->getBeatByX(jmax(dragLine.getStartX(), dragLine.getEndX()));
+    const auto range = this->findNotesInRange(activeClip, startBeat, endBeat);
+
+    // the notes keep their parameters from the moment they were first intersected
+    FlatHashMap<Note, float, MidiEventHash> newIntersections;
+
+    for (int i = range.getStart(); i < range.getEnd(); ++i)
     {
-        if (!i.second->isEditable())
+        const auto &note = static_cast<const Note &>(*sequence->getUnchecked(i));
+        if (!this->isEditable(activeClip, note))
         {
             continue;
         }
 
-        const bool ia = dragLine.intersects(i.second->getStartLine(), intersectionA);
-        const bool ib = dragLine.intersects(i.second->getEndLine(), intersectionB);
-        const bool hasIntersection = ia || ib;
+        const auto bounds = this->getLevelBounds(activeClip, note);
+        const Line<float> startLine(bounds.getX(), 0.f,
+            bounds.getX(), float(Globals::UI::levelsMapHeight));
+        const Line<float> endLine(bounds.getRight(), 0.f,
+            bounds.getRight(), float(Globals::UI::levelsMapHeight));
+
+        const bool ia = dragLine.intersects(startLine, intersectionA);
+        const bool ib = dragLine.intersects(endLine, intersectionB);
+        if (!ia && !ib)
+        {
+            continue;
+        }
 
         float intersectionVelocity = 0.f;
         if (ascending)
         {
-            if (ia)
+            if (!ia)
             {
-                intersectionVelocity = getVelocityByIntersection(intersectionA);
-            }
-            else
-            {
-                dragLineExt.intersects(i.second->getStartLine(), intersectionA);
-                intersectionVelocity = getVelocityByIntersection(intersectionA);
+                dragLineExt.intersects(startLine, intersectionA);
             }
+
+            intersectionVelocity = getVelocityByIntersection(intersectionA);
         }
         else
         {
-            if (ib)
-            {
-                intersectionVelocity = getVelocityByIntersection(intersectionB);
-            }
-            else
+            if (!ib)
             {
-                dragLineExt.intersects(i.second->getEndLine(), intersectionB);
-                intersectionVelocity = getVelocityByIntersection(intersectionB);
+                dragLineExt.intersects(endLine, intersectionB);
             }
+
+            intersectionVelocity = getVelocityByIntersection(intersectionB);
         }
 
-        auto existingIntersection = this->dragIntersections.find(i.first);
-        if (hasIntersection && existingIntersection == this->dragIntersections.end())
+        const auto existingIntersection = this->dragIntersections.find(note);
+        if (existingIntersection != this->dragIntersections.end())
         {
-            // found new intersection
-            shouldUndo = true;
-            this->dragIntersections.emplace(i.first, intersectionVelocity);
+            newIntersections.emplace(existingIntersection->first, intersectionVelocity);
         }
-        else if (!hasIntersection && existingIntersection != this->dragIntersections.end())
+        else
         {
-            // lost existing intersection
-            shouldUndo = true;
-            this->dragIntersections.erase(existingIntersection);
+            newIntersections.emplace(note, intersectionVelocity);
         }
-        else if (hasIntersection)
+    }
+
+    // found new intersections or lost existing ones
+    bool shouldUndo = newIntersections.size() != this->dragIntersections.size();
+    for (const auto &i : newIntersections)
+    {
+        if (shouldUndo)
         {
-            this->dragIntersections[i.first] = intersectionVelocity;
+            break;
         }
+
+        shouldUndo = !this->dragIntersections.contains(i.first);
     }
 
+    this->dragIntersections = move(newIntersections);
+
     // filling up arrays all the time on mouse drag - kinda sucks, nah?
     this->dragChangedNotes.clearQuick();
     this->dragChanges.clearQuick();
@@ -811,8 +737,6 @@ void VelocityProjectMap::applyVolumeChanges()
         this->dragChanges.add(i.first.withVelocity(newVelocity));
     }
 
-    auto *sequence = static_cast<PianoSequence *>(this->activeClip.getPattern()->getTrack()->getSequence());
-
     if (shouldUndo && this->dragHasChanges)
     {
         sequence->undoCurrentTransactionOnly();
@@ -832,93 +756,23 @@ void VelocityProjectMap::applyVolumeChanges()
 
 void VelocityProjectMap::reloadTrackMap()
 {
-    this->patternMap.clear();
-
-    VELOCITY_MAP_BULK_REPAINT_START
+    this->pianoTracks.clearQuick();
+    this->selectedNotes.clear();
 
     const auto &tracks = this->project.getTracks();
     for (const auto *track : tracks)
     {
-        if (dynamic_cast<const PianoSequence *>(track->getSequence()))
+        if (dynamic_cast<const PianoSequence *>(track->getSequence()) &&
+            track->getPattern() != nullptr)
         {
-            this->loadTrack(track);
+            this->pianoTracks.add(track);
         }
     }
 
-    VELOCITY_MAP_BULK_REPAINT_END
-}
-
-void VelocityProjectMap::loadTrack(const MidiTrack *const track)
-{
-    if (track->getPattern() == nullptr)
-    {
-        return;
-    }
-
-    for (int i = 0; i < track->getPattern()->size(); ++i)
-    {
-        const Clip *clip = track->getPattern()->getUnchecked(i);
-        const bool editable = this->activeClip == *clip;
-
-        auto *sequenceMap = new SequenceMap();
-        this->patternMap[*clip] = UniquePointer<SequenceMap>(sequenceMap);
-
-        for (int j = 0; j < track->getSequence()->size(); ++j)
-        {
-            const MidiEvent *event = track->getSequence()->getUnchecked(j);
-            if (event->isTypeOf(MidiEvent::Type::Note))
-            {
-                const Note *note = static_cast<const Note *>(event);
-                auto *noteComponent = new VelocityMapNoteComponent(*note, *clip);
-                (*sequenceMap)[*note] = UniquePointer<VelocityMapNoteComponent>(noteComponent);
-                this->addAndMakeVisible(noteComponent);
-                this->applyNoteBounds(noteComponent);
-                noteComponent->setEditable(editable);
-            }
-        }
-    }
-}
-
-void VelocityProjectMap::applyNoteBounds(VelocityMapNoteComponent *nc)
-{
-    const float rollLengthInBeats = (this->rollLastBeat - this->rollFirstBeat);
-    const float projectLengthInBeats = (this->projectLastBeat - this->projectFirstBeat);
-
-    const float beat = (nc->getBeat() - this->rollFirstBeat);
-    const float mapWidth = float(this->getWidth()) * (projectLengthInBeats / rollLengthInBeats);
-
-    const float x = (mapWidth * (beat / projectLengthInBeats));
-    const float w = (mapWidth * (nc->getLength() / projectLengthInBeats));
-
-    // at least 4 pixels are visible for 0 volume events:
-    const int h = jmax(4, int(this->getHeight() * nc->getVelocity()));
-    nc->setRealBounds(x, this->getHeight() - h, jmax(1.f, w), h);
-}
-
-void VelocityProjectMap::triggerBatchRepaintFor(VelocityMapNoteComponent *target)
-{
-    this->batchRepaintList.add(target);
-    this->triggerAsyncUpdate();
+    this->repaint();
 }
 
 void VelocityProjectMap::handleAsyncUpdate()
 {
-    // batch repaint & resize stuff
-    if (this->batchRepaintList.size() > 0)
-    {
-        VELOCITY_MAP_BULK_REPAINT_START
-
-        for (int i = 0; i < this->batchRepaintList.size(); ++i)
-        {
-            // There are still many cases when a scheduled component is deleted at this time:
-            if (Component *component = this->batchRepaintList.getUnchecked(i))
-            {
-                this->applyNoteBounds(static_cast<VelocityMapNoteComponent *>(component));
-            }
-        }
-
-        VELOCITY_MAP_BULK_REPAINT_END
-
-        this->batchRepaintList.clearQuick();
-    }
+    this->repaint();
 }
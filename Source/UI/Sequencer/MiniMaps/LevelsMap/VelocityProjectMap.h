@@ -24,14 +24,13 @@
 
 class HybridRoll;
 class ProjectNode;
-class VelocityMapNoteComponent;
 class VelocityLevelDraggingHelper;
 class FineTuningValueIndicator;
 
 class VelocityProjectMap final :
     public Component,
     public ProjectListener,
-    public AsyncUpdater, // triggers batch repaints for children
+    public AsyncUpdater, // triggers batch repaints
     public ChangeListener // subscribes on parent roll's lasso changes
 {
 public:
@@ -44,6 +43,8 @@ public:
     //===------------------------------------------------------------------===//
 
     void resized() override;
+    void paint(Graphics &g) override;
+    void mouseMove(const MouseEvent &e) override;
     void mouseDown(const MouseEvent &e) override;
     void mouseDrag(const MouseEvent &e) override;
     void mouseUp(const MouseEvent &e) override;
@@ -57,6 +58,11 @@ public:
     void onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2) override;
     void onRemoveMidiEvent(const MidiEvent &event) override;
 
+    void onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents) override;
+    void onAddMidiEvents(const Array<const MidiEvent *> &events) override;
+    void onRemoveMidiEvents(const Array<const MidiEvent *> &events) override;
+
     void onAddClip(const Clip &clip) override;
     void onChangeClip(const Clip &oldClip, const Clip &newClip) override;
     void onRemoveClip(const Clip &clip) override;
@@ -75,9 +81,7 @@ private:
 
     void changeListenerCallback(ChangeBroadcaster *source) override;
 
-    void applyNoteBounds(VelocityMapNoteComponent *nc);
     void reloadTrackMap();
-    void loadTrack(const MidiTrack *const track);
 
     float projectFirstBeat = 0.f;
     float projectLastBeat = Globals::Defaults::projectLength;
@@ -90,9 +94,32 @@ private:
 
     Clip activeClip;
 
-    using SequenceMap = FlatHashMap<Note, UniquePointer<VelocityMapNoteComponent>, MidiEventHash>;
-    using PatternMap = FlatHashMap<Clip, UniquePointer<SequenceMap>, ClipHash>;
-    PatternMap patternMap;
+    // The levels are painted and hit-tested straight from the sequences,
+    // which are sorted by beat, so only the notes in the visible (or dragged over)
+    // beat range are visited, no matter how many notes the project has;
+    // the notes starting up to the longest note length before that range
+    // might still overlap it, see PianoSequence::getMaxNoteLength()
+
+    Array<const MidiTrack *> pianoTracks;
+
+    // the indices of the notes of the clip's sequence, which might
+    // overlap the given range of absolute beats, as [start, end)
+    Range<int> findNotesInRange(const Clip &clip, float startBeat, float endBeat) const;
+
+    // all notes of the active clip are editable, unless some of them
+    // are selected in the roll, then only the selected ones are
+    FlatHashSet<MidiEvent::Id> selectedNotes;
+    bool isEditable(const Clip &clip, const Note &note) const noexcept;
+
+    float getXByBeat(float beat) const noexcept;
+    float getBeatByX(float x) const noexcept;
+    Rectangle<float> getLevelBounds(const Clip &clip, const Note &note) const noexcept;
+
+    // the level under the mouse can be dragged individually by its header line
+    const Note *findEditableNoteAt(const Point<float> &position) const;
+    Note draggedNote;
+    float draggedNoteVelocityAnchor = 0.f;
+    bool isDraggingNote = false;
 
     UniquePointer<VelocityLevelDraggingHelper> dragHelper;
     FlatHashMap<Note, float, MidiEventHash> dragIntersections;
@@ -106,9 +133,7 @@ private:
 
     void applyVolumeChanges();
 
-    void triggerBatchRepaintFor(VelocityMapNoteComponent *target);
     void handleAsyncUpdate() override;
-    Array<WeakReference<Component>> batchRepaintList;
 
     JUCE_LEAK_DETECTOR(VelocityProjectMap)
 };
@@ -58,36 +58,67 @@ void PianoProjectMap::resized()
 
 void PianoProjectMap::paint(Graphics &g)
 {
-    const float rollLengthInBeats = this->rollLastBeat - this->rollFirstBeat;
-    const float projectLengthInBeats = this->projectLastBeat - this->projectFirstBeat;
-    const float mapWidth = float(this->getWidth()) * (projectLengthInBeats / rollLengthInBeats);
+    this->tiles.paint(g, this->getWidth(), this->getHeight(),
+        this->rollFirstBeat, this->rollLastBeat,
+        [this](PianoProjectMapTiles::Painter &painter)
+    {
+        this->renderNotes(painter);
+    });
+}
 
+void PianoProjectMap::renderNotes(PianoProjectMapTiles::Painter &painter) const
+{
     for (const auto &c : this->patternMap)
     {
         const auto sequenceMap = c.second.get();
         const bool isActiveClip = this->activeClip == c.first;
 
-        g.setColour(c.first.getTrackColour().
+        const auto colour = c.first.getTrackColour().
             interpolatedWith(this->baseColour, .4f).
-            withAlpha(isActiveClip ? .9f : .6f));
+            withAlpha(isActiveClip ? .9f : .6f);
 
         for (const auto &n : *sequenceMap)
         {
-            const auto key = jlimit(0, this->keyboardSize, n.getKey() + c.first.getKey());
-            const auto beat = n.getBeat() + c.first.getBeat() - this->rollFirstBeat;
+            const auto beat = n.getBeat() + c.first.getBeat();
             const auto length = n.getLength();
+            if (!painter.isVisible(beat, length))
+            {
+                continue;
+            }
 
-            const float x = (mapWidth * (beat / projectLengthInBeats));
-            const float w = (mapWidth * (length / projectLengthInBeats));
+            const auto key = jlimit(0, this->keyboardSize, n.getKey() + c.first.getKey());
 
             // with rounding, it just looks better:
             const int y = this->getHeight() - static_cast<int>(key * this->componentHeight);
-
-            g.fillRect(x, static_cast<float>(y), jmax(0.25f, w), 1.0f);
+            painter.fillNote(beat, length, y, colour);
         }
     }
 }
 
+void PianoProjectMap::invalidateTiles(const Clip &clip, const Note &note)
+{
+    const auto beat = clip.getBeat() + note.getBeat();
+    this->tiles.invalidate(beat, beat + note.getLength());
+}
+
+void PianoProjectMap::invalidateTiles(const Clip &clip, const SequenceSet &sequenceMap)
+{
+    if (sequenceMap.empty())
+    {
+        return;
+    }
+
+    float startBeat = FLT_MAX;
+    float endBeat = -FLT_MAX;
+    for (const auto &note : sequenceMap)
+    {
+        startBeat = jmin(startBeat, note.getBeat());
+        endBeat = jmax(endBeat, note.getBeat() + note.getLength());
+    }
+
+    this->tiles.invalidate(clip.getBeat() + startBeat, clip.getBeat() + endBeat);
+}
+
 //===----------------------------------------------------------------------===//
 // ProjectListener
 //===----------------------------------------------------------------------===//
@@ -111,6 +142,8 @@ void PianoProjectMap::onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2
             {
                 sequenceMap.erase(note);
                 sequenceMap.insert(newNote);
+                this->invalidateTiles(c.first, note);
+                this->invalidateTiles(c.first, newNote);
             }
         }
 
@@ -129,6 +162,7 @@ void PianoProjectMap::onAddMidiEvent(const MidiEvent &event)
         {
             auto &sequenceMap = *c.second.get();
             sequenceMap.insert(note);
+            this->invalidateTiles(c.first, note);
         }
 
         this->triggerAsyncUpdate();
@@ -148,6 +182,7 @@ void PianoProjectMap::onRemoveMidiEvent(const MidiEvent &event)
             if (sequenceMap.contains(note))
             {
                 sequenceMap.erase(note);
+                this->invalidateTiles(c.first, note);
             }
         }
 
@@ -155,6 +190,85 @@ void PianoProjectMap::onRemoveMidiEvent(const MidiEvent &event)
     }
 }
 
+// the group edits always belong to the same sequence,
+// so the clips of its track are only looked up once
+
+void PianoProjectMap::onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+    const Array<const MidiEvent *> &newEvents)
+{
+    if (newEvents.isEmpty() || !newEvents.getFirst()->isTypeOf(MidiEvent::Type::Note))
+    {
+        return;
+    }
+
+    const auto *track = newEvents.getFirst()->getSequence()->getTrack();
+
+    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
+    {
+        auto &sequenceMap = *c.second.get();
+        for (int i = 0; i < oldEvents.size(); ++i)
+        {
+            const auto &note = static_cast<const Note &>(*oldEvents.getUnchecked(i));
+            if (sequenceMap.contains(note))
+            {
+                const auto &newNote = static_cast<const Note &>(*newEvents.getUnchecked(i));
+                sequenceMap.erase(note);
+                sequenceMap.insert(newNote);
+                this->invalidateTiles(c.first, note);
+                this->invalidateTiles(c.first, newNote);
+            }
+        }
+    }
+
+    this->triggerAsyncUpdate();
+}
+
+void PianoProjectMap::onAddMidiEvents(const Array<const MidiEvent *> &events)
+{
+    if (events.isEmpty() || !events.getFirst()->isTypeOf(MidiEvent::Type::Note))
+    {
+        return;
+    }
+
+    const auto *track = events.getFirst()->getSequence()->getTrack();
+
+    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
+    {
+        auto &sequenceMap = *c.second.get();
+        for (const auto *event : events)
+        {
+            const auto &note = static_cast<const Note &>(*event);
+            sequenceMap.insert(note);
+            this->invalidateTiles(c.first, note);
+        }
+    }
+
+    this->triggerAsyncUpdate();
+}
+
+void PianoProjectMap::onRemoveMidiEvents(const Array<const MidiEvent *> &events)
+{
+    if (events.isEmpty() || !events.getFirst()->isTypeOf(MidiEvent::Type::Note))
+    {
+        return;
+    }
+
+    const auto *track = events.getFirst()->getSequence()->getTrack();
+
+    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
+    {
+        auto &sequenceMap = *c.second.get();
+        for (const auto *event : events)
+        {
+            const auto &note = static_cast<const Note &>(*event);
+            sequenceMap.erase(note);
+            this->invalidateTiles(c.first, note);
+        }
+    }
+
+    this->triggerAsyncUpdate();
+}
+
 void PianoProjectMap::onAddClip(const Clip &clip)
 {
     const SequenceSet *referenceMap = nullptr;
@@ -182,6 +296,7 @@ void PianoProjectMap::onAddClip(const Clip &clip)
         sequenceMap->insert(note);
     }
 
+    this->invalidateTiles(clip, *sequenceMap);
     this->triggerAsyncUpdate();
 }
 
@@ -193,15 +308,19 @@ void PianoProjectMap::onChangeClip(const Clip &clip, const Clip &newClip)
         auto *sequenceMap = this->patternMap[clip].release();
         this->patternMap.erase(clip);
         this->patternMap[newClip] = UniquePointer<SequenceSet>(sequenceMap);
+        this->invalidateTiles(clip, *sequenceMap);
+        this->invalidateTiles(newClip, *sequenceMap);
         this->triggerAsyncUpdate();
     }
 }
 
 void PianoProjectMap::onRemoveClip(const Clip &clip)
 {
-    if (this->patternMap.contains(clip))
+    const auto found = this->patternMap.find(clip);
+    if (found != this->patternMap.end())
     {
-        this->patternMap.erase(clip);
+        this->invalidateTiles(clip, *found->second);
+        this->patternMap.erase(found);
         this->triggerAsyncUpdate();
     }
 }
@@ -212,6 +331,7 @@ void PianoProjectMap::onChangeProjectInfo(const ProjectMetadata *info)
     {
         this->keyboardSize = info->getKeyboardSize();
         this->resized(); // updates componenetHeight
+        this->tiles.invalidateAll();
         this->triggerAsyncUpdate(); // repaints
     }
 }
@@ -219,6 +339,7 @@ void PianoProjectMap::onChangeProjectInfo(const ProjectMetadata *info)
 void PianoProjectMap::onChangeTrackProperties(MidiTrack *const track)
 {
     if (!dynamic_cast<const PianoSequence *>(track->getSequence())) { return; }
+    this->tiles.invalidateAll(); // the colour might have changed
     this->triggerAsyncUpdate();
 }
 
@@ -233,6 +354,7 @@ void PianoProjectMap::onAddTrack(MidiTrack *const track)
 {
     if (!dynamic_cast<const PianoSequence *>(track->getSequence())) { return; }
     this->loadTrack(track);
+    this->tiles.invalidateAll();
     this->triggerAsyncUpdate();
 }
 
@@ -249,6 +371,7 @@ void PianoProjectMap::onRemoveTrack(MidiTrack *const track)
         }
     }
 
+    this->tiles.invalidateAll();
     this->triggerAsyncUpdate();
 }
 
@@ -283,6 +406,7 @@ void PianoProjectMap::onChangeViewEditableScope(MidiTrack *const, const Clip &cl
     }
 
     this->activeClip = clip;
+    this->tiles.invalidateAll();
     this->triggerAsyncUpdate();
 }
 
@@ -293,6 +417,7 @@ void PianoProjectMap::onChangeViewEditableScope(MidiTrack *const, const Clip &cl
 void PianoProjectMap::reloadTrackMap()
 {
     this->patternMap.clear();
+    this->tiles.invalidateAll();
 
     const auto &tracks = this->project.getTracks();
     for (const auto *track : tracks)
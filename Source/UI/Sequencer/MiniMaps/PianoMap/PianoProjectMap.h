@@ -20,6 +20,7 @@
 #include "Clip.h"
 #include "Note.h"
 #include "ProjectListener.h"
+#include "PianoProjectMapTiles.h"
 
 class HybridRoll;
 class ProjectNode;
@@ -50,6 +51,11 @@ public:
     void onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2) override;
     void onRemoveMidiEvent(const MidiEvent &event) override;
 
+    void onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents) override;
+    void onAddMidiEvents(const Array<const MidiEvent *> &events) override;
+    void onRemoveMidiEvents(const Array<const MidiEvent *> &events) override;
+
     void onAddClip(const Clip &clip) override;
     void onChangeClip(const Clip &oldClip, const Clip &newClip) override;
     void onRemoveClip(const Clip &clip) override;
@@ -91,6 +97,14 @@ private:
     using PatternMap = FlatHashMap<Clip, UniquePointer<SequenceSet>, ClipHash>;
     PatternMap patternMap;
 
+    // the notes are rendered into the cached image tiles,
+    // and the edits only invalidate the tiles they overlap
+    PianoProjectMapTiles tiles;
+    void renderNotes(PianoProjectMapTiles::Painter &painter) const;
+
+    void invalidateTiles(const Clip &clip, const Note &note);
+    void invalidateTiles(const Clip &clip, const SequenceSet &sequenceMap);
+
     void handleAsyncUpdate() override;
 
     JUCE_LEAK_DETECTOR(PianoProjectMap)
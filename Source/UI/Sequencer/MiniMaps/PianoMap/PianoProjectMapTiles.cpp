@@ -0,0 +1,430 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "PianoProjectMapTiles.h"
+
+static inline int64 getTileKey(int zoomLevel, int index) noexcept
+{
+    return (int64(zoomLevel) << 32) | int64(uint32(index));
+}
+
+void PianoProjectMapTiles::paint(Graphics &g, int width, int height,
+    float firstBeat, float lastBeat, const RenderFunction &renderNotes)
+{
+    const auto lengthInBeats = lastBeat - firstBeat;
+    if (lengthInBeats <= 0.f || width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    const auto startTime = Time::getMillisecondCounterHiRes();
+
+    if (this->tilesHeight != height)
+    {
+        this->tilesHeight = height;
+        this->tiles.clear();
+    }
+
+    const auto pixelsPerBeat = float(width) / lengthInBeats;
+    const auto zoomLevel = jlimit(minZoomLevel, maxZoomLevel,
+        int(std::floor(std::log2(pixelsPerBeat))));
+
+    const auto tilePixelsPerBeat = std::ldexp(1.f, zoomLevel);
+    const auto tileLengthInBeats = float(tileWidth) / tilePixelsPerBeat;
+
+    const auto firstTileIndex = int(std::floor(firstBeat / tileLengthInBeats));
+    const auto lastTileIndex = int(std::floor(lastBeat / tileLengthInBeats));
+
+    for (auto &it : this->tiles)
+    {
+        it.second->isVisible = false;
+    }
+
+    Array<Tile *> visibleTiles;
+    Array<Tile *> dirtyTiles;
+    for (int i = firstTileIndex; i <= lastTileIndex; ++i)
+    {
+        auto &tile = this->tiles[getTileKey(zoomLevel, i)];
+        if (tile == nullptr)
+        {
+            tile = make<Tile>();
+            tile->zoomLevel = zoomLevel;
+            tile->index = i;
+            tile->image = Image(Image::ARGB, tileWidth, height, true);
+        }
+
+        tile->isVisible = true;
+        visibleTiles.add(tile.get());
+
+        if (tile->isDirty)
+        {
+            dirtyTiles.add(tile.get());
+        }
+    }
+
+    if (!dirtyTiles.isEmpty())
+    {
+        this->renderTiles(dirtyTiles, tilePixelsPerBeat, tileLengthInBeats, renderNotes);
+    }
+
+    // the invisible tiles of this and other zoom levels are kept
+    // for a while, so that zooming back and forth doesn't re-render them
+    if (this->tiles.size() > maxCachedTiles)
+    {
+        for (auto it = this->tiles.begin(); it != this->tiles.end();)
+        {
+            it = it->second->isVisible ? std::next(it) : this->tiles.erase(it);
+        }
+    }
+
+    // the tiles are only shrunk when zoomed out beyond the least detailed level,
+    // and then the notes thinner than a pixel shouldn't be skipped
+    const auto scale = pixelsPerBeat / tilePixelsPerBeat;
+    g.setImageResamplingQuality(scale < 1.f ?
+        Graphics::mediumResamplingQuality : Graphics::lowResamplingQuality);
+
+    for (const auto *tile : visibleTiles)
+    {
+        const auto x = (float(tile->index) * tileLengthInBeats - firstBeat) * pixelsPerBeat;
+        g.drawImageTransformed(tile->image, AffineTransform::scale(scale, 1.f).translated(x, 0.f));
+    }
+
+    this->numPaints++;
+    this->totalPaintTimeMs += Time::getMillisecondCounterHiRes() - startTime;
+}
+
+// all dirty tiles are rendered in a single pass over the notes;
+// they are usually adjacent, so they are looked up by their offsets
+void PianoProjectMapTiles::renderTiles(const Array<Tile *> &dirtyTiles,
+    float tilePixelsPerBeat, float tileLengthInBeats, const RenderFunction &renderNotes)
+{
+    int firstIndex = INT_MAX;
+    int lastIndex = INT_MIN;
+    for (const auto *tile : dirtyTiles)
+    {
+        firstIndex = jmin(firstIndex, tile->index);
+        lastIndex = jmax(lastIndex, tile->index);
+    }
+
+    OwnedArray<Graphics> tileGraphics;
+    tileGraphics.insertMultiple(0, nullptr, lastIndex - firstIndex + 1);
+
+    for (auto *tile : dirtyTiles)
+    {
+        tile->image.clear(tile->image.getBounds());
+        tileGraphics.set(tile->index - firstIndex, new Graphics(tile->image));
+        tile->isDirty = false;
+    }
+
+    Array<Graphics *> graphics;
+    graphics.addArray(tileGraphics);
+
+    Painter painter(graphics, firstIndex, tilePixelsPerBeat, tileLengthInBeats);
+    renderNotes(painter);
+
+    this->numRenderedTiles += dirtyTiles.size();
+}
+
+void PianoProjectMapTiles::invalidate(float startBeat, float endBeat)
+{
+    for (auto &it : this->tiles)
+    {
+        auto *tile = it.second.get();
+        const auto tileLengthInBeats = float(tileWidth) / std::ldexp(1.f, tile->zoomLevel);
+        const auto tileStartBeat = float(tile->index) * tileLengthInBeats;
+        if (tileStartBeat <= endBeat && tileStartBeat + tileLengthInBeats >= startBeat)
+        {
+            tile->isDirty = true;
+        }
+    }
+}
+
+void PianoProjectMapTiles::invalidateAll()
+{
+    for (auto &it : this->tiles)
+    {
+        it.second->isDirty = true;
+    }
+}
+
+//===----------------------------------------------------------------------===//
+// Painter
+//===----------------------------------------------------------------------===//
+
+PianoProjectMapTiles::Painter::Painter(const Array<Graphics *> &tileGraphics,
+    int firstIndex, float tilePixelsPerBeat, float tileLengthInBeats) :
+    tileGraphics(tileGraphics),
+    firstIndex(firstIndex),
+    lastIndex(firstIndex + tileGraphics.size() - 1),
+    firstBeat(float(firstIndex) * tileLengthInBeats),
+    lastBeat(float(firstIndex + tileGraphics.size()) * tileLengthInBeats),
+    tilePixelsPerBeat(tilePixelsPerBeat),
+    tileLengthInBeats(tileLengthInBeats) {}
+
+bool PianoProjectMapTiles::Painter::isVisible(float beat, float length) const noexcept
+{
+    return beat + length >= this->firstBeat && beat <= this->lastBeat;
+}
+
+void PianoProjectMapTiles::Painter::fillNote(float beat, float length,
+    int y, const Colour &colour)
+{
+    if (!this->isVisible(beat, length))
+    {
+        return;
+    }
+
+    const float w = jmax(0.25f, length * this->tilePixelsPerBeat);
+
+    const auto noteFirstIndex = jmax(this->firstIndex,
+        int(std::floor(beat / this->tileLengthInBeats)));
+    const auto noteLastIndex = jmin(this->lastIndex,
+        int(std::floor((beat + length) / this->tileLengthInBeats)));
+
+    for (int i = noteFirstIndex; i <= noteLastIndex; ++i)
+    {
+        if (auto *tg = this->tileGraphics.getUnchecked(i - this->firstIndex))
+        {
+            const float x = (beat - float(i) * this->tileLengthInBeats) * this->tilePixelsPerBeat;
+            tg->setColour(colour);
+            tg->fillRect(x, static_cast<float>(y), w, 1.0f);
+        }
+    }
+}
+
+//===----------------------------------------------------------------------===//
+// Paint stats
+//===----------------------------------------------------------------------===//
+
+int PianoProjectMapTiles::getNumPaints() const noexcept
+{
+    return this->numPaints;
+}
+
+int PianoProjectMapTiles::getNumRenderedTiles() const noexcept
+{
+    return this->numRenderedTiles;
+}
+
+double PianoProjectMapTiles::getTotalPaintTimeMs() const noexcept
+{
+    return this->totalPaintTimeMs;
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+class PianoProjectMapTilesTests final : public UnitTest
+{
+public:
+    PianoProjectMapTilesTests() : UnitTest("Piano project map tiles tests", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        beginTest("Only the invalidated tiles are re-rendered");
+
+        {
+            const Array<NoteRect> notes({ { 4.f, 1.f, 10 }, { 20.f, 2.f, 20 }, { 33.f, 0.5f, 30 } });
+
+            PianoProjectMapTiles tiles;
+            Image canvas(Image::ARGB, width, height, true);
+            Graphics g(canvas);
+
+            // 16 pixels per beat, so the tiles are 16 beats long,
+            // and the view shows 4 of them at the same zoom level
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 4);
+
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 4);
+
+            tiles.invalidate(20.f, 21.f);
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 5);
+
+            tiles.invalidate(30.f, 34.f);
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 7);
+
+            tiles.invalidate(100.f, 110.f);
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 7);
+
+            // scrolling renders the tiles which weren't visible yet
+            paint(g, tiles, notes, 8.f, 68.f);
+            expectEquals(tiles.getNumRenderedTiles(), 8);
+
+            // zooming out uses the less detailed level, 8 pixels per beat,
+            // and zooming back in uses the cached tiles of the previous one
+            paint(g, tiles, notes, 0.f, 120.f);
+            expectEquals(tiles.getNumRenderedTiles(), 12);
+
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 12);
+
+            // the edits invalidate the tiles of all levels,
+            // but only the visible ones are re-rendered
+            tiles.invalidate(20.f, 21.f);
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 13);
+            paint(g, tiles, notes, 0.f, 120.f);
+            expectEquals(tiles.getNumRenderedTiles(), 14);
+
+            tiles.invalidateAll();
+            paint(g, tiles, notes, 0.f, 60.f);
+            expectEquals(tiles.getNumRenderedTiles(), 18);
+
+            // changing the height discards all tiles
+            Image smallerCanvas(Image::ARGB, width, height / 2, true);
+            Graphics sg(smallerCanvas);
+            tiles.paint(sg, width, height / 2, 0.f, 60.f, getRenderFunction(notes));
+            expectEquals(tiles.getNumRenderedTiles(), 22);
+
+            expectEquals(tiles.getNumPaints(), 12);
+        }
+
+        beginTest("Short notes are painted at any zoom level");
+
+        {
+            Array<NoteRect> notes;
+            for (int i = 0; i < 64; ++i)
+            {
+                notes.add({ float(i) * 3.7f, 0.0625f, 4 + (i % 60) * 2 });
+            }
+
+            PianoProjectMapTiles tiles;
+
+            // the view ranges are picked so that the tiles are stretched
+            // by all kinds of non-integer factors
+            for (float viewLength = 40.f; viewLength < 240.f; viewLength += 7.3f)
+            {
+                Image canvas(Image::ARGB, width, height, true);
+                Graphics g(canvas);
+                paint(g, tiles, notes, 0.f, viewLength);
+
+                const auto pixelsPerBeat = float(width) / viewLength;
+                for (const auto &note : notes)
+                {
+                    const auto x1 = int(std::floor(note.beat * pixelsPerBeat)) - 1;
+                    const auto x2 = int(std::ceil((note.beat + note.length) * pixelsPerBeat)) + 1;
+                    if (x1 < 0 || x2 >= width)
+                    {
+                        continue;
+                    }
+
+                    bool isPainted = false;
+                    for (int x = x1; x <= x2 && !isPainted; ++x)
+                    {
+                        isPainted = canvas.getPixelAt(x, note.y).getAlpha() > 0;
+                    }
+
+                    expect(isPainted, "A note at beat " + String(note.beat) +
+                        " is not painted in a view of " + String(viewLength) + " beats");
+                }
+            }
+        }
+
+        beginTest("Painting the cached tiles compared to painting every note");
+
+        {
+            static constexpr auto numNotes = 20000;
+            static constexpr auto numFrames = 100;
+            static constexpr auto viewLength = 256.f;
+
+            Random random(42);
+            Array<NoteRect> notes;
+            for (int i = 0; i < numNotes; ++i)
+            {
+                notes.add({ random.nextFloat() * 1024.f,
+                    0.25f + random.nextFloat() * 4.f, random.nextInt(height) });
+            }
+
+            Image canvas(Image::ARGB, width, height, true);
+            Graphics g(canvas);
+
+            // this is what the map did before the tiles: one fill per note on every repaint,
+            // and these frames are like the ones while scrolling, one beat at a time
+            auto startTime = Time::getMillisecondCounterHiRes();
+            for (int frame = 0; frame < numFrames; ++frame)
+            {
+                const auto firstBeat = float(frame);
+                const auto pixelsPerBeat = float(width) / viewLength;
+                g.setColour(Colours::white);
+                for (const auto &note : notes)
+                {
+                    if (note.beat + note.length >= firstBeat && note.beat <= firstBeat + viewLength)
+                    {
+                        g.fillRect((note.beat - firstBeat) * pixelsPerBeat, float(note.y),
+                            jmax(0.25f, note.length * pixelsPerBeat), 1.f);
+                    }
+                }
+            }
+
+            const auto directTime = Time::getMillisecondCounterHiRes() - startTime;
+
+            PianoProjectMapTiles tiles;
+            for (int frame = 0; frame < numFrames; ++frame)
+            {
+                paint(g, tiles, notes, float(frame), float(frame) + viewLength);
+            }
+
+            expectEquals(tiles.getNumPaints(), numFrames);
+
+            logMessage("Painting " + String(numFrames) + " frames of " + String(numNotes) +
+                " notes, one fill per note: " + String(directTime, 2) + "ms, from the tiles: " +
+                String(tiles.getTotalPaintTimeMs(), 2) + "ms, with " +
+                String(tiles.getNumRenderedTiles()) + " tiles rendered");
+        }
+    }
+
+private:
+
+    static constexpr auto width = 960;
+    static constexpr auto height = 128;
+
+    struct NoteRect final
+    {
+        float beat;
+        float length;
+        int y;
+    };
+
+    static PianoProjectMapTiles::RenderFunction getRenderFunction(const Array<NoteRect> &notes)
+    {
+        return [&notes](PianoProjectMapTiles::Painter &painter)
+        {
+            for (const auto &note : notes)
+            {
+                painter.fillNote(note.beat, note.length, note.y, Colours::white);
+            }
+        };
+    }
+
+    static void paint(Graphics &g, PianoProjectMapTiles &tiles,
+        const Array<NoteRect> &notes, float firstBeat, float lastBeat)
+    {
+        tiles.paint(g, width, height, firstBeat, lastBeat, getRenderFunction(notes));
+    }
+};
+
+static PianoProjectMapTilesTests pianoProjectMapTilesTests;
+
+#endif
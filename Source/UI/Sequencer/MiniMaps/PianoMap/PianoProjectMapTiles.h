@@ -0,0 +1,104 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// The project map notes are rendered into image tiles, cached at a few
+// zoom levels, so that most repaints, like the ones while scrolling, zooming
+// or playing back, only draw the images; each zoom level has twice as many
+// pixels per beat as the previous one, and the view draws the tiles of the
+// nearest level which is at most as detailed as itself, so that the tiles
+// are only ever stretched, and even the shortest notes never skip a frame;
+// the tiles are positioned in absolute beats, and the edits only
+// invalidate the tiles they overlap, which are re-rendered when visible
+
+class PianoProjectMapTiles final
+{
+public:
+
+    PianoProjectMapTiles() = default;
+
+    // splits the notes, positioned in absolute beats, between the tiles being rendered
+    class Painter final
+    {
+    public:
+
+        bool isVisible(float beat, float length) const noexcept;
+        void fillNote(float beat, float length, int y, const Colour &colour);
+
+    private:
+
+        Painter(const Array<Graphics *> &tileGraphics, int firstIndex,
+            float tilePixelsPerBeat, float tileLengthInBeats);
+
+        const Array<Graphics *> &tileGraphics;
+        const int firstIndex;
+        const int lastIndex;
+        const float firstBeat;
+        const float lastBeat;
+        const float tilePixelsPerBeat;
+        const float tileLengthInBeats;
+
+        friend class PianoProjectMapTiles;
+    };
+
+    // renders all the notes into the dirty tiles in a single pass
+    using RenderFunction = Function<void(Painter &painter)>;
+
+    void paint(Graphics &g, int width, int height,
+        float firstBeat, float lastBeat, const RenderFunction &renderNotes);
+
+    void invalidate(float startBeat, float endBeat);
+    void invalidateAll();
+
+    //===------------------------------------------------------------------===//
+    // Paint stats
+    //===------------------------------------------------------------------===//
+
+    int getNumPaints() const noexcept;
+    int getNumRenderedTiles() const noexcept;
+    double getTotalPaintTimeMs() const noexcept;
+
+private:
+
+    struct Tile final
+    {
+        Image image;
+        int zoomLevel = 0;
+        int index = 0;
+        bool isDirty = true;
+        bool isVisible = false;
+    };
+
+    static constexpr auto tileWidth = 256;
+    static constexpr auto minZoomLevel = -6; // 1/64 pixels per beat
+    static constexpr auto maxZoomLevel = 6; // 64 pixels per beat
+    static constexpr auto maxCachedTiles = 64;
+
+    FlatHashMap<int64, UniquePointer<Tile>> tiles;
+    int tilesHeight = 0;
+
+    void renderTiles(const Array<Tile *> &dirtyTiles,
+        float tilePixelsPerBeat, float tileLengthInBeats,
+        const RenderFunction &renderNotes);
+
+    int numPaints = 0;
+    int numRenderedTiles = 0;
+    double totalPaintTimeMs = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PianoProjectMapTiles)
+};
@@ -17,23 +17,19 @@
 
 #pragma once
 
-#include "Note.h"
 #include "ClipComponent.h"
-#include "ProjectListener.h"
 
 class HybridRoll;
 class MidiSequence;
 class ProjectNode;
 
-class PianoClipComponent final : public ClipComponent, public ProjectListener
+class PianoClipComponent final : public ClipComponent
 {
 public:
 
     PianoClipComponent(ProjectNode &project, MidiSequence *sequence,
         HybridRoll &roll, const Clip &clip);
 
-    ~PianoClipComponent() override;
-
     void setShowRecordingMode(bool isRecording);
 
     //===------------------------------------------------------------------===//
@@ -41,38 +37,11 @@ public:
     //===------------------------------------------------------------------===//
 
     void paint(Graphics &g) override;
-    
-    //===------------------------------------------------------------------===//
-    // ProjectListener
-    //===------------------------------------------------------------------===//
-
-    void onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2) override;
-    void onAddMidiEvent(const MidiEvent &event) override;
-    void onRemoveMidiEvent(const MidiEvent &event) override;
-
-    void onAddClip(const Clip &clip) override {}
-    void onChangeClip(const Clip &oldClip, const Clip &newClip) override;
-    void onRemoveClip(const Clip &clip) override {}
-
-    void onAddTrack(MidiTrack *const track) override;
-    void onRemoveTrack(MidiTrack *const track) override;
-    void onChangeTrackProperties(MidiTrack *const track) override;
-
-    void onChangeProjectBeatRange(float firstBeat, float lastBeat) override {}
-    void onChangeViewBeatRange(float firstBeat, float lastBeat) override {}
-    void onChangeProjectInfo(const ProjectMetadata *info) override;
-    void onReloadProjectContent(const Array<MidiTrack *> &tracks,
-        const ProjectMetadata *meta) override;
 
 private:
 
-    void reloadTrackMap();
-
     ProjectNode &project;
     WeakReference<MidiSequence> sequence;
-    FlatHashSet<Note, MidiEventHash> displayedNotes;
-
-    int keyboardSize = Globals::twelveToneKeyboardSize;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PianoClipComponent)
 };
@@ -0,0 +1,95 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "PianoClipThumbnails.h"
+#include "MidiSequence.h"
+#include "Note.h"
+
+const Image &PianoClipThumbnails::getThumbnail(const MidiSequence *sequence,
+    int width, int height, int keyboardSize)
+{
+    jassert(sequence != nullptr);
+
+    auto &thumbnail = this->thumbnails[sequence];
+    if (thumbnail == nullptr)
+    {
+        thumbnail = make<Thumbnail>();
+    }
+
+    const auto imageWidth = jmin(width, PianoClipThumbnails::maxThumbnailWidth);
+
+    if (!thumbnail->image.isValid() ||
+        thumbnail->changeGeneration != sequence->getChangeGeneration() ||
+        thumbnail->width != imageWidth ||
+        thumbnail->height != height ||
+        thumbnail->keyboardSize != keyboardSize)
+    {
+        thumbnail->changeGeneration = sequence->getChangeGeneration();
+        thumbnail->width = imageWidth;
+        thumbnail->height = height;
+        thumbnail->keyboardSize = keyboardSize;
+        this->render(*thumbnail, sequence);
+    }
+
+    return thumbnail->image;
+}
+
+void PianoClipThumbnails::removeThumbnail(const MidiSequence *sequence)
+{
+    this->thumbnails.erase(sequence);
+}
+
+void PianoClipThumbnails::clear()
+{
+    this->thumbnails.clear();
+}
+
+void PianoClipThumbnails::render(Thumbnail &thumbnail, const MidiSequence *sequence) const
+{
+    if (thumbnail.width <= 0 || thumbnail.height <= 0 || thumbnail.keyboardSize <= 0)
+    {
+        thumbnail.image = {};
+        return;
+    }
+
+    thumbnail.image = Image(Image::SingleChannel, thumbnail.width, thumbnail.height + 1, true);
+
+    Graphics g(thumbnail.image);
+    g.setColour(Colours::white);
+
+    const float sequenceLength = sequence->getLengthInBeats();
+    const float firstBeat = sequence->getFirstBeat();
+    const float w = float(thumbnail.width);
+    const float h = float(thumbnail.height);
+
+    for (const auto *event : *sequence)
+    {
+        if (!event->isTypeOf(MidiEvent::Type::Note))
+        {
+            continue;
+        }
+
+        const auto *note = static_cast<const Note *>(event);
+        const float beat = note->getBeat() - firstBeat;
+        const auto key = jlimit(0, thumbnail.keyboardSize, int(note->getKey()));
+        const float x = w * (beat / sequenceLength);
+        const float noteWidth = w * (note->getLength() / sequenceLength);
+        const int y = int(h - key * h / float(thumbnail.keyboardSize));
+        g.fillRect(x, float(y), jmax(0.25f, noteWidth), 1.f);
+    }
+}
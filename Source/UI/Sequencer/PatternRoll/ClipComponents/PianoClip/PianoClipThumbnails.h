@@ -0,0 +1,61 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class MidiSequence;
+
+// All the clips of a piano sequence look the same, except for the key offset,
+// so instead of painting each note in each clip, the notes are rendered once
+// into an alpha mask at the zero key offset, which the clips only have to blit;
+// the thumbnail is re-rendered when the sequence's change generation,
+// the clip size or the keyboard size don't match the ones it was rendered for
+
+class PianoClipThumbnails final
+{
+public:
+
+    PianoClipThumbnails() = default;
+
+    // the image is one pixel taller than the clip, so that the lowest key,
+    // which is drawn right below the clip, gets into it too;
+    // the width is limited by maxThumbnailWidth, then it is to be scaled
+    const Image &getThumbnail(const MidiSequence *sequence,
+        int width, int height, int keyboardSize);
+
+    void removeThumbnail(const MidiSequence *sequence);
+    void clear();
+
+    static constexpr auto maxThumbnailWidth = 2048;
+
+private:
+
+    struct Thumbnail final
+    {
+        Image image;
+        uint32 changeGeneration = 0;
+        int width = 0;
+        int height = 0;
+        int keyboardSize = 0;
+    };
+
+    void render(Thumbnail &thumbnail, const MidiSequence *sequence) const;
+
+    FlatHashMap<const MidiSequence *, UniquePointer<Thumbnail>> thumbnails;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PianoClipThumbnails)
+};
@@ -45,6 +45,7 @@
 #include "AutomationSequence.h"
 #include "ClipComponent.h"
 #include "PianoClipComponent.h"
+#include "PianoClipThumbnails.h"
 #include "AutomationCurveClipComponent.h"
 #include "AutomationStepsClipComponent.h"
 #include "DummyClipComponent.h"
@@ -82,6 +83,8 @@ PatternRoll::PatternRoll(ProjectNode &parentProject,
     WeakReference<AudioMonitor> clippingDetector) :
     HybridRoll(parentProject, viewportRef, clippingDetector, false, false, true)
 {
+    this->pianoClipThumbnails = make<PianoClipThumbnails>();
+
     this->selectionListeners.add(new PatternRollSelectionMenuManager(&this->selection));
     this->selectionListeners.add(new PatternRollRecordingTargetController(&this->selection, parentProject));
 
@@ -129,6 +132,8 @@ void PatternRoll::reloadRollContent()
 {
     this->selection.deselectAll();
     this->clipComponents.clear();
+    this->clipsIndices.clear();
+    this->pianoClipThumbnails->clear();
     this->tracks.clearQuick();
     this->rows.clearQuick();
 
@@ -150,6 +155,7 @@ void PatternRoll::reloadRollContent()
                 if (auto *clipComponent = createClipComponentFor(track, clip, this->project, *this))
                 {
                     this->clipComponents[clip] = UniquePointer<ClipComponent>(clipComponent);
+                    this->addToClipsIndex(clipComponent, clip);
                     this->addAndMakeVisible(clipComponent);
                 }
             }
@@ -294,10 +300,68 @@ float PatternRoll::getBeatByMousePosition(const Pattern *pattern, int x) const
     return this->getFloorBeatSnapByXPosition(x) - sequence->getFirstBeat();
 }
 
+PianoClipThumbnails &PatternRoll::getPianoClipThumbnails() noexcept
+{
+    return *this->pianoClipThumbnails;
+}
+
+void PatternRoll::triggerBatchRepaintForClipsOf(const MidiSequence *sequence)
+{
+    if (dynamic_cast<const PianoSequence *>(sequence) == nullptr)
+    {
+        return; // the automation clips update themselves
+    }
+
+    const auto *pattern = sequence->getTrack()->getPattern();
+    if (pattern == nullptr)
+    {
+        return;
+    }
+
+    for (int i = 0; i < pattern->size(); ++i)
+    {
+        const auto found = this->clipComponents.find(*pattern->getUnchecked(i));
+        if (found != this->clipComponents.end())
+        {
+            this->batchRepaintList.add(found->second.get());
+        }
+    }
+
+    this->triggerAsyncUpdate();
+}
+
 //===----------------------------------------------------------------------===//
 // ProjectListener
 //===----------------------------------------------------------------------===//
 
+void PatternRoll::onAddMidiEvent(const MidiEvent &event)
+{
+    this->triggerBatchRepaintForClipsOf(event.getSequence());
+}
+
+void PatternRoll::onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2)
+{
+    this->triggerBatchRepaintForClipsOf(e2.getSequence());
+}
+
+void PatternRoll::onPostRemoveMidiEvent(MidiSequence *const layer)
+{
+    this->triggerBatchRepaintForClipsOf(layer);
+}
+
+void PatternRoll::onAddMidiEvents(const Array<const MidiEvent *> &events)
+{
+    if (events.isEmpty()) { return; }
+    this->triggerBatchRepaintForClipsOf(events.getFirst()->getSequence());
+}
+
+void PatternRoll::onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+    const Array<const MidiEvent *> &newEvents)
+{
+    if (newEvents.isEmpty()) { return; }
+    this->triggerBatchRepaintForClipsOf(newEvents.getFirst()->getSequence());
+}
+
 void PatternRoll::onAddTrack(MidiTrack *const track)
 {
     if (auto *pattern = track->getPattern())
@@ -312,6 +376,7 @@ void PatternRoll::onAddTrack(MidiTrack *const track)
             if (auto *clipComponent = createClipComponentFor(track, clip, this->project, *this))
             {
                 this->clipComponents[clip] = UniquePointer<ClipComponent>(clipComponent);
+                this->addToClipsIndex(clipComponent, clip);
                 this->addAndMakeVisible(clipComponent);
 
                 if (this->isEnabled())
@@ -380,6 +445,9 @@ void PatternRoll::onRemoveTrack(MidiTrack *const track)
         }
     }
 
+    this->clipsIndices.erase(track);
+    this->pianoClipThumbnails->removeThumbnail(track->getSequence());
+
     this->updateRollSize();
     this->resized();
 }
@@ -390,6 +458,7 @@ void PatternRoll::onAddClip(const Clip &clip)
     if (auto *clipComponent = createClipComponentFor(track, clip, this->project, *this))
     {
         this->clipComponents[clip] = UniquePointer<ClipComponent>(clipComponent);
+        this->addToClipsIndex(clipComponent, clip);
         this->addAndMakeVisible(clipComponent);
         clipComponent->toFront(false);
 
@@ -409,11 +478,17 @@ void PatternRoll::onAddClip(const Clip &clip)
 
 void PatternRoll::onChangeClip(const Clip &clip, const Clip &newClip)
 {
-    if (const auto component = this->clipComponents[clip].release())
+    const auto found = this->clipComponents.find(clip);
+    if (found != this->clipComponents.end())
     {
-        this->clipComponents.erase(clip);
+        const auto component = found.value().release();
+        this->clipComponents.erase(found);
         this->clipComponents[newClip] = UniquePointer<ClipComponent>(component);
 
+        this->removeFromClipsIndex(component, clip);
+        this->addToClipsIndex(component, newClip);
+
+        component->updateColours(); // transparency depends on clip velocity
         this->batchRepaintList.add(component);
         this->triggerAsyncUpdate();
     }
@@ -421,11 +496,14 @@ void PatternRoll::onChangeClip(const Clip &clip, const Clip &newClip)
 
 void PatternRoll::onRemoveClip(const Clip &clip)
 {
-    if (const auto deletedComponent = this->clipComponents[clip].get())
+    const auto found = this->clipComponents.find(clip);
+    if (found != this->clipComponents.end())
     {
+        const auto deletedComponent = found->second.get();
         this->fader.fadeOut(deletedComponent, Globals::UI::fadeOutLong);
         this->selection.deselect(deletedComponent);
-        this->clipComponents.erase(clip);
+        this->removeFromClipsIndex(deletedComponent, clip);
+        this->clipComponents.erase(found);
     }
 }
 
@@ -438,6 +516,14 @@ void PatternRoll::onReloadProjectContent(const Array<MidiTrack *> &tracks,
     this->reloadRollContent();
 }
 
+void PatternRoll::onChangeProjectInfo(const ProjectMetadata *info)
+{
+    HybridRoll::onChangeProjectInfo(info);
+
+    // the piano clips depend on the keyboard size
+    this->repaint(this->viewport.getViewArea());
+}
+
 //===----------------------------------------------------------------------===//
 // LassoSource
 //===----------------------------------------------------------------------===//
@@ -449,29 +535,42 @@ void PatternRoll::selectEventsInRange(float startBeat, float endBeat, bool shoul
         this->selection.deselectAll();
     }
 
-    for (const auto &e : this->clipComponents)
+    for (const auto &it : this->clipsIndices)
     {
-        const auto component = e.second.get();
-        if (component->isActive() &&
-            component->getBeat() >= startBeat &&
-            component->getBeat() < endBeat)
+        this->clipsSearchResult.clearQuick();
+        it.second->findItems(this->clipsSearchResult, startBeat, endBeat, 0, 0);
+
+        for (auto *component : this->clipsSearchResult)
         {
-            this->selection.addToSelection(component);
+            if (component->isActive() &&
+                component->getBeat() >= startBeat &&
+                component->getBeat() < endBeat)
+            {
+                this->selection.addToSelection(component);
+            }
         }
     }
 }
 
 void PatternRoll::findLassoItemsInArea(Array<SelectableComponent *> &itemsFound, const Rectangle<int> &rectangle)
 {
-    for (const auto &e : this->clipComponents)
+    // only the components under the previous lasso area
+    // or under the current one could have changed their state
+    const auto searchArea = this->lastLassoArea.expanded(1)
+        .getUnion(rectangle.expanded(1)).toFloat();
+
+    this->lastLassoArea = rectangle;
+
+    this->clipsSearchResult.clearQuick();
+    this->findClipComponents(this->clipsSearchResult, searchArea);
+
+    for (auto *component : this->clipsSearchResult)
     {
-        const auto component = e.second.get();
         component->setSelected(this->selection.isSelected(component));
     }
 
-    for (const auto &e : this->clipComponents)
+    for (auto *component : this->clipsSearchResult)
     {
-        const auto component = e.second.get();
         if (rectangle.intersects(component->getBounds()) && component->isActive())
         {
             jassert(!itemsFound.contains(component));
@@ -480,6 +579,63 @@ void PatternRoll::findLassoItemsInArea(Array<SelectableComponent *> &itemsFound,
     }
 }
 
+void PatternRoll::addToClipsIndex(ClipComponent *component, const Clip &clip)
+{
+    auto &clipsIndex = this->clipsIndices[clip.getPattern()->getTrack()];
+    if (clipsIndex == nullptr)
+    {
+        clipsIndex = make<ClipsIndex>();
+    }
+
+    clipsIndex->add(component, clip.getBeat(), clip.getBeat(), 0);
+}
+
+void PatternRoll::removeFromClipsIndex(ClipComponent *component, const Clip &clip)
+{
+    const auto found = this->clipsIndices.find(clip.getPattern()->getTrack());
+    if (found != this->clipsIndices.end())
+    {
+        found->second->remove(component, clip.getBeat(), clip.getBeat(), 0);
+    }
+}
+
+void PatternRoll::findClipComponents(Array<ClipComponent *> &result, const Rectangle<float> &area)
+{
+    const auto grouping = this->project.getTrackGroupingMode();
+    const auto startBeat = this->getBeatByXPosition(area.getX());
+    const auto endBeat = this->getBeatByXPosition(area.getRight());
+
+    for (const auto &it : this->clipsIndices)
+    {
+        const auto *track = it.first;
+
+        // the rows are checked first, as there are way less rows than clips
+        const auto trackIndex = this->rows.indexOfSorted(kStringSort, track->getTrackGroupKey(grouping));
+        const auto rowY = float(Globals::UI::rollHeaderHeight + trackIndex * PatternRoll::rowHeight);
+        if (rowY > area.getBottom() || rowY + PatternRoll::rowHeight < area.getY())
+        {
+            continue;
+        }
+
+        // the index knows the clip beats only, so look a sequence length back
+        const auto *sequence = track->getSequence();
+        const auto sequenceLength = sequence->isEmpty() ? Globals::Defaults::emptyClipLength :
+            jmax(sequence->getLengthInBeats(), Globals::minClipLength);
+        const auto firstBeat = sequence->getFirstBeat();
+
+        const auto prevNumResults = result.size();
+        it.second->findItems(result, startBeat - firstBeat - sequenceLength, endBeat - firstBeat, 0, 0);
+
+        for (int i = result.size(); i-- > prevNumResults;)
+        {
+            if (!result.getUnchecked(i)->getBounds().toFloat().intersects(area))
+            {
+                result.remove(i);
+            }
+        }
+    }
+}
+
 void PatternRoll::updateHighlightedInstances()
 {
     for (const auto *track : this->tracks)
@@ -933,11 +1089,14 @@ void PatternRoll::insertNewClipAt(const MouseEvent &e)
 void PatternRoll::startCuttingClips(const MouseEvent &e)
 {
     ClipComponent *targetClip = nullptr;
-    for (const auto &cc : this->clipComponents)
+
+    this->clipsSearchResult.clearQuick();
+    this->findClipComponents(this->clipsSearchResult, { e.position.x, e.position.y, 1.f, 1.f });
+    for (auto *cc : this->clipsSearchResult)
     {
-        if (cc.second.get()->getBounds().contains(e.position.toInt()))
+        if (cc->getBounds().contains(e.position.toInt()))
         {
-            targetClip = cc.second.get();
+            targetClip = cc;
             break;
         }
     }
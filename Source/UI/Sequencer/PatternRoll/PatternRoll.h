@@ -19,9 +19,11 @@
 
 class CutPointMark;
 class ClipComponent;
+class PianoClipThumbnails;
 
 #include "HelioTheme.h"
 #include "HybridRoll.h"
+#include "RollSpatialIndex.h"
 #include "MidiTrack.h"
 #include "Pattern.h"
 #include "Clip.h"
@@ -48,14 +50,21 @@ public:
     float getBeatForClipByXPosition(const Clip &clip, float x) const;
     float getBeatByMousePosition(const Pattern *pattern, int x) const;
 
+    PianoClipThumbnails &getPianoClipThumbnails() noexcept;
+
     //===------------------------------------------------------------------===//
     // ProjectListener
     //===------------------------------------------------------------------===//
 
-    void onAddMidiEvent(const MidiEvent &event) override {}
-    void onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2) override {}
+    void onAddMidiEvent(const MidiEvent &event) override;
+    void onChangeMidiEvent(const MidiEvent &e1, const MidiEvent &e2) override;
     void onRemoveMidiEvent(const MidiEvent &event) override {}
-    void onPostRemoveMidiEvent(MidiSequence *const layer) override {}
+    void onPostRemoveMidiEvent(MidiSequence *const layer) override;
+
+    void onAddMidiEvents(const Array<const MidiEvent *> &events) override;
+    void onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents) override;
+    void onRemoveMidiEvents(const Array<const MidiEvent *> &events) override {}
 
     void onAddClip(const Clip &clip) override;
     void onChangeClip(const Clip &oldClip, const Clip &newClip) override;
@@ -67,6 +76,7 @@ public:
     void onChangeTrackProperties(MidiTrack *const track) override;
     void onReloadProjectContent(const Array<MidiTrack *> &tracks,
         const ProjectMetadata *meta) override;
+    void onChangeProjectInfo(const ProjectMetadata *info) override;
 
     //===------------------------------------------------------------------===//
     // LassoSource
@@ -167,5 +177,24 @@ private:
     using ClipComponentsMap = FlatHashMap<Clip, UniquePointer<ClipComponent>, ClipHash>;
     ClipComponentsMap clipComponents;
 
+    // the clip components of each track are indexed by the clip beats,
+    // so that the lasso and the knife tool only check the ones in the area;
+    // the sequence range, which also affects the clip bounds, is only
+    // taken into account when searching, so the note edits don't touch the index
+    using ClipsIndex = RollSpatialIndex<ClipComponent *>;
+    FlatHashMap<const MidiTrack *, UniquePointer<ClipsIndex>> clipsIndices;
+    Array<ClipComponent *> clipsSearchResult;
+
+    void addToClipsIndex(ClipComponent *component, const Clip &clip);
+    void removeFromClipsIndex(ClipComponent *component, const Clip &clip);
+    void findClipComponents(Array<ClipComponent *> &result, const Rectangle<float> &area);
+
+    // the piano clips don't listen to the project themselves,
+    // so that looping a pattern many times doesn't multiply the note callbacks;
+    // instead, the roll repaints all clips of the changed sequence,
+    // and they share one cached thumbnail of it
+    UniquePointer<PianoClipThumbnails> pianoClipThumbnails;
+    void triggerBatchRepaintForClipsOf(const MidiSequence *sequence);
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatternRoll)
 };
@@ -53,23 +53,31 @@ PianoRoll &NoteComponent::getRoll() const noexcept
 // Accessors
 //===----------------------------------------------------------------------===//
 
-void NoteComponent::updateColours()
+Colour NoteComponent::getNoteColour(const Colour &trackColour, bool ghost, bool selected)
 {
-    const bool ghost = this->flags.isGhost || !this->flags.isActive;
     const auto base = findDefaultColour(ColourIDs::Roll::noteFill);
 
-    this->colour = this->getNote().getTrackColour()
+    const auto colour = trackColour
         .interpolatedWith(base, ghost ? 0.15f : 0.4f)
-        .brighter(this->flags.isSelected ? 1.15f : 0.f)
+        .brighter(selected ? 1.15f : 0.f)
         .withMultipliedSaturationHSL(ghost ? 1.5f : 1.f)
         .withAlpha(ghost ? 0.25f : 0.9f);
 
     if (ghost)
     {
-        this->colour = HelioTheme::getCurrentTheme().isDark() ?
-            this->colour.brighter(0.55f) : this->colour.darker(0.45f);
+        return HelioTheme::getCurrentTheme().isDark() ?
+            colour.brighter(0.55f) : colour.darker(0.45f);
     }
 
+    return colour;
+}
+
+void NoteComponent::updateColours()
+{
+    const bool ghost = this->flags.isGhost || !this->flags.isActive;
+    this->colour = NoteComponent::getNoteColour(this->getNote().getTrackColour(),
+        ghost, this->flags.isSelected);
+
     this->colourLighter = this->colour.brighter(0.125f).withMultipliedAlpha(1.45f);
     this->colourDarker = this->colour.darker(0.175f).withMultipliedAlpha(1.45f);
     this->colourVolume = this->colour.darker(0.8f).withAlpha(ghost ? 0.f : 0.5f);
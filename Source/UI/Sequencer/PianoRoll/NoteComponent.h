@@ -58,6 +58,10 @@ public:
 
     void updateColours() override;
 
+    // the roll paints the notes which don't have components by itself,
+    // and they should look like the components would
+    static Colour getNoteColour(const Colour &trackColour, bool ghost, bool selected);
+
     //===------------------------------------------------------------------===//
     // MidiEventComponent
     //===------------------------------------------------------------------===//
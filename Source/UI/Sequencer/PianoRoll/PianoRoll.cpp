@@ -103,48 +103,159 @@ void PianoRoll::reloadRollContent()
 {
     this->selection.deselectAll();
     this->patternMap.clear();
+    this->notesIndex.clear();
 
     HYBRID_ROLL_BULK_REPAINT_START
 
     for (const auto *track : this->project.getTracks())
     {
-        this->loadTrack(track);
+        this->notesIndex.loadTrack(track);
     }
 
+    this->createActiveClipComponents();
     this->updateBackgroundCachesAndRepaint();
 
     HYBRID_ROLL_BULK_REPAINT_END
 }
 
-void PianoRoll::loadTrack(const MidiTrack *const track)
+void PianoRoll::createActiveClipComponents()
 {
-    if (track->getPattern() == nullptr)
+    this->patternMap.clear();
+    this->activeComponentsBeatRange = {};
+    this->activeComponentsKeyRange = {};
+
+    const auto *clip = this->findActiveClipInPattern();
+    if (clip == nullptr)
     {
         return;
     }
 
-    for (int i = 0; i < track->getPattern()->size(); ++i)
+    auto *sequenceMap = new SequenceMap();
+    this->patternMap[*clip] = UniquePointer<SequenceMap>(sequenceMap);
+
+    // only the notes around the viewport get their components,
+    // the rest of the clip is painted from the index for now
+    this->updateActiveClipComponents();
+}
+
+void PianoRoll::updateActiveClipComponents()
+{
+    const auto *clip = this->findActiveClipInPattern();
+    const auto sequenceMapIt = this->patternMap.find(this->activeClip);
+    if (clip == nullptr || sequenceMapIt == this->patternMap.end())
     {
-        const Clip *clip = track->getPattern()->getUnchecked(i);
+        return;
+    }
+
+    float startBeat, endBeat;
+    int minKey, maxKey;
+    this->getBeatKeyRange(this->viewport.getViewArea().toFloat(),
+        startBeat, endBeat, minKey, maxKey);
+
+    if (this->activeComponentsBeatRange.contains(Range<float>(startBeat, endBeat)) &&
+        this->activeComponentsKeyRange.contains(Range<int>(minKey, maxKey)))
+    {
+        return;
+    }
+
+    // a margin of one screen in each direction, so that
+    // the components are not updated at each scroll step
+    const auto beatMargin = endBeat - startBeat;
+    const auto keyMargin = maxKey - minKey;
+    this->activeComponentsBeatRange = { startBeat - beatMargin, endBeat + beatMargin };
+    this->activeComponentsKeyRange = { minKey - keyMargin, maxKey + keyMargin };
+
+    auto &sequenceMap = *sequenceMapIt->second.get();
 
-        auto *sequenceMap = new SequenceMap();
-        this->patternMap[*clip] = UniquePointer<SequenceMap>(sequenceMap);
+    // the lasso and the knife tool keep the pointers to the components,
+    // so while they are in use, the components are only added
+    const bool canRemoveComponents = this->knifeToolHelper == nullptr &&
+        !this->lassoComponent->isDragging();
 
-        for (int j = 0; j < track->getSequence()->size(); ++j)
+    if (canRemoveComponents)
+    {
+        Array<Note> notesToRemove;
+        for (const auto &e : sequenceMap)
         {
-            const MidiEvent *event = track->getSequence()->getUnchecked(j);
-            if (event->isTypeOf(MidiEvent::Type::Note))
+            const auto *component = e.second.get();
+            if (!component->isSelected() &&
+                component != this->newNoteDragging &&
+                !this->isInActiveComponentsRange(e.first, *clip))
             {
-                const Note *note = static_cast<const Note *>(event);
-                auto *nc = new NoteComponent(*this, *note, *clip);
-                (*sequenceMap)[*note] = UniquePointer<NoteComponent>(nc);
-                const bool isActive = nc->belongsTo(this->activeTrack, this->activeClip);
-                nc->setActive(isActive, true);
-                this->addAndMakeVisible(nc);
-                nc->setFloatBounds(this->getEventBounds(nc));
+                notesToRemove.add(e.first);
             }
         }
+
+        for (const auto &note : notesToRemove)
+        {
+            sequenceMap.erase(note);
+        }
+    }
+
+    this->notesSearchResult.clearQuick();
+    this->notesIndex.findNotes(this->notesSearchResult, this->activeTrack, *clip,
+        this->activeComponentsBeatRange.getStart(), this->activeComponentsBeatRange.getEnd(),
+        this->activeComponentsKeyRange.getStart(), this->activeComponentsKeyRange.getEnd());
+
+    bool addedComponents = false;
+    for (const auto *note : this->notesSearchResult)
+    {
+        if (!sequenceMap.contains(*note) &&
+            this->isInActiveComponentsRange(*note, *clip))
+        {
+            this->createActiveNoteComponent(sequenceMap, *note, *clip);
+            addedComponents = true;
+        }
+    }
+
+    if (addedComponents)
+    {
+        this->noteNameGuides->toFront(false);
+    }
+}
+
+const Clip *PianoRoll::findActiveClipInPattern() const
+{
+    if (this->activeTrack == nullptr ||
+        this->activeTrack->getPattern() == nullptr)
+    {
+        return nullptr;
     }
+
+    const auto *pattern = this->activeTrack->getPattern();
+    const int clipIndex = pattern->indexOfSorted(&this->activeClip);
+    return clipIndex >= 0 ? pattern->getUnchecked(clipIndex) : nullptr;
+}
+
+bool PianoRoll::isInActiveComponentsRange(const Note &note, const Clip &clip) const noexcept
+{
+    const auto beat = note.getBeat() + clip.getBeat();
+    return this->activeComponentsKeyRange.contains(note.getKey() + clip.getKey()) &&
+        this->activeComponentsBeatRange.intersects(Range<float>(beat, beat + note.getLength()));
+}
+
+bool PianoRoll::hasActiveNoteComponent(const Note &note) const
+{
+    const auto sequenceMap = this->patternMap.find(this->activeClip);
+    return sequenceMap != this->patternMap.end() && sequenceMap->second->contains(note);
+}
+
+NoteComponent *PianoRoll::createActiveNoteComponent(SequenceMap &sequenceMap,
+    const Note &note, const Clip &clip)
+{
+    auto *component = new NoteComponent(*this, note, clip);
+    sequenceMap[note] = UniquePointer<NoteComponent>(component);
+    component->setActive(true, true);
+    this->addAndMakeVisible(component);
+    component->setFloatBounds(this->getEventBounds(component));
+
+    const auto &editMode = this->project.getEditMode();
+    const bool interactsWithChildren = editMode.shouldInteractWithChildren();
+    component->setInterceptsMouseClicks(interactsWithChildren, interactsWithChildren);
+    component->setMouseCursor(interactsWithChildren ?
+        MouseCursor::NormalCursor : editMode.getCursor());
+
+    return component;
 }
 
 void PianoRoll::updateActiveRangeIndicator() const
@@ -196,6 +307,25 @@ void PianoRoll::updateSize()
 
 void PianoRoll::selectAll()
 {
+    // all the notes of the clip are about to be selected,
+    // so the ones outside the viewport need their components too
+    const auto *clip = this->findActiveClipInPattern();
+    const auto sequenceMap = this->patternMap.find(this->activeClip);
+    if (clip != nullptr && sequenceMap != this->patternMap.end())
+    {
+        const auto *sequence = this->activeTrack->getSequence();
+        for (int i = 0; i < sequence->size(); ++i)
+        {
+            const auto *event = sequence->getUnchecked(i);
+            if (event->isTypeOf(MidiEvent::Type::Note) &&
+                !sequenceMap->second->contains(static_cast<const Note &>(*event)))
+            {
+                this->createActiveNoteComponent(*sequenceMap->second,
+                    static_cast<const Note &>(*event), *clip);
+            }
+        }
+    }
+
     forEachEventComponent(this->patternMap, e)
     {
         auto *childComponent = e.second.get();
@@ -255,11 +385,10 @@ void PianoRoll::longTapEvent(const Point<float> &position,
     if (!this->multiTouchController->hasMultitouch() &&
         !this->getEditMode().forbidsSelectionMode())
     {
-        const auto *nc = dynamic_cast<NoteComponent *>(target.get());
-        if (nc != nullptr && !nc->isActive())
+        const auto *clip = (target == this) ? this->findInactiveClipAt(position) : nullptr;
+        if (clip != nullptr)
         {
-            auto *track = nc->getNote().getSequence()->getTrack();
-            this->project.setEditableScope(track, nc->getClip(), false);
+            this->project.setEditableScope(clip->getPattern()->getTrack(), *clip, false);
             return;
         }
     }
@@ -380,6 +509,157 @@ int PianoRoll::getYPositionByKey(int targetKey) const
     return (this->getHeight() - this->rowHeight) - (targetKey * this->rowHeight);
 }
 
+//===----------------------------------------------------------------------===//
+// Indexed notes
+//===----------------------------------------------------------------------===//
+
+void PianoRoll::getBeatKeyRange(const Rectangle<float> &area,
+    float &startBeat, float &endBeat, int &minKey, int &maxKey) const
+{
+    startBeat = this->getBeatByXPosition(area.getX());
+    endBeat = this->getBeatByXPosition(area.getRight());
+    minKey = int((this->getHeight() - area.getBottom()) / this->rowHeight) - 1;
+    maxKey = int((this->getHeight() - area.getY()) / this->rowHeight) + 1;
+}
+
+void PianoRoll::repaintIndexedNote(const Note &note, const MidiTrack *track)
+{
+    if (track->getPattern() == nullptr)
+    {
+        return;
+    }
+
+    for (const auto *clip : track->getPattern()->getClips())
+    {
+        if (this->activeTrack.get() == track && *clip == this->activeClip &&
+            this->hasActiveNoteComponent(note))
+        {
+            continue;
+        }
+
+        this->repaint(this->getEventBounds(note.getKey() + clip->getKey(),
+            note.getBeat() + clip->getBeat(), note.getLength()).getSmallestIntegerContainer());
+    }
+}
+
+void PianoRoll::repaintIndexedNotes(const MidiTrack *track)
+{
+    if (track->getPattern() == nullptr)
+    {
+        return;
+    }
+
+    // the active clip is also painted from the index,
+    // if some of its notes don't have the components
+    const auto numClips = track->getPattern()->getClips().size();
+    const auto sequenceMap = this->patternMap.find(this->activeClip);
+    const auto hasIndexedNotes = this->activeTrack.get() == track ?
+        (numClips > 1 || sequenceMap == this->patternMap.end() ||
+            int(sequenceMap->second->size()) < track->getSequence()->size()) :
+        numClips > 0;
+
+    if (hasIndexedNotes)
+    {
+        this->repaint(this->viewport.getViewArea());
+    }
+}
+
+const Clip *PianoRoll::findInactiveClipAt(const Point<float> &position)
+{
+    float startBeat, endBeat;
+    int minKey, maxKey;
+    this->getBeatKeyRange({ position.x, position.y, 1.f, 1.f },
+        startBeat, endBeat, minKey, maxKey);
+
+    for (const auto *track : this->notesIndex.getTracks())
+    {
+        for (const auto *clip : track->getPattern()->getClips())
+        {
+            if (this->activeTrack.get() == track && *clip == this->activeClip)
+            {
+                continue;
+            }
+
+            this->notesSearchResult.clearQuick();
+            this->notesIndex.findNotes(this->notesSearchResult,
+                track, *clip, startBeat, endBeat, minKey, maxKey);
+
+            for (const auto *note : this->notesSearchResult)
+            {
+                if (this->getEventBounds(note->getKey() + clip->getKey(),
+                    note->getBeat() + clip->getBeat(), note->getLength()).contains(position))
+                {
+                    return clip;
+                }
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+void PianoRoll::findActiveNoteComponents(Array<NoteComponent *> &result,
+    const Rectangle<float> &area)
+{
+    const auto *clip = this->findActiveClipInPattern();
+    const auto sequenceMap = this->patternMap.find(this->activeClip);
+    if (clip == nullptr || sequenceMap == this->patternMap.end())
+    {
+        return;
+    }
+
+    float startBeat, endBeat;
+    int minKey, maxKey;
+    this->getBeatKeyRange(area, startBeat, endBeat, minKey, maxKey);
+
+    this->notesSearchResult.clearQuick();
+    this->notesIndex.findNotes(this->notesSearchResult,
+        this->activeTrack, *clip, startBeat, endBeat, minKey, maxKey);
+
+    for (const auto *note : this->notesSearchResult)
+    {
+        const auto found = sequenceMap->second->find(*note);
+        if (found != sequenceMap->second->end())
+        {
+            if (found->second->getBounds().toFloat().intersects(area))
+            {
+                result.add(found->second.get());
+            }
+        }
+        else if (this->getEventBounds(note->getKey() + clip->getKey(),
+            note->getBeat() + clip->getBeat(), note->getLength()).intersects(area))
+        {
+            result.add(this->createActiveNoteComponent(*sequenceMap->second, *note, *clip));
+        }
+    }
+}
+
+// Paints all the notes without components, i.e. the ones outside the active clip,
+// and the active clip's notes, which are outside the viewport most of the time
+void PianoRoll::paintIndexedNotes(Graphics &g)
+{
+    const auto paintArea = g.getClipBounds().toFloat();
+
+    float startBeat, endBeat;
+    int minKey, maxKey;
+    this->getBeatKeyRange(paintArea, startBeat, endBeat, minKey, maxKey);
+
+    const auto activeComponents = this->patternMap.find(this->activeClip);
+    const auto *sequenceMap = activeComponents != this->patternMap.end() ?
+        activeComponents->second.get() : nullptr;
+
+    this->notesIndex.paint(g, paintArea, startBeat, endBeat, minKey, maxKey,
+        [this](int key, float beat, float length)
+        {
+            return this->getEventBounds(key, beat, length);
+        },
+        this->activeTrack, this->activeClip,
+        [sequenceMap](const Note &note)
+        {
+            return sequenceMap != nullptr && sequenceMap->contains(note);
+        });
+}
+
 //===----------------------------------------------------------------------===//
 // Drag helpers
 //===----------------------------------------------------------------------===//
@@ -429,22 +709,7 @@ void PianoRoll::onChangeMidiEvent(const MidiEvent &oldEvent, const MidiEvent &ne
         const auto &newNote = static_cast<const Note &>(newEvent);
         const auto *track = newEvent.getSequence()->getTrack();
 
-        forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
-        {
-            auto &sequenceMap = *c.second.get();
-            if (auto *component = sequenceMap[note].release())
-            {
-                // Pass ownership to another key:
-                sequenceMap.erase(note);
-                // Hitting this assert means that a track somehow contains events
-                // with duplicate id's. This should never, ever happen.
-                jassert(!sequenceMap.contains(newNote));
-                // Always erase before updating, as it may happen both events have the same hash code:
-                sequenceMap[newNote] = UniquePointer<NoteComponent>(component);
-                // Schedule to be repainted later:
-                this->triggerBatchRepaintFor(component);
-            }
-        }
+        this->changeNoteComponents(note, newNote);
 
         // FIXME someday please: this is a kind of a really nasty hack,
         // and instead the guides bar should subscribe on project changes on its own,
@@ -452,6 +717,9 @@ void PianoRoll::onChangeMidiEvent(const MidiEvent &oldEvent, const MidiEvent &ne
         // BUT I'm too lazy, and this is also way less code and should work a bit faster,
         // so here we go. Yet this particular line is a piece of shit:
         this->noteNameGuides->syncWithSelection(&this->selection);
+
+        this->repaintIndexedNote(note, track);
+        this->repaintIndexedNote(newNote, track);
     }
     else if (oldEvent.isTypeOf(MidiEvent::Type::KeySignature))
     {
@@ -474,44 +742,8 @@ void PianoRoll::onAddMidiEvent(const MidiEvent &event)
     if (event.isTypeOf(MidiEvent::Type::Note))
     {
         const Note &note = static_cast<const Note &>(event);
-        const auto *track = note.getSequence()->getTrack();
-
-        forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
-        {
-            auto &sequenceMap = *c.second.get();
-            const auto *targetParams = &c.first;
-            const int i = track->getPattern()->indexOfSorted(targetParams);
-            jassert(i >= 0);
-            
-            const Clip *realClip = track->getPattern()->getUnchecked(i);
-            auto *component = new NoteComponent(*this, note, *realClip);
-            sequenceMap[note] = UniquePointer<NoteComponent>(component);
-            this->addAndMakeVisible(component);
-
-            this->fader.fadeIn(component, Globals::UI::fadeInLong);
-
-            // TODO check this in a more elegant way
-            // (needed not to break shift+drag note copying)
-            const bool isCurrentlyDraggingNote = this->draggingHelper->isVisible();
-
-            const bool isActive = component->belongsTo(this->activeTrack, this->activeClip);
-            component->setActive(isActive, true);
-
-            this->triggerBatchRepaintFor(component);
-
-            // arpeggiators preview cannot work without that:
-            if (isActive && !isCurrentlyDraggingNote)
-            {
-                this->selectEvent(component, false);
-            }
-
-            if (this->addNewNoteMode && isActive)
-            {
-                this->newNoteDragging = component;
-                this->addNewNoteMode = false;
-                this->selectEvent(this->newNoteDragging, true); // clear prev selection
-            }
-        }
+        this->addNoteComponents(note);
+        this->repaintIndexedNote(note, note.getSequence()->getTrack());
     }
     else if (event.isTypeOf(MidiEvent::Type::KeySignature))
     {
@@ -532,19 +764,8 @@ void PianoRoll::onRemoveMidiEvent(const MidiEvent &event)
         this->hideAllGhostNotes(); // Avoids crash
 
         const Note &note = static_cast<const Note &>(event);
-        const auto *track = note.getSequence()->getTrack();
-
-        forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
-        {
-            auto &sequenceMap = *c.second.get();
-            if (sequenceMap.contains(note))
-            {
-                NoteComponent *deletedComponent = sequenceMap[note].get();
-                this->fader.fadeOut(deletedComponent, Globals::UI::fadeOutLong);
-                this->selection.deselect(deletedComponent);
-                sequenceMap.erase(note);
-            }
-        }
+        this->removeNoteComponents(note);
+        this->repaintIndexedNote(note, note.getSequence()->getTrack());
     }
     else if (event.isTypeOf(MidiEvent::Type::KeySignature))
     {
@@ -556,42 +777,172 @@ void PianoRoll::onRemoveMidiEvent(const MidiEvent &event)
     HybridRoll::onRemoveMidiEvent(event);
 }
 
-void PianoRoll::onAddClip(const Clip &clip)
+// all events of a group belong to the same sequence, so either all of them
+// are notes, or none of them are, and the latter are handled one by one
+
+void PianoRoll::onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+    const Array<const MidiEvent *> &newEvents)
+{
+    if (newEvents.isEmpty() || !newEvents.getFirst()->isTypeOf(MidiEvent::Type::Note))
+    {
+        HybridRoll::onChangeMidiEvents(oldEvents, newEvents);
+        return;
+    }
+
+    for (int i = 0; i < newEvents.size(); ++i)
+    {
+        this->changeNoteComponents(static_cast<const Note &>(*oldEvents.getUnchecked(i)),
+            static_cast<const Note &>(*newEvents.getUnchecked(i)));
+    }
+
+    this->noteNameGuides->syncWithSelection(&this->selection);
+    this->repaintIndexedNotes(newEvents.getFirst()->getSequence()->getTrack());
+}
+
+void PianoRoll::onAddMidiEvents(const Array<const MidiEvent *> &events)
 {
-    const SequenceMap *referenceMap = nullptr;
-    const auto *track = clip.getPattern()->getTrack();
+    if (events.isEmpty() || !events.getFirst()->isTypeOf(MidiEvent::Type::Note))
+    {
+        HybridRoll::onAddMidiEvents(events);
+        return;
+    }
 
-    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
+    for (const auto *event : events)
     {
-        // Found a sequence map for the same track
-        referenceMap = c.second.get();
-        break;
+        this->addNoteComponents(static_cast<const Note &>(*event));
     }
 
-    if (referenceMap == nullptr)
+    this->repaintIndexedNotes(events.getFirst()->getSequence()->getTrack());
+}
+
+void PianoRoll::onRemoveMidiEvents(const Array<const MidiEvent *> &events)
+{
+    if (events.isEmpty() || !events.getFirst()->isTypeOf(MidiEvent::Type::Note))
     {
-        jassertfalse;
+        HybridRoll::onRemoveMidiEvents(events);
         return;
     }
 
-    auto *sequenceMap = new SequenceMap();
-    this->patternMap[clip] = UniquePointer<SequenceMap>(sequenceMap);
+    this->hideDragHelpers();
+    this->hideAllGhostNotes(); // Avoids crash
+
+    for (const auto *event : events)
+    {
+        this->removeNoteComponents(static_cast<const Note &>(*event));
+    }
+
+    this->repaintIndexedNotes(events.getFirst()->getSequence()->getTrack());
+}
+
+void PianoRoll::addNoteComponents(const Note &note)
+{
+    const auto *track = note.getSequence()->getTrack();
 
-    for (const auto &e : *referenceMap)
+    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
     {
-        // reference the same note as neighbor components:
-        const auto &note = e.second.get()->getNote();
-        auto *component = new NoteComponent(*this, note, clip);
-        (*sequenceMap)[note] = UniquePointer<NoteComponent>(component);
+        auto &sequenceMap = *c.second.get();
+        const auto *targetParams = &c.first;
+        const int i = track->getPattern()->indexOfSorted(targetParams);
+        jassert(i >= 0);
+
+        const Clip *realClip = track->getPattern()->getUnchecked(i);
+        auto *component = new NoteComponent(*this, note, *realClip);
+        sequenceMap[note] = UniquePointer<NoteComponent>(component);
         this->addAndMakeVisible(component);
 
+        this->fader.fadeIn(component, Globals::UI::fadeInLong);
+
+        // TODO check this in a more elegant way
+        // (needed not to break shift+drag note copying)
+        const bool isCurrentlyDraggingNote = this->draggingHelper->isVisible();
+
         const bool isActive = component->belongsTo(this->activeTrack, this->activeClip);
-        component->setActive(isActive);
+        component->setActive(isActive, true);
+
+        this->triggerBatchRepaintFor(component);
+
+        // arpeggiators preview cannot work without that:
+        if (isActive && !isCurrentlyDraggingNote)
+        {
+            this->selectEvent(component, false);
+        }
 
-        this->batchRepaintList.add(component);
+        if (this->addNewNoteMode && isActive)
+        {
+            this->newNoteDragging = component;
+            this->addNewNoteMode = false;
+            this->selectEvent(this->newNoteDragging, true); // clear prev selection
+        }
     }
 
-    this->triggerAsyncUpdate();
+    this->notesIndex.addNote(note);
+}
+
+void PianoRoll::changeNoteComponents(const Note &note, const Note &newNote)
+{
+    const auto *track = newNote.getSequence()->getTrack();
+
+    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
+    {
+        auto &sequenceMap = *c.second.get();
+        const auto found = sequenceMap.find(note);
+        if (found == sequenceMap.end())
+        {
+            // the notes only have components around the viewport,
+            // so the one which has been moved there needs it now:
+            const auto *clip = this->findActiveClipInPattern();
+            if (clip != nullptr && c.first == *clip &&
+                this->isInActiveComponentsRange(newNote, *clip))
+            {
+                jassert(!sequenceMap.contains(newNote));
+                this->createActiveNoteComponent(sequenceMap, newNote, *clip);
+            }
+
+            continue;
+        }
+
+        if (auto *component = found->second.release())
+        {
+            // Pass ownership to another key:
+            sequenceMap.erase(note);
+            // Hitting this assert means that a track somehow contains events
+            // with duplicate id's. This should never, ever happen.
+            jassert(!sequenceMap.contains(newNote));
+            // Always erase before updating, as it may happen both events have the same hash code:
+            sequenceMap[newNote] = UniquePointer<NoteComponent>(component);
+            // Schedule to be repainted later:
+            this->triggerBatchRepaintFor(component);
+        }
+    }
+
+    this->notesIndex.removeNote(newNote, note);
+    this->notesIndex.addNote(newNote);
+}
+
+void PianoRoll::removeNoteComponents(const Note &note)
+{
+    const auto *track = note.getSequence()->getTrack();
+
+    forEachSequenceMapOfGivenTrack(this->patternMap, c, track)
+    {
+        auto &sequenceMap = *c.second.get();
+        if (sequenceMap.contains(note))
+        {
+            NoteComponent *deletedComponent = sequenceMap[note].get();
+            this->fader.fadeOut(deletedComponent, Globals::UI::fadeOutLong);
+            this->selection.deselect(deletedComponent);
+            sequenceMap.erase(note);
+        }
+    }
+
+    this->notesIndex.removeNote(note, note);
+}
+
+void PianoRoll::onAddClip(const Clip &clip)
+{
+    // a new clip is never the active one, so it has no components,
+    // and its notes will be painted from the track's index
+    this->repaint(this->viewport.getViewArea());
 }
 
 void PianoRoll::onChangeClip(const Clip &clip, const Clip &newClip)
@@ -605,10 +956,12 @@ void PianoRoll::onChangeClip(const Clip &clip, const Clip &newClip)
         this->activeClip = newClip;
     }
 
-    if (auto *sequenceMap = this->patternMap[clip].release())
+    const auto found = this->patternMap.find(clip);
+    if (found != this->patternMap.end())
     {
         // Set new key for existing sequence map
-        this->patternMap.erase(clip);
+        auto *sequenceMap = found.value().release();
+        this->patternMap.erase(found);
         this->patternMap[newClip] = UniquePointer<SequenceMap>(sequenceMap);
 
         // And update all components within it, as their beats should change
@@ -620,11 +973,19 @@ void PianoRoll::onChangeClip(const Clip &clip, const Clip &newClip)
         if (newClip == this->activeClip)
         {
             this->updateActiveRangeIndicator();
+
+            // the clip has moved, and so has the range of its notes with components
+            this->activeComponentsBeatRange = {};
+            this->activeComponentsKeyRange = {};
+            this->updateActiveClipComponents();
         }
 
         // Schedule batch repaint
         this->triggerAsyncUpdate();
     }
+
+    // the inactive instances are painted by the roll
+    this->repaint(this->viewport.getViewArea());
 }
 
 void PianoRoll::onRemoveClip(const Clip &clip)
@@ -636,6 +997,8 @@ void PianoRoll::onRemoveClip(const Clip &clip)
         this->patternMap.erase(clip);
     }
 
+    this->repaint(this->viewport.getViewArea());
+
     HYBRID_ROLL_BULK_REPAINT_END
 }
 
@@ -666,7 +1029,12 @@ void PianoRoll::onAddTrack(MidiTrack *const track)
 {
     HYBRID_ROLL_BULK_REPAINT_START
 
-    this->loadTrack(track);
+    this->notesIndex.loadTrack(track);
+
+    if (this->activeTrack == track)
+    {
+        this->createActiveClipComponents();
+    }
 
     for (int j = 0; j < track->getSequence()->size(); ++j)
     {
@@ -710,6 +1078,8 @@ void PianoRoll::onRemoveTrack(MidiTrack *const track)
         }
     }
 
+    this->notesIndex.removeTrack(track);
+
     this->repaint();
 }
 
@@ -771,26 +1141,30 @@ void PianoRoll::onChangeViewEditableScope(MidiTrack *const newActiveTrack,
     this->activeTrack = newActiveTrack;
     this->activeClip = newActiveClip;
 
+    this->createActiveClipComponents();
+
     int focusMinKey = INT_MAX;
     int focusMaxKey = 0;
     float focusMinBeat = FLT_MAX;
     float focusMaxBeat = -FLT_MAX;
-    bool hasComponentsToFocusOn = false;
+    bool hasNotesToFocusOn = false;
 
-    forEachEventComponent(this->patternMap, e)
+    if (shouldFocus && this->activeTrack != nullptr)
     {
-        auto *nc = e.second.get();
-        const bool isActive = nc->belongsTo(this->activeTrack, this->activeClip);
-        const auto key = nc->getKey() + this->activeClip.getKey();
-        nc->setActive(isActive, true);
-
-        if (shouldFocus && isActive)
+        const auto *sequence = this->activeTrack->getSequence();
+        for (int i = 0; i < sequence->size(); ++i)
         {
-            hasComponentsToFocusOn = true;
-            focusMinKey = jmin(focusMinKey, key);
-            focusMaxKey = jmax(focusMaxKey, key);
-            focusMinBeat = jmin(focusMinBeat, nc->getBeat());
-            focusMaxBeat = jmax(focusMaxBeat, nc->getBeat() + nc->getLength());
+            const auto *event = sequence->getUnchecked(i);
+            if (event->isTypeOf(MidiEvent::Type::Note))
+            {
+                const auto *note = static_cast<const Note *>(event);
+                const auto key = note->getKey() + this->activeClip.getKey();
+                hasNotesToFocusOn = true;
+                focusMinKey = jmin(focusMinKey, key);
+                focusMaxKey = jmax(focusMaxKey, key);
+                focusMinBeat = jmin(focusMinBeat, note->getBeat());
+                focusMaxBeat = jmax(focusMaxBeat, note->getBeat() + note->getLength());
+            }
         }
     }
 
@@ -799,7 +1173,7 @@ void PianoRoll::onChangeViewEditableScope(MidiTrack *const newActiveTrack,
     if (shouldFocus)
     {
         // hardcoded zoom settings for empty tracks:
-        if (!hasComponentsToFocusOn)
+        if (!hasNotesToFocusOn)
         {
             focusMinKey = 44;
             focusMaxKey = 84;
@@ -830,11 +1204,16 @@ void PianoRoll::selectEventsInRange(float startBeat, float endBeat, bool shouldC
         this->selection.deselectAll();
     }
 
-    forEachEventComponent(this->patternMap, e)
+    const auto startX = float(this->getXPositionByBeat(startBeat));
+    const auto endX = float(this->getXPositionByBeat(endBeat));
+
+    this->componentsSearchResult.clearQuick();
+    this->findActiveNoteComponents(this->componentsSearchResult,
+        { startX, 0.f, endX - startX + 1.f, float(this->getHeight()) });
+
+    for (auto *component : this->componentsSearchResult)
     {
-        auto *component = e.second.get();
-        if (component->isActive() &&
-            (component->getNote().getBeat() + component->getClip().getBeat()) >= startBeat &&
+        if ((component->getNote().getBeat() + component->getClip().getBeat()) >= startBeat &&
             (component->getNote().getBeat() + component->getClip().getBeat()) < endBeat)
         {
             this->selectEvent(component, false);
@@ -844,9 +1223,18 @@ void PianoRoll::selectEventsInRange(float startBeat, float endBeat, bool shouldC
 
 void PianoRoll::findLassoItemsInArea(Array<SelectableComponent *> &itemsFound, const Rectangle<int> &rectangle)
 {
-    forEachEventComponent(this->patternMap, e)
+    // only the components under the previous lasso area
+    // or under the current one could have changed their state
+    const auto searchArea = this->lastLassoArea.expanded(1)
+        .getUnion(rectangle.expanded(1)).toFloat();
+
+    this->lastLassoArea = rectangle;
+
+    this->componentsSearchResult.clearQuick();
+    this->findActiveNoteComponents(this->componentsSearchResult, searchArea);
+
+    for (auto *component : this->componentsSearchResult)
     {
-        auto *component = e.second.get();
         component->setSelected(false);
     }
 
@@ -855,10 +1243,9 @@ void PianoRoll::findLassoItemsInArea(Array<SelectableComponent *> &itemsFound, c
         component->setSelected(true);
     }
     
-    forEachEventComponent(this->patternMap, e)
+    for (auto *component : this->componentsSearchResult)
     {
-        auto *component = e.second.get();
-        if (rectangle.intersects(component->getBounds()) && component->isActive())
+        if (rectangle.intersects(component->getBounds()))
         {
             component->setSelected(true);
             jassert(!itemsFound.contains(component));
@@ -887,6 +1274,16 @@ void PianoRoll::mouseDown(const MouseEvent &e)
     {
         return;
     }
+
+    // the quick layer selection mode for the notes outside the active clip
+    const bool isQuickSelectEvent = e.mods.isAltDown() || e.mods.isRightButtonDown();
+    if (const auto *clip = isQuickSelectEvent ? this->findInactiveClipAt(e.position) : nullptr)
+    {
+        HybridRoll::mouseDown(e);
+        this->project.setEditableScope(clip->getPattern()->getTrack(),
+            *clip, e.mods.isAnyModifierKeyDown());
+        return;
+    }
     
     if (! this->isUsingSpaceDraggingMode())
     {
@@ -1342,6 +1739,7 @@ void PianoRoll::paint(Graphics &g)
         if (beatX >= paintEndX)
         {
             HybridRoll::paint(g);
+            this->paintIndexedNotes(g);
             return;
         }
 
@@ -1362,6 +1760,7 @@ void PianoRoll::paint(Graphics &g)
         }
 
         HybridRoll::paint(g);
+        this->paintIndexedNotes(g);
     }
 }
 
@@ -1392,16 +1791,33 @@ void PianoRoll::switchToClipInViewport() const
 
     FlatHashMap<Clip, int, ClipHash> visibilityWeights;
 
-    forEachEventComponent(this->patternMap, e)
+    float startBeat, endBeat;
+    int minKey, maxKey;
+    this->getBeatKeyRange(fullArea.toFloat(), startBeat, endBeat, minKey, maxKey);
+
+    Array<const Note *> notes;
+    for (const auto *track : this->notesIndex.getTracks())
     {
-        auto *nc = e.second.get();
-        if (nc->getBounds().intersects(centreArea))
-        {
-            visibilityWeights[nc->getClip()] += 4;
-        }
-        else if (nc->getBounds().intersects(fullArea))
+        for (const auto *clip : track->getPattern()->getClips())
         {
-            visibilityWeights[nc->getClip()] += 1;
+            notes.clearQuick();
+            this->notesIndex.findNotes(notes, track, *clip,
+                startBeat, endBeat, minKey, maxKey);
+
+            for (const auto *note : notes)
+            {
+                const auto bounds = this->getEventBounds(note->getKey() + clip->getKey(),
+                    note->getBeat() + clip->getBeat(), note->getLength()).toNearestInt();
+
+                if (bounds.intersects(centreArea))
+                {
+                    visibilityWeights[*clip] += 4;
+                }
+                else if (bounds.intersects(fullArea))
+                {
+                    visibilityWeights[*clip] += 1;
+                }
+            }
         }
     }
 
@@ -1436,44 +1852,52 @@ void PianoRoll::startCuttingEvents(const MouseEvent &e)
 
     this->knifeToolHelper->setStartPosition(e.position);
     this->knifeToolHelper->setEndPosition(e.position);
+    this->knifeToolHelper->updateBounds();
 }
 
 void PianoRoll::continueCuttingEvents(const MouseEvent &event)
 {
     if (this->knifeToolHelper != nullptr)
     {
+        // the notes to check are the ones under the previous line,
+        // which might have the cut points, and under the new one
+        const auto previousLine = this->knifeToolHelper->getLine();
+
         this->knifeToolHelper->setEndPosition(event.position);
         this->knifeToolHelper->updateBounds();
 
+        const auto line = this->knifeToolHelper->getLine();
+        const auto searchArea = Rectangle<float>(previousLine.getStart(), previousLine.getEnd())
+            .expanded(1.f).getUnion(Rectangle<float>(line.getStart(), line.getEnd()).expanded(1.f));
+
+        this->componentsSearchResult.clearQuick();
+        this->findActiveNoteComponents(this->componentsSearchResult, searchArea);
+
         bool addsPoint;
         Point<float> intersection;
-        forEachEventComponent(this->patternMap, e)
+        for (auto *nc : this->componentsSearchResult)
         {
             addsPoint = false;
-            auto *nc = e.second.get();
-            if (nc->isActive())
-            {
-                const int h2 = nc->getHeight() / 2;
-                const Line<float> noteLine(nc->getPosition().translated(0, h2).toFloat(),
-                    nc->getPosition().translated(nc->getWidth(), h2).toFloat());
+            const int h2 = nc->getHeight() / 2;
+            const Line<float> noteLine(nc->getPosition().translated(0, h2).toFloat(),
+                nc->getPosition().translated(nc->getWidth(), h2).toFloat());
 
-                if (this->knifeToolHelper->getLine().intersects(noteLine, intersection))
-                {
-                    const float relativeCutBeat = this->getRoundBeatSnapByXPosition(int(intersection.getX()))
-                        - this->activeClip.getBeat() - nc->getBeat();
+            if (this->knifeToolHelper->getLine().intersects(noteLine, intersection))
+            {
+                const float relativeCutBeat = this->getRoundBeatSnapByXPosition(int(intersection.getX()))
+                    - this->activeClip.getBeat() - nc->getBeat();
  
-                    if (relativeCutBeat > 0.f && relativeCutBeat < nc->getLength())
-                    {
-                        addsPoint = true;
-                        this->knifeToolHelper->addOrUpdateCutPoint(nc, relativeCutBeat);
-                    }
-                }
-
-                if (!addsPoint)
+                if (relativeCutBeat > 0.f && relativeCutBeat < nc->getLength())
                 {
-                    this->knifeToolHelper->removeCutPointIfExists(nc->getNote());
+                    addsPoint = true;
+                    this->knifeToolHelper->addOrUpdateCutPoint(nc, relativeCutBeat);
                 }
             }
+
+            if (!addsPoint)
+            {
+                this->knifeToolHelper->removeCutPointIfExists(nc->getNote());
+            }
         }
     }
 }
@@ -1492,9 +1916,10 @@ void PianoRoll::endCuttingEventsIfNeeded()
             auto &sequenceMap = *c.second.get();
             for (const auto &note : cutEventsToTheRight)
             {
-                if (auto *component = sequenceMap[note].get())
+                const auto found = sequenceMap.find(note);
+                if (found != sequenceMap.end())
                 {
-                    this->selectEvent(component, false);
+                    this->selectEvent(found->second.get(), false);
                 }
             }
         }
@@ -1578,6 +2003,8 @@ void PianoRoll::updateChildrenBounds()
         this->noteNameGuides->updateBounds();
     }
 
+    this->updateActiveClipComponents();
+
     HybridRoll::updateChildrenBounds();
 }
 
@@ -1600,6 +2027,8 @@ void PianoRoll::updateChildrenPositions()
         this->noteNameGuides->updatePosition();
     }
 
+    this->updateActiveClipComponents();
+
     HybridRoll::updateChildrenPositions();
 }
 
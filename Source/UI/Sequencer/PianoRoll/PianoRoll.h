@@ -36,6 +36,7 @@ class Scale;
 #include "HighlightingScheme.h"
 #include "CommandPaletteModel.h"
 #include "MidiTrack.h"
+#include "PianoRollNotesIndex.h"
 
 class PianoRoll final :
     public HybridRoll,
@@ -109,6 +110,11 @@ public:
     void onAddMidiEvent(const MidiEvent &event) override;
     void onRemoveMidiEvent(const MidiEvent &event) override;
 
+    void onChangeMidiEvents(const Array<const MidiEvent *> &oldEvents,
+        const Array<const MidiEvent *> &newEvents) override;
+    void onAddMidiEvents(const Array<const MidiEvent *> &events) override;
+    void onRemoveMidiEvents(const Array<const MidiEvent *> &events) override;
+
     void onAddClip(const Clip &clip) override;
     void onChangeClip(const Clip &oldClip, const Clip &newClip) override;
     void onRemoveClip(const Clip &clip) override;
@@ -189,7 +195,8 @@ private:
 private:
 
     void reloadRollContent();
-    void loadTrack(const MidiTrack *const track);
+    void createActiveClipComponents();
+    void updateActiveClipComponents();
 
     void updateSize();
     void updateChildrenBounds() override;
@@ -258,10 +265,54 @@ private:
     UniquePointer<CommandPaletteMoveNotesMenu> consoleMoveNotesMenu;
     UniquePointer<CommandPaletteChordConstructor> consoleChordConstructor;
 
+    // only the active clip's notes have components, since only those
+    // can be selected and edited, so this map has one clip at most;
+    // and even within that clip, only the notes around the viewport,
+    // and the selected ones, have the components:
     using SequenceMap = FlatHashMap<Note, UniquePointer<NoteComponent>, MidiEventHash>;
     using PatternMap = FlatHashMap<Clip, UniquePointer<SequenceMap>, ClipHash>;
     PatternMap patternMap;
 
+    // the beats and keys around the viewport, within which
+    // all the active clip's notes are known to have the components
+    Range<float> activeComponentsBeatRange;
+    Range<int> activeComponentsKeyRange;
+
+    // the components reference the clip in the pattern, not the copy of it
+    const Clip *findActiveClipInPattern() const;
+    bool isInActiveComponentsRange(const Note &note, const Clip &clip) const noexcept;
+    bool hasActiveNoteComponent(const Note &note) const;
+    NoteComponent *createActiveNoteComponent(SequenceMap &sequenceMap,
+        const Note &note, const Clip &clip);
+
+    // and all other notes are painted by the roll itself from the index
+    PianoRollNotesIndex notesIndex;
+    Array<const Note *> notesSearchResult;
+
+    void getBeatKeyRange(const Rectangle<float> &area, float &startBeat,
+        float &endBeat, int &minKey, int &maxKey) const;
+
+    void paintIndexedNotes(Graphics &g);
+    void repaintIndexedNote(const Note &note, const MidiTrack *track);
+    // for the group edits, a single repaint instead of one per note
+    void repaintIndexedNotes(const MidiTrack *track);
+
+    // the parts of the project listener callbacks done for each note,
+    // shared by the single-event callbacks and by the group edits
+    void addNoteComponents(const Note &note);
+    void changeNoteComponents(const Note &note, const Note &newNote);
+    void removeNoteComponents(const Note &note);
+    const Clip *findInactiveClipAt(const Point<float> &position);
+
+    // the active clip's note components, which might intersect the area,
+    // are also looked up in the index, so that the lasso and the knife tool
+    // don't have to check all the components on every mouse drag;
+    // the found notes are about to be selected or cut, so the ones
+    // outside the viewport get their components created here
+    void findActiveNoteComponents(Array<NoteComponent *> &result,
+        const Rectangle<float> &area);
+    Array<NoteComponent *> componentsSearchResult;
+
 private:
 
 #if PLATFORM_DESKTOP
@@ -0,0 +1,425 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Common.h"
+#include "PianoRollNotesIndex.h"
+#include "MidiTrack.h"
+#include "MidiSequence.h"
+#include "Pattern.h"
+#include "NoteComponent.h"
+
+#if JUCE_UNIT_TESTS
+#   include "PianoTrackNode.h"
+#   include "PianoSequence.h"
+#endif
+
+void PianoRollNotesIndex::clear()
+{
+    this->indices.clear();
+    this->tracks.clearQuick();
+}
+
+void PianoRollNotesIndex::loadTrack(const MidiTrack *const track)
+{
+    if (track->getPattern() == nullptr)
+    {
+        return;
+    }
+
+    const auto *sequence = track->getSequence();
+    this->indices[sequence] = make<NotesIndex>();
+    this->tracks.addIfNotAlreadyThere(track);
+
+    for (int i = 0; i < sequence->size(); ++i)
+    {
+        const auto *event = sequence->getUnchecked(i);
+        if (event->isTypeOf(MidiEvent::Type::Note))
+        {
+            this->addNote(static_cast<const Note &>(*event));
+        }
+    }
+}
+
+void PianoRollNotesIndex::removeTrack(const MidiTrack *const track)
+{
+    this->indices.erase(track->getSequence());
+    this->tracks.removeFirstMatchingValue(track);
+}
+
+void PianoRollNotesIndex::addNote(const Note &note)
+{
+    const auto found = this->indices.find(note.getSequence());
+    if (found != this->indices.end())
+    {
+        found->second->add(&note, note.getBeat(),
+            note.getBeat() + note.getLength(), note.getKey());
+    }
+}
+
+void PianoRollNotesIndex::removeNote(const Note &note, const Note &indexedParams)
+{
+    const auto found = this->indices.find(note.getSequence());
+    if (found != this->indices.end())
+    {
+        found->second->remove(&note, indexedParams.getBeat(),
+            indexedParams.getBeat() + indexedParams.getLength(), indexedParams.getKey());
+    }
+}
+
+int PianoRollNotesIndex::getNumNotes(const MidiTrack *const track) const noexcept
+{
+    const auto found = this->indices.find(track->getSequence());
+    return found != this->indices.end() ? found->second->size() : 0;
+}
+
+void PianoRollNotesIndex::findNotes(Array<const Note *> &result,
+    const MidiTrack *const track, const Clip &clip,
+    float startBeat, float endBeat, int minKey, int maxKey) const
+{
+    const auto found = this->indices.find(track->getSequence());
+    if (found != this->indices.end())
+    {
+        found->second->findItems(result, startBeat - clip.getBeat(),
+            endBeat - clip.getBeat(), minKey - clip.getKey(), maxKey - clip.getKey());
+    }
+}
+
+int PianoRollNotesIndex::paint(Graphics &g, const Rectangle<float> &paintArea,
+    float startBeat, float endBeat, int minKey, int maxKey,
+    const NoteBoundsFunction &getNoteBounds,
+    const MidiTrack *const activeTrack, const Clip &activeClip,
+    const NoteFilter &hasComponent)
+{
+    int numPaintedNotes = 0;
+
+    for (const auto &it : this->indices)
+    {
+        const auto *notesIndex = it.second.get();
+        if (notesIndex->size() == 0)
+        {
+            continue;
+        }
+
+        const auto *sequence = it.first;
+        const auto *track = sequence->getTrack();
+
+        this->inactiveNoteFills.clear();
+        this->activeNoteFills.clear();
+
+        for (const auto *clip : track->getPattern()->getClips())
+        {
+            const auto clipBeat = clip->getBeat();
+            const auto clipKey = clip->getKey();
+            if (sequence->getFirstBeat() + clipBeat > endBeat ||
+                sequence->getLastBeat() + clipBeat < startBeat)
+            {
+                continue;
+            }
+
+            const bool isActiveClip = activeTrack == track && *clip == activeClip;
+            auto &noteFills = isActiveClip ? this->activeNoteFills : this->inactiveNoteFills;
+
+            this->searchResult.clearQuick();
+            notesIndex->findItems(this->searchResult, startBeat - clipBeat,
+                endBeat - clipBeat, minKey - clipKey, maxKey - clipKey);
+
+            for (const auto *note : this->searchResult)
+            {
+                if (isActiveClip && hasComponent(*note))
+                {
+                    continue;
+                }
+
+                const auto bounds = getNoteBounds(note->getKey() + clipKey,
+                    note->getBeat() + clipBeat, note->getLength());
+
+                if (!bounds.intersects(paintArea))
+                {
+                    continue;
+                }
+
+                noteFills.addNote(bounds, note->getTuplet());
+
+                if (isActiveClip)
+                {
+                    noteFills.addVolume(bounds, note->getVelocity(),
+                        clip->getVelocity(), note->getTuplet());
+                }
+
+                numPaintedNotes++;
+            }
+        }
+
+        const auto trackColour = track->getTrackColour();
+
+        if (!this->inactiveNoteFills.fills.isEmpty())
+        {
+            this->inactiveNoteFills.fill(g,
+                NoteComponent::getNoteColour(trackColour, true, false));
+        }
+
+        if (!this->activeNoteFills.fills.isEmpty())
+        {
+            this->activeNoteFills.fill(g,
+                NoteComponent::getNoteColour(trackColour, false, false));
+        }
+    }
+
+    return numPaintedNotes;
+}
+
+//===----------------------------------------------------------------------===//
+// NoteFills
+//===----------------------------------------------------------------------===//
+
+// the shapes here repeat the ones in NoteComponent::paint
+
+void PianoRollNotesIndex::NoteFills::clear()
+{
+    this->fills.clear();
+    this->lighterFills.clear();
+    this->darkerFills.clear();
+    this->volumeFills.clear();
+}
+
+void PianoRollNotesIndex::NoteFills::addNote(const Rectangle<float> &bounds, int tuplet)
+{
+    const float x = bounds.getX();
+    const float y = bounds.getY();
+    const float w = bounds.getWidth() - .5f; // a small gap between notes
+    const float h = bounds.getHeight();
+
+    this->fills.addWithoutMerging({ x + 0.5f, y + h / 6.f, 0.5f, h / 1.5f });
+
+    if (w >= 1.25f)
+    {
+        this->fills.addWithoutMerging({ x + w - 0.75f, y + h / 6.f, 0.5f, h / 1.5f });
+        this->fills.addWithoutMerging({ x + 0.75f, y + 1.f, w - 1.25f, h - 2.f });
+    }
+
+    if (w >= 2.25f)
+    {
+        this->lighterFills.addWithoutMerging({ x + 1.25f, roundf(y), w - 2.25f, 1.f });
+        this->darkerFills.addWithoutMerging({ x + 1.25f, roundf(y + h - 1), w - 2.25f, 1.f });
+    }
+
+    if (tuplet > 1 && bounds.getWidth() > 25.f)
+    {
+        for (int i = 1; i < tuplet; ++i)
+        {
+            this->lighterFills.addWithoutMerging({ x + i * (w / tuplet) - 1.f, y, 1.f, h });
+        }
+    }
+}
+
+void PianoRollNotesIndex::NoteFills::addVolume(const Rectangle<float> &bounds,
+    float noteVelocity, float clipVelocity, int tuplet)
+{
+    const float x = bounds.getX();
+    const float y = bounds.getY();
+    const float w = bounds.getWidth() - .5f;
+    const float h = bounds.getHeight();
+
+    if (w >= 4.f)
+    {
+        const float sy = y + h - 4.f;
+        this->volumeFills.addWithoutMerging({ x + 2.f, sy, (w - 4.f) * noteVelocity, 3.f });
+        this->volumeFills.addWithoutMerging({ x + 2.f, sy, (w - 4.f) * noteVelocity * clipVelocity, 3.f });
+    }
+
+    if (tuplet > 1 && bounds.getWidth() > 25.f)
+    {
+        for (int i = 1; i < tuplet; ++i)
+        {
+            this->volumeFills.addWithoutMerging({ x + i * (w / tuplet), y, 1.5f, h });
+        }
+    }
+}
+
+void PianoRollNotesIndex::NoteFills::fill(Graphics &g, const Colour &colour) const
+{
+    g.setColour(colour);
+    g.fillRectList(this->fills);
+
+    g.setColour(colour.brighter(0.125f).withMultipliedAlpha(1.45f));
+    g.fillRectList(this->lighterFills);
+
+    g.setColour(colour.darker(0.175f).withMultipliedAlpha(1.45f));
+    g.fillRectList(this->darkerFills);
+
+    if (!this->volumeFills.isEmpty())
+    {
+        g.setColour(colour.darker(0.8f).withAlpha(0.5f));
+        g.fillRectList(this->volumeFills);
+    }
+}
+
+//===----------------------------------------------------------------------===//
+// Tests
+//===----------------------------------------------------------------------===//
+
+#if JUCE_UNIT_TESTS
+
+// The piano roll itself can't be created without the workspace, which
+// the tests don't have, but this is the index it loads all the notes into,
+// and the code it paints them with, given a viewport-sized paint area
+class PianoRollNotesIndexBenchmark final : public UnitTest
+{
+public:
+    PianoRollNotesIndexBenchmark() :
+        UnitTest("Piano roll notes index benchmark", UnitTestCategories::helio) {}
+
+    void runTest() override
+    {
+        for (const auto numNotes : { 1000, 10000, 50000 })
+        {
+            beginTest("Loading and painting " + String(numNotes) + " notes");
+
+            PianoTrackNode track("");
+            auto *pattern = track.getPattern();
+            for (int i = 0; i < numClips; ++i)
+            {
+                pattern->insert(Clip(pattern, float(i * 8), i * 2), false);
+            }
+
+            auto *sequence = static_cast<PianoSequence *>(track.getSequence());
+
+            Random random(numNotes);
+            Array<Note> notes;
+            for (int i = 0; i < numNotes; ++i)
+            {
+                notes.add(Note(sequence, random.nextInt(numKeys - numClips * 2),
+                    float(random.nextInt(numNotes / 4)) * 0.25f,
+                    float(1 + random.nextInt(8)) * 0.25f, random.nextFloat()));
+            }
+
+            sequence->insertGroup(notes, false);
+            expectEquals(sequence->size(), numNotes);
+
+            PianoRollNotesIndex index;
+
+            const auto loadStart = Time::getMillisecondCounterHiRes();
+            index.loadTrack(&track);
+            const auto loadTime = Time::getMillisecondCounterHiRes() - loadStart;
+
+            expectEquals(index.getNumNotes(&track), numNotes);
+
+            const auto getNoteBounds = [](int key, float beat, float length)
+            {
+                return Rectangle<float>(beat * beatWidth,
+                    float((numKeys - 1 - key) * rowHeight) + 1.f,
+                    length * beatWidth, float(rowHeight - 1));
+            };
+
+            const Rectangle<float> viewport(0.f, 0.f, float(viewportWidth), float(viewportHeight));
+            const auto endBeat = viewport.getRight() / beatWidth;
+            const auto minKey = int(numKeys * rowHeight - viewport.getBottom()) / rowHeight - 1;
+            const auto maxKey = numKeys;
+
+            const auto &activeClip = *pattern->getUnchecked(0);
+
+            int numVisible = 0;
+            int numVisibleInActiveClip = 0;
+            for (const auto *clip : pattern->getClips())
+            {
+                for (const auto &note : notes)
+                {
+                    if (getNoteBounds(note.getKey() + clip->getKey(),
+                        note.getBeat() + clip->getBeat(), note.getLength()).intersects(viewport))
+                    {
+                        numVisible++;
+                        numVisibleInActiveClip += (*clip == activeClip) ? 1 : 0;
+                    }
+                }
+            }
+
+            Image frame(Image::ARGB, viewportWidth, viewportHeight, true);
+
+            // the frame before the roll has created the active clip's components
+            const auto paintStart = Time::getMillisecondCounterHiRes();
+            int numPainted = 0;
+            {
+                Graphics g(frame);
+                numPainted = index.paint(g, viewport, 0.f, endBeat, minKey, maxKey,
+                    getNoteBounds, &track, activeClip, [](const Note &) { return false; });
+            }
+            const auto paintTime = Time::getMillisecondCounterHiRes() - paintStart;
+
+            expectEquals(numPainted, numVisible);
+
+            // and the frame after, the components paint the active clip themselves
+            {
+                Graphics g(frame);
+                numPainted = index.paint(g, viewport, 0.f, endBeat, minKey, maxKey,
+                    getNoteBounds, &track, activeClip, [](const Note &) { return true; });
+            }
+
+            expectEquals(numPainted, numVisible - numVisibleInActiveClip);
+
+            // the roll keeps the components for a screen around the viewport,
+            // see PianoRoll::updateActiveClipComponents, instead of one per note
+            const Range<float> componentsBeatRange(-endBeat, endBeat * 2.f);
+            const Range<int> componentsKeyRange(minKey - (maxKey - minKey), maxKey + (maxKey - minKey));
+
+            Array<const Note *> foundNotes;
+            index.findNotes(foundNotes, &track, activeClip,
+                componentsBeatRange.getStart(), componentsBeatRange.getEnd(),
+                componentsKeyRange.getStart(), componentsKeyRange.getEnd());
+
+            int numComponents = 0;
+            for (const auto *note : foundNotes)
+            {
+                const auto beat = note->getBeat() + activeClip.getBeat();
+                if (componentsKeyRange.contains(note->getKey() + activeClip.getKey()) &&
+                    componentsBeatRange.intersects({ beat, beat + note->getLength() }))
+                {
+                    numComponents++;
+                }
+            }
+
+            expect(numComponents >= numVisibleInActiveClip);
+            expect(numComponents <= numNotes);
+
+            logMessage("Load: " + String(loadTime, 2) + "ms, " +
+                String(numVisibleInActiveClip) + " of " + String(numNotes) +
+                " notes of the active clip are in the viewport");
+            logMessage("Frame: " + String(paintTime, 2) + "ms for " +
+                String(numVisible) + " visible notes in " + String(numClips) + " clips");
+            logMessage("Memory: " + String(numComponents) + " note components instead of " +
+                String(numNotes) + ", at least " +
+                File::descriptionOfSizeInBytes(int64(numComponents * sizeof(NoteComponent))) +
+                " instead of " + File::descriptionOfSizeInBytes(int64(numNotes * sizeof(NoteComponent))));
+
+            index.removeTrack(&track);
+            expectEquals(index.getNumNotes(&track), 0);
+            expect(index.getTracks().isEmpty());
+        }
+    }
+
+private:
+
+    static constexpr auto numClips = 4;
+    static constexpr auto numKeys = 128;
+    static constexpr auto beatWidth = 32.f;
+    static constexpr auto rowHeight = 16;
+    static constexpr auto viewportWidth = 1920;
+    static constexpr auto viewportHeight = 1080;
+};
+
+static PianoRollNotesIndexBenchmark pianoRollNotesIndexBenchmark;
+
+#endif
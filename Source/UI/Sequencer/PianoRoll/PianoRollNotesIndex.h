@@ -0,0 +1,101 @@
+/*
+    This file is part of Helio Workstation.
+
+    Helio is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Helio is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Helio. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class MidiTrack;
+class MidiSequence;
+
+#include "Note.h"
+#include "Clip.h"
+#include "RollSpatialIndex.h"
+
+// Keeps the notes of all tracks indexed by beats and keys within their
+// sequences, i.e. without the clip offsets, so that all instances of a clip
+// share the same index; the piano roll finds the notes in the visible area
+// or under the mouse with it, and paints all the notes which don't have
+// the components from it, in a few batched fills per track
+
+class PianoRollNotesIndex final
+{
+public:
+
+    PianoRollNotesIndex() = default;
+
+    // maps the keys and beats within the roll, i.e. with the clip offsets,
+    // to the coordinates of the roll, the same way the note components do
+    using NoteBoundsFunction = Function<Rectangle<float>(int key, float beat, float length)>;
+    using NoteFilter = Function<bool(const Note &note)>;
+
+    void clear();
+    void loadTrack(const MidiTrack *const track);
+    void removeTrack(const MidiTrack *const track);
+
+    void addNote(const Note &note);
+    // the note is looked up by the parameters it had when it was indexed
+    void removeNote(const Note &note, const Note &indexedParams);
+
+    inline const Array<const MidiTrack *> &getTracks() const noexcept
+    {
+        return this->tracks;
+    }
+
+    int getNumNotes(const MidiTrack *const track) const noexcept;
+
+    // Collects the notes of the clip, which might intersect the given range
+    // of beats and keys within the roll; the precise check is up to the caller
+    void findNotes(Array<const Note *> &result, const MidiTrack *const track,
+        const Clip &clip, float startBeat, float endBeat, int minKey, int maxKey) const;
+
+    // Paints the notes of all clips, which intersect the paint area, the same way
+    // the note components would paint themselves; the notes of the active clip
+    // are painted as active ones, unless they have their own components,
+    // i.e. unless hasComponent returns true; returns the number of painted notes
+    int paint(Graphics &g, const Rectangle<float> &paintArea,
+        float startBeat, float endBeat, int minKey, int maxKey,
+        const NoteBoundsFunction &getNoteBounds,
+        const MidiTrack *const activeTrack, const Clip &activeClip,
+        const NoteFilter &hasComponent);
+
+private:
+
+    using NotesIndex = RollSpatialIndex<const Note *>;
+    FlatHashMap<const MidiSequence *, UniquePointer<NotesIndex>> indices;
+    Array<const MidiTrack *> tracks;
+
+    Array<const Note *> searchResult;
+
+    // the shapes of many notes, filled at once for each colour
+    struct NoteFills final
+    {
+        void clear();
+        void addNote(const Rectangle<float> &bounds, int tuplet);
+        void addVolume(const Rectangle<float> &bounds,
+            float noteVelocity, float clipVelocity, int tuplet);
+        void fill(Graphics &g, const Colour &colour) const;
+
+        RectangleList<float> fills;
+        RectangleList<float> lighterFills;
+        RectangleList<float> darkerFills;
+        RectangleList<float> volumeFills;
+    };
+
+    NoteFills inactiveNoteFills;
+    NoteFills activeNoteFills;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PianoRollNotesIndex)
+};